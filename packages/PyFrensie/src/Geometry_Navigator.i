@@ -93,6 +93,8 @@ class is shown below:
 // Rename a few overloaded methods
 %rename(fireRayAndGetSurfaceHit) Geometry::Navigator::fireRay( EntityId* );
 %rename(fireRayAndGetSurfaceHit2) Geometry::Navigator::fireRay( EntityId& );
+%rename(fireRayIfBoundaryIsWithinAndGetSurfaceHit) Geometry::Navigator::fireRayIfBoundaryIsWithin( const Length, EntityId* );
+%rename(fireRayIfBoundaryIsWithinAndGetSurfaceHit2) Geometry::Navigator::fireRayIfBoundaryIsWithin( const Length, EntityId& );
 %rename(advanceToCellBoundaryAndGetSurfaceNormal) Geometry::Navigator::advanceToCellBoundary( double* );
 
 // Add typemaps for the EntityId
@@ -153,6 +155,10 @@ class is shown below:
 %apply const Geometry::UnitAwareRay<Geometry::Navigator::LengthUnit>::Length { const Geometry::Navigator::Length };
 %apply Geometry::UnitAwareRay<Geometry::Navigator::LengthUnit>::Length { Geometry::Navigator::Length };
 
+// The pooled allocation is an implementation detail
+%ignore Geometry::Navigator::operator new;
+%ignore Geometry::Navigator::operator delete;
+
 // Include the Navigator class
 %include "Geometry_Navigator.hpp"
 
@@ -254,6 +254,18 @@ typedef long unsigned int uint64_t;
     $self->setSampleMomentHistogramBins( bin_boundaries );
   }
 
+  // Stream the snapshots to a file
+  void setSnapshotDataOutputFile( const std::string& file_name )
+  {
+    $self->setSnapshotDataOutputFile( file_name );
+  }
+
+  // Return the snapshot data output file name
+  std::string getSnapshotDataOutputFileName() const
+  {
+    return $self->getSnapshotDataOutputFileName().string();
+  }
+
   // //! Get the total sample moment histogram
   // Utility::SampleMomentHistogram<double> getTotalSampleMomentHistogram( const size_t response_function_index )
   // {
@@ -269,6 +281,8 @@ typedef long unsigned int uint64_t;
 %ignore *::getParticleTypes;
 %ignore *::setResponseFunctions;
 %ignore *::setSampleMomentHistogramBins;
+%ignore *::setSnapshotDataOutputFile;
+%ignore *::getSnapshotDataOutputFileName;
 //%ignore *::getTotalSampleMomentHistogram;
 
 // Add a typemap for Utility::SampleMomentHistogram<double>& histogram
@@ -172,6 +172,10 @@ typedef unsigned long int uint64_t;
   $1 = (PyArray_Check($input) || PySequence_Check($input)) ? 1 : 0;
 }
 
+// The pooled allocation is an implementation detail
+%ignore MonteCarlo::ParticleState::operator new;
+%ignore MonteCarlo::ParticleState::operator delete;
+
 %shared_ptr(MonteCarlo::ParticleState)
 %include "MonteCarlo_ParticleState.hpp"
 
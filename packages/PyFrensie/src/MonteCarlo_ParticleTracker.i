@@ -41,9 +41,24 @@ using namespace MonteCarlo;
 
     return PyFrensie::Details::convertMapToPython( history_map );
   }
+
+  // Stream the history data to a file
+  void setHistoryDataOutputFile( const std::string& file_name,
+                                 const size_t history_buffer_size = 100 )
+  {
+    $self->setHistoryDataOutputFile( file_name, history_buffer_size );
+  }
+
+  // Return the history data output file name
+  std::string getHistoryDataOutputFileName() const
+  {
+    return $self->getHistoryDataOutputFileName().string();
+  }
 };
 
 %ignore *::getHistoryData;
+%ignore *::setHistoryDataOutputFile;
+%ignore *::getHistoryDataOutputFileName;
 
 %shared_ptr(MonteCarlo::ParticleTracker)
 %include "MonteCarlo_ParticleTracker.hpp"
@@ -52,6 +52,49 @@ MonteCarlo::PROPERTIES::setImplicitCaptureModeOn;
 %feature("autodoc", "isImplicitCaptureModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isImplicitCaptureModeOn;
 
+// Set unionized energy grid mode on/off
+%feature("autodoc", "setUnionizedEnergyGridModeOff(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setUnionizedEnergyGridModeOff;
+
+%feature("autodoc", "setUnionizedEnergyGridModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setUnionizedEnergyGridModeOn;
+
+%feature("autodoc", "isUnionizedEnergyGridModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isUnionizedEnergyGridModeOn;
+
+// Set event-based transport mode on/off
+%feature("autodoc", "setEventBasedTransportModeOff(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setEventBasedTransportModeOff;
+
+%feature("autodoc", "setEventBasedTransportModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setEventBasedTransportModeOn;
+
+%feature("autodoc", "isEventBasedTransportModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isEventBasedTransportModeOn;
+
+%feature("autodoc", "setNumberOfEventBasedHistoriesPerThread(PROPERTIES self, const uint64_t number_of_histories) -> void")
+MonteCarlo::PROPERTIES::setNumberOfEventBasedHistoriesPerThread;
+
+%feature("autodoc", "getNumberOfEventBasedHistoriesPerThread(PROPERTIES self) -> uint64_t")
+MonteCarlo::PROPERTIES::getNumberOfEventBasedHistoriesPerThread;
+
+// Set delta tracking mode on/off
+%feature("autodoc", "setDeltaTrackingModeOff(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setDeltaTrackingModeOff;
+
+%feature("autodoc", "setDeltaTrackingModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setDeltaTrackingModeOn;
+
+%feature("autodoc", "isDeltaTrackingModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isDeltaTrackingModeOn;
+
+// Set/get the delta tracking cross section ratio threshold
+%feature("autodoc", "setDeltaTrackingCrossSectionRatioThreshold(PROPERTIES self, const double threshold) -> void")
+MonteCarlo::PROPERTIES::setDeltaTrackingCrossSectionRatioThreshold;
+
+%feature("autodoc", "getDeltaTrackingCrossSectionRatioThreshold(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getDeltaTrackingCrossSectionRatioThreshold;
+
 // Set/get max energy
 %feature("autodoc", "setNumberOfBatchesPerProcessor(PROPERTIES self, const unsigned batches_per_processor) -> void")
 MonteCarlo::PROPERTIES::setNumberOfBatchesPerProcessor;
@@ -34,6 +34,9 @@ Prng.RandomNumberGenerator proxy class.
 
 // Frensie Includes
 #include "PyFrensie_PythonTypeTraits.hpp"
+#include "Utility_ParallelRandomNumberGenerator.hpp"
+#include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_CounterBasedGenerator.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 %}
 
@@ -67,6 +70,16 @@ Prng.RandomNumberGenerator proxy class.
   }
 }
 
+//---------------------------------------------------------------------------//
+// Add support for the parallel generator interface
+//---------------------------------------------------------------------------//
+// The cache line aligned allocation is an implementation detail
+%ignore Utility::ParallelRandomNumberGenerator::operator new;
+%ignore Utility::ParallelRandomNumberGenerator::operator delete;
+
+// Include ParallelRandomNumberGenerator
+%include "Utility_ParallelRandomNumberGenerator.hpp"
+
 //---------------------------------------------------------------------------//
 // Add support for the 64bit-LCG
 //---------------------------------------------------------------------------//
@@ -123,6 +136,61 @@ this class is shown below:
 // Include LinearCongruentialGenerator
 %include "Utility_LinearCongruentialGenerator.hpp"
 
+//---------------------------------------------------------------------------//
+// Add support for the counter-based generator
+//---------------------------------------------------------------------------//
+// Add more detailed docstrings for the counter-based generator
+%feature("docstring")
+Utility::CounterBasedGenerator
+"
+The CounterBasedGenerator (Philox-4x32-10) can be used to generate a uniform
+deviate in [0,1). Each random number is a function of the history number, an
+optional secondary stream index and a draw counter, which makes
+'changeHistory' a constant time operation for any history number. A brief
+usage tutorial for this class is shown below:
+
+  import PyFrensie.Utility.Prng
+
+  generator = PyFrensie.Utility.Prng.CounterBasedGenerator()
+  generator.getRandomNumber()
+  generator.getGeneratorState()
+
+  generator.changeHistory( 10 )
+  generator.getRandomNumber()
+
+  generator.changeHistory( 10, 1 )
+  generator.getRandomNumber()
+"
+
+// Add some useful methods to the counter-based generator
+%extend Utility::CounterBasedGenerator
+{
+  // String conversion method
+  PyObject* __str__() const
+  {
+    std::ostringstream oss;
+    oss << "stream state: " << $self->getGeneratorState();
+
+    return PyString_FromString( oss.str().c_str() );
+  }
+
+  // String representation method
+  PyObject* __repr__() const
+  {
+    std::ostringstream oss;
+    oss << "CounterBasedGenerator(history: " << $self->getHistory()
+        << ", stream state: " << $self->getGeneratorState() << ")";
+
+    return PyString_FromString( oss.str().c_str() );
+  }
+};
+
+// The block generator is only useful for verification
+%ignore Utility::CounterBasedGenerator::generateBlock;
+
+// Include CounterBasedGenerator
+%include "Utility_CounterBasedGenerator.hpp"
+
 //---------------------------------------------------------------------------//
 // Add support for the RandomNumberGenerator interface
 //---------------------------------------------------------------------------//
@@ -182,6 +250,14 @@ the stream from the underlying random number generator. Make sure to call the
 Only numpy arrays should be used to specify the fake stream.
 "
 
+%feature("docstring")
+Utility::RandomNumberGenerator::setGeneratorType
+"
+Sets the generator type (LINEAR_CONGRUENTIAL_GENERATOR or
+COUNTER_BASED_GENERATOR) that will be used by the streams. The type only
+applies to streams created after this call (see 'createStreams').
+"
+
 %feature("docstring")
 Utility::RandomNumberGenerator::unsetFakeStream
 "
@@ -8,6 +8,10 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <limits>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
@@ -15,23 +19,348 @@
 
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
-#include "Data_ACEHelperWrappers.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
 namespace Data{
 
+namespace{
+
+// The line of a text table
+typedef std::pair<const char*,const char*> Line;
+
+// Check if a character is a blank character
+inline bool isBlank( const char character )
+{
+  return character == ' ' || character == '\t' || character == '\n' ||
+    character == '\r';
+}
+
+// Check if a character is a digit
+inline bool isDigit( const char character )
+{
+  return character >= '0' && character <= '9';
+}
+
+// Get the next line (the line ending is not included)
+Line getNextLine( const char*& position, const char* end )
+{
+  const char* line_start = position;
+
+  const char* line_end = static_cast<const char*>(
+                          std::memchr( position, '\n', end - position ) );
+
+  if( line_end == NULL )
+  {
+    line_end = end;
+    position = end;
+  }
+  else
+    position = line_end + 1;
+
+  if( line_end != line_start && *(line_end-1) == '\r' )
+    --line_end;
+
+  return Line( line_start, line_end );
+}
+
+// Get the characters in a fixed width field of a line
+Line getLineField( const Line& line, const size_t start, const size_t width )
+{
+  const size_t line_length = line.second - line.first;
+
+  if( start >= line_length )
+    return Line( line.second, line.second );
+  else
+  {
+    return Line( line.first + start,
+                 line.first + std::min( start + width, line_length ) );
+  }
+}
+
+// Parse a real number in the range (Fortran formatted numbers are supported)
+/*! \details Numbers with up to 19 significant digits and a decimal exponent
+ * in [-22,22] after the digits have been shifted into an integer mantissa
+ * are converted exactly with a single floating point multiplication or
+ * division (the result is correctly rounded since both operands are exact).
+ * All other numbers are converted with std::strtod. Leading blank characters
+ * are skipped and the position is moved past the number. False will be
+ * returned if there is no number in the range.
+ */
+bool parseReal( const char*& position, const char* end, double& value )
+{
+  static const double powers_of_ten[] =
+    {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+     1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  while( position != end && isBlank( *position ) )
+    ++position;
+
+  if( position == end )
+    return false;
+
+  const char* number_start = position;
+
+  bool negative = false;
+
+  if( *position == '-' || *position == '+' )
+  {
+    negative = (*position == '-');
+    ++position;
+  }
+
+  uint64_t mantissa = 0;
+  int significant_digits = 0;
+  int exponent = 0;
+  bool digit_found = false;
+  bool truncated = false;
+
+  // Integer part
+  while( position != end && isDigit( *position ) )
+  {
+    digit_found = true;
+
+    if( significant_digits < 19 )
+    {
+      mantissa = mantissa*10 + (*position - '0');
+
+      if( mantissa != 0 )
+        ++significant_digits;
+    }
+    else
+    {
+      truncated = true;
+      ++exponent;
+    }
+
+    ++position;
+  }
+
+  // Fractional part
+  if( position != end && *position == '.' )
+  {
+    ++position;
+
+    while( position != end && isDigit( *position ) )
+    {
+      digit_found = true;
+
+      if( significant_digits < 19 )
+      {
+        mantissa = mantissa*10 + (*position - '0');
+
+        if( mantissa != 0 )
+          ++significant_digits;
+
+        --exponent;
+      }
+      else
+        truncated = true;
+
+      ++position;
+    }
+  }
+
+  if( !digit_found )
+  {
+    position = number_start;
+
+    return false;
+  }
+
+  // Exponent (the exponent character can be omitted in Fortran output)
+  bool implicit_exponent_character = false;
+
+  if( position != end )
+  {
+    if( *position == 'e' || *position == 'E' ||
+        *position == 'd' || *position == 'D' )
+      ++position;
+    else if( (*position == '-' || *position == '+') &&
+             position+1 != end && isDigit( *(position+1) ) )
+      implicit_exponent_character = true;
+    else
+      end = position;
+  }
+
+  if( position != end )
+  {
+    bool negative_exponent = false;
+
+    if( *position == '-' || *position == '+' )
+    {
+      negative_exponent = (*position == '-');
+      ++position;
+    }
+
+    int explicit_exponent = 0;
+
+    while( position != end && isDigit( *position ) )
+    {
+      if( explicit_exponent < 100000 )
+        explicit_exponent = explicit_exponent*10 + (*position - '0');
+
+      ++position;
+    }
+
+    exponent += (negative_exponent ? -explicit_exponent : explicit_exponent);
+  }
+
+  // Fast path
+  if( !truncated && mantissa <= (uint64_t(1) << 53) &&
+      exponent >= -22 && exponent <= 22 )
+  {
+    value = (double)mantissa;
+
+    if( exponent < 0 )
+      value /= powers_of_ten[-exponent];
+    else
+      value *= powers_of_ten[exponent];
+
+    if( negative )
+      value = -value;
+  }
+  // Slow path
+  else
+  {
+    std::string number( number_start, position );
+
+    for( size_t i = 0; i < number.size(); ++i )
+    {
+      if( number[i] == 'd' || number[i] == 'D' )
+        number[i] = 'e';
+    }
+
+    if( implicit_exponent_character )
+    {
+      size_t exponent_sign_pos = number.find_last_of( "+-" );
+
+      number.insert( exponent_sign_pos, 1, 'e' );
+    }
+
+    value = std::strtod( number.c_str(), NULL );
+  }
+
+  return true;
+}
+
+// Parse an integer in the range
+/*! \details Leading blank characters are skipped and the position is moved
+ * past the integer. False will be returned if there is no integer in the
+ * range.
+ */
+bool parseInteger( const char*& position, const char* end, int& value )
+{
+  while( position != end && isBlank( *position ) )
+    ++position;
+
+  if( position == end )
+    return false;
+
+  const char* number_start = position;
+
+  bool negative = false;
+
+  if( *position == '-' || *position == '+' )
+  {
+    negative = (*position == '-');
+    ++position;
+  }
+
+  if( position == end || !isDigit( *position ) )
+  {
+    position = number_start;
+
+    return false;
+  }
+
+  long long raw_value = 0;
+
+  while( position != end && isDigit( *position ) )
+  {
+    raw_value = raw_value*10 + (*position - '0');
+
+    TEST_FOR_EXCEPTION( raw_value > std::numeric_limits<int>::max(),
+                        std::runtime_error,
+                        "Integer "
+                        << std::string( number_start, position+1 ) <<
+                        " is too large!" );
+
+    ++position;
+  }
+
+  value = static_cast<int>( negative ? -raw_value : raw_value );
+
+  return true;
+}
+
+// Parse a fixed width real number field (a blank field is zero)
+double parseRealField( const Line& line,
+                       const size_t start,
+                       const size_t width )
+{
+  Line field = getLineField( line, start, width );
+
+  double value = 0.0;
+
+  parseReal( field.first, field.second, value );
+
+  return value;
+}
+
+// Parse a fixed width integer field (a blank field is zero)
+int parseIntegerField( const Line& line,
+                       const size_t start,
+                       const size_t width )
+{
+  Line field = getLineField( line, start, width );
+
+  int value = 0;
+
+  parseInteger( field.first, field.second, value );
+
+  return value;
+}
+
+// Get a fixed width string field
+std::string getStringField( const Line& line,
+                            const size_t start,
+                            const size_t width )
+{
+  Line field = getLineField( line, start, width );
+
+  return std::string( field.first, field.second );
+}
+
+// Copy a value from a binary record
+template<typename T>
+inline void copyFromRecord( const char*& position, T& value )
+{
+  std::memcpy( &value, position, sizeof(T) );
+
+  position += sizeof(T);
+}
+
+} // end local namespace
+
 // Constructor
+/*! \details The binary record length is the number of bytes in each record
+ * of the binary library (the xsdir record length) and the binary entries per
+ * record is the number of XSS array elements stored in each record (the
+ * xsdir entries per record). These values are ignored when the library is
+ * stored in text format.
+ */
 ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
 				const std::string& table_name,
 				const size_t table_start_line,
-				const bool is_ascii )
-  : d_ace_file_id( 1 ),
-    d_ace_library_name( file_name_with_path ),
-    d_ace_table_name( 10, ' ' ),
-    d_ace_table_processing_date( 10, ' ' ),
-    d_ace_table_comment( 70, ' ' ),
-    d_ace_table_material_id( 10, ' ' ),
+				const bool is_ascii,
+                                const size_t binary_record_length,
+                                const size_t binary_entries_per_record )
+  : d_ace_library_name( file_name_with_path ),
+    d_ace_table_name(),
+    d_ace_table_processing_date(),
+    d_ace_table_comment(),
+    d_ace_table_material_id(),
     d_atomic_weight_ratio( 0.0 ),
     d_temperature( 0.0*Utility::Units::MeV ),
     d_zaids(),
@@ -47,119 +376,313 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
                       std::runtime_error,
                       "ACE file " << d_ace_library_name.string() <<
                       " does not exist!" );
-  
-  this->openACEFile( d_ace_library_name.string(), is_ascii );
-  this->readACETable( table_name, table_start_line );
+
+  // Map the library (it will be unmapped once the table has been read)
+  std::unique_ptr<const Utility::MemoryMappedFile> ace_library;
+
+  try{
+    ace_library.reset( new Utility::MemoryMappedFile( d_ace_library_name ) );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "ACE file " << d_ace_library_name.string() <<
+                           " could not be opened!" );
+
+  if( is_ascii )
+    this->readASCIIACETable( *ace_library, table_name, table_start_line );
+  else
+  {
+    this->readBinaryACETable( *ace_library,
+                              table_name,
+                              table_start_line,
+                              binary_record_length,
+                              binary_entries_per_record );
+  }
 }
 
 // Destructor
 ACEFileHandler::~ACEFileHandler()
 {}
 
-// Open an ACE library file
-void ACEFileHandler::openACEFile( const std::string& file_name,
-				  const bool is_ascii )
-{
-  // Make sure no other ace library is open and assigned the desired id
-  testPrecondition( !fileIsOpenUsingFortran( d_ace_file_id ) );
-
-  // Binary files cannot currently be handled
-  TEST_FOR_EXCEPTION( !is_ascii,
-		      std::runtime_error,
-		      "Binary ACE files cannot currently be read ("
-                      << file_name << ")." );
-
-  // Check that the file exists
-  bool ace_file_exists = (bool)fileExistsUsingFortran( file_name.c_str(),
-						       file_name.size() );
-  TEST_FOR_EXCEPTION( !ace_file_exists,
-		      std::runtime_error,
-		      "ACE file " << file_name << " does not exists." );
-
-  // Check that the file can be opened
-  bool ace_file_is_readable =
-    (bool)fileIsReadableUsingFortran( file_name.c_str(),
-                                      file_name.size() );
+// Read the text ACE table
+/*! \details The header lines are parsed using the fixed width fields of the
+ * ACE format. The XSS array elements are parsed as blank separated numbers.
+ */
+void ACEFileHandler::readASCIIACETable(
+                                   const Utility::MemoryMappedFile& ace_library,
+                                   const std::string& table_name,
+                                   const size_t table_start_line )
+{
+  TEST_FOR_EXCEPTION( table_start_line == 0,
+                      std::runtime_error,
+                      "Invalid start line (0) for table " << table_name <<
+                      " in ACE library " << d_ace_library_name << "!" );
   
-  TEST_FOR_EXCEPTION( !ace_file_is_readable,
-		      std::runtime_error,
-		      "ACE file " + file_name +
-                      " exists but is not readable." );
+  const char* position = ace_library.begin();
+  const char* const end = ace_library.end();
+
+  // Move to the start of the ACE table in the ACE file
+  for( size_t i = 1; i < table_start_line; ++i )
+  {
+    TEST_FOR_EXCEPTION( position == end,
+                        std::runtime_error,
+                        "ACE library " << d_ace_library_name << " has fewer "
+                        "than " << table_start_line << " lines!" );
+
+    getNextLine( position, end );
+  }
+
+  TEST_FOR_EXCEPTION( position == end,
+                      std::runtime_error,
+                      "ACE library " << d_ace_library_name << " has fewer "
+                      "than " << table_start_line << " lines!" );
+
+  // Read the first line of the ACE table header (A10,2G12.0,1X,A10)
+  Line line = getNextLine( position, end );
+
+  d_ace_table_name = getStringField( line, 0, 10 );
+  d_atomic_weight_ratio = parseRealField( line, 10, 12 );
+  d_temperature = parseRealField( line, 22, 12 )*Utility::Units::MeV;
+  d_ace_table_processing_date = getStringField( line, 35, 10 );
+
+  // Clear white space from the ace table name and processing date
+  boost::algorithm::trim( d_ace_table_name );
+  boost::algorithm::trim( d_ace_table_processing_date );
+
+  // Test that the table name is the same as the desired table name
+  this->checkTableName( table_name, table_start_line );
+
+  // Read the second line of the ACE table header (A70,A10)
+  line = getNextLine( position, end );
 
-  // Open the file
-  openFileUsingFortran( file_name.c_str(), file_name.size(), d_ace_file_id );
+  d_ace_table_comment = getStringField( line, 0, 70 );
+  d_ace_table_material_id = getStringField( line, 70, 10 );
 
-  // Make sure the ace library is open and assigned the desired id
-  testPostcondition( fileIsOpenUsingFortran( d_ace_file_id ) );
+  boost::algorithm::trim( d_ace_table_comment );
+  boost::algorithm::trim( d_ace_table_material_id );
+
+  // Read the zaids and awrs (4(I7,F11.0) on each of the next four lines)
+  std::array<int,16> raw_zaids;
+  std::array<double,16> raw_atomic_weight_ratios;
+
+  for( size_t i = 0; i < 4; ++i )
+  {
+    line = getNextLine( position, end );
+
+    for( size_t j = 0; j < 4; ++j )
+    {
+      raw_zaids[4*i+j] = parseIntegerField( line, 18*j, 7 );
+      raw_atomic_weight_ratios[4*i+j] = parseRealField( line, 18*j+7, 11 );
+    }
+  }
+
+  this->extractZaidsAndAtomicWeightRatios( raw_zaids,
+                                           raw_atomic_weight_ratios );
+
+  // Read the nxs array (8I9 on each of the next two lines)
+  for( size_t i = 0; i < 2; ++i )
+  {
+    line = getNextLine( position, end );
+
+    for( size_t j = 0; j < 8; ++j )
+      d_nxs[8*i+j] = parseIntegerField( line, 9*j, 9 );
+  }
+
+  // Read the jxs array (8I9 on each of the next four lines)
+  for( size_t i = 0; i < 4; ++i )
+  {
+    line = getNextLine( position, end );
+
+    for( size_t j = 0; j < 8; ++j )
+      d_jxs[8*i+j] = parseIntegerField( line, 9*j, 9 );
+  }
+
+  TEST_FOR_EXCEPTION( d_nxs[0] <= 0,
+                      std::runtime_error,
+                      "Table " << table_name << " in ACE library "
+                      << d_ace_library_name << " has an invalid XSS array "
+                      "size (" << d_nxs[0] << ")!" );
+
+  // Read the xss array
+  d_xss->resize( d_nxs[0] );
+
+  for( size_t i = 0; i < d_xss->size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( !parseReal( position, end, (*d_xss)[i] ),
+                        std::runtime_error,
+                        "Only " << i << " of the " << d_xss->size() <<
+                        " XSS array elements of table " << table_name <<
+                        " could be read from ACE library "
+                        << d_ace_library_name << "!" );
+  }
 }
 
-// Read a table in the ACE file
-void ACEFileHandler::readACETable( const std::string& table_name,
-				   const size_t table_start_line )
+// Read the binary ACE table
+/*! \details The binary table layout is the one written by NJOY with Fortran
+ * direct access records. The first record of the table stores the header
+ * (hz(10 chars),aw0,tz,hd(10 chars),hk(70 chars),hm(10 chars),
+ * (iz(i),aw(i),i=1,16),nxs(16),jxs(32)) and the following records store the
+ * XSS array. The records are not padded and the native byte order is
+ * assumed.
+ */
+void ACEFileHandler::readBinaryACETable(
+                                   const Utility::MemoryMappedFile& ace_library,
+                                   const std::string& table_name,
+                                   const size_t table_start_record,
+                                   const size_t record_length,
+                                   const size_t entries_per_record )
 {
-  testPrecondition( table_start_line <= (size_t)std::numeric_limits<int>::max() );
+  // The size of the header record
+  const size_t header_size = 10 + 2*sizeof(double) + 10 + 70 + 10 +
+    16*(sizeof(int32_t) + sizeof(double)) + 48*sizeof(int32_t);
   
-  // Move to the start of the ACE table in the ACE file
-  moveToLineUsingFortran( d_ace_file_id, static_cast<int>( table_start_line ) );
+  TEST_FOR_EXCEPTION( table_start_record == 0,
+                      std::runtime_error,
+                      "Invalid start record (0) for table " << table_name <<
+                      " in ACE library " << d_ace_library_name << "!" );
 
-  // Read the first line of the ACE table header
-  readAceTableHeaderLine1( d_ace_file_id,
-			   &d_ace_table_name[0],
-			   &d_atomic_weight_ratio,
-			   Utility::reinterpretAsRaw(&d_temperature),
-			   &d_ace_table_processing_date[0] );
+  TEST_FOR_EXCEPTION( record_length < header_size,
+                      std::runtime_error,
+                      "The record length (" << record_length << ") of "
+                      "binary ACE library " << d_ace_library_name <<
+                      " is too small to store a table header!" );
+
+  TEST_FOR_EXCEPTION( entries_per_record == 0 ||
+                      entries_per_record*sizeof(double) > record_length,
+                      std::runtime_error,
+                      "The number of entries per record ("
+                      << entries_per_record << ") of binary ACE library "
+                      << d_ace_library_name << " is not valid!" );
+
+  const size_t header_offset = (table_start_record-1)*record_length;
+
+  TEST_FOR_EXCEPTION( header_offset + header_size > ace_library.size(),
+                      std::runtime_error,
+                      "Binary ACE library " << d_ace_library_name << " has "
+                      "fewer than " << table_start_record << " records!" );
+
+  // Read the table header
+  const char* position = ace_library.data() + header_offset;
+
+  d_ace_table_name.assign( position, 10 );
+  position += 10;
+
+  copyFromRecord( position, d_atomic_weight_ratio );
+
+  double raw_temperature;
+
+  copyFromRecord( position, raw_temperature );
+
+  d_temperature = raw_temperature*Utility::Units::MeV;
+
+  d_ace_table_processing_date.assign( position, 10 );
+  position += 10;
 
-  // Clear white space from the ace table name and processing date
   boost::algorithm::trim( d_ace_table_name );
   boost::algorithm::trim( d_ace_table_processing_date );
 
   // Test that the table name is the same as the desired table name
-  TEST_FOR_EXCEPTION( table_name != d_ace_table_name,
-                      std::runtime_error,
-                      "Expected table " << table_name << " at line "
-                      << table_start_line << " of ACE library "
-                      << d_ace_library_name << " but found table "
-                      << d_ace_table_name << "!" );
+  this->checkTableName( table_name, table_start_record );
+
+  d_ace_table_comment.assign( position, 70 );
+  position += 70;
 
-  // Read the second line of the ACE table header
-  readAceTableHeaderLine2( d_ace_file_id,
-			   &d_ace_table_comment[0],
-			   &d_ace_table_material_id[0] );
+  d_ace_table_material_id.assign( position, 10 );
+  position += 10;
 
   boost::algorithm::trim( d_ace_table_comment );
   boost::algorithm::trim( d_ace_table_material_id );
 
-  // Read the zaids and awrs
   std::array<int,16> raw_zaids;
   std::array<double,16> raw_atomic_weight_ratios;
-  
-  readAceTableZaidsAndAwrs( d_ace_file_id,
-			    raw_zaids.data(),
-			    raw_atomic_weight_ratios.data() );
 
   for( size_t i = 0; i < 16; ++i )
   {
-    if( raw_zaids[i] != 0 )
-    {
-      d_zaids.push_back( raw_zaids[i] );
-      d_atomic_weight_ratios.push_back( raw_atomic_weight_ratios[i] );
-    }
+    int32_t raw_zaid;
+
+    copyFromRecord( position, raw_zaid );
+    copyFromRecord( position, raw_atomic_weight_ratios[i] );
+
+    raw_zaids[i] = raw_zaid;
+  }
+
+  this->extractZaidsAndAtomicWeightRatios( raw_zaids,
+                                           raw_atomic_weight_ratios );
+
+  for( size_t i = 0; i < d_nxs.size(); ++i )
+  {
+    int32_t raw_value;
+
+    copyFromRecord( position, raw_value );
+
+    d_nxs[i] = raw_value;
   }
 
-  // Read the nxs array
-  readAceTableNXSArray( d_ace_file_id, d_nxs.data() );
+  for( size_t i = 0; i < d_jxs.size(); ++i )
+  {
+    int32_t raw_value;
+
+    copyFromRecord( position, raw_value );
+
+    d_jxs[i] = raw_value;
+  }
 
-  // Read the jxs array
-  readAceTableJXSArray( d_ace_file_id, d_jxs.data() );
+  TEST_FOR_EXCEPTION( d_nxs[0] <= 0,
+                      std::runtime_error,
+                      "Table " << table_name << " in ACE library "
+                      << d_ace_library_name << " has an invalid XSS array "
+                      "size (" << d_nxs[0] << ")!" );
 
-  // Resize the xss array
+  // Read the xss array (each record is copied with a single block copy)
   d_xss->resize( d_nxs[0] );
 
-  // Read the xss array
-  readAceTableXSSArray( d_ace_file_id, d_xss->data(), d_xss->size() );
+  const size_t number_of_xss_records =
+    (d_xss->size() + entries_per_record - 1)/entries_per_record;
+
+  TEST_FOR_EXCEPTION( header_offset + number_of_xss_records*record_length +
+                      (d_xss->size() - (number_of_xss_records-1)*entries_per_record)*sizeof(double) > ace_library.size(),
+                      std::runtime_error,
+                      "Binary ACE library " << d_ace_library_name << " is "
+                      "too small to store the XSS array of table "
+                      << table_name << "!" );
+
+  for( size_t i = 0; i < number_of_xss_records; ++i )
+  {
+    const size_t first_entry = i*entries_per_record;
+
+    const size_t number_of_entries =
+      std::min( entries_per_record, d_xss->size() - first_entry );
 
-  // Close the ACE File
-  closeFileUsingFortran( d_ace_file_id );
+    std::memcpy( d_xss->data() + first_entry,
+                 ace_library.data() + header_offset + (i+1)*record_length,
+                 number_of_entries*sizeof(double) );
+  }
+}
+
+// Check that the table name is the desired table name
+void ACEFileHandler::checkTableName( const std::string& table_name,
+                                     const size_t table_start ) const
+{
+  TEST_FOR_EXCEPTION( table_name != d_ace_table_name,
+                      std::runtime_error,
+                      "Expected table " << table_name << " at line (record) "
+                      << table_start << " of ACE library "
+                      << d_ace_library_name << " but found table "
+                      << d_ace_table_name << "!" );
+}
+
+// Extract the nonzero zaids and atomic weight ratios
+void ACEFileHandler::extractZaidsAndAtomicWeightRatios(
+                      const std::array<int,16>& raw_zaids,
+                      const std::array<double,16>& raw_atomic_weight_ratios )
+{
+  for( size_t i = 0; i < 16; ++i )
+  {
+    if( raw_zaids[i] != 0 )
+    {
+      d_zaids.push_back( raw_zaids[i] );
+      d_atomic_weight_ratios.push_back( raw_atomic_weight_ratios[i] );
+    }
+  }
 }
 
 // Get the library name
@@ -22,6 +22,7 @@
 #include "Utility_Vector.hpp"
 #include "Utility_Array.hpp"
 #include "Utility_ArrayView.hpp"
+#include "Utility_MemoryMappedFile.hpp"
 
 namespace Data{
 
@@ -42,7 +43,15 @@ namespace Data{
  * Data::ACEFileHandler.
  */
 
-//! The ACE (A Compact ENDF) file handler class
+/*! The ACE (A Compact ENDF) file handler class
+ *
+ * The ACE library is memory mapped and the requested table is parsed
+ * directly from the mapped file. Both text (Type 1) and binary (Type 2)
+ * tables can be read. The table start for a text table is the line in the
+ * library where the table starts and the table start for a binary table is
+ * the record in the library where the table starts (both are stored in the
+ * xsdir file). No global state is used so tables can be read concurrently.
+ */
 class ACEFileHandler
 {
 
@@ -58,7 +67,9 @@ public:
   ACEFileHandler( const boost::filesystem::path& file_name_with_path,
 		  const std::string& table_name,
 		  const size_t table_start_line,
-		  const bool is_ascii = true );
+		  const bool is_ascii = true,
+                  const size_t binary_record_length = 4096,
+                  const size_t binary_entries_per_record = 512 );
 
   //! Destructor
   ~ACEFileHandler();
@@ -101,16 +112,26 @@ public:
 
 private:
 
-  // Open the ACE file
-  void openACEFile( const std::string& file_name,
-		    const bool is_ascii );
-
-  // Read the ACE table
-  void readACETable( const std::string& table_name,
-		     const size_t table_start_line );
-
-  // The ace file id used by the ace_helpers fortran module (always set to 1)
-  int d_ace_file_id;
+  // Read the text ACE table
+  void readASCIIACETable( const Utility::MemoryMappedFile& ace_library,
+                          const std::string& table_name,
+                          const size_t table_start_line );
+
+  // Read the binary ACE table
+  void readBinaryACETable( const Utility::MemoryMappedFile& ace_library,
+                           const std::string& table_name,
+                           const size_t table_start_record,
+                           const size_t record_length,
+                           const size_t entries_per_record );
+
+  // Check that the table name is the desired table name
+  void checkTableName( const std::string& table_name,
+                       const size_t table_start ) const;
+
+  // Extract the nonzero zaids and atomic weight ratios
+  void extractZaidsAndAtomicWeightRatios(
+                     const std::array<int,16>& raw_zaids,
+                     const std::array<double,16>& raw_atomic_weight_ratios );
 
   // The name of the ace library that is currently open
   boost::filesystem::path d_ace_library_name;
@@ -25,11 +25,15 @@ ACENuclearDataProperties::ACENuclearDataProperties(
                                       const Energy evaluation_temp,
                                       const boost::filesystem::path& file_path,
                                       const size_t file_start_line,
-                                      const ACETableName& file_table_name )
+                                      const ACETableName& file_table_name,
+                                      const size_t file_record_length,
+                                      const size_t file_entries_per_record )
   : d_atomic_weight_ratio( atomic_weight_ratio ),
     d_evaluation_temp( evaluation_temp ),
     d_file_path( file_path ),
     d_file_start_line( file_start_line ),
+    d_file_record_length( file_record_length ),
+    d_file_entries_per_record( file_entries_per_record ),
     d_file_table_name( file_table_name )
 {
   // Make sure that the atomic weight ratio is valid
@@ -38,6 +42,8 @@ ACENuclearDataProperties::ACENuclearDataProperties(
   testPrecondition( evaluation_temp >= 0.0*Utility::Units::MeV );
   // Make sure that the file path is valid
   testPrecondition( !file_path.string().empty() );
+  // Make sure that the record data is valid
+  testPrecondition( (file_record_length == 0) == (file_entries_per_record == 0) );
 
   // Convert to the preferred path format
   d_file_path.make_preferred();
@@ -54,6 +60,8 @@ ACENuclearDataProperties::ACENuclearDataProperties(
     d_evaluation_temp( other.d_evaluation_temp ),
     d_file_path( other.d_file_path ),
     d_file_start_line( other.d_file_start_line ),
+    d_file_record_length( other.d_file_record_length ),
+    d_file_entries_per_record( other.d_file_entries_per_record ),
     d_file_table_name( other.d_file_table_name )
 {
   // Convert to the preferred path format
@@ -96,6 +104,20 @@ size_t ACENuclearDataProperties::fileStartLine() const
   return d_file_start_line;
 }
 
+// Get the nuclear data file record length (binary files only)
+/*! \details A record length of zero indicates a text file.
+ */
+size_t ACENuclearDataProperties::fileRecordLength() const
+{
+  return d_file_record_length;
+}
+
+// Get the nuclear data file entries per record (binary files only)
+size_t ACENuclearDataProperties::fileEntriesPerRecord() const
+{
+  return d_file_entries_per_record;
+}
+
 // Get the nuclear data file major version
 unsigned ACENuclearDataProperties::fileMajorVersion() const
 {
@@ -24,16 +24,22 @@ ACEPhotoatomicDataProperties::ACEPhotoatomicDataProperties(
                                       const AtomicWeight atomic_weight,
                                       const boost::filesystem::path& file_path,
                                       const size_t file_start_line,
-                                      const ACETableName& file_table_name )
+                                      const ACETableName& file_table_name,
+                                      const size_t file_record_length,
+                                      const size_t file_entries_per_record )
   : d_atomic_weight( atomic_weight ),
     d_file_path( file_path ),
     d_file_start_line( file_start_line ),
+    d_file_record_length( file_record_length ),
+    d_file_entries_per_record( file_entries_per_record ),
     d_file_table_name( file_table_name )
 {
   // Make sure that the atomic weight is valid
   testPrecondition( atomic_weight > 0.0*Utility::Units::amu );
   // Make sure that the file path is valid
   testPrecondition( !file_path.string().empty() );
+  // Make sure that the record data is valid
+  testPrecondition( (file_record_length == 0) == (file_entries_per_record == 0) );
 
   // Convert to the preferred path format
   d_file_path.make_preferred();
@@ -49,6 +55,8 @@ ACEPhotoatomicDataProperties::ACEPhotoatomicDataProperties(
   : d_atomic_weight( other.d_atomic_weight ),
     d_file_path( other.d_file_path ),
     d_file_start_line( other.d_file_start_line ),
+    d_file_record_length( other.d_file_record_length ),
+    d_file_entries_per_record( other.d_file_entries_per_record ),
     d_file_table_name( other.d_file_table_name )
 { 
   // Convert to the preferred path format
@@ -88,6 +96,20 @@ size_t ACEPhotoatomicDataProperties::fileStartLine() const
   return d_file_start_line;
 }
 
+// Get the photoatomic data file record length (binary files only)
+/*! \details A record length of zero indicates a text file.
+ */
+size_t ACEPhotoatomicDataProperties::fileRecordLength() const
+{
+  return d_file_record_length;
+}
+
+// Get the photoatomic data file entries per record (binary files only)
+size_t ACEPhotoatomicDataProperties::fileEntriesPerRecord() const
+{
+  return d_file_entries_per_record;
+}
+
 // Get the photoatomic data file version
 unsigned ACEPhotoatomicDataProperties::fileVersion() const
 {
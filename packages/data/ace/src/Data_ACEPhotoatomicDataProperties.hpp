@@ -26,7 +26,9 @@ public:
   ACEPhotoatomicDataProperties( const AtomicWeight atomic_weight,
                                 const boost::filesystem::path& file_path,
                                 const size_t file_start_line,
-                                const ACETableName& file_table_name );
+                                const ACETableName& file_table_name,
+                                const size_t file_record_length = 0,
+                                const size_t file_entries_per_record = 0 );
 
   //! Destructor
   ~ACEPhotoatomicDataProperties()
@@ -47,6 +49,12 @@ public:
   //! Get the photoatomic data file start line
   size_t fileStartLine() const override;
 
+  //! Get the photoatomic data file record length (binary files only)
+  size_t fileRecordLength() const override;
+
+  //! Get the photoatomic data file entries per record (binary files only)
+  size_t fileEntriesPerRecord() const override;
+
   //! Get the photoatomic data file version
   unsigned fileVersion() const override;
 
@@ -89,6 +97,12 @@ private:
   // The file start line
   size_t d_file_start_line;
 
+  // The file record length (binary files only)
+  size_t d_file_record_length;
+
+  // The number of entries per file record (binary files only)
+  size_t d_file_entries_per_record;
+
   // The file table name
   ACETableName d_file_table_name;
 };
@@ -108,6 +122,8 @@ void ACEPhotoatomicDataProperties::save( Archive& ar, const unsigned version ) c
   ar & BOOST_SERIALIZATION_NVP( raw_path );
   ar & BOOST_SERIALIZATION_NVP( d_file_start_line );
   ar & BOOST_SERIALIZATION_NVP( d_file_table_name );
+  ar & BOOST_SERIALIZATION_NVP( d_file_record_length );
+  ar & BOOST_SERIALIZATION_NVP( d_file_entries_per_record );
 }
 
 // Load the properties from an archive
@@ -128,11 +144,23 @@ void ACEPhotoatomicDataProperties::load( Archive& ar, const unsigned version )
   
   ar & BOOST_SERIALIZATION_NVP( d_file_start_line );
   ar & BOOST_SERIALIZATION_NVP( d_file_table_name );
+
+  // Version 0 archives only stored the properties of text tables
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_file_record_length );
+    ar & BOOST_SERIALIZATION_NVP( d_file_entries_per_record );
+  }
+  else
+  {
+    d_file_record_length = 0;
+    d_file_entries_per_record = 0;
+  }
 }
 
 } // end Data namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ACEPhotoatomicDataProperties, Data, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ACEPhotoatomicDataProperties, Data, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ACEPhotoatomicDataProperties, Data );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Data, ACEPhotoatomicDataProperties );
 
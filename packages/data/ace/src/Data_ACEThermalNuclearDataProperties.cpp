@@ -26,11 +26,15 @@ ACEThermalNuclearDataProperties::ACEThermalNuclearDataProperties(
                                const Energy evaluation_temp,
                                const boost::filesystem::path& file_path,
                                const size_t file_start_line,
-                               const std::string& file_table_name )
+                               const std::string& file_table_name,
+                               const size_t file_record_length,
+                               const size_t file_entries_per_record )
   : d_zaids( zaids ),
     d_evaluation_temp( evaluation_temp ),
     d_file_path( file_path ),
     d_file_start_line( file_start_line ),
+    d_file_record_length( file_record_length ),
+    d_file_entries_per_record( file_entries_per_record ),
     d_file_table_name( file_table_name ),
     d_name(),
     d_file_version()
@@ -41,6 +45,8 @@ ACEThermalNuclearDataProperties::ACEThermalNuclearDataProperties(
   testPrecondition( evaluation_temp >= 0.0*Utility::Units::MeV );
   // Make sure that the file path is valid
   testPrecondition( !file_path.string().empty() );
+  // Make sure that the record data is valid
+  testPrecondition( (file_record_length == 0) == (file_entries_per_record == 0) );
 
   // Convert to the preferred path format
   d_file_path.make_preferred();
@@ -64,6 +70,8 @@ ACEThermalNuclearDataProperties::ACEThermalNuclearDataProperties(
     d_evaluation_temp( other.d_evaluation_temp ),
     d_file_path( other.d_file_path ),
     d_file_start_line( other.d_file_start_line ),
+    d_file_record_length( other.d_file_record_length ),
+    d_file_entries_per_record( other.d_file_entries_per_record ),
     d_file_table_name( other.d_file_table_name ),
     d_name( other.d_name ),
     d_file_version( other.d_file_version )
@@ -114,6 +122,20 @@ size_t ACEThermalNuclearDataProperties::fileStartLine() const
   return d_file_start_line;
 }
 
+// Get the nuclear data file record length (binary files only)
+/*! \details A record length of zero indicates a text file.
+ */
+size_t ACEThermalNuclearDataProperties::fileRecordLength() const
+{
+  return d_file_record_length;
+}
+
+// Get the nuclear data file entries per record (binary files only)
+size_t ACEThermalNuclearDataProperties::fileEntriesPerRecord() const
+{
+  return d_file_entries_per_record;
+}
+
 // Get the nuclear data file major version
 unsigned ACEThermalNuclearDataProperties::fileMajorVersion() const
 {
@@ -27,14 +27,18 @@ public:
                                    const Energy evaluation_temp,
                                    const boost::filesystem::path& file_path,
                                    const size_t file_start_line,
-                                   const std::string& file_table_name );
+                                   const std::string& file_table_name,
+                                   const size_t file_record_length = 0,
+                                   const size_t file_entries_per_record = 0 );
 
   //! Constructor
   ACEThermalNuclearDataProperties( const std::set<Data::ZAID>& zaids,
                                    const Energy evaluation_temp,
                                    const boost::filesystem::path& file_path,
                                    const size_t file_start_line,
-                                   const std::string& file_table_name );
+                                   const std::string& file_table_name,
+                                   const size_t file_record_length = 0,
+                                   const size_t file_entries_per_record = 0 );
 
   //! Destructor
   ~ACEThermalNuclearDataProperties()
@@ -61,6 +65,12 @@ public:
   //! Get the nuclear data file start line
   size_t fileStartLine() const override;
 
+  //! Get the nuclear data file record length (binary files only)
+  size_t fileRecordLength() const override;
+
+  //! Get the nuclear data file entries per record (binary files only)
+  size_t fileEntriesPerRecord() const override;
+
   //! Get the nuclear data file major version
   unsigned fileMajorVersion() const override;
 
@@ -109,6 +119,12 @@ private:
   // The file start line
   size_t d_file_start_line;
 
+  // The file record length (binary files only)
+  size_t d_file_record_length;
+
+  // The number of entries per file record (binary files only)
+  size_t d_file_entries_per_record;
+
   // The file table name
   std::string d_file_table_name;
 
@@ -126,12 +142,16 @@ ACEThermalNuclearDataProperties::ACEThermalNuclearDataProperties(
                                 const Energy evaluation_temp,
                                 const boost::filesystem::path& file_path,
                                 const size_t file_start_line,
-                                const std::string& file_table_name )
+                                const std::string& file_table_name,
+                                const size_t file_record_length,
+                                const size_t file_entries_per_record )
   : ACEThermalNuclearDataProperties( std::set<Data::ZAID>( zaids.begin(), zaids.end() ),
                                      evaluation_temp,
                                      file_path,
                                      file_start_line,
-                                     file_table_name )
+                                     file_table_name,
+                                     file_record_length,
+                                     file_entries_per_record )
 { /* ... */ }
 
 // Save the properties to an archive
@@ -152,6 +172,8 @@ void ACEThermalNuclearDataProperties::save( Archive& ar, const unsigned version
   ar & BOOST_SERIALIZATION_NVP( d_file_table_name );
   ar & BOOST_SERIALIZATION_NVP( d_name );
   ar & BOOST_SERIALIZATION_NVP( d_file_version );
+  ar & BOOST_SERIALIZATION_NVP( d_file_record_length );
+  ar & BOOST_SERIALIZATION_NVP( d_file_entries_per_record );
 }
 
 // Load the properties from an archive
@@ -175,11 +197,23 @@ void ACEThermalNuclearDataProperties::load( Archive& ar, const unsigned version
   ar & BOOST_SERIALIZATION_NVP( d_file_table_name );
   ar & BOOST_SERIALIZATION_NVP( d_name );
   ar & BOOST_SERIALIZATION_NVP( d_file_version );
+
+  // Version 0 archives only stored the properties of text tables
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_file_record_length );
+    ar & BOOST_SERIALIZATION_NVP( d_file_entries_per_record );
+  }
+  else
+  {
+    d_file_record_length = 0;
+    d_file_entries_per_record = 0;
+  }
 }
 
 } // end Data namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ACEThermalNuclearDataProperties, Data, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ACEThermalNuclearDataProperties, Data, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ACEThermalNuclearDataProperties, Data );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Data, ACEThermalNuclearDataProperties );
 
@@ -10,6 +10,9 @@
 #include <string>
 #include <memory>
 #include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
 
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
@@ -22,6 +25,70 @@
 std::string test_neutron_ace_file_name;
 unsigned test_neutron_ace_file_start_line;
 
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Write a table to a binary (Type 2) ACE library
+void writeBinaryACETable( const Data::ACEFileHandler& ace_file_handler,
+                          const std::string& binary_file_name,
+                          const size_t record_length,
+                          const size_t entries_per_record )
+{
+  std::vector<char> header_record( record_length, '\0' );
+
+  char* position = header_record.data();
+
+  auto write_string = [&position]( const std::string& value,
+                                   const size_t width ){
+    std::string padded_value( value );
+    padded_value.resize( width, ' ' );
+
+    std::memcpy( position, padded_value.data(), width );
+    position += width;
+  };
+
+  auto write_value = [&position]( const auto value ){
+    std::memcpy( position, &value, sizeof(value) );
+    position += sizeof(value);
+  };
+
+  write_string( ace_file_handler.getTableName(), 10 );
+  write_value( ace_file_handler.getTableAtomicWeightRatio() );
+  write_value( ace_file_handler.getTableTemperature().value() );
+  write_string( ace_file_handler.getTableProcessingDate(), 10 );
+  write_string( ace_file_handler.getTableComment(), 70 );
+  write_string( ace_file_handler.getTableMatId(), 10 );
+
+  for( size_t i = 0; i < 16; ++i )
+  {
+    write_value( (int32_t)0 );
+    write_value( 0.0 );
+  }
+
+  for( auto&& value : ace_file_handler.getTableNXSArray() )
+    write_value( (int32_t)value );
+
+  for( auto&& value : ace_file_handler.getTableJXSArray() )
+    write_value( (int32_t)value );
+
+  std::ofstream binary_file( binary_file_name, std::ios::binary );
+
+  binary_file.write( header_record.data(), header_record.size() );
+
+  const std::vector<double>& xss = *ace_file_handler.getTableXSSArray();
+
+  for( size_t i = 0; i < xss.size(); i += entries_per_record )
+  {
+    std::vector<char> xss_record( record_length, '\0' );
+
+    std::memcpy( xss_record.data(),
+                 xss.data() + i,
+                 std::min( entries_per_record, xss.size() - i )*sizeof(double) );
+
+    binary_file.write( xss_record.data(), xss_record.size() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -91,6 +158,67 @@ FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron )
   FRENSIE_CHECK_EQUAL( xss->back(), 102 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the ACEFileHandler can read a binary neutron ace file
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron_binary )
+{
+  std::string table_name( "1001.70c" );
+
+  Data::ACEFileHandler ascii_ace_file_handler( test_neutron_ace_file_name,
+                                               table_name,
+                                               test_neutron_ace_file_start_line );
+
+  std::string binary_file_name( "test_1001_70c_binary.ace" );
+
+  writeBinaryACETable( ascii_ace_file_handler, binary_file_name, 4096, 512 );
+
+  std::shared_ptr<Data::ACEFileHandler> ace_file_handler(
+                          new Data::ACEFileHandler( binary_file_name,
+                                                    table_name,
+                                                    1u,
+                                                    false,
+                                                    4096,
+                                                    512 ) );
+
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableName(), table_name );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableAtomicWeightRatio(),
+		       0.999167 );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableTemperature(),
+		       2.53010e-08*Utility::Units::MeV );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableProcessingDate(),
+		       "03/27/08" );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableComment(),
+		       "1-H -  1 at 293.6K from endf/b-vii.0 njoy99.248" );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableMatId(),
+		       "mat 125" );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableZAIDs().size(), 0 );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableNXSArray(),
+                       ascii_ace_file_handler.getTableNXSArray() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableJXSArray(),
+                       ascii_ace_file_handler.getTableJXSArray() );
+  FRENSIE_CHECK_EQUAL( *ace_file_handler->getTableXSSArray(),
+                       *ascii_ace_file_handler.getTableXSSArray() );
+
+  // A record length that cannot store the header is not valid
+  FRENSIE_CHECK_THROW( Data::ACEFileHandler( binary_file_name,
+                                             table_name,
+                                             1u,
+                                             false,
+                                             256,
+                                             32 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the wrong table cannot be read
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_wrong_table )
+{
+  FRENSIE_CHECK_THROW( Data::ACEFileHandler( test_neutron_ace_file_name,
+                                             "1002.70c",
+                                             test_neutron_ace_file_start_line ),
+                       std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
@@ -85,6 +85,27 @@ FRENSIE_UNIT_TEST( ACENuclearDataProperties, fileStartLine )
   FRENSIE_CHECK_EQUAL( properties->fileStartLine(), 10 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data file record data can be returned
+FRENSIE_UNIT_TEST( ACENuclearDataProperties, fileRecordLength )
+{
+  FRENSIE_CHECK_EQUAL( properties->fileRecordLength(), 0 );
+  FRENSIE_CHECK_EQUAL( properties->fileEntriesPerRecord(), 0 );
+
+  Data::ACENuclearDataProperties binary_properties(
+                                               1.0,
+                                               2.5301e-8*Utility::Units::MeV,
+                                               "neutron_data/h_data.bin",
+                                               3,
+                                               "1001.70c",
+                                               4096,
+                                               512 );
+
+  FRENSIE_CHECK_EQUAL( binary_properties.fileStartLine(), 3 );
+  FRENSIE_CHECK_EQUAL( binary_properties.fileRecordLength(), 4096 );
+  FRENSIE_CHECK_EQUAL( binary_properties.fileEntriesPerRecord(), 512 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the data file major version can be returned
 FRENSIE_UNIT_TEST( ACENuclearDataProperties, fileMajorVersion )
@@ -140,9 +161,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ACENuclearDataProperties,
 
     Data::ACENuclearDataProperties local_properties( 16.0,
                                                      2.5301e-8*Utility::Units::MeV,
-                                                     "neutron_data/o_data.txt",
-                                                     0,
-                                                     "8016.81c" );
+                                                     "neutron_data/o_data.bin",
+                                                     1,
+                                                     "8016.81c",
+                                                     4096,
+                                                     512 );
 
     std::shared_ptr<const Data::NuclearDataProperties>
       shared_properties( properties->clone() );
@@ -168,8 +191,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ACENuclearDataProperties,
   FRENSIE_CHECK_EQUAL( local_properties.evaluationTemperatureInMeV(),
                        2.5301e-8*Utility::Units::MeV );
   FRENSIE_CHECK_EQUAL( local_properties.filePath().string(),
-                       "neutron_data/o_data.txt" );
-  FRENSIE_CHECK_EQUAL( local_properties.fileStartLine(), 0 );
+                       "neutron_data/o_data.bin" );
+  FRENSIE_CHECK_EQUAL( local_properties.fileStartLine(), 1 );
+  FRENSIE_CHECK_EQUAL( local_properties.fileRecordLength(), 4096 );
+  FRENSIE_CHECK_EQUAL( local_properties.fileEntriesPerRecord(), 512 );
   FRENSIE_CHECK_EQUAL( local_properties.fileVersion(), 81 );
   FRENSIE_CHECK_EQUAL( local_properties.tableName(), "8016.81c" );
 
@@ -184,6 +209,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ACENuclearDataProperties,
   FRENSIE_CHECK_EQUAL( shared_properties->filePath().string(),
                        "neutron_data/h_data.txt" );
   FRENSIE_CHECK_EQUAL( shared_properties->fileStartLine(), 10 );
+  FRENSIE_CHECK_EQUAL( shared_properties->fileRecordLength(), 0 );
+  FRENSIE_CHECK_EQUAL( shared_properties->fileEntriesPerRecord(), 0 );
   FRENSIE_CHECK_EQUAL( shared_properties->fileVersion(), 70 );
   FRENSIE_CHECK_EQUAL( shared_properties->tableName(), "1001.70c" );
 }
@@ -76,6 +76,25 @@ FRENSIE_UNIT_TEST( ACEPhotoatomicDataProperties, fileStartLine )
   FRENSIE_CHECK_EQUAL( properties->fileStartLine(), 10 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the file record data can be returned
+FRENSIE_UNIT_TEST( ACEPhotoatomicDataProperties, fileRecordLength )
+{
+  FRENSIE_CHECK_EQUAL( properties->fileRecordLength(), 0 );
+  FRENSIE_CHECK_EQUAL( properties->fileEntriesPerRecord(), 0 );
+
+  Data::ACEPhotoatomicDataProperties binary_properties(
+                                                 1.0*amu,
+                                                 "photoatomic_data/h_data.bin",
+                                                 3,
+                                                 "1000.12p",
+                                                 4096,
+                                                 512 );
+
+  FRENSIE_CHECK_EQUAL( binary_properties.fileRecordLength(), 4096 );
+  FRENSIE_CHECK_EQUAL( binary_properties.fileEntriesPerRecord(), 512 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the file version can be returned
 FRENSIE_UNIT_TEST( ACEPhotoatomicDataProperties, fileVersion )
@@ -123,9 +142,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ACEPhotoatomicDataProperties,
     createOArchive( archive_base_name, archive_ostream, oarchive );
 
     Data::ACEPhotoatomicDataProperties local_properties( 2.0*amu,
-                                                         "photoatomic_data/he_data.txt",
+                                                         "photoatomic_data/he_data.bin",
                                                           2,
-                                                          "2000.04p" );
+                                                          "2000.04p",
+                                                          4096,
+                                                          512 );
 
     std::shared_ptr<const Data::PhotoatomicDataProperties>
       shared_properties( properties->clone() );
@@ -150,8 +171,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ACEPhotoatomicDataProperties,
   FRENSIE_CHECK_EQUAL( local_properties.atomicNumber(), 2 );
   FRENSIE_CHECK_EQUAL( local_properties.atomicWeight(), 2.0*amu );
   FRENSIE_CHECK_EQUAL( local_properties.filePath().string(),
-                       "photoatomic_data/he_data.txt" );
+                       "photoatomic_data/he_data.bin" );
   FRENSIE_CHECK_EQUAL( local_properties.fileStartLine(), 2 );
+  FRENSIE_CHECK_EQUAL( local_properties.fileRecordLength(), 4096 );
+  FRENSIE_CHECK_EQUAL( local_properties.fileEntriesPerRecord(), 512 );
   FRENSIE_CHECK_EQUAL( local_properties.fileVersion(), 4 );
   FRENSIE_CHECK_EQUAL( local_properties.tableName(), "2000.04p" );
 
@@ -165,6 +188,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ACEPhotoatomicDataProperties,
   FRENSIE_CHECK_EQUAL( shared_properties->filePath().string(),
                        "photoatomic_data/h_data.txt" );
   FRENSIE_CHECK_EQUAL( shared_properties->fileStartLine(), 10 );
+  FRENSIE_CHECK_EQUAL( shared_properties->fileRecordLength(), 0 );
+  FRENSIE_CHECK_EQUAL( shared_properties->fileEntriesPerRecord(), 0 );
   FRENSIE_CHECK_EQUAL( shared_properties->fileVersion(), 12 );
   FRENSIE_CHECK_EQUAL( shared_properties->tableName(), "1000.12p" );
 }
@@ -16,6 +16,21 @@ namespace Data{
 ElectroatomicDataProperties::ElectroatomicDataProperties()
 { /* ... */ }
 
+// Get the electroatomic data file record length (binary files only)
+/*! \details Files that are not stored in fixed length records (e.g. text
+ * files) have a record length of zero.
+ */
+size_t ElectroatomicDataProperties::fileRecordLength() const
+{
+  return 0;
+}
+
+// Get the electroatomic data file entries per record (binary files only)
+size_t ElectroatomicDataProperties::fileEntriesPerRecord() const
+{
+  return 0;
+}
+
 } // end Data namespace
 
 namespace Utility{
@@ -76,6 +76,12 @@ public:
   //! Get the electroatomic data file start line
   virtual size_t fileStartLine() const = 0;
 
+  //! Get the electroatomic data file record length (binary files only)
+  virtual size_t fileRecordLength() const;
+
+  //! Get the electroatomic data file entries per record (binary files only)
+  virtual size_t fileEntriesPerRecord() const;
+
   //! Get the photoatomic data file version
   virtual unsigned fileVersion() const = 0;
 
@@ -17,6 +17,21 @@ namespace Data{
 NuclearDataProperties::NuclearDataProperties()
 { /* ... */ }
 
+// Get the nuclear data file record length (binary files only)
+/*! \details Files that are not stored in fixed length records (e.g. text
+ * files) have a record length of zero.
+ */
+size_t NuclearDataProperties::fileRecordLength() const
+{
+  return 0;
+}
+
+// Get the nuclear data file entries per record (binary files only)
+size_t NuclearDataProperties::fileEntriesPerRecord() const
+{
+  return 0;
+}
+
 // Get the nuclear data evaluation temperature (Kelvin)
 auto NuclearDataProperties::evaluationTemperature() const -> Temperature
 {
@@ -75,6 +75,12 @@ public:
   //! Get the photoatomic data file start line
   virtual size_t fileStartLine() const = 0;
 
+  //! Get the photoatomic data file record length (binary files only)
+  virtual size_t fileRecordLength() const;
+
+  //! Get the photoatomic data file entries per record (binary files only)
+  virtual size_t fileEntriesPerRecord() const;
+
   //! Get the photoatomic data file version
   virtual unsigned fileVersion() const = 0;
 
@@ -69,6 +69,12 @@ public:
   //! Get the nuclear data file start line
   virtual size_t fileStartLine() const = 0;
 
+  //! Get the nuclear data file record length (binary files only)
+  virtual size_t fileRecordLength() const;
+
+  //! Get the nuclear data file entries per record (binary files only)
+  virtual size_t fileEntriesPerRecord() const;
+
   //! Get the nuclear data file version
   virtual unsigned fileVersion() const = 0;
 
@@ -17,6 +17,21 @@ namespace Data{
 ThermalNuclearDataProperties::ThermalNuclearDataProperties()
 { /* ... */ }
 
+// Get the nuclear data file record length (binary files only)
+/*! \details Files that are not stored in fixed length records (e.g. text
+ * files) have a record length of zero.
+ */
+size_t ThermalNuclearDataProperties::fileRecordLength() const
+{
+  return 0;
+}
+
+// Get the nuclear data file entries per record (binary files only)
+size_t ThermalNuclearDataProperties::fileEntriesPerRecord() const
+{
+  return 0;
+}
+
 // Get the nuclear data evaluation temperature (Kelvin)
 auto ThermalNuclearDataProperties::evaluationTemperature() const -> Temperature
 {
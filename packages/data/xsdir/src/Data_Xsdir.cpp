@@ -268,6 +268,67 @@ size_t Xsdir::quickExtractFileStartLineFromEntryTokens(
   return Utility::fromString<size_t>( entry_tokens[5] );
 }
 
+// Extract the file record length of the table (binary tables only)
+/*! \details Zero will be returned for text tables.
+ */
+size_t Xsdir::extractFileRecordLengthFromEntryTokens(
+                                 const std::vector<std::string>& entry_tokens )
+{
+  TEST_FOR_EXCEPTION( !Xsdir::isLineTableEntry( entry_tokens ),
+                      std::logic_error,
+                      "The line does not have table data!" );
+
+  return Xsdir::quickExtractFileRecordLengthFromEntryTokens( entry_tokens );
+}
+
+// Extract the file record length of the table
+size_t Xsdir::quickExtractFileRecordLengthFromEntryTokens(
+                                 const std::vector<std::string>& entry_tokens )
+{
+  if( entry_tokens.size() >= 9 && !Xsdir::isTableHumanReadableQuick( entry_tokens ) )
+    return Utility::fromString<size_t>( entry_tokens[7] );
+  else
+    return 0;
+}
+
+// Extract the file entries per record of the table (binary tables only)
+/*! \details Zero will be returned for text tables.
+ */
+size_t Xsdir::extractFileEntriesPerRecordFromEntryTokens(
+                                 const std::vector<std::string>& entry_tokens )
+{
+  TEST_FOR_EXCEPTION( !Xsdir::isLineTableEntry( entry_tokens ),
+                      std::logic_error,
+                      "The line does not have table data!" );
+
+  return Xsdir::quickExtractFileEntriesPerRecordFromEntryTokens( entry_tokens );
+}
+
+// Extract the file entries per record of the table
+size_t Xsdir::quickExtractFileEntriesPerRecordFromEntryTokens(
+                                 const std::vector<std::string>& entry_tokens )
+{
+  if( entry_tokens.size() >= 9 && !Xsdir::isTableHumanReadableQuick( entry_tokens ) )
+    return Utility::fromString<size_t>( entry_tokens[8] );
+  else
+    return 0;
+}
+
+// Check if the table can be read
+/*! \details A binary table can only be read if the record length and the
+ * number of entries per record are given.
+ */
+bool Xsdir::isTableReadableQuick( const std::vector<std::string>& entry_tokens )
+{
+  if( Xsdir::isTableHumanReadableQuick( entry_tokens ) )
+    return true;
+  else
+  {
+    return Xsdir::quickExtractFileRecordLengthFromEntryTokens( entry_tokens ) > 0 &&
+      Xsdir::quickExtractFileEntriesPerRecordFromEntryTokens( entry_tokens ) > 0;
+  }
+}
+
 // Extract the table evaluation temperature from the entry tokens
 auto Xsdir::extractEvaluationTemperatureFromEntryTokens(
                        const std::vector<std::string>& entry_tokens ) -> Energy
@@ -408,6 +469,12 @@ void Xsdir::parseEntryTokensAndCreateDataPropertiesObject(
   const size_t file_start_line =
     this->quickExtractFileStartLineFromEntryTokens( entry_tokens );
 
+  const size_t file_record_length =
+    this->quickExtractFileRecordLengthFromEntryTokens( entry_tokens );
+
+  const size_t file_entries_per_record =
+    this->quickExtractFileEntriesPerRecordFromEntryTokens( entry_tokens );
+
   const unsigned table_major_version =
     Utility::get<1>( table_name_components )/10;
 
@@ -421,6 +488,8 @@ void Xsdir::parseEntryTokensAndCreateDataPropertiesObject(
                                                        evaluation_temp,
                                                        table_file_path,
                                                        file_start_line,
+                                                       file_record_length,
+                                                       file_entries_per_record,
                                                        table_major_version,
                                                        table_name_components );
       break;
@@ -432,6 +501,8 @@ void Xsdir::parseEntryTokensAndCreateDataPropertiesObject(
                   evaluation_temp,
                   table_file_path,
                   file_start_line,
+                  file_record_length,
+                  file_entries_per_record,
                   table_major_version,
                   this->quickExtractTableNameFromEntryTokens( entry_tokens ) );
       break;
@@ -442,6 +513,8 @@ void Xsdir::parseEntryTokensAndCreateDataPropertiesObject(
                                                atomic_weight_ratio,
                                                table_file_path,
                                                file_start_line,
+                                               file_record_length,
+                                               file_entries_per_record,
                                                table_major_version,
                                                table_name_components );
       break;
@@ -452,6 +525,8 @@ void Xsdir::parseEntryTokensAndCreateDataPropertiesObject(
                                          atomic_weight_ratio,
                                          table_file_path,
                                          file_start_line,
+                                         file_record_length,
+                                         file_entries_per_record,
                                          table_name_components );
       break;
     }
@@ -461,6 +536,8 @@ void Xsdir::parseEntryTokensAndCreateDataPropertiesObject(
                                          atomic_weight_ratio,
                                          table_file_path,
                                          file_start_line,
+                                         file_record_length,
+                                         file_entries_per_record,
                                          table_name_components );
       break;
     }
@@ -486,6 +563,8 @@ void Xsdir::createContinuousEnergyNeutronTableProperties(
                                 const Energy evaluation_temp,
                                 const boost::filesystem::path& table_file_path,
                                 const size_t file_start_line,
+                                const size_t file_record_length,
+                                const size_t file_entries_per_record,
                                 const unsigned table_major_version,
                                 const ACETableName& table_name ) const
 {
@@ -504,7 +583,9 @@ void Xsdir::createContinuousEnergyNeutronTableProperties(
                                     evaluation_temp,
                                     table_file_path,
                                     file_start_line,
-                                    table_name ) );
+                                    table_name,
+                                    file_record_length,
+                                    file_entries_per_record ) );
 
   // Add the nuclear properties to the corresponding nuclide properties entry
   // in the database
@@ -531,6 +612,8 @@ void Xsdir::createSABTableProperties(
                                 const Energy evaluation_temp,
                                 const boost::filesystem::path& table_file_path,
                                 const size_t file_start_line,
+                                const size_t file_record_length,
+                                const size_t file_entries_per_record,
                                 const unsigned table_major_version,
                                 const std::string& table_name ) const
 {
@@ -541,6 +624,8 @@ void Xsdir::createSABTableProperties(
                               table_file_path,
                               table_name,
                               file_start_line,
+                              file_record_length,
+                              file_entries_per_record,
                               zaids );
 
   std::shared_ptr<const ACEThermalNuclearDataProperties> properties(
@@ -548,7 +633,9 @@ void Xsdir::createSABTableProperties(
                                                     evaluation_temp,
                                                     table_file_path,
                                                     file_start_line,
-                                                    table_name ) );
+                                                    table_name,
+                                                    file_record_length,
+                                                    file_entries_per_record ) );
 
   for( std::set<ZAID>::const_iterator zaid_it = zaids.begin();
        zaid_it != zaids.end();
@@ -581,6 +668,8 @@ void Xsdir::createPhotonuclearTableProperties(
                                 const double atomic_weight_ratio,
                                 const boost::filesystem::path& table_file_path,
                                 const size_t file_start_line,
+                                const size_t file_record_length,
+                                const size_t file_entries_per_record,
                                 const unsigned table_major_version,
                                 const ACETableName& table_name ) const
 {
@@ -602,7 +691,9 @@ void Xsdir::createPhotonuclearTableProperties(
                      new ACEPhotonuclearDataProperties( atomic_weight,
                                                         table_file_path,
                                                         file_start_line,
-                                                        table_name ) );
+                                                        table_name,
+                                                        file_record_length,
+                                                        file_entries_per_record ) );
 
   // Add the photonuclear properties to the corresponding nuclide properties
   // in the database
@@ -629,6 +720,8 @@ void Xsdir::createAtomicTableProperties(
             const double atomic_weight_ratio,
             const boost::filesystem::path& table_file_path,
             const size_t file_start_line,
+            const size_t file_record_length,
+            const size_t file_entries_per_record,
             const std::tuple<std::string,unsigned,char> table_name_components ) const
 {
   // Verify that the table file exists
@@ -652,7 +745,9 @@ void Xsdir::createAtomicTableProperties(
                    new ACEPhotoatomicDataProperties( atomic_weight,
                                                      table_file_path,
                                                      file_start_line,
-                                                     table_name_components ) );
+                                                     table_name_components,
+                                                     file_record_length,
+                                                     file_entries_per_record ) );
 
     this->addPhotoatomicPropertiesToDatabase( database,
                                               photoatomic_properties );
@@ -664,7 +759,9 @@ void Xsdir::createAtomicTableProperties(
                  new ACEElectroatomicDataProperties( atomic_weight,
                                                      table_file_path,
                                                      file_start_line,
-                                                     table_name_components ) );
+                                                     table_name_components,
+                                                     file_record_length,
+                                                     file_entries_per_record ) );
 
       this->addElectroatomicPropertiesToDatabase( database,
                                                   electroatomic_properties );
@@ -676,7 +773,9 @@ void Xsdir::createAtomicTableProperties(
                  new ACEElectroatomicDataProperties( atomic_weight,
                                                      table_file_path,
                                                      file_start_line,
-                                                     table_name_components ) );
+                                                     table_name_components,
+                                                     file_record_length,
+                                                     file_entries_per_record ) );
 
       this->addElectroatomicPropertiesToDatabase( database,
                                                   electroatomic_properties );
@@ -762,6 +861,8 @@ void Xsdir::extractSABTableZaids(
                               const boost::filesystem::path& relative_sab_path,
                               const std::string& table_name,
                               const size_t file_start_line,
+                              const size_t file_record_length,
+                              const size_t file_entries_per_record,
                               std::set<ZAID>& table_zaids )
 {
   // To extract the zaids we have to actually load the file and read
@@ -783,7 +884,9 @@ void Xsdir::extractSABTableZaids(
     file_handler.reset( new ACEFileHandler( complete_table_file_path.string(),
                                             table_name,
                                             file_start_line,
-                                            true ) );
+                                            file_record_length == 0,
+                                            file_record_length,
+                                            file_entries_per_record ) );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "The S(A,B) table " << table_name <<
@@ -1178,12 +1281,20 @@ bool Xsdir::filterEntryLineByZAIDAndTableTypeKey(
     const size_t file_start_line =
       Xsdir::quickExtractFileStartLineFromEntryTokens( entry_tokens );
 
+    const size_t file_record_length =
+      Xsdir::quickExtractFileRecordLengthFromEntryTokens( entry_tokens );
+
+    const size_t file_entries_per_record =
+      Xsdir::quickExtractFileEntriesPerRecordFromEntryTokens( entry_tokens );
+
     std::set<ZAID> zaids;
 
     Xsdir::extractSABTableZaids( xsdir_path,
                                  relative_table_path,
                                  table_name,
                                  file_start_line,
+                                 file_record_length,
+                                 file_entries_per_record,
                                  zaids );
 
     if( zaids.find( zaid ) == zaids.end() )
@@ -1266,8 +1377,12 @@ void Xsdir::exportData( ScatteringCenterPropertiesDatabase& database ) const
                        data_table_keys,
                        std::placeholders::_1 );
 
+    // Binary tables are only exported if they can be read
+    LineFilterFunction readable_table_partial_line_filter_function =
+      &Xsdir::isTableReadableQuick;
+
     LineFilterFunction line_filter_function =
-      this->getStandardTableEntryLineFilterFunction( true, {table_type_key_partial_line_filter_function}, d_verbose );
+      this->getStandardTableEntryLineFilterFunction( false, {table_type_key_partial_line_filter_function, readable_table_partial_line_filter_function}, d_verbose );
 
     this->processXsdirFile( d_xsdir_path,
                             line_filter_function,
@@ -144,6 +144,14 @@ protected:
   static size_t extractFileStartLineFromEntryTokens(
                                 const std::vector<std::string>& entry_tokens );
 
+  //! Extract the file record length of the table (binary tables only)
+  static size_t extractFileRecordLengthFromEntryTokens(
+                                const std::vector<std::string>& entry_tokens );
+
+  //! Extract the file entries per record of the table (binary tables only)
+  static size_t extractFileEntriesPerRecordFromEntryTokens(
+                                const std::vector<std::string>& entry_tokens );
+
   //! Extract the table evaluation temperature from the entry tokens
   static Energy extractEvaluationTemperatureFromEntryTokens(
                                 const std::vector<std::string>& entry_tokens );
@@ -187,6 +195,18 @@ private:
   static size_t quickExtractFileStartLineFromEntryTokens(
                                 const std::vector<std::string>& entry_tokens );
 
+  // Extract (quickly) the file record length of the table
+  static size_t quickExtractFileRecordLengthFromEntryTokens(
+                                const std::vector<std::string>& entry_tokens );
+
+  // Extract (quickly) the file entries per record of the table
+  static size_t quickExtractFileEntriesPerRecordFromEntryTokens(
+                                const std::vector<std::string>& entry_tokens );
+
+  // Check (quickly) if the table can be read
+  static bool isTableReadableQuick(
+                                const std::vector<std::string>& entry_tokens );
+
   // Extract the table evaluation temperature from the entry tokens
   static Energy quickExtractEvaluationTemperatureFromEntryTokens(
                                 const std::vector<std::string>& entry_tokens );
@@ -196,6 +216,8 @@ private:
                                     const boost::filesystem::path& relative_sab_path,
                                     const std::string& table_name,
                                     const size_t file_start_line,
+                                    const size_t file_record_length,
+                                    const size_t file_entries_per_record,
                                     std::set<ZAID>& table_zaids );
 
   // Process the xsdir file  
@@ -281,6 +303,8 @@ private:
                                const Energy evaluation_temp,
                                const boost::filesystem::path& table_file_path,
                                const size_t file_start_line,
+                               const size_t file_record_length,
+                               const size_t file_entries_per_record,
                                const unsigned table_major_version,
                                const ACETableName& table_name ) const;
 
@@ -289,6 +313,8 @@ private:
                                  const Energy evaluation_temp,
                                  const boost::filesystem::path& table_file_path,
                                  const size_t file_start_line,
+                                 const size_t file_record_length,
+                                 const size_t file_entries_per_record,
                                  const unsigned table_major_version,
                                  const std::string& table_name ) const;
 
@@ -298,6 +324,8 @@ private:
                                 const double atomic_weight_ratio,
                                 const boost::filesystem::path& table_file_path,
                                 const size_t file_start_line,
+                                const size_t file_record_length,
+                                const size_t file_entries_per_record,
                                 const unsigned table_major_version,
                                 const ACETableName& table_name ) const;
 
@@ -307,6 +335,8 @@ private:
            const double atomic_weight_ratio,
            const boost::filesystem::path& table_file_path,
            const size_t file_start_line,
+           const size_t file_record_length,
+           const size_t file_entries_per_record,
            const std::tuple<std::string,unsigned,char> table_name_components ) const ;
 
   // Add photoatomic properties to the database
@@ -41,6 +41,8 @@ struct TestXsdir : public Data::Xsdir
   using Xsdir::extractAtomicWeightRatioFromEntryTokens;
   using Xsdir::extractPathFromEntryTokens;
   using Xsdir::extractFileStartLineFromEntryTokens;
+  using Xsdir::extractFileRecordLengthFromEntryTokens;
+  using Xsdir::extractFileEntriesPerRecordFromEntryTokens;
   using Xsdir::extractEvaluationTemperatureFromEntryTokens;
 };
 
@@ -701,6 +703,55 @@ FRENSIE_UNIT_TEST( Xsdir, extractFileStartLineFromEntryTokens )
   FRENSIE_CHECK_EQUAL( file_start_line, 7921 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the file record length can be extracted from the entry tokens
+FRENSIE_UNIT_TEST( Xsdir, extractFileRecordLengthFromEntryTokens )
+{
+  std::vector<std::string> entry_tokens;
+
+  TestXsdir::splitLineIntoEntryTokens( "atomic weight ratios", entry_tokens );
+
+  FRENSIE_CHECK_THROW( TestXsdir::extractFileRecordLengthFromEntryTokens( entry_tokens ),
+                       std::logic_error );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 1 4 17969 0 0 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractFileRecordLengthFromEntryTokens( entry_tokens ), 0 );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 2 1 17969 4096 512 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractFileRecordLengthFromEntryTokens( entry_tokens ), 4096 );
+
+  TestXsdir::splitLineIntoEntryTokens( " 61000.01e 143.667877 el 0 2 7921 478", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractFileRecordLengthFromEntryTokens( entry_tokens ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the file entries per record can be extracted from the entry
+// tokens
+FRENSIE_UNIT_TEST( Xsdir, extractFileEntriesPerRecordFromEntryTokens )
+{
+  std::vector<std::string> entry_tokens;
+
+  TestXsdir::splitLineIntoEntryTokens( "atomic weight ratios", entry_tokens );
+
+  FRENSIE_CHECK_THROW( TestXsdir::extractFileEntriesPerRecordFromEntryTokens( entry_tokens ),
+                       std::logic_error );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 1 4 17969 0 0 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractFileEntriesPerRecordFromEntryTokens( entry_tokens ), 0 );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 2 1 17969 4096 512 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractFileEntriesPerRecordFromEntryTokens( entry_tokens ), 512 );
+
+  TestXsdir::splitLineIntoEntryTokens( " 61000.01e 143.667877 el 0 2 7921 478", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractFileEntriesPerRecordFromEntryTokens( entry_tokens ), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the table evaluation temperature can be extracted from the entry
 // tokens
@@ -824,7 +875,7 @@ FRENSIE_UNIT_TEST( Xsdir, showEntriesWithTableData )
 
   FRENSIE_REQUIRE_EQUAL( output_lines.size(), 55 );
   FRENSIE_CHECK_EQUAL( output_lines.front(), "1001.80c 0.999167 h1.710nc 0 1 4 17969 0 0 2.5301E-08" );
-  FRENSIE_CHECK_EQUAL( output_lines[24], " 3006.70c 5.963400 endf70a 0 0 57247 35859 0 0 2.5301E-08" );
+  FRENSIE_CHECK_EQUAL( output_lines[24], " 3006.70c 5.963400 endf70a 0 2 57247 35859 4096 512 2.5301E-08" );
   FRENSIE_CHECK_EQUAL( output_lines[25], " 13027.24y 26.750000 531dos 0 1 1 1165" );
   FRENSIE_CHECK_EQUAL( output_lines[53], " 90000.04p    230.045000  mcplib04 0 1   163774    10565 0 0 0.00000E+00" );
 }
@@ -865,7 +916,7 @@ FRENSIE_UNIT_TEST( Xsdir, showEntriesWithTableTypeKey )
 
   FRENSIE_REQUIRE_EQUAL( output_lines.size(), 26 );
   FRENSIE_CHECK_EQUAL( output_lines.front(), "1001.80c 0.999167 h1.710nc 0 1 4 17969 0 0 2.5301E-08" );
-  FRENSIE_CHECK_EQUAL( output_lines[24], " 3006.70c 5.963400 endf70a 0 0 57247 35859 0 0 2.5301E-08" );
+  FRENSIE_CHECK_EQUAL( output_lines[24], " 3006.70c 5.963400 endf70a 0 2 57247 35859 4096 512 2.5301E-08" );
 
   oss.str( "" );
   oss.clear();
@@ -1037,7 +1088,7 @@ FRENSIE_UNIT_TEST( Xsdir, showEntriesWithTableTypeKeyAndVersion )
 
   FRENSIE_REQUIRE_EQUAL( output_lines.size(), 14 );
   FRENSIE_CHECK_EQUAL( output_lines[0], " 1001.70c 0.999167 endf70a 0 1 1 8177 0 0 2.5301E-08" );
-  FRENSIE_CHECK_EQUAL( output_lines[12], " 3006.70c 5.963400 endf70a 0 0 57247 35859 0 0 2.5301E-08" );
+  FRENSIE_CHECK_EQUAL( output_lines[12], " 3006.70c 5.963400 endf70a 0 2 57247 35859 4096 512 2.5301E-08" );
 
   oss.str( "" );
   oss.clear();
@@ -1977,10 +2028,33 @@ FRENSIE_UNIT_TEST( Xsdir, exportData )
   FRENSIE_CHECK( !database.doNuclidePropertiesExist( 2009 ) );
   FRENSIE_CHECK( !database.doNuclidePropertiesExist( 2010 ) );
 
-  // There is an entry in the test xsdir file for Li6 - it should be ignored
-  // since the entry states that the table is binary, which is not currently
-  // supported
-  FRENSIE_CHECK( !database.doNuclidePropertiesExist( 3006 ) );
+  // Check the Li atom properties
+  FRENSIE_CHECK( !database.doAtomPropertiesExist( 3000 ) );
+
+  // Check the Li6 nuclide properties (stored in a binary table)
+  FRENSIE_REQUIRE( database.doNuclidePropertiesExist( 3006 ) );
+
+  {
+    const Data::NuclideProperties& nuclide_properties =
+      database.getNuclideProperties( 3006 );
+
+    FRENSIE_REQUIRE( nuclide_properties.nuclearDataAvailable( Data::NuclearDataProperties::ACE_FILE, 7, 2.5301E-08*MeV ) );
+
+    const Data::NuclearDataProperties* nuclear_properties =
+      &nuclide_properties.getNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.5301E-08*MeV,
+                                         true );
+
+    FRENSIE_CHECK_EQUAL( nuclear_properties->filePath().string(), "endf70a" );
+    FRENSIE_CHECK_EQUAL( nuclear_properties->fileStartLine(), 57247 );
+    FRENSIE_CHECK_EQUAL( nuclear_properties->fileRecordLength(), 4096 );
+    FRENSIE_CHECK_EQUAL( nuclear_properties->fileEntriesPerRecord(), 512 );
+    FRENSIE_CHECK_EQUAL( nuclear_properties->tableName(), "3006.70c" );
+  }
+
+  FRENSIE_CHECK( !database.doNuclidePropertiesExist( 3007 ) );
 
   // Check the Be atom properties
   FRENSIE_CHECK( !database.doAtomPropertiesExist( 4000 ) );
@@ -167,6 +167,9 @@ public:
   //! Check if the model has been initialized
   virtual bool isInitialized() const = 0;  
 
+  //! Log the navigation statistics collected by the model
+  virtual void logNavigationSummary() const;
+
 protected:
 
   //! Initialize the model just-in-time
@@ -202,6 +205,12 @@ inline Geometry::Navigator* Model::createNavigatorAdvanced() const
   return this->createNavigatorAdvanced( Navigator::AdvanceCompleteCallback() );
 }
 
+// Log the navigation statistics collected by the model
+/*! \details The base model does not collect any navigation statistics.
+ */
+inline void Model::logNavigationSummary() const
+{ /* ... */ }
+
 // Create a navigator
 inline std::shared_ptr<Geometry::Navigator> Model::createNavigator(
              const Navigator::AdvanceCompleteCallback& advance_callback ) const
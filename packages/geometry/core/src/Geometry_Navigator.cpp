@@ -11,6 +11,7 @@
 
 // FRENSIE Includes
 #include "Geometry_Navigator.hpp"
+#include "Utility_MemoryBlockPool.hpp"
 
 namespace Geometry{
 
@@ -28,6 +29,13 @@ Navigator::Navigator( const Navigator& other )
   : d_on_advance_complete( other.d_on_advance_complete )
 { /* ... */ }
 
+// Fire the internal ray if the boundary could be within the distance
+auto Navigator::fireRayIfBoundaryIsWithin( const Length,
+                                           EntityId* surface_hit ) -> Length
+{
+  return this->fireRay( surface_hit );
+}
+
 // The invalid cell id
 auto Navigator::invalidCellId() -> EntityId
 {
@@ -40,6 +48,59 @@ auto Navigator::invalidSurfaceId() -> EntityId
   return 0;
 }
 
+// Allocate the memory of a navigator (from the thread's navigator pool)
+/*! \details Every particle state owns a navigator, so a navigator is
+ * created and destroyed with every secondary particle. The navigators of
+ * the particles that a thread destroys are recycled through the thread's
+ * pool so that the navigators of the secondaries that it creates do not
+ * need to go back to the heap.
+ */
+void* Navigator::operator new( const size_t size )
+{
+  Utility::MemoryBlockPool* pool =
+    Utility::MemoryBlockPool::getThreadPool<Navigator>();
+
+  if( pool )
+    return pool->allocate( size );
+  else
+    return ::operator new( size );
+}
+
+// Return the memory of a navigator to the thread's navigator pool
+/*! \details The destructor is virtual so the size will always be the size
+ * of the concrete navigator type.
+ */
+void Navigator::operator delete( void* navigator, const size_t size ) noexcept
+{
+  Utility::MemoryBlockPool* pool =
+    Utility::MemoryBlockPool::getThreadPool<Navigator>();
+
+  if( pool )
+  {
+    try{
+      pool->deallocate( navigator, size );
+    }
+    catch( ... )
+    {
+      ::operator delete( navigator );
+    }
+  }
+  else
+    ::operator delete( navigator );
+}
+
+// Return the number of navigator memory blocks in the thread's pool
+size_t Navigator::getNumberOfPooledNavigators()
+{
+  Utility::MemoryBlockPool* pool =
+    Utility::MemoryBlockPool::getThreadPool<Navigator>();
+
+  if( pool )
+    return pool->getNumberOfFreeBlocks();
+  else
+    return 0;
+}
+
 } // end Geometry namespace
 
 //---------------------------------------------------------------------------//
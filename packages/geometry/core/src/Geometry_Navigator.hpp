@@ -245,6 +245,32 @@ public:
    */
   Length fireRay();
 
+  /*! Fire the internal ray if the boundary could be within the distance
+   *
+   * If the navigator can show that the closest boundary in all directions
+   * is further than the distance without firing the ray, infinity will be
+   * returned and the surface hit will not be set. The default
+   * implementation always fires the ray. A std::runtime_error (or class
+   * derived from it) must be thrown if a ray tracing error occurs.
+   */
+  virtual Length fireRayIfBoundaryIsWithin( const Length distance,
+                                            EntityId* surface_hit );
+
+  /*! Fire the internal ray if the boundary could be within the distance
+   *
+   * A std::runtime_error (or class derived from it) must be thrown if a ray
+   * tracing error occurs.
+   */
+  Length fireRayIfBoundaryIsWithin( const Length distance,
+                                    EntityId& surface_hit );
+
+  /*! Fire the internal ray if the boundary could be within the distance
+   *
+   * A std::runtime_error (or class derived from it) must be thrown if a ray
+   * tracing error occurs.
+   */
+  Length fireRayIfBoundaryIsWithin( const Length distance );
+
   /*! Advance the internal ray to the cell boundary
    *
    * If a reflecting surface is hit "true" will be returned. Passing NULL
@@ -288,6 +314,15 @@ public:
    */
   virtual Navigator* clone() const = 0;
 
+  //! Allocate the memory of a navigator (from the thread's navigator pool)
+  static void* operator new( const size_t size );
+
+  //! Return the memory of a navigator to the thread's navigator pool
+  static void operator delete( void* navigator, const size_t size ) noexcept;
+
+  //! Return the number of navigator memory blocks in the thread's pool
+  static size_t getNumberOfPooledNavigators();
+
 protected:
 
   //! Copy constructor
@@ -394,6 +429,21 @@ inline auto Navigator::fireRay() -> Length
   return this->fireRay( NULL );
 }
 
+// Fire the internal ray if the boundary could be within the distance
+inline auto Navigator::fireRayIfBoundaryIsWithin( const Length distance,
+                                                  EntityId& surface_hit )
+  -> Length
+{
+  return this->fireRayIfBoundaryIsWithin( distance, &surface_hit );
+}
+
+// Fire the internal ray if the boundary could be within the distance
+inline auto Navigator::fireRayIfBoundaryIsWithin( const Length distance )
+  -> Length
+{
+  return this->fireRayIfBoundaryIsWithin( distance, NULL );
+}
+
 // Advance the internal ray to the cell boundary
 inline bool Navigator::advanceToCellBoundary( double* surface_normal )
 {
@@ -488,6 +488,38 @@ FRENSIE_UNIT_TEST( InfiniteMediumNavigator, clone )
   FRENSIE_CHECK_EQUAL( number_of_advances, 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the memory of a destroyed navigator is reused by the next clone
+FRENSIE_UNIT_TEST( InfiniteMediumNavigator, clone_pooled )
+{
+  std::unique_ptr<Geometry::Navigator>
+    navigator( new Geometry::InfiniteMediumNavigator( 1 ) );
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  std::unique_ptr<Geometry::Navigator> navigator_clone( navigator->clone() );
+
+  const Geometry::Navigator* destroyed_navigator = navigator_clone.get();
+
+  const size_t number_of_pooled_navigators =
+    Geometry::Navigator::getNumberOfPooledNavigators();
+
+  navigator_clone.reset();
+
+  FRENSIE_CHECK_EQUAL( Geometry::Navigator::getNumberOfPooledNavigators(),
+                       number_of_pooled_navigators + 1 );
+
+  navigator_clone.reset( navigator->clone() );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone.get(), destroyed_navigator );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 1 );
+  FRENSIE_CHECK_EQUAL( Geometry::Navigator::getNumberOfPooledNavigators(),
+                       number_of_pooled_navigators );
+}
+
 // //---------------------------------------------------------------------------//
 // // Check that the navigator can be archived
 // FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( InfiniteMediumNavigator,
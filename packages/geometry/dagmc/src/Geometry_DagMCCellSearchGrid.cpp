@@ -0,0 +1,367 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_DagMCCellSearchGrid.cpp
+//! \author Alex Robinson
+//! \brief  The DagMC cell search grid class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellSearchGrid.hpp"
+#include "Utility_MOABException.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const size_t DagMCCellSearchGrid::s_max_grid_dimension = 64;
+const double DagMCCellSearchGrid::s_relative_padding = 1e-6;
+
+// Constructor
+DagMCCellSearchGrid::DagMCCellSearchGrid(
+                                      const moab::DagMC* dagmc_instance,
+                                      const DagMCCellHandler& cell_handler )
+  : d_bounding_boxes(),
+    d_unbounded_cells(),
+    d_neighbors(),
+    d_grid_lower_bounds( {0.0, 0.0, 0.0} ),
+    d_inverse_grid_element_widths( {0.0, 0.0, 0.0} ),
+    d_grid_dimensions( {1, 1, 1} ),
+    d_grid_elements(),
+    d_no_cells()
+{
+  // Make sure the DagMC instance is valid
+  testPrecondition( dagmc_instance != NULL );
+
+  moab::DagMC* nonconst_dagmc_instance =
+    const_cast<moab::DagMC*>( dagmc_instance );
+
+  this->extractBoundingBoxes( *nonconst_dagmc_instance, cell_handler );
+
+  this->extractNeighbors( *nonconst_dagmc_instance, cell_handler );
+
+  this->constructGrid();
+}
+
+// Extract the cell bounding boxes
+/*! \details The implicit complement encloses every other cell so it is
+ * never bounded.
+ */
+void DagMCCellSearchGrid::extractBoundingBoxes(
+                                         moab::DagMC& dagmc_instance,
+                                         const DagMCCellHandler& cell_handler )
+{
+  moab::Range::const_iterator cell_handle_it = cell_handler.begin();
+
+  while( cell_handle_it != cell_handler.end() )
+  {
+    if( dagmc_instance.is_implicit_complement( *cell_handle_it ) )
+      d_unbounded_cells.push_back( *cell_handle_it );
+    else
+    {
+      BoundingBox bounding_box;
+
+      moab::ErrorCode return_value =
+        dagmc_instance.getobb( *cell_handle_it,
+                               bounding_box.data(),
+                               bounding_box.data()+3 );
+
+      TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                          Utility::MOABException,
+                          moab::ErrorCodeStr[return_value] );
+
+      d_bounding_boxes[*cell_handle_it] = bounding_box;
+    }
+
+    ++cell_handle_it;
+  }
+}
+
+// Extract the cell neighbors
+/*! \details The surfaces of a cell are its child sets and the cells on
+ * either side of a surface are its parent sets.
+ */
+void DagMCCellSearchGrid::extractNeighbors(
+                                         moab::DagMC& dagmc_instance,
+                                         const DagMCCellHandler& cell_handler )
+{
+  moab::Interface* moab_instance = dagmc_instance.moab_instance();
+
+  moab::Range::const_iterator cell_handle_it = cell_handler.begin();
+
+  while( cell_handle_it != cell_handler.end() )
+  {
+    std::vector<moab::EntityHandle> surface_handles;
+
+    moab::ErrorCode return_value =
+      moab_instance->get_child_meshsets( *cell_handle_it, surface_handles );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        Utility::MOABException,
+                        moab::ErrorCodeStr[return_value] );
+
+    CellHandleArray& neighbors = d_neighbors[*cell_handle_it];
+
+    for( size_t i = 0; i < surface_handles.size(); ++i )
+    {
+      std::vector<moab::EntityHandle> surface_cell_handles;
+
+      return_value = moab_instance->get_parent_meshsets( surface_handles[i],
+                                                         surface_cell_handles );
+
+      TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                          Utility::MOABException,
+                          moab::ErrorCodeStr[return_value] );
+
+      for( size_t j = 0; j < surface_cell_handles.size(); ++j )
+      {
+        if( surface_cell_handles[j] != *cell_handle_it &&
+            cell_handler.doesCellHandleExist( surface_cell_handles[j] ) )
+          neighbors.push_back( surface_cell_handles[j] );
+      }
+    }
+
+    std::sort( neighbors.begin(), neighbors.end() );
+
+    neighbors.erase( std::unique( neighbors.begin(), neighbors.end() ),
+                     neighbors.end() );
+
+    ++cell_handle_it;
+  }
+}
+
+// Construct the grid
+/*! \details The grid elements are roughly cubic and there are about as many
+ * grid elements as there are bounded cells.
+ */
+void DagMCCellSearchGrid::constructGrid()
+{
+  if( d_bounding_boxes.empty() )
+  {
+    d_grid_elements.resize( 1 );
+
+    return;
+  }
+
+  // Find the bounding box of the model
+  BoundingBox model_bounding_box =
+    {std::numeric_limits<double>::max(),
+     std::numeric_limits<double>::max(),
+     std::numeric_limits<double>::max(),
+     std::numeric_limits<double>::lowest(),
+     std::numeric_limits<double>::lowest(),
+     std::numeric_limits<double>::lowest()};
+
+  for( auto&& bounding_box : d_bounding_boxes )
+  {
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      model_bounding_box[i] =
+        std::min( model_bounding_box[i], bounding_box.second[i] );
+
+      model_bounding_box[i+3] =
+        std::max( model_bounding_box[i+3], bounding_box.second[i+3] );
+    }
+  }
+
+  // Pad the bounding boxes so that points on a cell boundary are not missed
+  double max_extent = 0.0;
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    max_extent = std::max( max_extent,
+                           model_bounding_box[i+3] - model_bounding_box[i] );
+  }
+
+  const double padding = std::max( s_relative_padding*max_extent,
+                                   std::numeric_limits<double>::min() );
+
+  for( auto&& bounding_box : d_bounding_boxes )
+  {
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      bounding_box.second[i] -= padding;
+      bounding_box.second[i+3] += padding;
+    }
+  }
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    model_bounding_box[i] -= padding;
+    model_bounding_box[i+3] += padding;
+  }
+
+  // Size the grid elements
+  double model_volume = 1.0;
+
+  for( unsigned i = 0; i < 3; ++i )
+    model_volume *= model_bounding_box[i+3] - model_bounding_box[i];
+
+  const double element_width =
+    std::cbrt( model_volume/d_bounding_boxes.size() );
+
+  size_t number_of_grid_elements = 1;
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    const double extent = model_bounding_box[i+3] - model_bounding_box[i];
+
+    d_grid_dimensions[i] = static_cast<size_t>( std::ceil( extent/element_width ) );
+
+    d_grid_dimensions[i] = std::max( d_grid_dimensions[i], (size_t)1 );
+    d_grid_dimensions[i] = std::min( d_grid_dimensions[i],
+                                     s_max_grid_dimension );
+
+    d_grid_lower_bounds[i] = model_bounding_box[i];
+    d_inverse_grid_element_widths[i] = d_grid_dimensions[i]/extent;
+
+    number_of_grid_elements *= d_grid_dimensions[i];
+  }
+
+  // Bin the cells
+  d_grid_elements.resize( number_of_grid_elements );
+
+  for( auto&& bounding_box : d_bounding_boxes )
+  {
+    size_t lower_indices[3], upper_indices[3];
+
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      lower_indices[i] = this->getGridIndex( bounding_box.second[i], i );
+      upper_indices[i] = this->getGridIndex( bounding_box.second[i+3], i );
+    }
+
+    for( size_t k = lower_indices[2]; k <= upper_indices[2]; ++k )
+    {
+      for( size_t j = lower_indices[1]; j <= upper_indices[1]; ++j )
+      {
+        for( size_t i = lower_indices[0]; i <= upper_indices[0]; ++i )
+        {
+          d_grid_elements[i + d_grid_dimensions[0]*(j + d_grid_dimensions[1]*k)].push_back( bounding_box.first );
+        }
+      }
+    }
+  }
+
+  // Test the smallest cells first since they are the cheapest to test
+  auto bounding_box_volume = [this]( const moab::EntityHandle cell_handle ){
+    const BoundingBox& bounding_box = d_bounding_boxes.find( cell_handle )->second;
+
+    return (bounding_box[3] - bounding_box[0])*
+      (bounding_box[4] - bounding_box[1])*
+      (bounding_box[5] - bounding_box[2]);
+  };
+
+  for( size_t i = 0; i < d_grid_elements.size(); ++i )
+  {
+    std::sort( d_grid_elements[i].begin(),
+               d_grid_elements[i].end(),
+               [&bounding_box_volume]( const moab::EntityHandle cell_a,
+                                       const moab::EntityHandle cell_b ){
+                 return bounding_box_volume( cell_a ) <
+                   bounding_box_volume( cell_b ); } );
+
+    d_grid_elements[i].shrink_to_fit();
+  }
+}
+
+// Get the grid element index along an axis
+/*! \details Coordinates outside of the grid are clamped to the nearest grid
+ * element.
+ */
+size_t DagMCCellSearchGrid::getGridIndex( const double coordinate,
+                                          const unsigned axis ) const
+{
+  const double scaled_coordinate =
+    (coordinate - d_grid_lower_bounds[axis])*
+    d_inverse_grid_element_widths[axis];
+
+  if( scaled_coordinate <= 0.0 )
+    return 0;
+  else if( scaled_coordinate >= d_grid_dimensions[axis] )
+    return d_grid_dimensions[axis] - 1;
+  else
+    return static_cast<size_t>( scaled_coordinate );
+}
+
+// Get the number of grid elements along each axis
+const std::array<size_t,3>& DagMCCellSearchGrid::getGridDimensions() const
+{
+  return d_grid_dimensions;
+}
+
+// Get the cells whose bounding boxes overlap the grid element with the point
+/*! \details An empty array will be returned if the point is outside of the
+ * grid. The cells are ordered by the volume of their bounding boxes.
+ */
+auto DagMCCellSearchGrid::getCandidateCellHandles(
+                            const double position[3] ) const
+  -> const CellHandleArray&
+{
+  size_t indices[3];
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    const double scaled_coordinate =
+      (position[i] - d_grid_lower_bounds[i])*d_inverse_grid_element_widths[i];
+
+    if( scaled_coordinate < 0.0 || scaled_coordinate > d_grid_dimensions[i] )
+      return d_no_cells;
+
+    indices[i] = this->getGridIndex( position[i], i );
+  }
+
+  return d_grid_elements[indices[0] + d_grid_dimensions[0]*(indices[1] + d_grid_dimensions[1]*indices[2])];
+}
+
+// Get the cells that do not have a bounding box
+auto DagMCCellSearchGrid::getUnboundedCellHandles() const
+  -> const CellHandleArray&
+{
+  return d_unbounded_cells;
+}
+
+// Get the cells that share a surface with the cell
+auto DagMCCellSearchGrid::getNeighborCellHandles(
+                            const moab::EntityHandle cell_handle ) const
+  -> const CellHandleArray&
+{
+  std::unordered_map<moab::EntityHandle,CellHandleArray>::const_iterator
+    neighbors_it = d_neighbors.find( cell_handle );
+
+  if( neighbors_it != d_neighbors.end() )
+    return neighbors_it->second;
+  else
+    return d_no_cells;
+}
+
+// Check if a point is inside of the bounding box of a cell
+/*! \details Unbounded cells are considered to contain every point.
+ */
+bool DagMCCellSearchGrid::isPointInBoundingBox(
+                                  const double position[3],
+                                  const moab::EntityHandle cell_handle ) const
+{
+  std::unordered_map<moab::EntityHandle,BoundingBox>::const_iterator
+    bounding_box_it = d_bounding_boxes.find( cell_handle );
+
+  if( bounding_box_it == d_bounding_boxes.end() )
+    return true;
+
+  const BoundingBox& bounding_box = bounding_box_it->second;
+
+  return position[0] >= bounding_box[0] && position[0] <= bounding_box[3] &&
+    position[1] >= bounding_box[1] && position[1] <= bounding_box[4] &&
+    position[2] >= bounding_box[2] && position[2] <= bounding_box[5];
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_DagMCCellSearchGrid.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,126 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_DagMCCellSearchGrid.hpp
+//! \author Alex Robinson
+//! \brief  The DagMC cell search grid class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_DAGMC_CELL_SEARCH_GRID_HPP
+#define GEOMETRY_DAGMC_CELL_SEARCH_GRID_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <array>
+#include <unordered_map>
+
+// Moab Includes
+#include <DagMC.hpp>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellHandler.hpp"
+
+namespace Geometry{
+
+//! The DagMC cell search grid
+/*! \details The axis-aligned bounding box of every cell is binned on a
+ * uniform grid that covers the model. The grid element containing a point
+ * stores the (small) set of cells whose bounding boxes overlap it, which
+ * is used to prune the cells that must be tested with an expensive
+ * point-in-volume query when the cell containing a point is unknown. The
+ * cells that are adjacent to each cell (cells that share a surface) are
+ * also stored so that searches can start from the last known cell. Cells
+ * that cannot be bounded (e.g. the implicit complement) must always be
+ * tested.
+ */
+class DagMCCellSearchGrid
+{
+
+public:
+
+  //! The cell handle array type
+  typedef std::vector<moab::EntityHandle> CellHandleArray;
+
+  //! Constructor
+  DagMCCellSearchGrid( const moab::DagMC* dagmc_instance,
+                       const DagMCCellHandler& cell_handler );
+
+  //! Destructor
+  ~DagMCCellSearchGrid()
+  { /* ... */ }
+
+  //! Get the number of grid elements along each axis
+  const std::array<size_t,3>& getGridDimensions() const;
+
+  //! Get the cells whose bounding boxes overlap the grid element with the point
+  const CellHandleArray& getCandidateCellHandles(
+                                           const double position[3] ) const;
+
+  //! Get the cells that do not have a bounding box
+  const CellHandleArray& getUnboundedCellHandles() const;
+
+  //! Get the cells that share a surface with the cell
+  const CellHandleArray& getNeighborCellHandles(
+                                  const moab::EntityHandle cell_handle ) const;
+
+  //! Check if a point is inside of the bounding box of a cell
+  bool isPointInBoundingBox( const double position[3],
+                             const moab::EntityHandle cell_handle ) const;
+
+private:
+
+  // The bounding box type (x_min, y_min, z_min, x_max, y_max, z_max)
+  typedef std::array<double,6> BoundingBox;
+
+  // Extract the cell bounding boxes
+  void extractBoundingBoxes( moab::DagMC& dagmc_instance,
+                             const DagMCCellHandler& cell_handler );
+
+  // Extract the cell neighbors
+  void extractNeighbors( moab::DagMC& dagmc_instance,
+                         const DagMCCellHandler& cell_handler );
+
+  // Construct the grid
+  void constructGrid();
+
+  // Get the grid element index along an axis
+  size_t getGridIndex( const double coordinate, const unsigned axis ) const;
+
+  // The maximum number of grid elements along each axis
+  static const size_t s_max_grid_dimension;
+
+  // The relative bounding box padding
+  static const double s_relative_padding;
+
+  // The cell bounding boxes
+  std::unordered_map<moab::EntityHandle,BoundingBox> d_bounding_boxes;
+
+  // The cells that do not have a bounding box
+  CellHandleArray d_unbounded_cells;
+
+  // The cell neighbors
+  std::unordered_map<moab::EntityHandle,CellHandleArray> d_neighbors;
+
+  // The lower corner of the grid
+  std::array<double,3> d_grid_lower_bounds;
+
+  // The inverse grid element widths
+  std::array<double,3> d_inverse_grid_element_widths;
+
+  // The number of grid elements along each axis
+  std::array<size_t,3> d_grid_dimensions;
+
+  // The cells whose bounding boxes overlap each grid element
+  std::vector<CellHandleArray> d_grid_elements;
+
+  // An empty cell handle array
+  CellHandleArray d_no_cells;
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_DAGMC_CELL_SEARCH_GRID_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_DagMCCellSearchGrid.hpp
+//---------------------------------------------------------------------------//
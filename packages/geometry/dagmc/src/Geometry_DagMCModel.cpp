@@ -28,7 +28,9 @@ namespace Geometry{
 
 // Default constructor
 DagMCModel::DagMCModel()
-  : d_dagmc( NULL )
+  : d_dagmc( NULL ),
+    d_number_of_ray_fires( 0 ),
+    d_number_of_avoided_ray_fires( 0 )
 { /* ... */ }
 
 // Constructor
@@ -37,9 +39,12 @@ DagMCModel::DagMCModel( const DagMCModelProperties& model_properties,
   : d_dagmc( NULL ),
     d_cell_handler(),
     d_surface_handler(),
+    d_cell_search_grid(),
     d_termination_cells(),
     d_reflecting_surfaces(),
-    d_model_properties( new DagMCModelProperties( model_properties ) )
+    d_model_properties( new DagMCModelProperties( model_properties ) ),
+    d_number_of_ray_fires( 0 ),
+    d_number_of_avoided_ray_fires( 0 )
 { 
   this->initialize( suppress_dagmc_output );
 }
@@ -100,6 +105,13 @@ void DagMCModel::initialize( const bool suppress_dagmc_output )
   EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
                            "Unable to construct the entity handlers!" );
 
+  // Construct the cell search grid
+  try{
+    this->constructCellSearchGrid();
+  }
+  EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
+                           "Unable to construct the cell search grid!" );
+
   // Extract the termination cells
   try{
     this->extractTerminationCells();
@@ -269,6 +281,18 @@ void DagMCModel::constructEntityHandlers()
   }
 }
 
+// Construct the cell search grid
+void DagMCModel::constructCellSearchGrid()
+{
+  try{
+    d_cell_search_grid.reset(
+                       new DagMCCellSearchGrid( d_dagmc, *d_cell_handler ) );
+  }
+  EXCEPTION_CATCH_RETHROW_AS( Utility::MOABException,
+                              InvalidDagMCGeometry,
+                              "Unable to set up the cell search grid!" );
+}
+
 // Extract the termination cells
 void DagMCModel::extractTerminationCells()
 {
@@ -960,6 +984,12 @@ const Geometry::DagMCSurfaceHandler& DagMCModel::getSurfaceHandler() const
   return *d_surface_handler;
 }
 
+// Return the cell search grid
+const Geometry::DagMCCellSearchGrid& DagMCModel::getCellSearchGrid() const
+{
+  return *d_cell_search_grid;
+}
+
 // Return the reflecting surfaces
 const DagMCNavigator::ReflectingSurfaceIdHandleMap&
 DagMCModel::getReflectingSurfaceIdHandleMap() const
@@ -973,6 +1003,37 @@ moab::DagMC& DagMCModel::getRawDagMCInstance() const
   return *d_dagmc;
 }
 
+// Get the number of ray fires done by destroyed navigators
+/*! \details Each navigator adds its ray fire counters to the model totals
+ * when it is destroyed so that the counters do not have to be shared
+ * between threads while tracking.
+ */
+unsigned long long DagMCModel::getNumberOfRayFires() const
+{
+  return d_number_of_ray_fires;
+}
+
+// Get the number of ray fires avoided by destroyed navigators
+unsigned long long DagMCModel::getNumberOfAvoidedRayFires() const
+{
+  return d_number_of_avoided_ray_fires;
+}
+
+// Log the ray fire counts of destroyed navigators
+/*! \details Navigators that are still alive have not added their counters
+ * to the model totals yet.
+ */
+void DagMCModel::logNavigationSummary() const
+{
+  const unsigned long long number_of_ray_fires = d_number_of_ray_fires;
+  const unsigned long long number_of_avoided_ray_fires =
+    d_number_of_avoided_ray_fires;
+
+  FRENSIE_LOG_DAGMC_NOTIFICATION( "Ray fires: " << number_of_ray_fires
+                                  << ", avoided ray fires: "
+                                  << number_of_avoided_ray_fires );
+}
+
 EXPLICIT_CLASS_SAVE_LOAD_INST( DagMCModel );
 
 }  // end Geometry namespace
@@ -14,6 +14,7 @@
 #include <stdexcept>
 #include <iostream>
 #include <memory>
+#include <atomic>
 
 // Moab Includes
 #include <DagMC.hpp>
@@ -22,6 +23,7 @@
 #include "Geometry_DagMCModelProperties.hpp"
 #include "Geometry_DagMCCellHandler.hpp"
 #include "Geometry_DagMCSurfaceHandler.hpp"
+#include "Geometry_DagMCCellSearchGrid.hpp"
 #include "Geometry_DagMCNavigator.hpp"
 #include "Geometry_PointLocation.hpp"
 #include "Geometry_AdvancedModel.hpp"
@@ -113,6 +115,15 @@ public:
   //! Create a raw, heap-allocated navigator
   DagMCNavigator* createNavigatorAdvanced() const override;
 
+  //! Get the number of ray fires done by destroyed navigators
+  unsigned long long getNumberOfRayFires() const;
+
+  //! Get the number of ray fires avoided by destroyed navigators
+  unsigned long long getNumberOfAvoidedRayFires() const;
+
+  //! Log the ray fire counts of destroyed navigators
+  void logNavigationSummary() const override;
+
   //! Check if the model has been initialized
   bool isInitialized() const final override;
 
@@ -156,6 +167,9 @@ private:
   // Construct the entity handlers
   void constructEntityHandlers();
 
+  // Construct the cell search grid
+  void constructCellSearchGrid();
+
   // Extract the termination cells
   void extractTerminationCells();
 
@@ -210,6 +224,9 @@ private:
   //! Return the surface handler
   const Geometry::DagMCSurfaceHandler& getSurfaceHandler() const;
 
+  //! Return the cell search grid
+  const Geometry::DagMCCellSearchGrid& getCellSearchGrid() const;
+
   //! Return the reflecting surfaces
   const DagMCNavigator::ReflectingSurfaceIdHandleMap&
   getReflectingSurfaceIdHandleMap() const;
@@ -245,6 +262,9 @@ private:
   // The DagMC surface handle
   std::unique_ptr<const Geometry::DagMCSurfaceHandler> d_surface_handler;
 
+  // The DagMC cell search grid
+  std::unique_ptr<const Geometry::DagMCCellSearchGrid> d_cell_search_grid;
+
   // The termination cells
   CellIdSet d_termination_cells;
 
@@ -255,6 +275,12 @@ private:
 
   // The model properties
   std::unique_ptr<const DagMCModelProperties> d_model_properties;
+
+  // The number of ray fires done by destroyed navigators
+  mutable std::atomic<unsigned long long> d_number_of_ray_fires;
+
+  // The number of ray fires avoided by destroyed navigators
+  mutable std::atomic<unsigned long long> d_number_of_avoided_ray_fires;
 };
 
 //! The invalid DagMC geometry error
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <sstream>
+#include <limits>
 
 // FRENSIE Includes
 #include "Geometry_DagMCNavigator.hpp"
@@ -25,6 +26,8 @@ const double DagMCNavigator::s_boundary_tol = 1e-5;
 
 // Default constructor
 DagMCNavigator::DagMCNavigator()
+  : d_number_of_ray_fires( 0 ),
+    d_number_of_avoided_ray_fires( 0 )
 { /* ... */ }
 
 // Constructor
@@ -33,21 +36,39 @@ DagMCNavigator::DagMCNavigator(
           const Navigator::AdvanceCompleteCallback& advance_complete_callback )
   : Navigator( advance_complete_callback ),
     d_dagmc_model( dagmc_model ),
-    d_internal_ray()
+    d_internal_ray(),
+    d_number_of_ray_fires( 0 ),
+    d_number_of_avoided_ray_fires( 0 )
 {
   // Make sure that the dagmc instance is valid
   testPrecondition( dagmc_model.get() );
 }
 
 // Copy constructor
-/*! \details This constructor should only be used by the clone method.
+/*! \details This constructor should only be used by the clone method. The
+ * ray fire counters of the clone will start at zero.
  */
 DagMCNavigator::DagMCNavigator( const DagMCNavigator& other )
   : Navigator( other ),
     d_dagmc_model( other.d_dagmc_model ),
-    d_internal_ray( other.d_internal_ray )
+    d_internal_ray( other.d_internal_ray ),
+    d_number_of_ray_fires( 0 ),
+    d_number_of_avoided_ray_fires( 0 )
 { /* ... */ }
 
+// Destructor
+/*! \details The ray fire counters will be added to the model totals.
+ */
+DagMCNavigator::~DagMCNavigator()
+{
+  if( d_dagmc_model )
+  {
+    d_dagmc_model->d_number_of_ray_fires += d_number_of_ray_fires;
+    d_dagmc_model->d_number_of_avoided_ray_fires +=
+      d_number_of_avoided_ray_fires;
+  }
+}
+
 // Get the point location w.r.t. a given cell
 /*! \details This function will only return if a point is inside of or
  * outside of the cell of interest (not on the cell). The ray direction will be
@@ -203,9 +224,16 @@ void DagMCNavigator::setState( const Length x_position,
   // Make sure that the direction is valid
   testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
 
+  // Start the search from the current cell if there is one
+  moab::EntityHandle start_cell_handle = 0;
+
+  if( this->isStateSet() )
+    start_cell_handle = d_internal_ray.getCurrentCell();
+
   moab::EntityHandle cell_handle =
     this->findCellHandleContainingRay( x_position, y_position, z_position,
-                                       x_direction, y_direction, z_direction );
+                                       x_direction, y_direction, z_direction,
+                                       false, start_cell_handle );
 
   this->setStateWithCellHandle( x_position, y_position, z_position,
                                 x_direction, y_direction, z_direction,
@@ -270,6 +298,10 @@ auto DagMCNavigator::getCurrentCell() const -> EntityId
 }
 
 // Get the distance from the internal DagMC ray pos. to the nearest boundary in all directions
+/*! \details The distance will be cached in the internal ray so that
+ * subsequent ray fires can be avoided while the ray stays inside of the
+ * safety sphere.
+ */
 auto DagMCNavigator::getDistanceToClosestBoundary() -> Length
 {
   // Make sure that the ray is set
@@ -301,10 +333,16 @@ auto DagMCNavigator::getDistanceToClosestBoundary() -> Length
                "  Position: "
                << this->arrayToString( d_internal_ray.getPosition() ) );
 
+  // Cache the safety distance in the ray
+  d_internal_ray.setSafetyDistance( raw_distance_to_surface );
+
   return Length::from_value(raw_distance_to_surface);
 }
 
 // Get the distance from the internal DagMC ray pos. to the nearest boundary
+/*! \details The ray will only be fired if it has not been fired since the
+ * last change of state (the result of the last ray fire is cached).
+ */
 auto DagMCNavigator::fireRay( EntityId* surface_hit ) -> Length
 {
   // Make sure that the ray is set
@@ -341,11 +379,57 @@ auto DagMCNavigator::fireRay( EntityId* surface_hit ) -> Length
     // Cache the surface data in the ray
     d_internal_ray.setIntersectionSurfaceData( surface_hit_handle,
                                                distance_to_surface.value() );
+
+    ++d_number_of_ray_fires;
   }
 
   return distance_to_surface;
 }
 
+// Fire the internal DagMC ray if the boundary could be within the distance
+/*! \details If the intersection surface is already known it will be
+ * returned. Otherwise the (cached) safety distance will be used to determine
+ * if a ray fire can be avoided. The safety distance will not be computed
+ * when the ray is on a cell boundary since it is zero there.
+ */
+auto DagMCNavigator::fireRayIfBoundaryIsWithin( const Length distance,
+                                                EntityId* surface_hit )
+  -> Length
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the distance is valid
+  testPrecondition( distance.value() >= 0.0 );
+
+  if( !d_internal_ray.knowsIntersectionSurface() &&
+      !d_internal_ray.isOnBoundary() )
+  {
+    if( !d_internal_ray.knowsSafetyDistance() )
+      this->getDistanceToClosestBoundary();
+
+    if( d_internal_ray.getSafetyDistance() > distance.value() )
+    {
+      ++d_number_of_avoided_ray_fires;
+
+      return Length::from_value( std::numeric_limits<double>::infinity() );
+    }
+  }
+
+  return this->fireRay( surface_hit );
+}
+
+// Get the number of ray fires
+unsigned long long DagMCNavigator::getNumberOfRayFires() const
+{
+  return d_number_of_ray_fires;
+}
+
+// Get the number of ray fires that were avoided
+unsigned long long DagMCNavigator::getNumberOfAvoidedRayFires() const
+{
+  return d_number_of_avoided_ray_fires;
+}
+
 // Advance the internal DagMC ray to the next boundary
 /*! \details Upon reaching the boundary the internal ray will enter the
  * boundary cell if the boundary surface is not a reflecting surface. The
@@ -359,8 +443,10 @@ bool DagMCNavigator::advanceToCellBoundaryImpl( double* surface_normal,
 {
   // Make sure that the ray is set
   testPrecondition( this->isStateSet() );
-  // Make sure that the instersection surface is know
-  testPrecondition( d_internal_ray.knowsIntersectionSurface() );
+
+  // Fire the ray if the intersection surface is not known yet
+  if( !d_internal_ray.knowsIntersectionSurface() )
+    Navigator::fireRay();
 
   bool reflecting_boundary = false;
 
@@ -398,7 +484,6 @@ bool DagMCNavigator::advanceToCellBoundaryImpl( double* surface_normal,
                                 local_surface_normal,
                                 reflected_direction );
 
-    // This will also fire a ray to fill the new intersection data
     this->changeDirection( reflected_direction[0],
                            reflected_direction[1],
                            reflected_direction[2],
@@ -425,15 +510,15 @@ bool DagMCNavigator::advanceToCellBoundaryImpl( double* surface_normal,
     }
   }
 
-  // Fire the ray so that the new intersection data is set
-  Navigator::fireRay();
-
+  // The ray will not be fired until the new intersection data is requested
   return reflecting_boundary;
 }
 
 // Advance the internal DagMC ray a substep
 /*! \details The substep distance must be less than the distance to the
- * intersection surface.
+ * intersection surface. If the ray has not been fired the substep distance
+ * must be less than the distance to the intersection surface that would
+ * be found (e.g. the substep must be inside of the safety sphere).
  */
 void DagMCNavigator::advanceBySubstepImpl( const Length substep_distance )
 {
@@ -441,8 +526,9 @@ void DagMCNavigator::advanceBySubstepImpl( const Length substep_distance )
   testPrecondition( this->isStateSet() );
   // Make sure that the substep distance is valid
   testPrecondition( substep_distance.value() >= 0.0 );
-  testPrecondition( substep_distance.value() <
-                    d_internal_ray.getDistanceToIntersectionSurface());
+  testPrecondition( !d_internal_ray.knowsIntersectionSurface() ||
+                    substep_distance.value() <
+                    d_internal_ray.getDistanceToIntersectionSurface() );
 
   d_internal_ray.advanceSubstep( substep_distance.value() );
 }
@@ -472,8 +558,7 @@ void DagMCNavigator::changeDirection( const double x_direction,
                                   z_direction,
                                   reflection );
 
-  // Fire the ray so that the new intersection data is set
-  Navigator::fireRay();
+  // The ray will not be fired until the new intersection data is requested
 }
 
 // Check if the surface handle is a reflecting surface
@@ -546,48 +631,141 @@ moab::EntityHandle DagMCNavigator::getBoundaryCellHandle(
   return boundary_cell_handle;
 }
 
+// Check if the ray is inside of the cell
+bool DagMCNavigator::isRayInCellWithHandle(
+                                   const Length position[3],
+                                   const double direction[3],
+                                   const moab::EntityHandle cell_handle ) const
+{
+  PointLocation test_point_location;
+
+  try{
+    test_point_location =
+      this->getPointLocationWithCellHandle( position,
+                                            direction,
+                                            cell_handle );
+  }
+  EXCEPTION_CATCH_RETHROW( DagMCGeometryError,
+                           "Could not find the location of the ray with "
+                           "respect to cell "
+                           << d_dagmc_model->getCellHandler().getCellId( cell_handle ) <<
+                           "! Here are the details...\n"
+                           "  Position: "
+                           << this->arrayToString( position ) << "\n"
+                           "  Direction: "
+                           << this->arrayToString( direction ) );
+
+  return test_point_location == POINT_INSIDE_CELL;
+}
+
+// Find the cell handle that contains the ray from a set of candidate cells
+/*! \details Only the candidate cells with a bounding box that contains the
+ * ray position will be tested. If none of the candidate cells contain the
+ * ray a null handle (0) will be returned.
+ */
+moab::EntityHandle DagMCNavigator::findCellHandleContainingRayInCells(
+                  const Length position[3],
+                  const double direction[3],
+                  const std::vector<moab::EntityHandle>& candidate_cell_handles,
+                  const moab::EntityHandle skip_cell_handle ) const
+{
+  const DagMCCellSearchGrid& search_grid =
+    d_dagmc_model->getCellSearchGrid();
+
+  for( size_t i = 0; i < candidate_cell_handles.size(); ++i )
+  {
+    if( candidate_cell_handles[i] == skip_cell_handle )
+      continue;
+
+    if( !search_grid.isPointInBoundingBox(
+                                        Utility::reinterpretAsRaw( position ),
+                                        candidate_cell_handles[i] ) )
+      continue;
+
+    if( this->isRayInCellWithHandle( position,
+                                     direction,
+                                     candidate_cell_handles[i] ) )
+      return candidate_cell_handles[i];
+  }
+
+  return 0;
+}
+
 // Find the cell handle that contains the ray
+/*! \details If a start cell is provided, it and the cells that share a
+ * surface with it will be tested first. The cells whose bounding boxes
+ * contain the ray position (found with the model's cell search grid) will be
+ * tested next followed by the unbounded cells (e.g. the implicit
+ * complement). All of the cells will only be tested if the search grid fails
+ * to locate the ray, which should only happen with a poorly-formed model.
+ */
 moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
-                                           const Length position[3],
-                                           const double direction[3],
-                                           const bool check_on_boundary ) const
+                                   const Length position[3],
+                                   const double direction[3],
+                                   const bool check_on_boundary,
+                                   const moab::EntityHandle start_cell_handle ) const
 {
   // Make sure that the direction is valid
   testPrecondition( Utility::isUnitVector( direction ) );
 
+  const DagMCCellSearchGrid& search_grid =
+    d_dagmc_model->getCellSearchGrid();
+
   moab::EntityHandle cell_handle = 0;
 
-  // Test all of the cells
-  moab::Range::const_iterator cell_handle_it = d_dagmc_model->getCellHandler().begin();
+  // Test the start cell and its neighbors
+  if( start_cell_handle != 0 )
+  {
+    if( search_grid.isPointInBoundingBox( Utility::reinterpretAsRaw( position ),
+                                          start_cell_handle ) &&
+        this->isRayInCellWithHandle( position, direction, start_cell_handle ) )
+      cell_handle = start_cell_handle;
+    else
+    {
+      cell_handle = this->findCellHandleContainingRayInCells(
+                     position,
+                     direction,
+                     search_grid.getNeighborCellHandles( start_cell_handle ) );
+    }
+  }
+
+  // Test the cells with a bounding box that contains the ray
+  if( cell_handle == 0 )
+  {
+    cell_handle = this->findCellHandleContainingRayInCells(
+          position,
+          direction,
+          search_grid.getCandidateCellHandles( Utility::reinterpretAsRaw( position ) ),
+          start_cell_handle );
+  }
 
-  while( cell_handle_it != d_dagmc_model->getCellHandler().end() )
+  // Test the unbounded cells
+  if( cell_handle == 0 )
   {
-    PointLocation test_point_location;
+    cell_handle = this->findCellHandleContainingRayInCells(
+                                       position,
+                                       direction,
+                                       search_grid.getUnboundedCellHandles(),
+                                       start_cell_handle );
+  }
 
-    try{
-      test_point_location =
-        this->getPointLocationWithCellHandle( position,
-                                              direction,
-                                              *cell_handle_it );
-    }
-    EXCEPTION_CATCH_RETHROW( DagMCGeometryError,
-                             "Could not find the location of the ray with "
-                             "respect to cell "
-                             << d_dagmc_model->getCellHandler().getCellId( *cell_handle_it ) <<
-                             "! Here are the details...\n"
-                             "  Position: "
-                             << this->arrayToString( position ) << "\n"
-                             "  Direction: "
-                             << this->arrayToString( direction ) );
+  // Test all of the cells
+  if( cell_handle == 0 )
+  {
+    moab::Range::const_iterator cell_handle_it =
+      d_dagmc_model->getCellHandler().begin();
 
-    if( test_point_location == POINT_INSIDE_CELL )
+    while( cell_handle_it != d_dagmc_model->getCellHandler().end() )
     {
-      cell_handle = *cell_handle_it;
+      if( this->isRayInCellWithHandle( position, direction, *cell_handle_it ) )
+      {
+        cell_handle = *cell_handle_it;
 
-      break;
-    }
+        break;
+      }
 
-    ++cell_handle_it;
+      ++cell_handle_it;
+    }
   }
 
   // Make sure that a cell handle was found
@@ -623,13 +801,14 @@ moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
 
 // Find the cell handle that contains the ray
 moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
-                                           const Length x_position,
-                                           const Length y_position,
-                                           const Length z_position,
-                                           const double x_direction,
-                                           const double y_direction,
-                                           const double z_direction,
-                                           const bool check_on_boundary ) const
+                                   const Length x_position,
+                                   const Length y_position,
+                                   const Length z_position,
+                                   const double x_direction,
+                                   const double y_direction,
+                                   const double z_direction,
+                                   const bool check_on_boundary,
+                                   const moab::EntityHandle start_cell_handle ) const
 {
   // Create position and direction arrays
   const Length position[3] = {x_position, y_position, z_position};
@@ -637,7 +816,8 @@ moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
 
   return this->findCellHandleContainingRay( position,
                                             direction,
-                                            check_on_boundary );
+                                            check_on_boundary,
+                                            start_cell_handle );
 }
 
 // Get the distance from the ray position to the nearest boundary
@@ -717,8 +897,7 @@ void DagMCNavigator::setStateWithCellHandle(
                       z_direction,
                       current_cell_handle );
 
-  // Fire the ray so that the intersection data is set
-  Navigator::fireRay();
+  // The ray will not be fired until the intersection data is requested
 }
 
 //! Clone the navigator
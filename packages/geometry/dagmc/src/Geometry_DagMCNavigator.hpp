@@ -43,8 +43,7 @@ public:
           Navigator::AdvanceCompleteCallback() );
 
   //! Destructor
-  ~DagMCNavigator()
-  { /* ... */ }
+  ~DagMCNavigator();
 
   //! Get the point location w.r.t. a given cell
   PointLocation getPointLocation(
@@ -113,6 +112,19 @@ public:
   //! Get the distance from the internal DagMC ray pos. to the nearest boundary
   Length fireRay( EntityId* surface_hit ) override;
 
+  //! Fire the internal DagMC ray if the boundary could be within the distance
+  Length fireRayIfBoundaryIsWithin( const Length distance,
+                                    EntityId* surface_hit ) override;
+
+  //! Fire the internal DagMC ray if the boundary could be within the distance (base overloads)
+  using Navigator::fireRayIfBoundaryIsWithin;
+
+  //! Get the number of ray fires
+  unsigned long long getNumberOfRayFires() const;
+
+  //! Get the number of ray fires that were avoided
+  unsigned long long getNumberOfAvoidedRayFires() const;
+
   //! Change the internal ray direction (without changing its location)
   void changeDirection( const double x_direction,
                         const double y_direction,
@@ -165,21 +177,35 @@ private:
                       const moab::EntityHandle cell_handle,
                       const moab::EntityHandle boundary_surface_handle ) const;
 
+  // Check if the ray is inside of the cell
+  bool isRayInCellWithHandle( const Length position[3],
+                              const double direction[3],
+                              const moab::EntityHandle cell_handle ) const;
+
+  // Find the cell handle that contains the ray from a set of candidate cells
+  moab::EntityHandle findCellHandleContainingRayInCells(
+                  const Length position[3],
+                  const double direction[3],
+                  const std::vector<moab::EntityHandle>& candidate_cell_handles,
+                  const moab::EntityHandle skip_cell_handle = 0 ) const;
+
   // Find the cell handle that contains the ray
   moab::EntityHandle findCellHandleContainingRay(
-                                  const Length position[3],
-                                  const double direction[3],
-                                  const bool check_on_boundary = false ) const;
+                      const Length position[3],
+                      const double direction[3],
+                      const bool check_on_boundary = false,
+                      const moab::EntityHandle start_cell_handle = 0 ) const;
 
   // Find the cell handle that contains the ray
   moab::EntityHandle findCellHandleContainingRay(
-                                  const Length x_position,
-                                  const Length y_position,
-                                  const Length z_position,
-                                  const double x_direction,
-                                  const double y_direction,
-                                  const double z_direction,
-                                  const bool check_on_boundary = false ) const;
+                      const Length x_position,
+                      const Length y_position,
+                      const Length z_position,
+                      const double x_direction,
+                      const double y_direction,
+                      const double z_direction,
+                      const bool check_on_boundary = false,
+                      const moab::EntityHandle start_cell_handle = 0 ) const;
 
   // Get the distance from the ray position to the nearest boundary
   Length fireRayWithCellHandle( const Length position[3],
@@ -211,6 +237,12 @@ private:
 
   // The internal ray
   DagMCRay d_internal_ray;
+
+  // The number of ray fires
+  unsigned long long d_number_of_ray_fires;
+
+  // The number of ray fires that were avoided
+  unsigned long long d_number_of_avoided_ray_fires;
 };
 
 /*! The DagMC geometry error
@@ -19,7 +19,9 @@ DagMCRay::DagMCRay()
     d_cell_handle( 0 ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_safety_distance( -1.0 ),
+    d_on_boundary( false )
 { /* ... */ }
 
 // Constructor
@@ -28,7 +30,9 @@ DagMCRay::DagMCRay( const Ray& ray, moab::EntityHandle cell_handle )
     d_cell_handle( cell_handle ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_safety_distance( -1.0 ),
+    d_on_boundary( false )
 {
   // Make sure the direction is valid
   testPrecondition( Utility::isUnitVector( d_basic_ray->getDirection() ) );
@@ -44,7 +48,9 @@ DagMCRay::DagMCRay( const double position[3],
     d_cell_handle( cell_handle ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_safety_distance( -1.0 ),
+    d_on_boundary( false )
 {
   // Make sure the direction is valid
   testPrecondition( Utility::isUnitVector( direction ) );
@@ -65,7 +71,9 @@ DagMCRay::DagMCRay( const double x_position,
     d_cell_handle( cell_handle ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_safety_distance( -1.0 ),
+    d_on_boundary( false )
 {
   // Make sure the direction is valid
   testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
@@ -79,7 +87,9 @@ DagMCRay::DagMCRay( const DagMCRay& ray )
     d_cell_handle( 0 ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_safety_distance( -1.0 ),
+    d_on_boundary( false )
 {
   if( ray.isReady() )
   {
@@ -96,6 +106,10 @@ DagMCRay::DagMCRay( const DagMCRay& ray )
 
       d_intersection_surface_handle = ray.d_intersection_surface_handle;
     }
+
+    d_safety_distance = ray.d_safety_distance;
+
+    d_on_boundary = ray.d_on_boundary;
   }
 }
 
@@ -158,11 +172,14 @@ void DagMCRay::set( const double x_position,
 
   // Reset the extra data
   this->resetIntersectionSurfaceData();
+  this->resetSafetyDistance();
+  d_on_boundary = false;
   d_history.reset();
 }
 
 // Change the direction
-/*! \details This method will reset the history.
+/*! \details This method will reset the history. The safety distance only
+ * depends on the position so it will be kept.
  */
 void DagMCRay::changeDirection( const double direction[3],
                                 const bool reflection )
@@ -174,7 +191,8 @@ void DagMCRay::changeDirection( const double direction[3],
 }
 
 // Change the direction
-/*! \details This method will reset the history.
+/*! \details This method will reset the history. The safety distance only
+ * depends on the position so it will be kept.
  */
 void DagMCRay::changeDirection( const double x_direction,
                                 const double y_direction,
@@ -269,6 +287,45 @@ void DagMCRay::resetIntersectionSurfaceData()
   d_intersection_distance = -1.0;
 }
 
+// Check if the ray knows the distance to the closest boundary
+bool DagMCRay::knowsSafetyDistance() const
+{
+  return d_safety_distance >= 0.0;
+}
+
+// Set the distance to the closest boundary in all directions
+void DagMCRay::setSafetyDistance( const double distance )
+{
+  // Make sure the distance is valid
+  testPrecondition( distance >= 0.0 );
+
+  d_safety_distance = distance;
+}
+
+// Reset the distance to the closest boundary in all directions
+void DagMCRay::resetSafetyDistance()
+{
+  d_safety_distance = -1.0;
+}
+
+// Get the distance to the closest boundary in all directions
+double DagMCRay::getSafetyDistance() const
+{
+  // Make sure the safety distance has been set
+  testPrecondition( this->knowsSafetyDistance() );
+
+  return d_safety_distance;
+}
+
+// Check if the ray is on the boundary of the current cell
+/*! \details A ray is on the boundary after it has been advanced to the
+ * intersection surface and before it has been advanced a substep.
+ */
+bool DagMCRay::isOnBoundary() const
+{
+  return d_on_boundary;
+}
+
 // Get the ray history
 const moab::DagMC::RayHistory& DagMCRay::getHistory() const
 {
@@ -282,7 +339,8 @@ moab::DagMC::RayHistory& DagMCRay::getHistory()
 }
 
 // Advance the ray to the intersection surface
-/*! \details This method will reset the intersection data.
+/*! \details This method will reset the intersection data and the safety
+ * distance.
  */
 void DagMCRay::advanceToIntersectionSurface(
                                     const moab::EntityHandle next_cell_handle )
@@ -298,22 +356,38 @@ void DagMCRay::advanceToIntersectionSurface(
 
   // Reset the intersection data
   this->resetIntersectionSurfaceData();
+
+  // The closest boundary is the one that was just crossed
+  this->resetSafetyDistance();
+
+  d_on_boundary = true;
 }
 
 // Advance the ray a substep
 /*! \details This method should only be used to move the ray a distance
- * that is less than the intersection distance.
+ * that is less than the intersection distance (or the safety distance if
+ * the intersection distance is not known).
  */
 void DagMCRay::advanceSubstep( const double substep_distance )
 {
   // Make sure the substep is less than the intersection distance
-  testPrecondition( substep_distance < d_intersection_distance );
+  testPrecondition( !this->knowsIntersectionSurface() ||
+                    substep_distance < d_intersection_distance );
 
   // Advance the basic ray the substep distance
   d_basic_ray->advanceHead( substep_distance );
 
   // Update the intersection distance
-  d_intersection_distance -= substep_distance;
+  if( this->knowsIntersectionSurface() )
+    d_intersection_distance -= substep_distance;
+
+  // Shrink the safety sphere (it must be recomputed once it vanishes)
+  if( d_safety_distance > substep_distance )
+    d_safety_distance -= substep_distance;
+  else
+    this->resetSafetyDistance();
+
+  d_on_boundary = false;
 }
 
 } // end Geometry namespace
@@ -108,6 +108,21 @@ public:
   //! Get the boundary surface
   moab::EntityHandle getIntersectionSurface() const;
 
+  //! Check if the ray knows the distance to the closest boundary
+  bool knowsSafetyDistance() const;
+
+  //! Set the distance to the closest boundary in all directions
+  void setSafetyDistance( const double distance );
+
+  //! Reset the distance to the closest boundary in all directions
+  void resetSafetyDistance();
+
+  //! Get the distance to the closest boundary in all directions
+  double getSafetyDistance() const;
+
+  //! Check if the ray is on the boundary of the current cell
+  bool isOnBoundary() const;
+
   //! Get the ray history
   const moab::DagMC::RayHistory& getHistory() const;
 
@@ -137,6 +152,12 @@ private:
 
   // The boundary surface that will be intersected (0 for not known)
   moab::EntityHandle d_intersection_surface_handle;
+
+  // The distance to the closest boundary in all directions (-1 for not known)
+  double d_safety_distance;
+
+  // Records if the ray is on the boundary of the current cell
+  bool d_on_boundary;
 };
 
 } // end Geometry namespace
@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDagMCCellSearchGrid.cpp
+//! \author Alex Robinson
+//! \brief  DagMCCellSearchGrid class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellSearchGrid.hpp"
+#include "Geometry_StandardDagMCCellHandler.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::shared_ptr<Geometry::DagMCCellHandler> cell_handler;
+std::shared_ptr<Geometry::DagMCCellSearchGrid> search_grid;
+moab::DagMC* dagmc_instance;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Check if a cell handle is in a cell handle array
+bool contains( const Geometry::DagMCCellSearchGrid::CellHandleArray& cells,
+               const Geometry::DagMCCellHandler::EntityId cell_id )
+{
+  return std::find( cells.begin(),
+                    cells.end(),
+                    cell_handler->getCellHandle( cell_id ) ) != cells.end();
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the search grid can be constructed
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, constructor )
+{
+  FRENSIE_CHECK_NO_THROW( search_grid.reset( new Geometry::DagMCCellSearchGrid( dagmc_instance, *cell_handler ) ) );
+
+  const std::array<size_t,3>& grid_dimensions =
+    search_grid->getGridDimensions();
+
+  FRENSIE_CHECK_GREATER_OR_EQUAL( grid_dimensions[0], 1 );
+  FRENSIE_CHECK_GREATER_OR_EQUAL( grid_dimensions[1], 1 );
+  FRENSIE_CHECK_GREATER_OR_EQUAL( grid_dimensions[2], 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the candidate cells can be returned
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, getCandidateCellHandles )
+{
+  double position[3] = {-40.0, -40.0, 59.0};
+
+  const Geometry::DagMCCellSearchGrid::CellHandleArray& candidate_cells =
+    search_grid->getCandidateCellHandles( position );
+
+  FRENSIE_CHECK( candidate_cells.size() < cell_handler->getNumberOfCells() );
+  FRENSIE_CHECK( contains( candidate_cells, 53 ) );
+
+  position[2] = 61.0;
+
+  FRENSIE_CHECK( contains( search_grid->getCandidateCellHandles( position ), 54 ) );
+
+  position[2] = 64.0;
+
+  FRENSIE_CHECK( contains( search_grid->getCandidateCellHandles( position ), 55 ) );
+
+  // Points outside of the grid have no candidates
+  position[2] = 1e12;
+
+  FRENSIE_CHECK_EQUAL( search_grid->getCandidateCellHandles( position ).size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a point is inside of the bounding box of a cell
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, isPointInBoundingBox )
+{
+  double position[3] = {-40.0, -40.0, 59.0};
+
+  FRENSIE_CHECK( search_grid->isPointInBoundingBox( position, cell_handler->getCellHandle( 53 ) ) );
+
+  position[2] = 1e12;
+
+  FRENSIE_CHECK( !search_grid->isPointInBoundingBox( position, cell_handler->getCellHandle( 53 ) ) );
+
+  // Unbounded cells contain every point
+  const Geometry::DagMCCellSearchGrid::CellHandleArray& unbounded_cells =
+    search_grid->getUnboundedCellHandles();
+
+  for( size_t i = 0; i < unbounded_cells.size(); ++i )
+  {
+    FRENSIE_CHECK( search_grid->isPointInBoundingBox( position, unbounded_cells[i] ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the neighbors of a cell can be returned
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, getNeighborCellHandles )
+{
+  // Cells 53 and 54 share surface 242 and cells 54 and 55 share surface 248
+  const Geometry::DagMCCellSearchGrid::CellHandleArray& neighbors_53 =
+    search_grid->getNeighborCellHandles( cell_handler->getCellHandle( 53 ) );
+
+  FRENSIE_CHECK( contains( neighbors_53, 54 ) );
+  FRENSIE_CHECK( !contains( neighbors_53, 53 ) );
+
+  const Geometry::DagMCCellSearchGrid::CellHandleArray& neighbors_54 =
+    search_grid->getNeighborCellHandles( cell_handler->getCellHandle( 54 ) );
+
+  FRENSIE_CHECK( contains( neighbors_54, 53 ) );
+  FRENSIE_CHECK( contains( neighbors_54, 55 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_dagmc_geom_file_name;
+bool suppress_dagmc_output = true;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_cad_file",
+                                        test_dagmc_geom_file_name, "",
+                                        "Test CAD file name" );
+
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "suppress_dagmc_output",
+                                        suppress_dagmc_output, true,
+                                        "Suppress DagMC output" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize dagmc
+  dagmc_instance = new moab::DagMC();
+
+  std::streambuf* cout_streambuf, *cerr_streambuf;
+
+  if( suppress_dagmc_output )
+  {
+    cout_streambuf = std::cout.rdbuf();
+    cerr_streambuf = std::cerr.rdbuf();
+
+    std::cout.rdbuf( NULL );
+    std::cerr.rdbuf( NULL );
+  }
+
+  dagmc_instance->load_file( test_dagmc_geom_file_name.c_str() );
+
+  // The bounding boxes require the OBB tree
+  dagmc_instance->init_OBBTree();
+
+  if( suppress_dagmc_output )
+  {
+    std::cout.rdbuf( cout_streambuf );
+    std::cerr.rdbuf( cerr_streambuf );
+  }
+
+  cell_handler.reset( new Geometry::StandardDagMCCellHandler( dagmc_instance ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDagMCCellSearchGrid.cpp
+//---------------------------------------------------------------------------//
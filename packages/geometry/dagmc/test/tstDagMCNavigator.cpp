@@ -10,6 +10,7 @@
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <limits>
 
 // FRENSIE Includes
 #include "Geometry_DagMCNavigator.hpp"
@@ -394,6 +395,82 @@ FRENSIE_UNIT_TEST( DagMCNavigator, fireRay )
   FRENSIE_CHECK_EQUAL( surface_hit, 242 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the internal ray is only fired when the boundary could be
+// within the distance
+FRENSIE_UNIT_TEST( DagMCNavigator, fireRayIfBoundaryIsWithin )
+{
+  const unsigned long long initial_avoided_ray_fires =
+    model->getNumberOfAvoidedRayFires();
+
+  std::shared_ptr<Geometry::DagMCNavigator>
+    navigator( model->createNavigatorAdvanced() );
+
+  // The closest boundary is 1.27 cm away
+  navigator->setState( -39.6*cgs::centimeter,
+                       -39.6*cgs::centimeter,
+                       59.69*cgs::centimeter,
+                       0.0, 0.0, 1.0,
+                       53 );
+
+  // Setting the state does not fire the ray
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfRayFires(), 0 );
+
+  Geometry::Navigator::EntityId surface_hit = 0;
+
+  Geometry::Navigator::Length distance_to_surface_hit =
+    navigator->fireRayIfBoundaryIsWithin( 1.0*cgs::centimeter, surface_hit );
+
+  FRENSIE_CHECK_EQUAL( distance_to_surface_hit.value(),
+                       std::numeric_limits<double>::infinity() );
+  FRENSIE_CHECK_EQUAL( surface_hit, 0 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfRayFires(), 0 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfAvoidedRayFires(), 1 );
+
+  distance_to_surface_hit =
+    navigator->fireRayIfBoundaryIsWithin( 2.0*cgs::centimeter, surface_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance_to_surface_hit,
+                                   1.27*cgs::centimeter,
+                                   1e-9 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 242 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfRayFires(), 1 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfAvoidedRayFires(), 1 );
+
+  // The safety sphere is kept after a substep and a direction change
+  navigator->advanceBySubstep( 0.5*cgs::centimeter );
+  navigator->changeDirection( 0.0, 0.0, -1.0 );
+
+  distance_to_surface_hit =
+    navigator->fireRayIfBoundaryIsWithin( 0.5*cgs::centimeter );
+
+  FRENSIE_CHECK_EQUAL( distance_to_surface_hit.value(),
+                       std::numeric_limits<double>::infinity() );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfRayFires(), 1 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfAvoidedRayFires(), 2 );
+
+  navigator->advanceBySubstep( 0.5*cgs::centimeter );
+  navigator->changeDirection( 0.0, 0.0, 1.0 );
+
+  // The ray is fired when the boundary is crossed
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 54 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfRayFires(), 2 );
+
+  // The ray must always be fired on a boundary
+  navigator->fireRayIfBoundaryIsWithin( 1e-3*cgs::centimeter );
+
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfRayFires(), 3 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfAvoidedRayFires(), 2 );
+
+  // The counters are added to the model totals
+  navigator.reset();
+
+  FRENSIE_CHECK_EQUAL( model->getNumberOfAvoidedRayFires(),
+                       initial_avoided_ray_fires + 2 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an internal ray can be advanced by a substep
 FRENSIE_UNIT_TEST( DagMCNavigator, advanceBySubstep )
@@ -210,6 +210,70 @@ FRENSIE_UNIT_TEST( DagMCRay, advanceSubstep )
   FRENSIE_CHECK_EQUAL( ray.getCurrentCell(), 1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the safety distance can be set
+FRENSIE_UNIT_TEST( DagMCRay, setSafetyDistance )
+{
+  Geometry::Ray raw_ray( 1.0, 1.0, 1.0, 0.0, 0.0, 1.0 );
+
+  Geometry::DagMCRay ray( raw_ray, 1 );
+
+  FRENSIE_CHECK( !ray.knowsSafetyDistance() );
+
+  ray.setSafetyDistance( 2.0 );
+
+  FRENSIE_CHECK( ray.knowsSafetyDistance() );
+  FRENSIE_CHECK_EQUAL( ray.getSafetyDistance(), 2.0 );
+
+  // The safety distance does not depend on the direction
+  ray.changeDirection( 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK( ray.knowsSafetyDistance() );
+  FRENSIE_CHECK_EQUAL( ray.getSafetyDistance(), 2.0 );
+
+  // The safety sphere shrinks as the ray is advanced
+  ray.advanceSubstep( 0.5 );
+
+  FRENSIE_CHECK( !ray.knowsIntersectionSurface() );
+  FRENSIE_CHECK_EQUAL( ray.getSafetyDistance(), 1.5 );
+
+  ray.advanceSubstep( 1.5 );
+
+  FRENSIE_CHECK( !ray.knowsSafetyDistance() );
+
+  ray.setSafetyDistance( 2.0 );
+  ray.resetSafetyDistance();
+
+  FRENSIE_CHECK( !ray.knowsSafetyDistance() );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the ray is on a boundary
+FRENSIE_UNIT_TEST( DagMCRay, isOnBoundary )
+{
+  Geometry::Ray raw_ray( 1.0, 1.0, 1.0, 0.0, 0.0, 1.0 );
+
+  Geometry::DagMCRay ray( raw_ray, 1 );
+
+  FRENSIE_CHECK( !ray.isOnBoundary() );
+
+  ray.setSafetyDistance( 3.0 );
+  ray.setIntersectionSurfaceData( 10, 3.0 );
+  ray.advanceToIntersectionSurface( 2 );
+
+  FRENSIE_CHECK( ray.isOnBoundary() );
+  FRENSIE_CHECK( !ray.knowsSafetyDistance() );
+
+  ray.advanceSubstep( 1.0 );
+
+  FRENSIE_CHECK( !ray.isOnBoundary() );
+
+  ray.advanceToIntersectionSurface( 1 );
+  ray.set( raw_ray, 1 );
+
+  FRENSIE_CHECK( !ray.isOnBoundary() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstDagMCRay.cpp
 //---------------------------------------------------------------------------//
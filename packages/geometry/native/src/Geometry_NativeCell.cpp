@@ -0,0 +1,474 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCell.cpp
+//! \author Alex Robinson
+//! \brief  The native geometry cell class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Geometry_NativeCell.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const int NativeCell::s_intersection_instruction = -1;
+const int NativeCell::s_union_instruction = -2;
+const unsigned NativeCell::s_max_stack_depth = 64;
+
+// Constructor
+NativeCell::NativeCell( const EntityId id,
+                        const std::string& definition,
+                        const SurfaceMap& surfaces )
+  : d_id( id ),
+    d_definition( definition ),
+    d_surfaces(),
+    d_half_spaces(),
+    d_program(),
+    d_intersection_only( true ),
+    d_bounding_box(),
+    d_bounded( false )
+{
+  this->compileDefinition( surfaces );
+
+  this->calculateBoundingBox();
+}
+
+// Compile the cell definition
+/*! \details The infix cell definition is converted to a postfix program
+ * using the shunting-yard algorithm. Non-negative instructions are
+ * half-space indices and negative instructions are operators.
+ */
+void NativeCell::compileDefinition( const SurfaceMap& surfaces )
+{
+  std::vector<char> operator_stack;
+  std::unordered_map<EntityId,unsigned> surface_indices;
+
+  auto emit_operator = [this]( const char op ){
+    d_program.push_back( op == 'n' ? s_intersection_instruction :
+                         s_union_instruction );
+
+    if( op == 'u' )
+      d_intersection_only = false;
+  };
+
+  bool expecting_half_space = true;
+  size_t i = 0;
+
+  while( i < d_definition.size() )
+  {
+    const char token = d_definition[i];
+
+    if( std::isspace( token ) )
+      ++i;
+    else if( token == '(' )
+    {
+      TEST_FOR_EXCEPTION( !expecting_half_space,
+                          InvalidNativeGeometry,
+                          "Cell " << d_id << " has an invalid definition ("
+                          << d_definition << ")! An operator must come "
+                          "before an opening parenthesis." );
+
+      operator_stack.push_back( token );
+      ++i;
+    }
+    else if( token == ')' )
+    {
+      TEST_FOR_EXCEPTION( expecting_half_space,
+                          InvalidNativeGeometry,
+                          "Cell " << d_id << " has an invalid definition ("
+                          << d_definition << ")! A half-space must come "
+                          "before a closing parenthesis." );
+
+      while( !operator_stack.empty() && operator_stack.back() != '(' )
+      {
+        emit_operator( operator_stack.back() );
+        operator_stack.pop_back();
+      }
+
+      TEST_FOR_EXCEPTION( operator_stack.empty(),
+                          InvalidNativeGeometry,
+                          "Cell " << d_id << " has an invalid definition ("
+                          << d_definition << ")! The parentheses are not "
+                          "balanced." );
+
+      operator_stack.pop_back();
+      ++i;
+    }
+    else if( token == 'n' || token == 'u' )
+    {
+      TEST_FOR_EXCEPTION( expecting_half_space,
+                          InvalidNativeGeometry,
+                          "Cell " << d_id << " has an invalid definition ("
+                          << d_definition << ")! A half-space must come "
+                          "before an operator." );
+
+      // Intersections are evaluated before unions
+      while( !operator_stack.empty() && operator_stack.back() != '(' &&
+             (operator_stack.back() == 'n' || token == 'u') )
+      {
+        emit_operator( operator_stack.back() );
+        operator_stack.pop_back();
+      }
+
+      operator_stack.push_back( token );
+      expecting_half_space = true;
+      ++i;
+    }
+    else if( token == '+' || token == '-' || std::isdigit( token ) )
+    {
+      TEST_FOR_EXCEPTION( !expecting_half_space,
+                          InvalidNativeGeometry,
+                          "Cell " << d_id << " has an invalid definition ("
+                          << d_definition << ")! An operator must come "
+                          "between half-spaces." );
+
+      NativeSurface::Sense sense = NativeSurface::POSITIVE_SENSE;
+
+      if( token == '-' )
+        sense = NativeSurface::NEGATIVE_SENSE;
+
+      if( !std::isdigit( token ) )
+        ++i;
+
+      size_t end = i;
+
+      while( end < d_definition.size() && std::isdigit( d_definition[end] ) )
+        ++end;
+
+      TEST_FOR_EXCEPTION( end == i,
+                          InvalidNativeGeometry,
+                          "Cell " << d_id << " has an invalid definition ("
+                          << d_definition << ")! A surface id must follow "
+                          "a sign." );
+
+      const EntityId surface_id =
+        std::stoull( d_definition.substr( i, end - i ) );
+
+      SurfaceMap::const_iterator surface_it = surfaces.find( surface_id );
+
+      TEST_FOR_EXCEPTION( surface_it == surfaces.end(),
+                          InvalidNativeGeometry,
+                          "Cell " << d_id << " references surface "
+                          << surface_id << " which does not exist!" );
+
+      if( surface_indices.find( surface_id ) == surface_indices.end() )
+      {
+        surface_indices[surface_id] = d_surfaces.size();
+
+        d_surfaces.push_back( surface_it->second );
+      }
+
+      HalfSpace half_space;
+      half_space.surface_index = surface_indices[surface_id];
+      half_space.sense = sense;
+
+      d_program.push_back( d_half_spaces.size() );
+      d_half_spaces.push_back( half_space );
+
+      expecting_half_space = false;
+      i = end;
+    }
+    else
+    {
+      THROW_EXCEPTION( InvalidNativeGeometry,
+                       "Cell " << d_id << " has an invalid definition ("
+                       << d_definition << ")! Character '" << token
+                       << "' is not allowed." );
+    }
+  }
+
+  TEST_FOR_EXCEPTION( expecting_half_space,
+                      InvalidNativeGeometry,
+                      "Cell " << d_id << " has an invalid definition ("
+                      << d_definition << ")! The definition is empty or "
+                      "ends with an operator." );
+
+  while( !operator_stack.empty() )
+  {
+    TEST_FOR_EXCEPTION( operator_stack.back() == '(',
+                        InvalidNativeGeometry,
+                        "Cell " << d_id << " has an invalid definition ("
+                        << d_definition << ")! The parentheses are not "
+                        "balanced." );
+
+    emit_operator( operator_stack.back() );
+    operator_stack.pop_back();
+  }
+
+  // The evaluation stack is stored in the bits of a single integer
+  unsigned stack_depth = 0, max_stack_depth = 0;
+
+  for( size_t j = 0; j < d_program.size(); ++j )
+  {
+    if( d_program[j] >= 0 )
+    {
+      ++stack_depth;
+
+      max_stack_depth = std::max( max_stack_depth, stack_depth );
+    }
+    else
+      --stack_depth;
+  }
+
+  TEST_FOR_EXCEPTION( max_stack_depth > s_max_stack_depth,
+                      InvalidNativeGeometry,
+                      "Cell " << d_id << " has a definition that is nested "
+                      "too deeply (" << max_stack_depth << " > "
+                      << s_max_stack_depth << ")!" );
+}
+
+// Calculate the cell bounding box
+/*! \details The bounding box of an intersection is the intersection of the
+ * operand bounding boxes and the bounding box of a union is the union of
+ * the operand bounding boxes.
+ */
+void NativeCell::calculateBoundingBox()
+{
+  auto is_empty = []( const BoundingBox& box ){
+    return box[0] > box[3] || box[1] > box[4] || box[2] > box[5];
+  };
+
+  std::vector<BoundingBox> box_stack;
+
+  for( size_t i = 0; i < d_program.size(); ++i )
+  {
+    if( d_program[i] >= 0 )
+    {
+      const HalfSpace& half_space = d_half_spaces[d_program[i]];
+
+      box_stack.push_back(
+         d_surfaces[half_space.surface_index]->getBoundingBox( half_space.sense ) );
+    }
+    else
+    {
+      BoundingBox right_box = box_stack.back();
+      box_stack.pop_back();
+
+      BoundingBox& left_box = box_stack.back();
+
+      if( d_program[i] == s_intersection_instruction )
+      {
+        for( unsigned j = 0; j < 3; ++j )
+        {
+          left_box[j] = std::max( left_box[j], right_box[j] );
+          left_box[j+3] = std::min( left_box[j+3], right_box[j+3] );
+        }
+      }
+      else if( is_empty( left_box ) )
+        left_box = right_box;
+      else if( !is_empty( right_box ) )
+      {
+        for( unsigned j = 0; j < 3; ++j )
+        {
+          left_box[j] = std::min( left_box[j], right_box[j] );
+          left_box[j+3] = std::max( left_box[j+3], right_box[j+3] );
+        }
+      }
+    }
+  }
+
+  d_bounding_box = box_stack.back();
+
+  d_bounded = true;
+
+  for( unsigned i = 0; i < 6; ++i )
+  {
+    if( std::isinf( d_bounding_box[i] ) )
+    {
+      d_bounded = false;
+      break;
+    }
+  }
+}
+
+// Get the cell id
+auto NativeCell::getId() const -> EntityId
+{
+  return d_id;
+}
+
+// Get the cell definition
+const std::string& NativeCell::getDefinition() const
+{
+  return d_definition;
+}
+
+// Get the surfaces that bound the cell
+auto NativeCell::getSurfaces() const -> const SurfaceArray&
+{
+  return d_surfaces;
+}
+
+// Check if the cell is bounded
+bool NativeCell::isBounded() const
+{
+  return d_bounded;
+}
+
+// Get the cell bounding box
+auto NativeCell::getBoundingBox() const -> const BoundingBox&
+{
+  return d_bounding_box;
+}
+
+// Check if a point is inside of the cell bounding box
+/*! \details The bounding box is padded by a small relative amount so that
+ * points on the boundary of the cell are never culled.
+ */
+bool NativeCell::isPointInBoundingBox( const double position[3] ) const
+{
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    const double padding =
+      1e-9*std::max( std::fabs( position[i] ), 1.0 );
+
+    if( position[i] < d_bounding_box[i] - padding ||
+        position[i] > d_bounding_box[i+3] + padding )
+      return false;
+  }
+
+  return true;
+}
+
+// Check if a ray is in a half-space
+inline bool NativeCell::isRayInHalfSpace(
+                    const HalfSpace& half_space,
+                    const double position[3],
+                    const double direction[3],
+                    const EntityId boundary_surface_id,
+                    const NativeSurface::Sense boundary_surface_sense ) const
+{
+  const NativeSurface& surface = *d_surfaces[half_space.surface_index];
+
+  if( surface.getId() == boundary_surface_id )
+    return boundary_surface_sense == half_space.sense;
+  else
+    return surface.getSenseOfRay( position, direction ) == half_space.sense;
+}
+
+// Check if a ray is inside of the cell
+/*! \details If the ray is on a boundary surface (e.g. it has just crossed
+ * the surface) the sense of the ray w.r.t. the surface can be passed in so
+ * that it is not recalculated. Cells that are intersections of half-spaces
+ * will return as soon as a half-space that does not contain the ray is
+ * found.
+ */
+bool NativeCell::isRayInCell(
+                    const double position[3],
+                    const double direction[3],
+                    const EntityId boundary_surface_id,
+                    const NativeSurface::Sense boundary_surface_sense ) const
+{
+  if( d_intersection_only )
+  {
+    for( size_t i = 0; i < d_half_spaces.size(); ++i )
+    {
+      if( !this->isRayInHalfSpace( d_half_spaces[i],
+                                   position,
+                                   direction,
+                                   boundary_surface_id,
+                                   boundary_surface_sense ) )
+        return false;
+    }
+
+    return true;
+  }
+  else
+  {
+    uint64_t stack = 0;
+
+    for( size_t i = 0; i < d_program.size(); ++i )
+    {
+      const int instruction = d_program[i];
+
+      if( instruction >= 0 )
+      {
+        const bool in_half_space =
+          this->isRayInHalfSpace( d_half_spaces[instruction],
+                                  position,
+                                  direction,
+                                  boundary_surface_id,
+                                  boundary_surface_sense );
+
+        stack = (stack << 1) | (in_half_space ? 1 : 0);
+      }
+      else
+      {
+        const uint64_t right_value = stack & 1;
+        const uint64_t left_value = (stack >> 1) & 1;
+
+        stack >>= 2;
+
+        if( instruction == s_intersection_instruction )
+          stack = (stack << 1) | (left_value & right_value);
+        else
+          stack = (stack << 1) | (left_value | right_value);
+      }
+    }
+
+    return stack & 1;
+  }
+}
+
+// Get the distance along a ray to the cell boundary
+/*! \details The boundary surface is the surface that the ray is currently
+ * on (or the invalid surface id). Infinity will be returned if none of the
+ * cell surfaces are hit.
+ */
+double NativeCell::getDistanceToBoundary( const double position[3],
+                                          const double direction[3],
+                                          const EntityId boundary_surface_id,
+                                          EntityId& surface_hit ) const
+{
+  double distance = std::numeric_limits<double>::infinity();
+
+  surface_hit = Navigator::invalidSurfaceId();
+
+  for( size_t i = 0; i < d_surfaces.size(); ++i )
+  {
+    const double distance_to_surface =
+      d_surfaces[i]->getDistance( position,
+                                  direction,
+                                  d_surfaces[i]->getId() == boundary_surface_id );
+
+    if( distance_to_surface < distance )
+    {
+      distance = distance_to_surface;
+      surface_hit = d_surfaces[i]->getId();
+    }
+  }
+
+  return distance;
+}
+
+// Get a lower bound on the distance to the cell boundary in all directions
+double NativeCell::getSafetyDistance( const double position[3] ) const
+{
+  double safety_distance = std::numeric_limits<double>::infinity();
+
+  for( size_t i = 0; i < d_surfaces.size(); ++i )
+  {
+    safety_distance = std::min( safety_distance,
+                                d_surfaces[i]->getSafetyDistance( position ) );
+
+    if( safety_distance == 0.0 )
+      break;
+  }
+
+  return safety_distance;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCell.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCell.hpp
+//! \author Alex Robinson
+//! \brief  The native geometry cell class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_CELL_HPP
+#define GEOMETRY_NATIVE_CELL_HPP
+
+// Std Lib Includes
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Geometry_NativeSurface.hpp"
+
+namespace Geometry{
+
+/*! The native geometry cell
+ * \details A cell is a boolean combination of the half-spaces of its
+ * surfaces. The cell definition uses the same syntax as the original
+ * FRENSIE cell class: a surface id with an optional sign selects the
+ * positive (+ or no sign) or negative (-) half-space of the surface, "n"
+ * is the intersection operator, "u" is the union operator and parentheses
+ * can be used for grouping (e.g. "-1n2n(-3u4)"). Intersections are
+ * evaluated before unions and white space is ignored. The definition is
+ * compiled to a postfix program when the cell is constructed so that
+ * point-in-cell queries never have to parse the definition.
+ */
+class NativeCell
+{
+
+public:
+
+  //! The entity id type
+  typedef Navigator::EntityId EntityId;
+
+  //! The bounding box type (x_min, y_min, z_min, x_max, y_max, z_max)
+  typedef NativeSurface::BoundingBox BoundingBox;
+
+  //! The surface map type
+  typedef std::unordered_map<EntityId,std::shared_ptr<const NativeSurface> > SurfaceMap;
+
+  //! The surface array type
+  typedef std::vector<std::shared_ptr<const NativeSurface> > SurfaceArray;
+
+  //! Constructor
+  NativeCell( const EntityId id,
+              const std::string& definition,
+              const SurfaceMap& surfaces );
+
+  //! Destructor
+  ~NativeCell()
+  { /* ... */ }
+
+  //! Get the cell id
+  EntityId getId() const;
+
+  //! Get the cell definition
+  const std::string& getDefinition() const;
+
+  //! Get the surfaces that bound the cell
+  const SurfaceArray& getSurfaces() const;
+
+  //! Check if the cell is bounded
+  bool isBounded() const;
+
+  //! Get the cell bounding box
+  const BoundingBox& getBoundingBox() const;
+
+  //! Check if a point is inside of the cell bounding box
+  bool isPointInBoundingBox( const double position[3] ) const;
+
+  //! Check if a ray is inside of the cell
+  bool isRayInCell( const double position[3],
+                    const double direction[3],
+                    const EntityId boundary_surface_id =
+                    Navigator::invalidSurfaceId(),
+                    const NativeSurface::Sense boundary_surface_sense =
+                    NativeSurface::ON_SURFACE ) const;
+
+  //! Get the distance along a ray to the cell boundary
+  double getDistanceToBoundary( const double position[3],
+                                const double direction[3],
+                                const EntityId boundary_surface_id,
+                                EntityId& surface_hit ) const;
+
+  //! Get a lower bound on the distance to the cell boundary in all directions
+  double getSafetyDistance( const double position[3] ) const;
+
+private:
+
+  // A half-space of a surface
+  struct HalfSpace
+  {
+    // The index of the surface in the surface array
+    unsigned surface_index;
+
+    // The sense of the half-space
+    NativeSurface::Sense sense;
+  };
+
+  // The intersection instruction
+  static const int s_intersection_instruction;
+
+  // The union instruction
+  static const int s_union_instruction;
+
+  // The maximum evaluation stack depth
+  static const unsigned s_max_stack_depth;
+
+  // Compile the cell definition
+  void compileDefinition( const SurfaceMap& surfaces );
+
+  // Calculate the cell bounding box
+  void calculateBoundingBox();
+
+  // Check if a ray is in a half-space
+  bool isRayInHalfSpace( const HalfSpace& half_space,
+                         const double position[3],
+                         const double direction[3],
+                         const EntityId boundary_surface_id,
+                         const NativeSurface::Sense boundary_surface_sense ) const;
+
+  // The cell id
+  EntityId d_id;
+
+  // The cell definition
+  std::string d_definition;
+
+  // The surfaces that bound the cell
+  SurfaceArray d_surfaces;
+
+  // The half-spaces in the cell definition
+  std::vector<HalfSpace> d_half_spaces;
+
+  // The postfix program (half-space indices and operator instructions)
+  std::vector<int> d_program;
+
+  // Records if the cell is an intersection of half-spaces only
+  bool d_intersection_only;
+
+  // The cell bounding box
+  BoundingBox d_bounding_box;
+
+  // Records if the cell bounding box is finite
+  bool d_bounded;
+};
+
+//! The invalid native geometry error
+class InvalidNativeGeometry : public std::runtime_error
+{
+
+public:
+
+  InvalidNativeGeometry( const std::string& what_arg )
+    : std::runtime_error( what_arg )
+  { /* ... */ }
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_NATIVE_CELL_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCell.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,521 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.cpp
+//! \author Alex Robinson
+//! \brief  The native geometry model class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_NativeModel.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const unsigned NativeModel::s_volume_grid_points = 100;
+
+// Constructor
+NativeModel::NativeModel( const std::string& name )
+  : AdvancedModel(),
+    d_name( name ),
+    d_surfaces(),
+    d_surface_ids(),
+    d_cells(),
+    d_cell_definitions(),
+    d_cell_material_ids(),
+    d_cell_densities(),
+    d_termination_cells(),
+    d_reflecting_surfaces(),
+    d_cell_volumes(),
+    d_surface_areas(),
+    d_cell_estimator_data(),
+    d_surface_estimator_data(),
+    d_surface_cells(),
+    d_search_ordered_cells(),
+    d_no_cells()
+{ /* ... */ }
+
+// Add a surface
+void NativeModel::addSurface( const NativeSurface& surface )
+{
+  TEST_FOR_EXCEPTION( surface.getId() == Model::invalidSurfaceId(),
+                      InvalidNativeGeometry,
+                      "The surface id " << surface.getId() << " is reserved "
+                      "for invalid surfaces!" );
+
+  TEST_FOR_EXCEPTION( d_surfaces.find( surface.getId() ) != d_surfaces.end(),
+                      InvalidNativeGeometry,
+                      "Surface " << surface.getId() << " has already been "
+                      "added to the model!" );
+
+  d_surfaces[surface.getId()].reset( new NativeSurface( surface ) );
+  d_surface_ids.push_back( surface.getId() );
+}
+
+// Add a void cell
+void NativeModel::addCell( const EntityId cell_id,
+                           const std::string& definition )
+{
+  this->addCellImpl( cell_id, definition );
+}
+
+// Add a cell with a material
+/*! \details A positive density is an atom density (atom/b-cm) and a negative
+ * density is a mass density (g/cm^3).
+ */
+void NativeModel::addCell( const EntityId cell_id,
+                           const std::string& definition,
+                           const MaterialId material_id,
+                           const Density density )
+{
+  TEST_FOR_EXCEPTION( density == 0.0*DensityUnit(),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " cannot have a material with a "
+                      "density of zero!" );
+
+  this->addCellImpl( cell_id, definition );
+
+  d_cell_material_ids[cell_id] = material_id;
+  d_cell_densities[cell_id] = density;
+}
+
+// Add a cell
+/*! \details The cell is added to the adjacency list of each of its surfaces
+ * and to the ordered list of cells that is used when the cell containing a
+ * point is unknown (smallest bounding boxes first since those cells are
+ * the most likely to be culled).
+ */
+void NativeModel::addCellImpl( const EntityId cell_id,
+                               const std::string& definition )
+{
+  TEST_FOR_EXCEPTION( cell_id == Model::invalidCellId(),
+                      InvalidNativeGeometry,
+                      "The cell id " << cell_id << " is reserved for invalid "
+                      "cells!" );
+
+  TEST_FOR_EXCEPTION( d_cells.find( cell_id ) != d_cells.end(),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " has already been added to the "
+                      "model!" );
+
+  std::shared_ptr<const NativeCell> cell(
+                             new NativeCell( cell_id, definition, d_surfaces ) );
+
+  d_cells[cell_id] = cell;
+  d_cell_definitions.push_back( std::make_pair( cell_id, definition ) );
+
+  const NativeCell::SurfaceArray& cell_surfaces = cell->getSurfaces();
+
+  for( size_t i = 0; i < cell_surfaces.size(); ++i )
+    d_surface_cells[cell_surfaces[i]->getId()].push_back( cell.get() );
+
+  d_search_ordered_cells.push_back( cell.get() );
+
+  auto bounding_box_volume = []( const NativeCell* cell ){
+    if( !cell->isBounded() )
+      return std::numeric_limits<double>::infinity();
+
+    const NativeCell::BoundingBox& bounding_box = cell->getBoundingBox();
+
+    return (bounding_box[3] - bounding_box[0])*
+      (bounding_box[4] - bounding_box[1])*
+      (bounding_box[5] - bounding_box[2]);
+  };
+
+  std::stable_sort( d_search_ordered_cells.begin(),
+                    d_search_ordered_cells.end(),
+                    [&bounding_box_volume]( const NativeCell* cell_a,
+                                            const NativeCell* cell_b ){
+                      return bounding_box_volume( cell_a ) <
+                        bounding_box_volume( cell_b ); } );
+}
+
+// Set a termination cell
+void NativeModel::setTerminationCell( const EntityId cell_id )
+{
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell_id ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  d_termination_cells.insert( cell_id );
+}
+
+// Set a reflecting surface
+void NativeModel::setReflectingSurface( const EntityId surface_id )
+{
+  TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surface_id ),
+                      InvalidNativeGeometry,
+                      "Surface " << surface_id << " does not exist!" );
+
+  d_reflecting_surfaces.insert( surface_id );
+}
+
+// Set the cell volume
+void NativeModel::setCellVolume( const EntityId cell_id, const Volume volume )
+{
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell_id ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  d_cell_volumes[cell_id] = volume;
+}
+
+// Set the surface area
+void NativeModel::setSurfaceArea( const EntityId surface_id, const Area area )
+{
+  TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surface_id ),
+                      InvalidNativeGeometry,
+                      "Surface " << surface_id << " does not exist!" );
+
+  d_surface_areas[surface_id] = area;
+}
+
+// Add a cell estimator
+void NativeModel::addCellEstimator( const EstimatorId estimator_id,
+                                    const EstimatorType estimator_type,
+                                    const ParticleType particle_type,
+                                    const CellIdArray& cells )
+{
+  TEST_FOR_EXCEPTION( isSurfaceEstimator( estimator_type ),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " is not a cell "
+                      "estimator!" );
+
+  TEST_FOR_EXCEPTION( d_cell_estimator_data.find( estimator_id ) !=
+                      d_cell_estimator_data.end() ||
+                      d_surface_estimator_data.find( estimator_id ) !=
+                      d_surface_estimator_data.end(),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " has already been "
+                      "added to the model!" );
+
+  for( size_t i = 0; i < cells.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( !this->doesCellExist( cells[i] ),
+                        InvalidNativeGeometry,
+                        "Estimator " << estimator_id << " references cell "
+                        << cells[i] << " which does not exist!" );
+  }
+
+  d_cell_estimator_data[estimator_id] =
+    std::make_tuple( estimator_type, particle_type, cells );
+}
+
+// Add a surface estimator
+void NativeModel::addSurfaceEstimator( const EstimatorId estimator_id,
+                                       const EstimatorType estimator_type,
+                                       const ParticleType particle_type,
+                                       const SurfaceIdArray& surfaces )
+{
+  TEST_FOR_EXCEPTION( !isSurfaceEstimator( estimator_type ),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " is not a surface "
+                      "estimator!" );
+
+  TEST_FOR_EXCEPTION( d_cell_estimator_data.find( estimator_id ) !=
+                      d_cell_estimator_data.end() ||
+                      d_surface_estimator_data.find( estimator_id ) !=
+                      d_surface_estimator_data.end(),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " has already been "
+                      "added to the model!" );
+
+  for( size_t i = 0; i < surfaces.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surfaces[i] ),
+                        InvalidNativeGeometry,
+                        "Estimator " << estimator_id << " references surface "
+                        << surfaces[i] << " which does not exist!" );
+  }
+
+  d_surface_estimator_data[estimator_id] =
+    std::make_tuple( estimator_type, particle_type, surfaces );
+}
+
+// Get the cell
+const NativeCell& NativeModel::getCell( const EntityId cell_id ) const
+{
+  // Make sure the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  return *d_cells.find( cell_id )->second;
+}
+
+// Get the surface
+const NativeSurface& NativeModel::getSurface( const EntityId surface_id ) const
+{
+  // Make sure the surface exists
+  testPrecondition( this->doesSurfaceExist( surface_id ) );
+
+  return *d_surfaces.find( surface_id )->second;
+}
+
+// Get the cells adjacent to a surface
+auto NativeModel::getCellsAdjacentToSurface(
+                      const EntityId surface_id ) const -> const CellArray&
+{
+  std::unordered_map<EntityId,CellArray>::const_iterator surface_cells_it =
+    d_surface_cells.find( surface_id );
+
+  if( surface_cells_it != d_surface_cells.end() )
+    return surface_cells_it->second;
+  else
+    return d_no_cells;
+}
+
+// Get the cells sorted by bounding box volume (unbounded cells last)
+auto NativeModel::getSearchOrderedCells() const -> const CellArray&
+{
+  return d_search_ordered_cells;
+}
+
+// Get the model name
+std::string NativeModel::getName() const
+{
+  return d_name;
+}
+
+// Check if the model has cell estimator data
+bool NativeModel::hasCellEstimatorData() const
+{
+  return !d_cell_estimator_data.empty();
+}
+
+// Get the material ids
+void NativeModel::getMaterialIds( MaterialIdSet& material_ids ) const
+{
+  for( auto&& cell_material_id : d_cell_material_ids )
+    material_ids.insert( cell_material_id.second );
+}
+
+// Get the cells
+void NativeModel::getCells( CellIdSet& cell_set,
+                            const bool include_void_cells,
+                            const bool include_termination_cells ) const
+{
+  for( auto&& cell : d_cells )
+  {
+    // Check if it is a termination cell
+    if( this->isTerminationCell( cell.first ) )
+    {
+      if( include_termination_cells )
+        cell_set.insert( cell.first );
+    }
+    // Check if it is a void cell
+    else if( this->isVoidCell( cell.first ) )
+    {
+      if( include_void_cells )
+        cell_set.insert( cell.first );
+    }
+    // Cell with material
+    else
+      cell_set.insert( cell.first );
+  }
+}
+
+// Get the cell material ids
+void NativeModel::getCellMaterialIds( CellIdMatIdMap& cell_id_mat_id_map ) const
+{
+  cell_id_mat_id_map.insert( d_cell_material_ids.begin(),
+                             d_cell_material_ids.end() );
+}
+
+// Get the cell densities
+void NativeModel::getCellDensities( CellIdDensityMap& cell_density_map ) const
+{
+  cell_density_map.insert( d_cell_densities.begin(),
+                           d_cell_densities.end() );
+}
+
+// Get the cell estimator data
+void NativeModel::getCellEstimatorData(
+                 CellEstimatorIdDataMap& cell_estimator_id_data_map ) const
+{
+  cell_estimator_id_data_map.insert( d_cell_estimator_data.begin(),
+                                     d_cell_estimator_data.end() );
+}
+
+// Check if a cell exists
+bool NativeModel::doesCellExist( const EntityId cell ) const
+{
+  return d_cells.find( cell ) != d_cells.end();
+}
+
+// Check if the cell is a termination cell
+bool NativeModel::isTerminationCell( const EntityId cell ) const
+{
+  return d_termination_cells.find( cell ) != d_termination_cells.end();
+}
+
+// Check if a cell is void
+bool NativeModel::isVoidCell( const EntityId cell ) const
+{
+  return d_cell_material_ids.find( cell ) == d_cell_material_ids.end();
+}
+
+// Estimate the volume of a bounded cell
+/*! \details The volume is estimated by testing the points at the centers of
+ * a regular grid that covers the cell bounding box. Without any random
+ * sampling the estimate is reproducible.
+ */
+double NativeModel::estimateCellVolume( const NativeCell& cell ) const
+{
+  const NativeCell::BoundingBox& bounding_box = cell.getBoundingBox();
+
+  double widths[3];
+
+  for( unsigned i = 0; i < 3; ++i )
+    widths[i] = (bounding_box[i+3] - bounding_box[i])/s_volume_grid_points;
+
+  // An arbitrary direction is used to resolve points on surfaces
+  const double direction[3] = {0.0, 0.0, 1.0};
+
+  size_t points_in_cell = 0;
+
+  for( unsigned k = 0; k < s_volume_grid_points; ++k )
+  {
+    for( unsigned j = 0; j < s_volume_grid_points; ++j )
+    {
+      for( unsigned i = 0; i < s_volume_grid_points; ++i )
+      {
+        const double position[3] = {bounding_box[0] + (i + 0.5)*widths[0],
+                                    bounding_box[1] + (j + 0.5)*widths[1],
+                                    bounding_box[2] + (k + 0.5)*widths[2]};
+
+        if( cell.isRayInCell( position, direction ) )
+          ++points_in_cell;
+      }
+    }
+  }
+
+  return points_in_cell*widths[0]*widths[1]*widths[2];
+}
+
+// Get the cell volume
+/*! \details If the volume of the cell has not been set it will be estimated
+ * from its bounding box. The volume of an unbounded cell is infinite.
+ */
+auto NativeModel::getCellVolume( const EntityId cell ) const -> Volume
+{
+  std::map<EntityId,Volume>::const_iterator cell_volume_it =
+    d_cell_volumes.find( cell );
+
+  if( cell_volume_it != d_cell_volumes.end() )
+    return cell_volume_it->second;
+
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell << " does not exist!" );
+
+  const NativeCell& native_cell = this->getCell( cell );
+
+  if( native_cell.isBounded() )
+    return Volume::from_value( this->estimateCellVolume( native_cell ) );
+  else
+    return Utility::QuantityTraits<Volume>::inf();
+}
+
+// Check if the model has surface estimator data
+bool NativeModel::hasSurfaceEstimatorData() const
+{
+  return !d_surface_estimator_data.empty();
+}
+
+// Get the surfaces
+void NativeModel::getSurfaces( SurfaceIdSet& surfaces ) const
+{
+  surfaces.insert( d_surface_ids.begin(), d_surface_ids.end() );
+}
+
+// Get the surface estimator data
+void NativeModel::getSurfaceEstimatorData(
+           SurfaceEstimatorIdDataMap& surface_estimator_id_data_map ) const
+{
+  surface_estimator_id_data_map.insert( d_surface_estimator_data.begin(),
+                                        d_surface_estimator_data.end() );
+}
+
+// Check if a surface exists
+bool NativeModel::doesSurfaceExist( const EntityId surface_id ) const
+{
+  return d_surfaces.find( surface_id ) != d_surfaces.end();
+}
+
+// Get the surface area
+/*! \details If the area of the surface has not been set it will be
+ * calculated if possible (spheres only). An exception will be thrown if
+ * the area cannot be calculated.
+ */
+auto NativeModel::getSurfaceArea( const EntityId surface_id ) const -> Area
+{
+  std::map<EntityId,Area>::const_iterator surface_area_it =
+    d_surface_areas.find( surface_id );
+
+  if( surface_area_it != d_surface_areas.end() )
+    return surface_area_it->second;
+
+  TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surface_id ),
+                      InvalidNativeGeometry,
+                      "Surface " << surface_id << " does not exist!" );
+
+  const double area = this->getSurface( surface_id ).getArea();
+
+  TEST_FOR_EXCEPTION( std::isinf( area ),
+                      InvalidNativeGeometry,
+                      "The area of surface " << surface_id << " cannot be "
+                      "calculated! It must be set with "
+                      "NativeModel::setSurfaceArea." );
+
+  return Area::from_value( area );
+}
+
+// Check if the surface is a reflecting surface
+bool NativeModel::isReflectingSurface( const EntityId surface_id ) const
+{
+  return d_reflecting_surfaces.find( surface_id ) !=
+    d_reflecting_surfaces.end();
+}
+
+// Create a raw, heap-allocated navigator
+NativeNavigator* NativeModel::createNavigatorAdvanced(
+    const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  return new NativeNavigator( this->shared_from_this(),
+                              advance_complete_callback );
+}
+
+// Create a raw, heap-allocated navigator (no callback)
+NativeNavigator* NativeModel::createNavigatorAdvanced() const
+{
+  return new NativeNavigator( this->shared_from_this() );
+}
+
+// Check if the model has been initialized
+/*! \details The native model is always ready to use since the cells are
+ * compiled when they are added.
+ */
+bool NativeModel::isInitialized() const
+{
+  return true;
+}
+
+// Initialize the model just-in-time
+void NativeModel::initializeJustInTime()
+{ /* ... */ }
+
+} // end Geometry namespace
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry::NativeModel );
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( NativeModel, Geometry );
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,315 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.hpp
+//! \author Alex Robinson
+//! \brief  The native geometry model class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_MODEL_HPP
+#define GEOMETRY_NATIVE_MODEL_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "Geometry_AdvancedModel.hpp"
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_NativeCell.hpp"
+#include "Geometry_NativeSurface.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+
+namespace Geometry{
+
+/*! The native geometry model
+ * \details The native model is a constructive solid geometry model that is
+ * built from analytic quadric surfaces and cells that are boolean
+ * combinations of the surface half-spaces. It has no external
+ * dependencies. The surfaces must be added before the cells that reference
+ * them. Cells without a material are void cells. At least one termination
+ * cell (e.g. the cell outside of the region of interest) should be defined
+ * so that particles leaving the model are killed.
+ */
+class NativeModel : public AdvancedModel,
+                    public std::enable_shared_from_this<NativeModel>
+{
+
+public:
+
+  //! Constructor
+  NativeModel( const std::string& name = "Native" );
+
+  //! Destructor
+  ~NativeModel()
+  { /* ... */ }
+
+  //! Add a surface
+  void addSurface( const NativeSurface& surface );
+
+  //! Add a void cell
+  void addCell( const EntityId cell_id, const std::string& definition );
+
+  //! Add a cell with a material
+  void addCell( const EntityId cell_id,
+                const std::string& definition,
+                const MaterialId material_id,
+                const Density density );
+
+  //! Set a termination cell
+  void setTerminationCell( const EntityId cell_id );
+
+  //! Set a reflecting surface
+  void setReflectingSurface( const EntityId surface_id );
+
+  //! Set the cell volume
+  void setCellVolume( const EntityId cell_id, const Volume volume );
+
+  //! Set the surface area
+  void setSurfaceArea( const EntityId surface_id, const Area area );
+
+  //! Add a cell estimator
+  void addCellEstimator( const EstimatorId estimator_id,
+                         const EstimatorType estimator_type,
+                         const ParticleType particle_type,
+                         const CellIdArray& cells );
+
+  //! Add a surface estimator
+  void addSurfaceEstimator( const EstimatorId estimator_id,
+                            const EstimatorType estimator_type,
+                            const ParticleType particle_type,
+                            const SurfaceIdArray& surfaces );
+
+  //! Get the cell
+  const NativeCell& getCell( const EntityId cell_id ) const;
+
+  //! Get the surface
+  const NativeSurface& getSurface( const EntityId surface_id ) const;
+
+  //! Get the model name
+  std::string getName() const override;
+
+  //! Check if the model has cell estimator data
+  bool hasCellEstimatorData() const override;
+
+  //! Get the material ids
+  void getMaterialIds( MaterialIdSet& material_ids ) const override;
+
+  //! Get the cells
+  void getCells( CellIdSet& cell_set,
+                 const bool include_void_cells,
+                 const bool include_termination_cells ) const override;
+
+  //! Get the cell material ids
+  void getCellMaterialIds( CellIdMatIdMap& cell_id_mat_id_map ) const override;
+
+  //! Get the cell densities
+  void getCellDensities( CellIdDensityMap& cell_density_map ) const override;
+
+  //! Get the cell estimator data
+  void getCellEstimatorData(
+           CellEstimatorIdDataMap& cell_estimator_id_data_map ) const override;
+
+  //! Check if a cell exists
+  bool doesCellExist( const EntityId cell ) const override;
+
+  //! Check if the cell is a termination cell
+  bool isTerminationCell( const EntityId cell ) const override;
+
+  //! Check if a cell is void
+  bool isVoidCell( const EntityId cell ) const override;
+
+  //! Get the cell volume
+  Volume getCellVolume( const EntityId cell ) const override;
+
+  //! Check if the model has surface estimator data
+  bool hasSurfaceEstimatorData() const override;
+
+  //! Get the surfaces
+  void getSurfaces( SurfaceIdSet& surfaces ) const override;
+
+  //! Get the surface estimator data
+  void getSurfaceEstimatorData( SurfaceEstimatorIdDataMap& surface_estimator_id_data_map ) const override;
+
+  //! Check if a surface exists
+  bool doesSurfaceExist( const EntityId surface_id ) const override;
+
+  //! Get the surface area
+  Area getSurfaceArea( const EntityId surface_id ) const override;
+
+  //! Check if the surface is a reflecting surface
+  bool isReflectingSurface( const EntityId surface_id ) const override;
+
+  //! Create a raw, heap-allocated navigator
+  NativeNavigator* createNavigatorAdvanced(
+                                    const Navigator::AdvanceCompleteCallback&
+                                    advance_complete_callback ) const override;
+
+  //! Create a raw, heap-allocated navigator (no callback)
+  NativeNavigator* createNavigatorAdvanced() const override;
+
+  //! Check if the model has been initialized
+  bool isInitialized() const final override;
+
+protected:
+
+  //! Initialize the model just-in-time
+  void initializeJustInTime() final override;
+
+private:
+
+  // The cell array type
+  typedef std::vector<const NativeCell*> CellArray;
+
+  // Add a cell
+  void addCellImpl( const EntityId cell_id, const std::string& definition );
+
+  // Get the cells adjacent to a surface
+  const CellArray& getCellsAdjacentToSurface( const EntityId surface_id ) const;
+
+  // Get the cells sorted by bounding box volume (unbounded cells last)
+  const CellArray& getSearchOrderedCells() const;
+
+  // Estimate the volume of a bounded cell
+  double estimateCellVolume( const NativeCell& cell ) const;
+
+  // Save the model to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the model from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // Declare the NativeNavigator as a friend
+  friend class NativeNavigator;
+
+  // The number of volume estimation grid points along each axis
+  static const unsigned s_volume_grid_points;
+
+  // The model name
+  std::string d_name;
+
+  // The surfaces
+  NativeCell::SurfaceMap d_surfaces;
+
+  // The surface ids in the order that they were added
+  std::vector<EntityId> d_surface_ids;
+
+  // The cells
+  std::map<EntityId,std::shared_ptr<const NativeCell> > d_cells;
+
+  // The cell ids and definitions in the order that they were added
+  std::vector<std::pair<EntityId,std::string> > d_cell_definitions;
+
+  // The cell material ids
+  CellIdMatIdMap d_cell_material_ids;
+
+  // The cell densities
+  CellIdDensityMap d_cell_densities;
+
+  // The termination cells
+  CellIdSet d_termination_cells;
+
+  // The reflecting surfaces
+  SurfaceIdSet d_reflecting_surfaces;
+
+  // The user specified cell volumes
+  std::map<EntityId,Volume> d_cell_volumes;
+
+  // The user specified surface areas
+  std::map<EntityId,Area> d_surface_areas;
+
+  // The cell estimator data
+  CellEstimatorIdDataMap d_cell_estimator_data;
+
+  // The surface estimator data
+  SurfaceEstimatorIdDataMap d_surface_estimator_data;
+
+  // The cells adjacent to each surface
+  std::unordered_map<EntityId,CellArray> d_surface_cells;
+
+  // The cells sorted by bounding box volume (unbounded cells last)
+  CellArray d_search_ordered_cells;
+
+  // An empty cell array
+  CellArray d_no_cells;
+};
+
+// Save the model to an archive
+template<typename Archive>
+void NativeModel::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Save the local member data
+  std::vector<NativeSurface> surfaces;
+
+  for( size_t i = 0; i < d_surface_ids.size(); ++i )
+    surfaces.push_back( *d_surfaces.find( d_surface_ids[i] )->second );
+
+  ar & BOOST_SERIALIZATION_NVP( d_name );
+  ar & BOOST_SERIALIZATION_NVP( surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_definitions );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_material_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_densities );
+  ar & BOOST_SERIALIZATION_NVP( d_termination_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_reflecting_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_volumes );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_areas );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_estimator_data );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_estimator_data );
+}
+
+// Load the model from an archive
+/*! \details The cells are recompiled from their definitions.
+ */
+template<typename Archive>
+void NativeModel::load( Archive& ar, const unsigned version )
+{
+  // Load the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Load the local member data
+  std::vector<NativeSurface> surfaces;
+  std::vector<std::pair<EntityId,std::string> > cell_definitions;
+
+  ar & BOOST_SERIALIZATION_NVP( d_name );
+  ar & BOOST_SERIALIZATION_NVP( surfaces );
+  ar & boost::serialization::make_nvp( "d_cell_definitions", cell_definitions );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_material_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_densities );
+  ar & BOOST_SERIALIZATION_NVP( d_termination_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_reflecting_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_volumes );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_areas );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_estimator_data );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_estimator_data );
+
+  for( size_t i = 0; i < surfaces.size(); ++i )
+    this->addSurface( surfaces[i] );
+
+  for( size_t i = 0; i < cell_definitions.size(); ++i )
+  {
+    this->addCellImpl( cell_definitions[i].first,
+                       cell_definitions[i].second );
+  }
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeModel, Geometry, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( NativeModel, Geometry );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry, NativeModel );
+
+#endif // end GEOMETRY_NATIVE_MODEL_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.hpp
+//---------------------------------------------------------------------------//
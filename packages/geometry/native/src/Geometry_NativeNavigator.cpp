@@ -0,0 +1,563 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  The native geometry model navigator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Constructor
+NativeNavigator::NativeNavigator(
+          const std::shared_ptr<const NativeModel>& native_model,
+          const Navigator::AdvanceCompleteCallback& advance_complete_callback )
+  : Navigator( advance_complete_callback ),
+    d_model( native_model ),
+    d_cell( NULL ),
+    d_boundary_surface_id( Navigator::invalidSurfaceId() ),
+    d_boundary_surface_sense( NativeSurface::ON_SURFACE ),
+    d_distance_to_boundary( -1.0 ),
+    d_boundary_surface_hit( Navigator::invalidSurfaceId() ),
+    d_safety_distance( -1.0 )
+{
+  // Make sure the model is valid
+  testPrecondition( native_model.get() );
+
+  d_position[0] = 0.0*boost::units::cgs::centimeter;
+  d_position[1] = 0.0*boost::units::cgs::centimeter;
+  d_position[2] = 0.0*boost::units::cgs::centimeter;
+
+  d_direction[0] = 0.0;
+  d_direction[1] = 0.0;
+  d_direction[2] = 1.0;
+}
+
+// Copy constructor
+/*! \details This constructor should only be used within the clone method. The
+ * Navigator::AdvanceCompleteCallback will also be copied
+ */
+NativeNavigator::NativeNavigator( const NativeNavigator& other )
+  : Navigator( other ),
+    d_model( other.d_model )
+{
+  this->copyInternalRayState( other );
+}
+
+// Copy the internal ray state of another navigator
+void NativeNavigator::copyInternalRayState( const NativeNavigator& other )
+{
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    d_position[i] = other.d_position[i];
+    d_direction[i] = other.d_direction[i];
+  }
+
+  d_cell = other.d_cell;
+  d_boundary_surface_id = other.d_boundary_surface_id;
+  d_boundary_surface_sense = other.d_boundary_surface_sense;
+  d_distance_to_boundary = other.d_distance_to_boundary;
+  d_boundary_surface_hit = other.d_boundary_surface_hit;
+  d_safety_distance = other.d_safety_distance;
+}
+
+// Reset the cached distances
+void NativeNavigator::resetCachedDistances()
+{
+  d_distance_to_boundary = -1.0;
+  d_boundary_surface_hit = Navigator::invalidSurfaceId();
+  d_safety_distance = -1.0;
+}
+
+// Get the raw internal ray position (cm)
+inline void NativeNavigator::getRawPosition( double raw_position[3] ) const
+{
+  raw_position[0] = d_position[0].value();
+  raw_position[1] = d_position[1].value();
+  raw_position[2] = d_position[2].value();
+}
+
+// Get the location of a point w.r.t. a given cell
+PointLocation NativeNavigator::getPointLocation(
+                                             const Length position[3],
+                                             const double direction[3],
+                                             const EntityId cell ) const
+{
+  TEST_FOR_EXCEPTION( !d_model->doesCellExist( cell ),
+                      NativeGeometryError,
+                      "Cell " << cell << " does not exist!" );
+
+  const double raw_position[3] =
+    {position[0].value(), position[1].value(), position[2].value()};
+
+  if( d_model->getCell( cell ).isRayInCell( raw_position, direction ) )
+    return POINT_INSIDE_CELL;
+  else
+    return POINT_OUTSIDE_CELL;
+}
+
+// Get the surface normal at a point on the surface
+/*! \details The normal will be flipped if necessary so that its dot product
+ * with the direction is positive.
+ */
+void NativeNavigator::getSurfaceNormal( const EntityId surface_id,
+                                        const Length position[3],
+                                        const double direction[3],
+                                        double normal[3] ) const
+{
+  TEST_FOR_EXCEPTION( !d_model->doesSurfaceExist( surface_id ),
+                      NativeGeometryError,
+                      "Surface " << surface_id << " does not exist!" );
+
+  const double raw_position[3] =
+    {position[0].value(), position[1].value(), position[2].value()};
+
+  d_model->getSurface( surface_id ).getUnitNormalAtPoint( raw_position,
+                                                          normal );
+
+  if( normal[0]*direction[0] +
+      normal[1]*direction[1] +
+      normal[2]*direction[2] < 0.0 )
+  {
+    normal[0] = -normal[0];
+    normal[1] = -normal[1];
+    normal[2] = -normal[2];
+  }
+}
+
+// Find the cell that contains the ray from a set of candidate cells
+/*! \details The bounding box of each candidate cell is checked before the
+ * more expensive point-in-cell test is done.
+ */
+const NativeCell* NativeNavigator::findCellContainingRayInCells(
+                     const double position[3],
+                     const double direction[3],
+                     const CellArray& candidate_cells,
+                     const EntityId boundary_surface_id,
+                     const NativeSurface::Sense boundary_surface_sense,
+                     const NativeCell* skip_cell ) const
+{
+  for( size_t i = 0; i < candidate_cells.size(); ++i )
+  {
+    const NativeCell* candidate_cell = candidate_cells[i];
+
+    if( candidate_cell == skip_cell )
+      continue;
+
+    if( !candidate_cell->isPointInBoundingBox( position ) )
+      continue;
+
+    if( candidate_cell->isRayInCell( position,
+                                     direction,
+                                     boundary_surface_id,
+                                     boundary_surface_sense ) )
+      return candidate_cell;
+  }
+
+  return NULL;
+}
+
+// Find the cell that contains the ray
+/*! \details NULL will be returned if the cell cannot be found.
+ */
+const NativeCell* NativeNavigator::findNativeCellContainingRay(
+                     const double position[3],
+                     const double direction[3],
+                     const EntityId boundary_surface_id,
+                     const NativeSurface::Sense boundary_surface_sense ) const
+{
+  return this->findCellContainingRayInCells( position,
+                                             direction,
+                                             d_model->getSearchOrderedCells(),
+                                             boundary_surface_id,
+                                             boundary_surface_sense );
+}
+
+// Find the cell that contains a given ray
+auto NativeNavigator::findCellContainingRay(
+                                   const Length position[3],
+                                   const double direction[3],
+                                   CellIdSet& found_cell_cache ) const
+  -> EntityId
+{
+  const double raw_position[3] =
+    {position[0].value(), position[1].value(), position[2].value()};
+
+  // Check the cells in the cache first
+  CellIdSet::const_iterator cell_id_it = found_cell_cache.begin();
+
+  while( cell_id_it != found_cell_cache.end() )
+  {
+    if( d_model->doesCellExist( *cell_id_it ) )
+    {
+      if( d_model->getCell( *cell_id_it ).isRayInCell( raw_position,
+                                                       direction ) )
+        return *cell_id_it;
+    }
+
+    ++cell_id_it;
+  }
+
+  // Search the model
+  const EntityId cell_id = this->findCellContainingRay( position, direction );
+
+  found_cell_cache.insert( cell_id );
+
+  return cell_id;
+}
+
+// Find the cell that contains a given ray
+auto NativeNavigator::findCellContainingRay(
+                                  const Length position[3],
+                                  const double direction[3] ) const -> EntityId
+{
+  const double raw_position[3] =
+    {position[0].value(), position[1].value(), position[2].value()};
+
+  const NativeCell* cell =
+    this->findNativeCellContainingRay( raw_position, direction );
+
+  TEST_FOR_EXCEPTION( cell == NULL,
+                      NativeGeometryError,
+                      "Could not find the cell that contains the ray! "
+                      "Here are the details...\n  "
+                      "  Position: "
+                      << this->arrayToString( position ) << "\n"
+                      "  Direction: "
+                      << this->arrayToString( direction ) );
+
+  return cell->getId();
+}
+
+// Check if an internal ray has been set
+bool NativeNavigator::isStateSet() const
+{
+  return d_cell != NULL;
+}
+
+// Set the internal ray with unknown starting cell
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction )
+{
+  const Length position[3] = {x_position, y_position, z_position};
+  const double direction[3] = {x_direction, y_direction, z_direction};
+
+  const EntityId start_cell =
+    this->findCellContainingRay( position, direction );
+
+  this->setState( x_position, y_position, z_position,
+                  x_direction, y_direction, z_direction,
+                  start_cell );
+}
+
+// Set the internal ray with known starting cell
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction,
+                                const EntityId start_cell )
+{
+  // Make sure the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  TEST_FOR_EXCEPTION( !d_model->doesCellExist( start_cell ),
+                      NativeGeometryError,
+                      "Cell " << start_cell << " does not exist!" );
+
+  d_position[0] = x_position;
+  d_position[1] = y_position;
+  d_position[2] = z_position;
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  d_cell = &d_model->getCell( start_cell );
+
+  d_boundary_surface_id = Navigator::invalidSurfaceId();
+  d_boundary_surface_sense = NativeSurface::ON_SURFACE;
+
+  this->resetCachedDistances();
+}
+
+// Get the internal ray position
+auto NativeNavigator::getPosition() const -> const Length*
+{
+  return d_position;
+}
+
+// Get the internal ray direction
+const double* NativeNavigator::getDirection() const
+{
+  return d_direction;
+}
+
+// Get the cell that contains the internal ray
+auto NativeNavigator::getCurrentCell() const -> EntityId
+{
+  // Make sure the internal ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_cell->getId();
+}
+
+// Get the distance from the internal ray pos. to the nearest boundary in all directions
+/*! \details The distance is exact for cells bounded by planes, spheres and
+ * axis-aligned cylinders and zero for cells bounded by general quadrics.
+ */
+auto NativeNavigator::getDistanceToClosestBoundary() -> Length
+{
+  // Make sure the internal ray is set
+  testPrecondition( this->isStateSet() );
+
+  if( d_safety_distance < 0.0 )
+  {
+    double raw_position[3];
+
+    this->getRawPosition( raw_position );
+
+    d_safety_distance = d_cell->getSafetyDistance( raw_position );
+  }
+
+  return Length::from_value( d_safety_distance );
+}
+
+// Fire the internal ray through the geometry
+/*! \details The distance to the boundary is cached until the ray direction
+ * changes or the ray crosses a surface.
+ */
+auto NativeNavigator::fireRay( EntityId* surface_hit ) -> Length
+{
+  // Make sure the internal ray is set
+  testPrecondition( this->isStateSet() );
+
+  if( d_distance_to_boundary < 0.0 )
+  {
+    double raw_position[3];
+
+    this->getRawPosition( raw_position );
+
+    d_distance_to_boundary =
+      d_cell->getDistanceToBoundary( raw_position,
+                                     d_direction,
+                                     d_boundary_surface_id,
+                                     d_boundary_surface_hit );
+  }
+
+  if( surface_hit )
+    *surface_hit = d_boundary_surface_hit;
+
+  return Length::from_value( d_distance_to_boundary );
+}
+
+// Fire the internal ray if the boundary could be within the distance
+/*! \details If the safety distance is greater than the distance the
+ * surfaces of the cell will not be intersected.
+ */
+auto NativeNavigator::fireRayIfBoundaryIsWithin( const Length distance,
+                                                 EntityId* surface_hit )
+  -> Length
+{
+  if( d_distance_to_boundary < 0.0 )
+  {
+    if( this->getDistanceToClosestBoundary() > distance )
+      return Utility::QuantityTraits<Length>::inf();
+  }
+
+  return this->fireRay( surface_hit );
+}
+
+// Change the internal ray direction
+/*! \details The safety distance does not depend on the direction so it will
+ * not be reset.
+ */
+void NativeNavigator::changeDirection( const double x_direction,
+                                       const double y_direction,
+                                       const double z_direction )
+{
+  // Make sure the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  d_distance_to_boundary = -1.0;
+  d_boundary_surface_hit = Navigator::invalidSurfaceId();
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone(
+               const AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  NativeNavigator* cloned_navigator =
+    new NativeNavigator( d_model, advance_complete_callback );
+
+  cloned_navigator->copyInternalRayState( *this );
+
+  return cloned_navigator;
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone() const
+{
+  return new NativeNavigator( *this );
+}
+
+// Advance the internal ray to the cell boundary
+/*! \details The cells that are adjacent to the surface that is hit are
+ * checked first. If none of them contain the ray the current cell is
+ * checked (the surface may be internal to a cell that is defined with
+ * unions) and then the entire model is searched.
+ */
+bool NativeNavigator::advanceToCellBoundaryImpl( double* surface_normal,
+                                                 Length& distance_traveled )
+{
+  EntityId surface_hit;
+
+  distance_traveled = this->fireRay( &surface_hit );
+
+  TEST_FOR_EXCEPTION( surface_hit == Navigator::invalidSurfaceId(),
+                      NativeGeometryError,
+                      "The ray in cell " << d_cell->getId() << " does not "
+                      "intersect any of the cell surfaces!" );
+
+  for( unsigned i = 0; i < 3; ++i )
+    d_position[i] += distance_traveled*d_direction[i];
+
+  if( surface_normal != NULL )
+  {
+    this->getSurfaceNormal( surface_hit,
+                            d_position,
+                            d_direction,
+                            surface_normal );
+  }
+
+  double raw_position[3];
+
+  this->getRawPosition( raw_position );
+
+  const NativeSurface& surface = d_model->getSurface( surface_hit );
+
+  this->resetCachedDistances();
+
+  d_boundary_surface_id = surface_hit;
+
+  if( d_model->isReflectingSurface( surface_hit ) )
+  {
+    double normal[3], reflected_direction[3];
+
+    surface.getUnitNormalAtPoint( raw_position, normal );
+
+    Utility::reflectUnitVector( d_direction, normal, reflected_direction );
+
+    d_direction[0] = reflected_direction[0];
+    d_direction[1] = reflected_direction[1];
+    d_direction[2] = reflected_direction[2];
+
+    // The reflected ray is moving back into the current cell
+    d_boundary_surface_sense =
+      surface.getSenseOfRayOnSurface( raw_position, d_direction );
+
+    return true;
+  }
+
+  d_boundary_surface_sense =
+    surface.getSenseOfRayOnSurface( raw_position, d_direction );
+
+  const NativeCell* next_cell =
+    this->findCellContainingRayInCells(
+                               raw_position,
+                               d_direction,
+                               d_model->getCellsAdjacentToSurface( surface_hit ),
+                               d_boundary_surface_id,
+                               d_boundary_surface_sense,
+                               d_cell );
+
+  if( next_cell == NULL )
+  {
+    if( d_cell->isRayInCell( raw_position,
+                             d_direction,
+                             d_boundary_surface_id,
+                             d_boundary_surface_sense ) )
+      next_cell = d_cell;
+    else
+    {
+      next_cell = this->findNativeCellContainingRay( raw_position,
+                                                     d_direction,
+                                                     d_boundary_surface_id,
+                                                     d_boundary_surface_sense );
+    }
+  }
+
+  TEST_FOR_EXCEPTION( next_cell == NULL,
+                      NativeGeometryError,
+                      "Could not find the cell on the other side of surface "
+                      << surface_hit << " from cell " << d_cell->getId()
+                      << "! Here are the details...\n  "
+                      "  Position: "
+                      << this->arrayToString( d_position ) << "\n"
+                      "  Direction: "
+                      << this->arrayToString( d_direction ) );
+
+  d_cell = next_cell;
+
+  return false;
+}
+
+// Advance the internal ray by a substep (less than distance to boundary)
+/*! \details The cached distance to the boundary is reduced by the step size
+ * since the direction does not change. The cached safety distance is
+ * reduced by the step size, which keeps it a valid lower bound.
+ */
+void NativeNavigator::advanceBySubstepImpl( const Length step_size )
+{
+  // Make sure the internal ray is set
+  testPrecondition( this->isStateSet() );
+
+  for( unsigned i = 0; i < 3; ++i )
+    d_position[i] += step_size*d_direction[i];
+
+  const double raw_step_size = step_size.value();
+
+  if( d_distance_to_boundary >= 0.0 )
+  {
+    d_distance_to_boundary -= raw_step_size;
+
+    if( d_distance_to_boundary < 0.0 )
+      d_distance_to_boundary = 0.0;
+  }
+
+  if( d_safety_distance >= 0.0 )
+  {
+    d_safety_distance -= raw_step_size;
+
+    if( d_safety_distance < 0.0 )
+      d_safety_distance = -1.0;
+  }
+
+  d_boundary_surface_id = Navigator::invalidSurfaceId();
+  d_boundary_surface_sense = NativeSurface::ON_SURFACE;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeNavigator.cpp
+//---------------------------------------------------------------------------//
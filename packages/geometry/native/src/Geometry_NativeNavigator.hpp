@@ -0,0 +1,224 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeNavigator.hpp
+//! \author Alex Robinson
+//! \brief  The native geometry model navigator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_NAVIGATOR_HPP
+#define GEOMETRY_NATIVE_NAVIGATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "Geometry_Navigator.hpp"
+#include "Geometry_NativeCell.hpp"
+#include "Geometry_NativeSurface.hpp"
+
+namespace Geometry{
+
+class NativeModel;
+
+/*! The native geometry navigator
+ * \details The distance to the cell boundary is only calculated when it is
+ * needed and is cached until the ray direction changes. When a surface is
+ * crossed only the cells that are adjacent to the surface are tested
+ * before a search of the model (with bounding box culling) is done. The
+ * sense of the ray w.r.t. the surface that was just crossed is recorded so
+ * that round-off can never place the ray on the wrong side of it.
+ */
+class NativeNavigator : public Navigator
+{
+
+public:
+
+  //! Constructor
+  NativeNavigator(
+          const std::shared_ptr<const NativeModel>& native_model,
+          const Navigator::AdvanceCompleteCallback& advance_complete_callback =
+          Navigator::AdvanceCompleteCallback() );
+
+  //! Destructor
+  ~NativeNavigator()
+  { /* ... */ }
+
+  //! Get the location of a point w.r.t. a given cell
+  PointLocation getPointLocation(
+                                const Length position[3],
+                                const double direction[3],
+                                const EntityId cell ) const override;
+
+  //! Get the surface normal at a point on the surface
+  void getSurfaceNormal( const EntityId surface_id,
+                         const Length position[3],
+                         const double direction[3],
+                         double normal[3] ) const override;
+
+  //! Find the cell that contains a given ray
+  EntityId findCellContainingRay(
+                                  const Length position[3],
+                                  const double direction[3],
+                                  CellIdSet& found_cell_cache ) const override;
+
+  //! Find the cell that contains a given ray
+  EntityId findCellContainingRay(
+                                    const Length position[3],
+                                    const double direction[3] ) const override;
+
+  //! Check if an internal ray has been set
+  bool isStateSet() const override;
+
+  //! Set the internal ray with unknown starting cell
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction ) override;
+
+  //! Set the internal ray with known starting cell
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction,
+                 const EntityId start_cell ) override;
+
+  //! Set the internal ray state (base class overloads)
+  using Navigator::setState;
+
+  //! Get the internal ray position
+  const Length* getPosition() const override;
+
+  //! Get the internal ray direction
+  const double* getDirection() const override;
+
+  //! Get the cell that contains the internal ray
+  EntityId getCurrentCell() const override;
+
+  //! Get the distance from the internal ray pos. to the nearest boundary in all directions
+  Length getDistanceToClosestBoundary() override;
+
+  //! Fire the internal ray through the geometry
+  Length fireRay( EntityId* surface_hit ) override;
+
+  //! Fire the internal ray through the geometry (base class overloads)
+  using Navigator::fireRay;
+
+  //! Fire the internal ray if the boundary could be within the distance
+  Length fireRayIfBoundaryIsWithin( const Length distance,
+                                    EntityId* surface_hit ) override;
+
+  //! Fire the internal ray if the boundary could be within the distance (base class overloads)
+  using Navigator::fireRayIfBoundaryIsWithin;
+
+  //! Change the internal ray direction
+  void changeDirection( const double x_direction,
+                        const double y_direction,
+                        const double z_direction ) override;
+
+  //! Change the internal ray direction (base class overloads)
+  using Navigator::changeDirection;
+
+  //! Clone the navigator
+  NativeNavigator* clone( const AdvanceCompleteCallback& advance_complete_callback ) const override;
+
+  //! Clone the navigator
+  NativeNavigator* clone() const override;
+
+protected:
+
+  //! Copy constructor
+  NativeNavigator( const NativeNavigator& other );
+
+  //! Advance the internal ray to the cell boundary
+  bool advanceToCellBoundaryImpl( double* surface_normal,
+                                  Length& distance_traveled ) override;
+
+  //! Advance the internal ray by a substep (less than distance to boundary)
+  void advanceBySubstepImpl( const Length step_size ) override;
+
+private:
+
+  // The cell array type
+  typedef std::vector<const NativeCell*> CellArray;
+
+  // Copy the internal ray state of another navigator
+  void copyInternalRayState( const NativeNavigator& other );
+
+  // Reset the cached distances
+  void resetCachedDistances();
+
+  // Get the raw internal ray position (cm)
+  void getRawPosition( double raw_position[3] ) const;
+
+  // Find the cell that contains the ray from a set of candidate cells
+  const NativeCell* findCellContainingRayInCells(
+                    const double position[3],
+                    const double direction[3],
+                    const CellArray& candidate_cells,
+                    const EntityId boundary_surface_id,
+                    const NativeSurface::Sense boundary_surface_sense,
+                    const NativeCell* skip_cell = NULL ) const;
+
+  // Find the cell that contains the ray
+  const NativeCell* findNativeCellContainingRay(
+                    const double position[3],
+                    const double direction[3],
+                    const EntityId boundary_surface_id =
+                    Navigator::invalidSurfaceId(),
+                    const NativeSurface::Sense boundary_surface_sense =
+                    NativeSurface::ON_SURFACE ) const;
+
+  // The native model
+  std::shared_ptr<const NativeModel> d_model;
+
+  // The position
+  Length d_position[3];
+
+  // The direction
+  double d_direction[3];
+
+  // The cell that contains the ray
+  const NativeCell* d_cell;
+
+  // The surface that the ray is on
+  EntityId d_boundary_surface_id;
+
+  // The sense of the ray w.r.t. the surface that it is on
+  NativeSurface::Sense d_boundary_surface_sense;
+
+  // The distance to the cell boundary (negative if unknown)
+  double d_distance_to_boundary;
+
+  // The surface that will be hit at the cell boundary
+  EntityId d_boundary_surface_hit;
+
+  // The distance to the closest boundary in all directions (negative if unknown)
+  double d_safety_distance;
+};
+
+/*! The native geometry error
+ * \details This error class can be used to record lost particles.
+ */
+class NativeGeometryError : public GeometryError
+{
+
+public:
+
+  NativeGeometryError( const std::string& what )
+    : GeometryError( what )
+  { /* ... */ }
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_NATIVE_NAVIGATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeNavigator.hpp
+//---------------------------------------------------------------------------//
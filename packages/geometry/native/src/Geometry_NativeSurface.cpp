@@ -0,0 +1,614 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeSurface.cpp
+//! \author Alex Robinson
+//! \brief  The native geometry surface class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_NativeSurface.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Default constructor
+NativeSurface::NativeSurface()
+  : d_id( Navigator::invalidSurfaceId() ),
+    d_coefficients(),
+    d_tolerance( 1e-9 ),
+    d_type( GENERAL_QUADRIC ),
+    d_center(),
+    d_radius( 0.0 )
+{ /* ... */ }
+
+// General quadric surface constructor
+NativeSurface::NativeSurface( const EntityId id,
+                              const double a,
+                              const double b,
+                              const double c,
+                              const double d,
+                              const double e,
+                              const double f,
+                              const double g,
+                              const double h,
+                              const double j,
+                              const double k,
+                              const double tolerance )
+  : d_id( id ),
+    d_coefficients( {a, b, c, d, e, f, g, h, j, k} ),
+    d_tolerance( tolerance ),
+    d_type( GENERAL_QUADRIC ),
+    d_center(),
+    d_radius( 0.0 )
+{
+  // Make sure the tolerance is valid
+  testPrecondition( tolerance >= 0.0 );
+
+  this->classify();
+}
+
+// Create a general plane (n_x*x + n_y*y + n_z*z - offset = 0)
+NativeSurface NativeSurface::createPlane( const EntityId id,
+                                          const double x_normal,
+                                          const double y_normal,
+                                          const double z_normal,
+                                          const double offset )
+{
+  return NativeSurface( id,
+                        0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+                        x_normal, y_normal, z_normal, -offset );
+}
+
+// Create a plane normal to the x-axis (x - x_0 = 0)
+NativeSurface NativeSurface::createXPlane( const EntityId id,
+                                           const double x_0 )
+{
+  return NativeSurface::createPlane( id, 1.0, 0.0, 0.0, x_0 );
+}
+
+// Create a plane normal to the y-axis (y - y_0 = 0)
+NativeSurface NativeSurface::createYPlane( const EntityId id,
+                                           const double y_0 )
+{
+  return NativeSurface::createPlane( id, 0.0, 1.0, 0.0, y_0 );
+}
+
+// Create a plane normal to the z-axis (z - z_0 = 0)
+NativeSurface NativeSurface::createZPlane( const EntityId id,
+                                           const double z_0 )
+{
+  return NativeSurface::createPlane( id, 0.0, 0.0, 1.0, z_0 );
+}
+
+// Create a sphere
+/*! \details Points inside of the sphere have a negative sense.
+ */
+NativeSurface NativeSurface::createSphere( const EntityId id,
+                                           const double x_0,
+                                           const double y_0,
+                                           const double z_0,
+                                           const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return NativeSurface( id,
+                        1.0, 1.0, 1.0, 0.0, 0.0, 0.0,
+                        -2.0*x_0, -2.0*y_0, -2.0*z_0,
+                        x_0*x_0 + y_0*y_0 + z_0*z_0 - radius*radius );
+}
+
+// Create a cylinder parallel to the x-axis
+/*! \details Points inside of the cylinder have a negative sense.
+ */
+NativeSurface NativeSurface::createXCylinder( const EntityId id,
+                                              const double y_0,
+                                              const double z_0,
+                                              const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return NativeSurface( id,
+                        0.0, 1.0, 1.0, 0.0, 0.0, 0.0,
+                        0.0, -2.0*y_0, -2.0*z_0,
+                        y_0*y_0 + z_0*z_0 - radius*radius );
+}
+
+// Create a cylinder parallel to the y-axis
+/*! \details Points inside of the cylinder have a negative sense.
+ */
+NativeSurface NativeSurface::createYCylinder( const EntityId id,
+                                              const double x_0,
+                                              const double z_0,
+                                              const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return NativeSurface( id,
+                        1.0, 0.0, 1.0, 0.0, 0.0, 0.0,
+                        -2.0*x_0, 0.0, -2.0*z_0,
+                        x_0*x_0 + z_0*z_0 - radius*radius );
+}
+
+// Create a cylinder parallel to the z-axis
+/*! \details Points inside of the cylinder have a negative sense.
+ */
+NativeSurface NativeSurface::createZCylinder( const EntityId id,
+                                              const double x_0,
+                                              const double y_0,
+                                              const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return NativeSurface( id,
+                        1.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+                        -2.0*x_0, -2.0*y_0, 0.0,
+                        x_0*x_0 + y_0*y_0 - radius*radius );
+}
+
+// Classify the surface from its coefficients
+/*! \details Surfaces that are not planes, spheres or axis-aligned cylinders
+ * are treated as general quadrics.
+ */
+void NativeSurface::classify()
+{
+  const double a = d_coefficients[0];
+  const double b = d_coefficients[1];
+  const double c = d_coefficients[2];
+  const double g = d_coefficients[6];
+  const double h = d_coefficients[7];
+  const double j = d_coefficients[8];
+  const double k = d_coefficients[9];
+
+  d_type = GENERAL_QUADRIC;
+  d_center = {0.0, 0.0, 0.0};
+  d_radius = 0.0;
+
+  // Cross terms are only allowed for general quadrics
+  if( d_coefficients[3] != 0.0 ||
+      d_coefficients[4] != 0.0 ||
+      d_coefficients[5] != 0.0 )
+    return;
+
+  if( a == 0.0 && b == 0.0 && c == 0.0 )
+  {
+    if( g != 0.0 || h != 0.0 || j != 0.0 )
+      d_type = PLANE;
+  }
+  else if( a == b && b == c )
+  {
+    d_center = {-g/(2*a), -h/(2*a), -j/(2*a)};
+
+    const double radius_squared = d_center[0]*d_center[0] +
+      d_center[1]*d_center[1] + d_center[2]*d_center[2] - k/a;
+
+    if( radius_squared > 0.0 )
+    {
+      d_type = SPHERE;
+      d_radius = std::sqrt( radius_squared );
+    }
+  }
+  else if( a == 0.0 && g == 0.0 && b == c )
+  {
+    d_center = {0.0, -h/(2*b), -j/(2*b)};
+
+    const double radius_squared =
+      d_center[1]*d_center[1] + d_center[2]*d_center[2] - k/b;
+
+    if( radius_squared > 0.0 )
+    {
+      d_type = X_CYLINDER;
+      d_radius = std::sqrt( radius_squared );
+    }
+  }
+  else if( b == 0.0 && h == 0.0 && a == c )
+  {
+    d_center = {-g/(2*a), 0.0, -j/(2*a)};
+
+    const double radius_squared =
+      d_center[0]*d_center[0] + d_center[2]*d_center[2] - k/a;
+
+    if( radius_squared > 0.0 )
+    {
+      d_type = Y_CYLINDER;
+      d_radius = std::sqrt( radius_squared );
+    }
+  }
+  else if( c == 0.0 && j == 0.0 && a == b )
+  {
+    d_center = {-g/(2*a), -h/(2*a), 0.0};
+
+    const double radius_squared =
+      d_center[0]*d_center[0] + d_center[1]*d_center[1] - k/a;
+
+    if( radius_squared > 0.0 )
+    {
+      d_type = Z_CYLINDER;
+      d_radius = std::sqrt( radius_squared );
+    }
+  }
+}
+
+// Get the surface id
+auto NativeSurface::getId() const -> EntityId
+{
+  return d_id;
+}
+
+// Get the quadric coefficients (a, b, c, d, e, f, g, h, j, k)
+const std::array<double,10>& NativeSurface::getCoefficients() const
+{
+  return d_coefficients;
+}
+
+// Check if the surface is a plane
+bool NativeSurface::isPlanar() const
+{
+  return d_type == PLANE;
+}
+
+// Check if the surface is a sphere
+bool NativeSurface::isSpherical() const
+{
+  return d_type == SPHERE;
+}
+
+// Evaluate the surface quadric at a point
+double NativeSurface::evaluate( const double position[3] ) const
+{
+  const double x = position[0];
+  const double y = position[1];
+  const double z = position[2];
+
+  return x*(d_coefficients[0]*x + d_coefficients[3]*y + d_coefficients[5]*z +
+            d_coefficients[6]) +
+    y*(d_coefficients[1]*y + d_coefficients[4]*z + d_coefficients[7]) +
+    z*(d_coefficients[2]*z + d_coefficients[8]) +
+    d_coefficients[9];
+}
+
+// Get the gradient of the surface quadric at a point
+void NativeSurface::getGradient( const double position[3],
+                                 double gradient[3] ) const
+{
+  const double x = position[0];
+  const double y = position[1];
+  const double z = position[2];
+
+  gradient[0] = 2*d_coefficients[0]*x + d_coefficients[3]*y +
+    d_coefficients[5]*z + d_coefficients[6];
+
+  gradient[1] = 2*d_coefficients[1]*y + d_coefficients[3]*x +
+    d_coefficients[4]*z + d_coefficients[7];
+
+  gradient[2] = 2*d_coefficients[2]*z + d_coefficients[4]*y +
+    d_coefficients[5]*x + d_coefficients[8];
+}
+
+// Get the sense of a point w.r.t. the surface
+/*! \details A point is on the surface if the first order estimate of its
+ * distance from the surface (quadric value over gradient magnitude) is
+ * within the surface tolerance.
+ */
+auto NativeSurface::getSenseOfPoint( const double position[3] ) const -> Sense
+{
+  const double value = this->evaluate( position );
+
+  double gradient[3];
+
+  this->getGradient( position, gradient );
+
+  const double gradient_magnitude =
+    std::sqrt( gradient[0]*gradient[0] +
+               gradient[1]*gradient[1] +
+               gradient[2]*gradient[2] );
+
+  if( std::fabs( value ) <= d_tolerance*gradient_magnitude )
+    return ON_SURFACE;
+  else if( value > 0.0 )
+    return POSITIVE_SENSE;
+  else
+    return NEGATIVE_SENSE;
+}
+
+// Get the sense of a ray w.r.t. the surface
+/*! \details If the ray position is on the surface the sense of the ray is
+ * the side of the surface that the ray is moving into. The on surface sense
+ * will never be returned.
+ */
+auto NativeSurface::getSenseOfRay( const double position[3],
+                                   const double direction[3] ) const -> Sense
+{
+  const Sense sense = this->getSenseOfPoint( position );
+
+  if( sense != ON_SURFACE )
+    return sense;
+  else
+    return this->getSenseOfRayOnSurface( position, direction );
+}
+
+// Get the sense of a ray that is on the surface
+/*! \details The sense of the ray is the side of the surface that the ray is
+ * moving into. A ray that is tangent to the surface is moving into the side
+ * that the surface curves away from. The position is assumed to be on the
+ * surface (e.g. the ray was just moved to the surface).
+ */
+auto NativeSurface::getSenseOfRayOnSurface(
+                                  const double position[3],
+                                  const double direction[3] ) const -> Sense
+{
+  double gradient[3];
+
+  this->getGradient( position, gradient );
+
+  const double projection = gradient[0]*direction[0] +
+    gradient[1]*direction[1] +
+    gradient[2]*direction[2];
+
+  if( projection > 0.0 )
+    return POSITIVE_SENSE;
+  else if( projection < 0.0 )
+    return NEGATIVE_SENSE;
+
+  // The ray is tangent to the surface - use the second order term
+  const double curvature =
+    d_coefficients[0]*direction[0]*direction[0] +
+    d_coefficients[1]*direction[1]*direction[1] +
+    d_coefficients[2]*direction[2]*direction[2] +
+    d_coefficients[3]*direction[0]*direction[1] +
+    d_coefficients[4]*direction[1]*direction[2] +
+    d_coefficients[5]*direction[0]*direction[2];
+
+  if( curvature < 0.0 )
+    return NEGATIVE_SENSE;
+  else
+    return POSITIVE_SENSE;
+}
+
+// Get the unit normal at a point on the surface
+/*! \details The normal points into the positive sense side of the surface.
+ */
+void NativeSurface::getUnitNormalAtPoint( const double position[3],
+                                          double normal[3] ) const
+{
+  this->getGradient( position, normal );
+
+  const double magnitude = std::sqrt( normal[0]*normal[0] +
+                                      normal[1]*normal[1] +
+                                      normal[2]*normal[2] );
+
+  // Make sure the normal is defined at the point
+  testInvariant( magnitude > 0.0 );
+
+  normal[0] /= magnitude;
+  normal[1] /= magnitude;
+  normal[2] /= magnitude;
+}
+
+// Get the distance along a ray to the surface
+/*! \details Substituting the ray into the quadric gives
+ * A*t^2 + B*t + C = 0. If the ray position is known to be on the surface
+ * (e.g. it was just moved to the surface) C is taken to be zero so that
+ * the surface that was just crossed is not hit again due to roundoff. If
+ * the ray does not intersect the surface infinity will be returned.
+ */
+double NativeSurface::getDistance( const double position[3],
+                                   const double direction[3],
+                                   const bool on_surface ) const
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  double gradient[3];
+
+  this->getGradient( position, gradient );
+
+  const double a_term =
+    d_coefficients[0]*direction[0]*direction[0] +
+    d_coefficients[1]*direction[1]*direction[1] +
+    d_coefficients[2]*direction[2]*direction[2] +
+    d_coefficients[3]*direction[0]*direction[1] +
+    d_coefficients[4]*direction[1]*direction[2] +
+    d_coefficients[5]*direction[0]*direction[2];
+
+  const double b_term = gradient[0]*direction[0] +
+    gradient[1]*direction[1] +
+    gradient[2]*direction[2];
+
+  if( on_surface )
+  {
+    if( a_term != 0.0 )
+    {
+      const double distance = -b_term/a_term;
+
+      return distance > 0.0 ? distance : inf;
+    }
+    else
+      return inf;
+  }
+
+  const double c_term = this->evaluate( position );
+
+  // Linear case (planes or directions along the quadric's degenerate axes)
+  if( a_term == 0.0 )
+  {
+    if( b_term != 0.0 )
+    {
+      const double distance = -c_term/b_term;
+
+      return distance > 0.0 ? distance : inf;
+    }
+    else
+      return inf;
+  }
+
+  const double discriminant = b_term*b_term - 4*a_term*c_term;
+
+  if( discriminant < 0.0 )
+    return inf;
+
+  // Use the numerically stable form of the roots
+  const double q = -0.5*(b_term + std::copysign( std::sqrt( discriminant ),
+                                                 b_term ));
+
+  double distance = inf;
+
+  const double root_1 = q/a_term;
+
+  if( root_1 > 0.0 )
+    distance = root_1;
+
+  if( q != 0.0 )
+  {
+    const double root_2 = c_term/q;
+
+    if( root_2 > 0.0 && root_2 < distance )
+      distance = root_2;
+  }
+
+  return distance;
+}
+
+// Get a lower bound on the distance to the surface in all directions
+/*! \details The distance is exact for planes, spheres and axis-aligned
+ * cylinders. Zero will be returned for general quadrics.
+ */
+double NativeSurface::getSafetyDistance( const double position[3] ) const
+{
+  switch( d_type )
+  {
+    case PLANE:
+    {
+      const double normal_magnitude =
+        std::sqrt( d_coefficients[6]*d_coefficients[6] +
+                   d_coefficients[7]*d_coefficients[7] +
+                   d_coefficients[8]*d_coefficients[8] );
+
+      return std::fabs( this->evaluate( position ) )/normal_magnitude;
+    }
+    case SPHERE:
+    {
+      const double x = position[0] - d_center[0];
+      const double y = position[1] - d_center[1];
+      const double z = position[2] - d_center[2];
+
+      return std::fabs( std::sqrt( x*x + y*y + z*z ) - d_radius );
+    }
+    case X_CYLINDER:
+    {
+      const double y = position[1] - d_center[1];
+      const double z = position[2] - d_center[2];
+
+      return std::fabs( std::sqrt( y*y + z*z ) - d_radius );
+    }
+    case Y_CYLINDER:
+    {
+      const double x = position[0] - d_center[0];
+      const double z = position[2] - d_center[2];
+
+      return std::fabs( std::sqrt( x*x + z*z ) - d_radius );
+    }
+    case Z_CYLINDER:
+    {
+      const double x = position[0] - d_center[0];
+      const double y = position[1] - d_center[1];
+
+      return std::fabs( std::sqrt( x*x + y*y ) - d_radius );
+    }
+    default:
+      return 0.0;
+  }
+}
+
+// Get the bounding box of the points with the given sense
+/*! \details Only axis-aligned planes and the interiors of spheres and
+ * axis-aligned cylinders are bounded. An infinite bounding box will be
+ * returned for every other surface and sense.
+ */
+auto NativeSurface::getBoundingBox( const Sense sense ) const -> BoundingBox
+{
+  // Make sure the sense is valid
+  testPrecondition( sense != ON_SURFACE );
+
+  const double inf = std::numeric_limits<double>::infinity();
+
+  BoundingBox bounding_box = {-inf, -inf, -inf, inf, inf, inf};
+
+  if( d_type == PLANE )
+  {
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      const unsigned j = (i+1)%3;
+      const unsigned k = (i+2)%3;
+
+      if( d_coefficients[6+i] != 0.0 &&
+          d_coefficients[6+j] == 0.0 &&
+          d_coefficients[6+k] == 0.0 )
+      {
+        const double intercept = -d_coefficients[9]/d_coefficients[6+i];
+
+        // The positive sense side is above the intercept when the
+        // coefficient is positive
+        if( (d_coefficients[6+i] > 0.0) == (sense == POSITIVE_SENSE) )
+          bounding_box[i] = intercept;
+        else
+          bounding_box[i+3] = intercept;
+      }
+    }
+  }
+  else if( d_type != GENERAL_QUADRIC )
+  {
+    // The interior has a negative sense when the quadratic terms are positive
+    const double leading_coefficient =
+      std::max( std::max( d_coefficients[0], d_coefficients[1] ),
+                d_coefficients[2] );
+
+    const Sense interior_sense =
+      leading_coefficient > 0.0 ? NEGATIVE_SENSE : POSITIVE_SENSE;
+
+    if( sense == interior_sense )
+    {
+      for( unsigned i = 0; i < 3; ++i )
+      {
+        if( (d_type == X_CYLINDER && i == 0) ||
+            (d_type == Y_CYLINDER && i == 1) ||
+            (d_type == Z_CYLINDER && i == 2) )
+          continue;
+
+        bounding_box[i] = d_center[i] - d_radius;
+        bounding_box[i+3] = d_center[i] + d_radius;
+      }
+    }
+  }
+
+  return bounding_box;
+}
+
+// Get the surface area
+/*! \details Only the area of a sphere can be calculated. Infinity will be
+ * returned for all other surfaces.
+ */
+double NativeSurface::getArea() const
+{
+  if( d_type == SPHERE )
+    return 4*Utility::PhysicalConstants::pi*d_radius*d_radius;
+  else
+    return std::numeric_limits<double>::infinity();
+}
+
+} // end Geometry namespace
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry::NativeSurface );
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeSurface.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,238 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeSurface.hpp
+//! \author Alex Robinson
+//! \brief  The native geometry surface class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_SURFACE_HPP
+#define GEOMETRY_NATIVE_SURFACE_HPP
+
+// Std Lib Includes
+#include <array>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+
+// FRENSIE Includes
+#include "Geometry_Navigator.hpp"
+#include "Utility_Array.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+
+namespace Geometry{
+
+/*! The native geometry surface
+ * \details A surface is defined by the general quadric
+ * ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k = 0. A point has a positive sense
+ * w.r.t. the surface if the quadric evaluated at the point is positive and
+ * a negative sense if it is negative. Planes, spheres and axis-aligned
+ * cylinders are recognized from their coefficients so that exact safety
+ * distances and bounding boxes can be calculated for them. All lengths
+ * are in cm.
+ */
+class NativeSurface
+{
+
+public:
+
+  //! The entity id type
+  typedef Navigator::EntityId EntityId;
+
+  //! The bounding box type (x_min, y_min, z_min, x_max, y_max, z_max)
+  typedef std::array<double,6> BoundingBox;
+
+  //! The sense of a point w.r.t. the surface
+  enum Sense{
+    NEGATIVE_SENSE = -1,
+    ON_SURFACE = 0,
+    POSITIVE_SENSE = 1
+  };
+
+  //! General quadric surface constructor
+  NativeSurface( const EntityId id,
+                 const double a,
+                 const double b,
+                 const double c,
+                 const double d,
+                 const double e,
+                 const double f,
+                 const double g,
+                 const double h,
+                 const double j,
+                 const double k,
+                 const double tolerance = 1e-9 );
+
+  //! Create a general plane (n_x*x + n_y*y + n_z*z - offset = 0)
+  static NativeSurface createPlane( const EntityId id,
+                                    const double x_normal,
+                                    const double y_normal,
+                                    const double z_normal,
+                                    const double offset );
+
+  //! Create a plane normal to the x-axis (x - x_0 = 0)
+  static NativeSurface createXPlane( const EntityId id, const double x_0 );
+
+  //! Create a plane normal to the y-axis (y - y_0 = 0)
+  static NativeSurface createYPlane( const EntityId id, const double y_0 );
+
+  //! Create a plane normal to the z-axis (z - z_0 = 0)
+  static NativeSurface createZPlane( const EntityId id, const double z_0 );
+
+  //! Create a sphere
+  static NativeSurface createSphere( const EntityId id,
+                                     const double x_0,
+                                     const double y_0,
+                                     const double z_0,
+                                     const double radius );
+
+  //! Create a cylinder parallel to the x-axis
+  static NativeSurface createXCylinder( const EntityId id,
+                                        const double y_0,
+                                        const double z_0,
+                                        const double radius );
+
+  //! Create a cylinder parallel to the y-axis
+  static NativeSurface createYCylinder( const EntityId id,
+                                        const double x_0,
+                                        const double z_0,
+                                        const double radius );
+
+  //! Create a cylinder parallel to the z-axis
+  static NativeSurface createZCylinder( const EntityId id,
+                                        const double x_0,
+                                        const double y_0,
+                                        const double radius );
+
+  //! Destructor
+  ~NativeSurface()
+  { /* ... */ }
+
+  //! Get the surface id
+  EntityId getId() const;
+
+  //! Get the quadric coefficients (a, b, c, d, e, f, g, h, j, k)
+  const std::array<double,10>& getCoefficients() const;
+
+  //! Check if the surface is a plane
+  bool isPlanar() const;
+
+  //! Check if the surface is a sphere
+  bool isSpherical() const;
+
+  //! Evaluate the surface quadric at a point
+  double evaluate( const double position[3] ) const;
+
+  //! Get the gradient of the surface quadric at a point
+  void getGradient( const double position[3], double gradient[3] ) const;
+
+  //! Get the sense of a point w.r.t. the surface
+  Sense getSenseOfPoint( const double position[3] ) const;
+
+  //! Get the sense of a ray w.r.t. the surface
+  Sense getSenseOfRay( const double position[3],
+                       const double direction[3] ) const;
+
+  //! Get the sense of a ray that is on the surface
+  Sense getSenseOfRayOnSurface( const double position[3],
+                                const double direction[3] ) const;
+
+  //! Get the unit normal at a point on the surface
+  void getUnitNormalAtPoint( const double position[3],
+                             double normal[3] ) const;
+
+  //! Get the distance along a ray to the surface
+  double getDistance( const double position[3],
+                      const double direction[3],
+                      const bool on_surface = false ) const;
+
+  //! Get a lower bound on the distance to the surface in all directions
+  double getSafetyDistance( const double position[3] ) const;
+
+  //! Get the bounding box of the points with the given sense
+  BoundingBox getBoundingBox( const Sense sense ) const;
+
+  //! Get the surface area
+  double getArea() const;
+
+private:
+
+  // The surface types that are recognized from the coefficients
+  enum Type{
+    GENERAL_QUADRIC = 0,
+    PLANE,
+    SPHERE,
+    X_CYLINDER,
+    Y_CYLINDER,
+    Z_CYLINDER
+  };
+
+  // Default constructor
+  NativeSurface();
+
+  // Classify the surface from its coefficients
+  void classify();
+
+  // Save the surface to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the surface from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The surface id
+  EntityId d_id;
+
+  // The quadric coefficients
+  std::array<double,10> d_coefficients;
+
+  // The on surface tolerance (cm)
+  double d_tolerance;
+
+  // The surface type
+  Type d_type;
+
+  // The center of a sphere or cylinder (the axis component is ignored)
+  std::array<double,3> d_center;
+
+  // The radius of a sphere or cylinder
+  double d_radius;
+};
+
+// Save the surface to an archive
+template<typename Archive>
+void NativeSurface::save( Archive& ar, const unsigned version ) const
+{
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & BOOST_SERIALIZATION_NVP( d_coefficients );
+  ar & BOOST_SERIALIZATION_NVP( d_tolerance );
+}
+
+// Load the surface from an archive
+template<typename Archive>
+void NativeSurface::load( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & BOOST_SERIALIZATION_NVP( d_coefficients );
+  ar & BOOST_SERIALIZATION_NVP( d_tolerance );
+
+  this->classify();
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeSurface, Geometry, 0 );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry, NativeSurface );
+
+#endif // end GEOMETRY_NATIVE_SURFACE_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeSurface.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,251 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeCell.cpp
+//! \author Alex Robinson
+//! \brief  Native cell class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeCell.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+Geometry::NativeCell::SurfaceMap surfaces;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Add a surface to the surface map
+void addSurface( const Geometry::NativeSurface& surface )
+{
+  surfaces[surface.getId()].reset( new Geometry::NativeSurface( surface ) );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a cell can be constructed
+FRENSIE_UNIT_TEST( NativeCell, constructor )
+{
+  std::shared_ptr<Geometry::NativeCell> cell;
+
+  FRENSIE_CHECK_NO_THROW( cell.reset( new Geometry::NativeCell( 1, "-1n2n-3n4n-5n6", surfaces ) ) );
+  FRENSIE_CHECK_EQUAL( cell->getId(), 1 );
+  FRENSIE_CHECK_EQUAL( cell->getDefinition(), "-1n2n-3n4n-5n6" );
+  FRENSIE_CHECK_EQUAL( cell->getSurfaces().size(), 6 );
+
+  // White space is ignored and repeated surfaces are only stored once
+  FRENSIE_CHECK_NO_THROW( cell.reset( new Geometry::NativeCell( 2, " -7 n (-1 u +1)", surfaces ) ) );
+  FRENSIE_CHECK_EQUAL( cell->getSurfaces().size(), 2 );
+
+  // Invalid definitions
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 3, "", surfaces ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 3, "-1n", surfaces ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 3, "-1 2", surfaces ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 3, "(-1n2", surfaces ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 3, "-1n2)", surfaces ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 3, "-1x2", surfaces ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 3, "-1n-100", surfaces ),
+                       Geometry::InvalidNativeGeometry );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell bounding box can be calculated
+FRENSIE_UNIT_TEST( NativeCell, getBoundingBox )
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  // Box
+  Geometry::NativeCell box( 1, "-1n2n-3n4n-5n6", surfaces );
+
+  FRENSIE_CHECK( box.isBounded() );
+  FRENSIE_CHECK_EQUAL( box.getBoundingBox()[0], -1.0 );
+  FRENSIE_CHECK_EQUAL( box.getBoundingBox()[1], -1.0 );
+  FRENSIE_CHECK_EQUAL( box.getBoundingBox()[2], -1.0 );
+  FRENSIE_CHECK_EQUAL( box.getBoundingBox()[3], 1.0 );
+  FRENSIE_CHECK_EQUAL( box.getBoundingBox()[4], 1.0 );
+  FRENSIE_CHECK_EQUAL( box.getBoundingBox()[5], 1.0 );
+
+  // Half of a sphere
+  Geometry::NativeCell half_sphere( 2, "-7n2", surfaces );
+
+  FRENSIE_CHECK( half_sphere.isBounded() );
+  FRENSIE_CHECK_EQUAL( half_sphere.getBoundingBox()[0], -1.0 );
+  FRENSIE_CHECK_EQUAL( half_sphere.getBoundingBox()[3], 2.0 );
+  FRENSIE_CHECK_EQUAL( half_sphere.getBoundingBox()[1], -2.0 );
+  FRENSIE_CHECK_EQUAL( half_sphere.getBoundingBox()[4], 2.0 );
+
+  // Union of the box and the sphere
+  Geometry::NativeCell union_cell( 3, "-1n2n-3n4n-5n6 u -7", surfaces );
+
+  FRENSIE_CHECK( union_cell.isBounded() );
+  FRENSIE_CHECK_EQUAL( union_cell.getBoundingBox()[0], -2.0 );
+  FRENSIE_CHECK_EQUAL( union_cell.getBoundingBox()[5], 2.0 );
+
+  // Outside of the sphere
+  Geometry::NativeCell outside_cell( 4, "7", surfaces );
+
+  FRENSIE_CHECK( !outside_cell.isBounded() );
+  FRENSIE_CHECK_EQUAL( outside_cell.getBoundingBox()[0], -inf );
+  FRENSIE_CHECK_EQUAL( outside_cell.getBoundingBox()[3], inf );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a point is inside of the cell bounding box
+FRENSIE_UNIT_TEST( NativeCell, isPointInBoundingBox )
+{
+  Geometry::NativeCell box( 1, "-1n2n-3n4n-5n6", surfaces );
+
+  double position[3] = {0.0, 0.0, 0.0};
+
+  FRENSIE_CHECK( box.isPointInBoundingBox( position ) );
+
+  position[0] = 1.0;
+
+  FRENSIE_CHECK( box.isPointInBoundingBox( position ) );
+
+  position[0] = 1.5;
+
+  FRENSIE_CHECK( !box.isPointInBoundingBox( position ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a ray is inside of the cell
+FRENSIE_UNIT_TEST( NativeCell, isRayInCell )
+{
+  Geometry::NativeCell box( 1, "-1n2n-3n4n-5n6", surfaces );
+
+  double position[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK( box.isRayInCell( position, direction ) );
+
+  position[0] = 1.5;
+
+  FRENSIE_CHECK( !box.isRayInCell( position, direction ) );
+
+  // On the boundary - the direction determines the cell
+  position[0] = 1.0;
+
+  FRENSIE_CHECK( !box.isRayInCell( position, direction ) );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK( box.isRayInCell( position, direction ) );
+
+  // The sense w.r.t. a boundary surface can be specified
+  FRENSIE_CHECK( !box.isRayInCell( position,
+                                   direction,
+                                   1,
+                                   Geometry::NativeSurface::POSITIVE_SENSE ) );
+
+  // Intersections are evaluated before unions
+  Geometry::NativeCell union_cell( 2, "-1n2u-7n-2", surfaces );
+
+  position[0] = 0.5;
+  position[1] = 0.0;
+  position[2] = 0.5;
+
+  FRENSIE_CHECK( union_cell.isRayInCell( position, direction ) );
+
+  position[0] = -1.5;
+
+  FRENSIE_CHECK( union_cell.isRayInCell( position, direction ) );
+
+  position[0] = 1.5;
+
+  FRENSIE_CHECK( !union_cell.isRayInCell( position, direction ) );
+
+  // Parentheses
+  Geometry::NativeCell paren_cell( 3, "-1n(2u-7)n-2", surfaces );
+
+  position[0] = 0.5;
+
+  FRENSIE_CHECK( !paren_cell.isRayInCell( position, direction ) );
+
+  position[0] = -1.5;
+
+  FRENSIE_CHECK( paren_cell.isRayInCell( position, direction ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the cell boundary can be calculated
+FRENSIE_UNIT_TEST( NativeCell, getDistanceToBoundary )
+{
+  Geometry::NativeCell box( 1, "-1n2n-3n4n-5n6", surfaces );
+
+  double position[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {0.0, 0.0, 1.0};
+
+  Geometry::NativeCell::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+      box.getDistanceToBoundary( position,
+                                 direction,
+                                 Geometry::Navigator::invalidSurfaceId(),
+                                 surface_hit ),
+      1.0,
+      1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 5 );
+
+  // On a boundary surface
+  position[2] = -1.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+      box.getDistanceToBoundary( position, direction, 6, surface_hit ),
+      2.0,
+      1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the safety distance can be calculated
+FRENSIE_UNIT_TEST( NativeCell, getSafetyDistance )
+{
+  Geometry::NativeCell box( 1, "-1n2n-3n4n-5n6", surfaces );
+
+  const double position[3] = {0.5, 0.0, -0.25};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( box.getSafetyDistance( position ),
+                                   0.5,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // The planes of a 2x2x2 box centered at the origin
+  addSurface( Geometry::NativeSurface::createXPlane( 1, 1.0 ) );
+  addSurface( Geometry::NativeSurface::createXPlane( 2, -1.0 ) );
+  addSurface( Geometry::NativeSurface::createYPlane( 3, 1.0 ) );
+  addSurface( Geometry::NativeSurface::createYPlane( 4, -1.0 ) );
+  addSurface( Geometry::NativeSurface::createZPlane( 5, 1.0 ) );
+  addSurface( Geometry::NativeSurface::createZPlane( 6, -1.0 ) );
+
+  // A sphere that encloses the box
+  addSurface( Geometry::NativeSurface::createSphere( 7, 0.0, 0.0, 0.0, 2.0 ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNativeCell.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,395 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeModel.cpp
+//! \author Alex Robinson
+//! \brief  Native model class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_NativeModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a model (two spheres, the shell is split by the plane x=0)
+std::shared_ptr<Geometry::NativeModel> createModel()
+{
+  std::shared_ptr<Geometry::NativeModel>
+    model( new Geometry::NativeModel( "spheres" ) );
+
+  model->addSurface( Geometry::NativeSurface::createSphere( 1, 0.0, 0.0, 0.0, 1.0 ) );
+  model->addSurface( Geometry::NativeSurface::createSphere( 2, 0.0, 0.0, 0.0, 2.0 ) );
+  model->addSurface( Geometry::NativeSurface::createXPlane( 3, 0.0 ) );
+
+  model->addCell( 1, "-1", 1, -1.0*Geometry::Model::DensityUnit() );
+  model->addCell( 2, "1n-2n3", 2, 0.05*Geometry::Model::DensityUnit() );
+  model->addCell( 3, "1n-2n-3" );
+  model->addCell( 4, "2" );
+
+  model->setTerminationCell( 4 );
+
+  model->addCellEstimator( 0,
+                           Geometry::CELL_TRACK_LENGTH_FLUX_ESTIMATOR,
+                           Geometry::NEUTRON,
+                           {1, 2} );
+
+  model->addSurfaceEstimator( 1,
+                              Geometry::SURFACE_FLUX_ESTIMATOR,
+                              Geometry::PHOTON,
+                              {1, 2} );
+
+  return model;
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check if the model name can be returned
+FRENSIE_UNIT_TEST( NativeModel, getName )
+{
+  FRENSIE_CHECK_EQUAL( Geometry::NativeModel().getName(), "Native" );
+  FRENSIE_CHECK_EQUAL( createModel()->getName(), "spheres" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid geometry will be detected
+FRENSIE_UNIT_TEST( NativeModel, invalid_geometry )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  // Duplicate ids
+  FRENSIE_CHECK_THROW( model->addSurface( Geometry::NativeSurface::createXPlane( 1, 1.0 ) ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( model->addCell( 1, "-2" ),
+                       Geometry::InvalidNativeGeometry );
+
+  // Unknown surfaces
+  FRENSIE_CHECK_THROW( model->addCell( 5, "-5" ),
+                       Geometry::InvalidNativeGeometry );
+
+  // A material cell must have a density
+  FRENSIE_CHECK_THROW( model->addCell( 5, "-2", 1, 0.0*Geometry::Model::DensityUnit() ),
+                       Geometry::InvalidNativeGeometry );
+
+  // Unknown entities
+  FRENSIE_CHECK_THROW( model->setTerminationCell( 5 ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( model->setReflectingSurface( 5 ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( model->addCellEstimator( 2, Geometry::CELL_COLLISION_FLUX_ESTIMATOR, Geometry::NEUTRON, {5} ),
+                       Geometry::InvalidNativeGeometry );
+
+  // Mismatched estimator types
+  FRENSIE_CHECK_THROW( model->addCellEstimator( 2, Geometry::SURFACE_FLUX_ESTIMATOR, Geometry::NEUTRON, {1} ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( model->addSurfaceEstimator( 2, Geometry::CELL_COLLISION_FLUX_ESTIMATOR, Geometry::NEUTRON, {1} ),
+                       Geometry::InvalidNativeGeometry );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the material ids can be returned
+FRENSIE_UNIT_TEST( NativeModel, getMaterialIds )
+{
+  Geometry::Model::MaterialIdSet material_ids;
+
+  createModel()->getMaterialIds( material_ids );
+
+  FRENSIE_CHECK_EQUAL( material_ids, Geometry::Model::MaterialIdSet( {1, 2} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cells can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCells )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  Geometry::Model::CellIdSet cells;
+
+  model->getCells( cells, true, true );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 3, 4} ) );
+
+  cells.clear();
+
+  model->getCells( cells, false, true );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 4} ) );
+
+  cells.clear();
+
+  model->getCells( cells, true, false );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 3} ) );
+
+  cells.clear();
+
+  model->getCells( cells, false, false );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell material ids and densities can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellMaterialIds_getCellDensities )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  Geometry::Model::CellIdMatIdMap cell_id_mat_id_map;
+
+  model->getCellMaterialIds( cell_id_mat_id_map );
+
+  FRENSIE_REQUIRE_EQUAL( cell_id_mat_id_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[1], 1 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[2], 2 );
+
+  Geometry::Model::CellIdDensityMap cell_id_density_map;
+
+  model->getCellDensities( cell_id_density_map );
+
+  FRENSIE_REQUIRE_EQUAL( cell_id_density_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_id_density_map[1],
+                       -1.0*Geometry::Model::DensityUnit() );
+  FRENSIE_CHECK_EQUAL( cell_id_density_map[2],
+                       0.05*Geometry::Model::DensityUnit() );
+
+  FRENSIE_CHECK( !model->isVoidCell( 1 ) );
+  FRENSIE_CHECK( !model->isVoidCell( 2 ) );
+  FRENSIE_CHECK( model->isVoidCell( 3 ) );
+  FRENSIE_CHECK( model->isVoidCell( 4 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the estimator data can be returned
+FRENSIE_UNIT_TEST( NativeModel, getEstimatorData )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  FRENSIE_CHECK( model->hasCellEstimatorData() );
+  FRENSIE_CHECK( model->hasSurfaceEstimatorData() );
+  FRENSIE_CHECK( !Geometry::NativeModel().hasCellEstimatorData() );
+  FRENSIE_CHECK( !Geometry::NativeModel().hasSurfaceEstimatorData() );
+
+  Geometry::Model::CellEstimatorIdDataMap cell_estimator_data;
+
+  model->getCellEstimatorData( cell_estimator_data );
+
+  FRENSIE_REQUIRE_EQUAL( cell_estimator_data.size(), 1 );
+  FRENSIE_CHECK_EQUAL( std::get<0>( cell_estimator_data[0] ),
+                       Geometry::CELL_TRACK_LENGTH_FLUX_ESTIMATOR );
+  FRENSIE_CHECK_EQUAL( std::get<1>( cell_estimator_data[0] ),
+                       Geometry::NEUTRON );
+  FRENSIE_CHECK_EQUAL( std::get<2>( cell_estimator_data[0] ),
+                       Geometry::Model::CellIdArray( {1, 2} ) );
+
+  Geometry::AdvancedModel::SurfaceEstimatorIdDataMap surface_estimator_data;
+
+  model->getSurfaceEstimatorData( surface_estimator_data );
+
+  FRENSIE_REQUIRE_EQUAL( surface_estimator_data.size(), 1 );
+  FRENSIE_CHECK_EQUAL( std::get<0>( surface_estimator_data[1] ),
+                       Geometry::SURFACE_FLUX_ESTIMATOR );
+  FRENSIE_CHECK_EQUAL( std::get<1>( surface_estimator_data[1] ),
+                       Geometry::PHOTON );
+  FRENSIE_CHECK_EQUAL( std::get<2>( surface_estimator_data[1] ),
+                       Geometry::AdvancedModel::SurfaceIdArray( {1, 2} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if cells and surfaces exist
+FRENSIE_UNIT_TEST( NativeModel, doesEntityExist )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  FRENSIE_CHECK( model->doesCellExist( 1 ) );
+  FRENSIE_CHECK( model->doesCellExist( 4 ) );
+  FRENSIE_CHECK( !model->doesCellExist( 5 ) );
+
+  FRENSIE_CHECK( model->doesSurfaceExist( 1 ) );
+  FRENSIE_CHECK( model->doesSurfaceExist( 3 ) );
+  FRENSIE_CHECK( !model->doesSurfaceExist( 4 ) );
+
+  Geometry::AdvancedModel::SurfaceIdSet surfaces;
+
+  model->getSurfaces( surfaces );
+
+  FRENSIE_CHECK_EQUAL( surfaces,
+                       Geometry::AdvancedModel::SurfaceIdSet( {1, 2, 3} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a cell is a termination cell
+FRENSIE_UNIT_TEST( NativeModel, isTerminationCell )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  FRENSIE_CHECK( !model->isTerminationCell( 1 ) );
+  FRENSIE_CHECK( !model->isTerminationCell( 3 ) );
+  FRENSIE_CHECK( model->isTerminationCell( 4 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a surface is a reflecting surface
+FRENSIE_UNIT_TEST( NativeModel, isReflectingSurface )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  FRENSIE_CHECK( !model->isReflectingSurface( 3 ) );
+
+  model->setReflectingSurface( 3 );
+
+  FRENSIE_CHECK( model->isReflectingSurface( 3 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell volumes can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellVolume )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  // Estimated volumes
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getCellVolume( 1 ).value(),
+                                   4*M_PI/3,
+                                   1e-2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getCellVolume( 2 ).value(),
+                                   14*M_PI/3,
+                                   1e-2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getCellVolume( 3 ).value(),
+                                   14*M_PI/3,
+                                   1e-2 );
+  FRENSIE_CHECK_EQUAL( model->getCellVolume( 4 ),
+                       Utility::QuantityTraits<Geometry::Model::Volume>::inf() );
+
+  // Specified volumes
+  model->setCellVolume( 1, Geometry::Model::Volume::from_value( 4*M_PI/3 ) );
+
+  FRENSIE_CHECK_EQUAL( model->getCellVolume( 1 ).value(), 4*M_PI/3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface areas can be returned
+FRENSIE_UNIT_TEST( NativeModel, getSurfaceArea )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getSurfaceArea( 1 ).value(),
+                                   4*M_PI,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getSurfaceArea( 2 ).value(),
+                                   16*M_PI,
+                                   1e-12 );
+
+  // The area of a plane must be specified
+  FRENSIE_CHECK_THROW( model->getSurfaceArea( 3 ),
+                       Geometry::InvalidNativeGeometry );
+
+  model->setSurfaceArea( 3, Geometry::AdvancedModel::Area::from_value( 3*M_PI ) );
+
+  FRENSIE_CHECK_EQUAL( model->getSurfaceArea( 3 ).value(), 3*M_PI );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a navigator can be created
+FRENSIE_UNIT_TEST( NativeModel, createNavigator )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  FRENSIE_CHECK( model->isInitialized() );
+
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  FRENSIE_CHECK( navigator.get() != NULL );
+  FRENSIE_CHECK( !navigator->isStateSet() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( NativeModel, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_native_model" );
+  std::ostringstream archive_ostream;
+
+  // Create and archive a native model
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+    model->setReflectingSurface( 3 );
+    model->setSurfaceArea( 3, Geometry::AdvancedModel::Area::from_value( 3*M_PI ) );
+
+    std::shared_ptr<const Geometry::Model> base_model = model;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( model ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( base_model ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived model
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<Geometry::NativeModel> model;
+  std::shared_ptr<const Geometry::Model> base_model;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( model ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( base_model ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( model->getName(), "spheres" );
+  FRENSIE_CHECK( model->isTerminationCell( 4 ) );
+  FRENSIE_CHECK( model->isVoidCell( 3 ) );
+  FRENSIE_CHECK( model->isReflectingSurface( 3 ) );
+  FRENSIE_CHECK_EQUAL( model->getSurfaceArea( 3 ).value(), 3*M_PI );
+  FRENSIE_CHECK_EQUAL( model->getCell( 2 ).getDefinition(), "1n-2n3" );
+
+  Geometry::Model::CellEstimatorIdDataMap cell_estimator_data;
+
+  model->getCellEstimatorData( cell_estimator_data );
+
+  FRENSIE_CHECK_EQUAL( cell_estimator_data.size(), 1 );
+
+  FRENSIE_CHECK_EQUAL( base_model->getName(), "spheres" );
+  FRENSIE_CHECK( base_model->isAdvanced() );
+
+  // The cells must be recompiled
+  std::shared_ptr<Geometry::Navigator> navigator;
+
+  FRENSIE_REQUIRE_NO_THROW( navigator = base_model->createNavigator() );
+
+  navigator->setState( 0.5*boost::units::cgs::centimeter,
+                       1.0*boost::units::cgs::centimeter,
+                       0.0*boost::units::cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeModel.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,385 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  Native navigator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+namespace cgs = boost::units::cgs;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a model (two spheres, the shell is split by the plane x=0)
+std::shared_ptr<Geometry::NativeModel> createModel()
+{
+  std::shared_ptr<Geometry::NativeModel>
+    model( new Geometry::NativeModel( "spheres" ) );
+
+  model->addSurface( Geometry::NativeSurface::createSphere( 1, 0.0, 0.0, 0.0, 1.0 ) );
+  model->addSurface( Geometry::NativeSurface::createSphere( 2, 0.0, 0.0, 0.0, 2.0 ) );
+  model->addSurface( Geometry::NativeSurface::createXPlane( 3, 0.0 ) );
+
+  model->addCell( 1, "-1", 1, -1.0*Geometry::Model::DensityUnit() );
+  model->addCell( 2, "1n-2n3", 2, 0.05*Geometry::Model::DensityUnit() );
+  model->addCell( 3, "1n-2n-3" );
+  model->addCell( 4, "2" );
+
+  model->setTerminationCell( 4 );
+
+  return model;
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a point location w.r.t. a given cell can be determined
+FRENSIE_UNIT_TEST( NativeNavigator, getPointLocation )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator();
+
+  Geometry::Navigator::Ray ray( 0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 1 ),
+                       Geometry::POINT_INSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 2 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+
+  // Point on the boundary between cell 1 and cell 2
+  Geometry::Navigator::Ray boundary_ray( 1.0*cgs::centimeter,
+                                         0.0*cgs::centimeter,
+                                         0.0*cgs::centimeter,
+                                         1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( boundary_ray, 1 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( boundary_ray, 2 ),
+                       Geometry::POINT_INSIDE_CELL );
+
+  FRENSIE_CHECK_THROW( navigator->getPointLocation( ray, 5 ),
+                       Geometry::NativeGeometryError );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface normal can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getSurfaceNormal )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator();
+
+  Geometry::Navigator::Ray ray( 0.0*cgs::centimeter,
+                                2.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                0.0, 1.0, 0.0 );
+
+  double normal[3];
+
+  navigator->getSurfaceNormal( 2, ray, normal );
+
+  FRENSIE_CHECK_SMALL( normal[0], 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], 1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[2], 1e-15 );
+
+  // The normal is flipped so that it points along the direction
+  Geometry::Navigator::Ray reverse_ray( 0.0*cgs::centimeter,
+                                        2.0*cgs::centimeter,
+                                        0.0*cgs::centimeter,
+                                        0.0, -1.0, 0.0 );
+
+  navigator->getSurfaceNormal( 2, reverse_ray, normal );
+
+  FRENSIE_CHECK_SMALL( normal[0], 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], -1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[2], 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell containing the external ray can be found
+FRENSIE_UNIT_TEST( NativeNavigator, findCellContainingRay )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator();
+
+  Geometry::Navigator::Ray ray( 0.5*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray ), 1 );
+
+  Geometry::Navigator::Ray shell_ray( -1.5*cgs::centimeter,
+                                      0.0*cgs::centimeter,
+                                      0.0*cgs::centimeter,
+                                      1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( shell_ray ), 3 );
+
+  Geometry::Navigator::Ray outside_ray( 5.0*cgs::centimeter,
+                                        0.0*cgs::centimeter,
+                                        0.0*cgs::centimeter,
+                                        1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( outside_ray ), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest boundary can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getDistanceToClosestBoundary )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator();
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.25*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   0.75*cgs::centimeter,
+                                   1e-15 );
+
+  navigator->setState( 0.5*cgs::centimeter,
+                       1.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   (std::sqrt( 1.25 ) - 1.0)*cgs::centimeter,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a ray is only fired when the boundary could be within a distance
+FRENSIE_UNIT_TEST( NativeNavigator, fireRayIfBoundaryIsWithin )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator();
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->fireRayIfBoundaryIsWithin( 0.5*cgs::centimeter ),
+                       Utility::QuantityTraits<Geometry::Navigator::Length>::inf() );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+             navigator->fireRayIfBoundaryIsWithin( 1.5*cgs::centimeter,
+                                                   &surface_hit ),
+             1.0*cgs::centimeter,
+             1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a simple internal ray trace can be done
+FRENSIE_UNIT_TEST( NativeNavigator, ray_trace )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator();
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  Geometry::Navigator::Length distance_to_boundary =
+    navigator->fireRay( &surface_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance_to_boundary,
+                                   1.0*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+
+  double surface_normal[3];
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary( surface_normal ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( surface_normal[0], 1.0, 1e-15 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+
+  distance_to_boundary = navigator->fireRay( &surface_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance_to_boundary,
+                                   1.0*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 2 );
+
+  // Advance the ray a substep
+  navigator->advanceBySubstep( 0.5*distance_to_boundary );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0],
+                                   1.5*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(),
+                                   0.5*cgs::centimeter,
+                                   1e-15 );
+
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 4 );
+
+  // Start in the other half of the shell
+  navigator->setState( 0.0*cgs::centimeter,
+                       1.5*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       -1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+
+  distance_to_boundary = navigator->fireRay( &surface_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance_to_boundary,
+                                   std::sqrt( 1.75 )*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 2 );
+
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a ray can cross from one half of the shell into the inner sphere
+FRENSIE_UNIT_TEST( NativeNavigator, ray_trace_shell )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator();
+
+  navigator->setState( -1.5*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 1.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+
+  navigator->changeDirection( 1.0, 0.0, 0.0 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   0.5*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   2.0*cgs::centimeter,
+                                   1e-15 );
+
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a ray can be reflected
+FRENSIE_UNIT_TEST( NativeNavigator, reflection )
+{
+  std::shared_ptr<Geometry::NativeModel> model = createModel();
+
+  model->setReflectingSurface( 1 );
+
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.5*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(),
+                                   0.5*cgs::centimeter,
+                                   1e-15 );
+
+  double surface_normal[3];
+
+  FRENSIE_CHECK( navigator->advanceToCellBoundary( surface_normal ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( surface_normal[2], 1.0, 1e-15 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDirection()[2], -1.0, 1e-15 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   2.0*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the navigator can be cloned
+FRENSIE_UNIT_TEST( NativeNavigator, clone )
+{
+  size_t number_of_advances = 0;
+
+  std::shared_ptr<Geometry::Navigator> navigator =
+    createModel()->createNavigator( [&number_of_advances](const Geometry::Navigator::Length){ ++number_of_advances; } );
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  Geometry::Navigator::Length distance_to_boundary = navigator->fireRay();
+
+  navigator->advanceBySubstep( 0.1*distance_to_boundary );
+
+  FRENSIE_CHECK_EQUAL( number_of_advances, 1 );
+
+  std::shared_ptr<Geometry::Navigator> navigator_clone( navigator->clone() );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 1 );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getPosition()[2],
+                       navigator->getPosition()[2] );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getDirection()[2], 1.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator_clone->fireRay(),
+                                   0.9*cgs::centimeter,
+                                   1e-15 );
+
+  // The callback should've been copied during the clone
+  navigator_clone->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( number_of_advances, 2 );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 2 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+
+  // Clone with a new callback
+  navigator_clone.reset( navigator->clone( [](const Geometry::Navigator::Length){} ) );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 1 );
+
+  navigator_clone->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( number_of_advances, 2 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeNavigator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,272 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeSurface.cpp
+//! \author Alex Robinson
+//! \brief  Native surface class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_NativeSurface.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the surface types can be recognized from the coefficients
+FRENSIE_UNIT_TEST( NativeSurface, constructor )
+{
+  Geometry::NativeSurface plane =
+    Geometry::NativeSurface::createPlane( 1, 1.0, 1.0, 0.0, 2.0 );
+
+  FRENSIE_CHECK_EQUAL( plane.getId(), 1 );
+  FRENSIE_CHECK( plane.isPlanar() );
+  FRENSIE_CHECK( !plane.isSpherical() );
+
+  Geometry::NativeSurface sphere =
+    Geometry::NativeSurface::createSphere( 2, 1.0, 0.0, 0.0, 2.0 );
+
+  FRENSIE_CHECK_EQUAL( sphere.getId(), 2 );
+  FRENSIE_CHECK( !sphere.isPlanar() );
+  FRENSIE_CHECK( sphere.isSpherical() );
+
+  // x^2 + y^2 + z^2 - 4 = 0 defined with the general constructor
+  Geometry::NativeSurface general_sphere( 3,
+                                          1.0, 1.0, 1.0,
+                                          0.0, 0.0, 0.0,
+                                          0.0, 0.0, 0.0,
+                                          -4.0 );
+
+  FRENSIE_CHECK( general_sphere.isSpherical() );
+
+  // x^2 + y^2 - z^2 = 0 (cone)
+  Geometry::NativeSurface cone( 4,
+                                1.0, 1.0, -1.0,
+                                0.0, 0.0, 0.0,
+                                0.0, 0.0, 0.0,
+                                0.0 );
+
+  FRENSIE_CHECK( !cone.isPlanar() );
+  FRENSIE_CHECK( !cone.isSpherical() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sense of a point can be determined
+FRENSIE_UNIT_TEST( NativeSurface, getSenseOfPoint )
+{
+  Geometry::NativeSurface sphere =
+    Geometry::NativeSurface::createSphere( 1, 0.0, 0.0, 0.0, 1.0 );
+
+  double position[3] = {0.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( sphere.getSenseOfPoint( position ),
+                       Geometry::NativeSurface::NEGATIVE_SENSE );
+
+  position[0] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSenseOfPoint( position ),
+                       Geometry::NativeSurface::POSITIVE_SENSE );
+
+  position[0] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSenseOfPoint( position ),
+                       Geometry::NativeSurface::ON_SURFACE );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sense of a ray can be determined
+FRENSIE_UNIT_TEST( NativeSurface, getSenseOfRay )
+{
+  Geometry::NativeSurface plane =
+    Geometry::NativeSurface::createXPlane( 1, 0.0 );
+
+  double position[3] = {0.0, 1.0, 1.0};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( plane.getSenseOfRay( position, direction ),
+                       Geometry::NativeSurface::POSITIVE_SENSE );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( plane.getSenseOfRay( position, direction ),
+                       Geometry::NativeSurface::NEGATIVE_SENSE );
+
+  // A ray that is tangent to a sphere is moving out of the sphere
+  Geometry::NativeSurface sphere =
+    Geometry::NativeSurface::createSphere( 2, 0.0, 0.0, 0.0, 1.0 );
+
+  position[0] = 1.0;
+  position[1] = 0.0;
+  position[2] = 0.0;
+
+  direction[0] = 0.0;
+  direction[1] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSenseOfRay( position, direction ),
+                       Geometry::NativeSurface::POSITIVE_SENSE );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unit normal at a point on the surface can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getUnitNormalAtPoint )
+{
+  Geometry::NativeSurface sphere =
+    Geometry::NativeSurface::createSphere( 1, 0.0, 0.0, 0.0, 2.0 );
+
+  const double position[3] = {0.0, 2.0, 0.0};
+  double normal[3];
+
+  sphere.getUnitNormalAtPoint( position, normal );
+
+  FRENSIE_CHECK_SMALL( normal[0], 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], 1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[2], 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the surface can be calculated
+FRENSIE_UNIT_TEST( NativeSurface, getDistance )
+{
+  Geometry::NativeSurface plane =
+    Geometry::NativeSurface::createZPlane( 1, 2.0 );
+
+  double position[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {0.0, 0.0, 1.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( plane.getDistance( position, direction ),
+                                   2.0,
+                                   1e-15 );
+
+  direction[2] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( plane.getDistance( position, direction ),
+                       std::numeric_limits<double>::infinity() );
+
+  Geometry::NativeSurface sphere =
+    Geometry::NativeSurface::createSphere( 2, 0.0, 0.0, 0.0, 2.0 );
+
+  // Inside of the sphere
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction ),
+                                   2.0,
+                                   1e-15 );
+
+  // Outside of the sphere
+  position[2] = 5.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction ),
+                                   3.0,
+                                   1e-15 );
+
+  // Missing the sphere
+  position[0] = 3.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction ),
+                       std::numeric_limits<double>::infinity() );
+
+  // On the sphere
+  position[0] = 0.0;
+  position[2] = 2.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                         sphere.getDistance( position, direction, true ),
+                         4.0,
+                         1e-15 );
+
+  direction[2] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction, true ),
+                       std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the safety distance can be calculated
+FRENSIE_UNIT_TEST( NativeSurface, getSafetyDistance )
+{
+  const double position[3] = {1.0, 1.0, 0.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+       Geometry::NativeSurface::createXPlane( 1, 3.0 ).getSafetyDistance( position ),
+       2.0,
+       1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+       Geometry::NativeSurface::createSphere( 2, 0.0, 0.0, 0.0, 3.0 ).getSafetyDistance( position ),
+       3.0 - std::sqrt( 2.0 ),
+       1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+       Geometry::NativeSurface::createZCylinder( 3, 1.0, 0.0, 0.5 ).getSafetyDistance( position ),
+       0.5,
+       1e-15 );
+
+  Geometry::NativeSurface cone( 4,
+                                1.0, 1.0, -1.0,
+                                0.0, 0.0, 0.0,
+                                0.0, 0.0, 0.0,
+                                0.0 );
+
+  FRENSIE_CHECK_EQUAL( cone.getSafetyDistance( position ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the bounding box of a half-space can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getBoundingBox )
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  Geometry::NativeSurface plane =
+    Geometry::NativeSurface::createYPlane( 1, 2.0 );
+
+  Geometry::NativeSurface::BoundingBox bounding_box =
+    plane.getBoundingBox( Geometry::NativeSurface::POSITIVE_SENSE );
+
+  FRENSIE_CHECK_EQUAL( bounding_box[0], -inf );
+  FRENSIE_CHECK_EQUAL( bounding_box[1], 2.0 );
+  FRENSIE_CHECK_EQUAL( bounding_box[4], inf );
+
+  bounding_box = plane.getBoundingBox( Geometry::NativeSurface::NEGATIVE_SENSE );
+
+  FRENSIE_CHECK_EQUAL( bounding_box[1], -inf );
+  FRENSIE_CHECK_EQUAL( bounding_box[4], 2.0 );
+
+  Geometry::NativeSurface cylinder =
+    Geometry::NativeSurface::createXCylinder( 2, 1.0, 2.0, 0.5 );
+
+  bounding_box =
+    cylinder.getBoundingBox( Geometry::NativeSurface::NEGATIVE_SENSE );
+
+  FRENSIE_CHECK_EQUAL( bounding_box[0], -inf );
+  FRENSIE_CHECK_EQUAL( bounding_box[1], 0.5 );
+  FRENSIE_CHECK_EQUAL( bounding_box[2], 1.5 );
+  FRENSIE_CHECK_EQUAL( bounding_box[3], inf );
+  FRENSIE_CHECK_EQUAL( bounding_box[4], 1.5 );
+  FRENSIE_CHECK_EQUAL( bounding_box[5], 2.5 );
+
+  bounding_box =
+    cylinder.getBoundingBox( Geometry::NativeSurface::POSITIVE_SENSE );
+
+  FRENSIE_CHECK_EQUAL( bounding_box[1], -inf );
+  FRENSIE_CHECK_EQUAL( bounding_box[4], inf );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface area can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getArea )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+       Geometry::NativeSurface::createSphere( 1, 1.0, 1.0, 1.0, 2.0 ).getArea(),
+       16*M_PI,
+       1e-12 );
+
+  FRENSIE_CHECK_EQUAL( Geometry::NativeSurface::createXPlane( 2, 0.0 ).getArea(),
+                       std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeSurface.cpp
+//---------------------------------------------------------------------------//
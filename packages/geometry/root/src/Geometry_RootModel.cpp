@@ -140,6 +140,9 @@ void RootModel::loadRootGeometry( const int root_init_verbosity )
 
   d_manager->SetMaxThreads( max_threads );
 
+  // Set up the thread navigator pools
+  d_navigator_pools.resize( max_threads );
+
   // Tell Root to suppress all message below the warning level after this point
   gErrorIgnoreLevel = kWarning;
 }
@@ -541,6 +544,51 @@ TGeoManager* RootModel::getManager() const
   return d_manager;
 }
 
+// Acquire a navigator from the calling thread's navigator pool
+/*! \details A new navigator will only be added to the manager if the
+ * calling thread's pool is empty. Registering a navigator with the manager
+ * requires a lock so navigators are recycled instead of being removed.
+ */
+TGeoNavigator* RootModel::acquireNavigator() const
+{
+  // Make sure root is initialized
+  testPrecondition( this->isInitialized() );
+
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  if( thread_id < d_navigator_pools.size() )
+  {
+    NavigatorPool& navigator_pool = d_navigator_pools[thread_id];
+
+    if( !navigator_pool.empty() )
+    {
+      TGeoNavigator* navigator = navigator_pool.back();
+
+      navigator_pool.pop_back();
+
+      return navigator;
+    }
+  }
+
+  return d_manager->AddNavigator();
+}
+
+// Release a navigator to the calling thread's navigator pool
+void RootModel::releaseNavigator( TGeoNavigator* navigator ) const
+{
+  // Make sure root is initialized
+  testPrecondition( this->isInitialized() );
+  // Make sure the navigator is valid
+  testPrecondition( navigator != NULL );
+
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  if( thread_id < d_navigator_pools.size() )
+    d_navigator_pools[thread_id].push_back( navigator );
+  else
+    d_manager->RemoveNavigator( navigator );
+}
+
 EXPLICIT_CLASS_SAVE_LOAD_INST( RootModel );
 
 } // end Geometry namespace
@@ -141,6 +141,12 @@ private:
   // Get the manager
   TGeoManager* getManager() const;
 
+  // Acquire a navigator from the calling thread's navigator pool
+  TGeoNavigator* acquireNavigator() const;
+
+  // Release a navigator to the calling thread's navigator pool
+  void releaseNavigator( TGeoNavigator* navigator ) const;
+
   // The custom root error handler
   static void handleRootError( int level,
                                Bool_t abort,
@@ -179,6 +185,11 @@ private:
 
   // The model properties
   std::unique_ptr<const RootModelProperties> d_model_properties;
+
+  // The released navigators of each thread (Root navigators are bound to
+  // the thread that created them)
+  typedef std::vector<TGeoNavigator*> NavigatorPool;
+  mutable std::vector<NavigatorPool> d_navigator_pools;
 };
 
 //! The invalid root geometry error
@@ -32,22 +32,17 @@ RootNavigator::RootNavigator(
   : Navigator( advance_complete_callback ),
     d_root_model( root_model ),
     d_internal_ray_set( false ),
-    d_navigator( RootNavigator::createInternalRay( d_root_model->getManager() ) )
+    d_navigator( d_root_model->acquireNavigator() )
 { /* ... */ }
 
 // Copy constructor
 RootNavigator::RootNavigator( const RootNavigator& other )
   : Navigator( other ),
     d_root_model( other.d_root_model ),
-    d_internal_ray_set( other.d_internal_ray_set ),
-    d_navigator( RootNavigator::createInternalRay( d_root_model->getManager() ) )
+    d_internal_ray_set( false ),
+    d_navigator( d_root_model->acquireNavigator() )
 {
-  if( other.d_internal_ray_set )
-  {
-    this->setState( other.getPosition(),
-                    other.getDirection(),
-                    other.getCurrentCell() );
-  }
+  this->copyInternalRayState( other );
 }
 
 // Destructor
@@ -393,9 +388,8 @@ RootNavigator* RootNavigator::clone( const AdvanceCompleteCallback& advance_comp
                                             advance_complete_callback );
 
   // Copy the position, direction and cell
-  clone->setState( this->getPosition(),
-                   this->getDirection(),
-                   this->getCurrentCell() );
+  clone->copyInternalRayState( *this );
+
   return clone;
 }
 
@@ -405,18 +399,43 @@ RootNavigator* RootNavigator::clone() const
   return new RootNavigator( *this );
 }
 
-// Create internal ray
-TGeoNavigator* RootNavigator::createInternalRay( TGeoManager* manager )
+// Copy the internal ray state of another navigator
+/*! \details The node path of the other navigator will be used to set the
+ * current node, which avoids the search for the node that contains the
+ * point. A full search will only be done if the other navigator is outside
+ * of the geometry.
+ */
+void RootNavigator::copyInternalRayState( const RootNavigator& other )
 {
-  return manager->AddNavigator();
+  if( other.d_internal_ray_set )
+  {
+    if( other.d_navigator->IsOutside() )
+    {
+      d_navigator->InitTrack( other.d_navigator->GetCurrentPoint(),
+                              other.d_navigator->GetCurrentDirection() );
+    }
+    else
+    {
+      d_navigator->cd( other.d_navigator->GetPath() );
+      d_navigator->SetCurrentPoint( other.d_navigator->GetCurrentPoint() );
+      d_navigator->SetCurrentDirection(
+                                   other.d_navigator->GetCurrentDirection() );
+    }
+
+    this->stateSet();
+  }
 }
 
 // Free internal ray
+/*! \details The internal ray will be returned to the model's navigator pool
+ * so that it can be reused by the next navigator that is constructed on this
+ * thread.
+ */
 void RootNavigator::freeInternalRay()
 {
   if( d_navigator )
   {
-    d_root_model->getManager()->RemoveNavigator( d_navigator );
+    d_root_model->releaseNavigator( d_navigator );
 
     d_navigator = NULL;
   }
@@ -458,7 +477,7 @@ void RootNavigator::freeInternalRay()
 //   if( d_navigator )
 //     this->freeInternalRay();
 
-//   d_navigator = this->createInternalRay( d_root_model->getManager() );
+//   d_navigator = d_root_model->acquireNavigator();
 
 //   // Set the internal ray state (if one was archived)
 //   if( d_internal_ray_set )
@@ -145,8 +145,8 @@ private:
   // Set the internal ray set flag
   void stateSet();
 
-  // Create internal ray
-  static TGeoNavigator* createInternalRay( TGeoManager* manager );
+  // Copy the internal ray state of another navigator
+  void copyInternalRayState( const RootNavigator& other );
 
   // Free internal ray
   void freeInternalRay();
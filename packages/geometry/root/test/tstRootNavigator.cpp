@@ -10,6 +10,7 @@
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <vector>
 
 // FRENSIE Includes
 #include "Geometry_RootNavigator.hpp"
@@ -667,6 +668,64 @@ FRENSIE_UNIT_TEST( RootNavigator, clone )
   FRENSIE_CHECK_EQUAL( number_of_advances, 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that cloning a navigator reuses the released Root navigators
+FRENSIE_UNIT_TEST( RootNavigator, clone_navigator_reuse )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  // Warm up the navigator pool
+  delete navigator->clone();
+
+  const int number_of_registered_navigators =
+    gGeoManager->GetListOfNavigators()->GetEntriesFast();
+
+  // The released navigator should be reused by the next clone
+  for( size_t i = 0; i < 100; ++i )
+  {
+    std::unique_ptr<Geometry::Navigator> navigator_clone( navigator->clone() );
+
+    FRENSIE_REQUIRE_EQUAL( navigator_clone->getCurrentCell(),
+                           navigator->getCurrentCell() );
+    FRENSIE_REQUIRE_EQUAL( gGeoManager->GetListOfNavigators()->GetEntriesFast(),
+                           number_of_registered_navigators );
+  }
+
+  // Navigators released by a group of live clones should be reused by the
+  // next group of live clones
+  std::vector<std::unique_ptr<Geometry::Navigator> > navigator_clones;
+
+  for( size_t i = 0; i < 10; ++i )
+    navigator_clones.emplace_back( navigator->clone() );
+
+  const int number_of_registered_navigators_with_clones =
+    gGeoManager->GetListOfNavigators()->GetEntriesFast();
+
+  FRENSIE_CHECK( number_of_registered_navigators_with_clones >=
+                 number_of_registered_navigators );
+
+  navigator_clones.clear();
+
+  FRENSIE_CHECK_EQUAL( gGeoManager->GetListOfNavigators()->GetEntriesFast(),
+                       number_of_registered_navigators_with_clones );
+
+  for( size_t i = 0; i < 10; ++i )
+  {
+    navigator_clones.emplace_back( navigator->clone() );
+
+    FRENSIE_CHECK_EQUAL( navigator_clones.back()->getCurrentCell(),
+                         navigator->getCurrentCell() );
+  }
+
+  FRENSIE_CHECK_EQUAL( gGeoManager->GetListOfNavigators()->GetEntriesFast(),
+                       number_of_registered_navigators_with_clones );
+}
+
 // //---------------------------------------------------------------------------//
 // // Check that a navigator can be archived
 // FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( RootNavigator, archive, TestArchives )
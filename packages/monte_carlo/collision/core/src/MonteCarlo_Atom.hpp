@@ -101,6 +101,12 @@ public:
   //! Return the survival probability from nuclear interactions
   double getNuclearSurvivalProbability( const double energy ) const;
 
+  //! Add the energy grid points of the total and absorption cross sections
+  void getEnergyGridPoints( std::vector<double>& grid_points ) const;
+
+  //! Add the energy grid points of the nuclear cross sections
+  virtual void getNuclearEnergyGridPoints( std::vector<double>& grid_points ) const;
+
   //! Return the absorption reaction types
   void getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
@@ -412,6 +412,52 @@ double Atom<AtomCore>::getNuclearSurvivalProbability( const double energy ) cons
   return survival_prob;
 }
 
+// Add the energy grid points of the total and absorption cross sections
+/*! \details The grid points of every reaction that contributes to the total
+ * or absorption cross section will be added (the atomic reactions and the
+ * nuclear reactions). When the atomic reactions share a common energy grid
+ * only the grid points of the atomic total reaction need to be added.
+ * Duplicate grid points may be added.
+ */
+template<typename AtomCore>
+void Atom<AtomCore>::getEnergyGridPoints( std::vector<double>& grid_points ) const
+{
+  d_core.getTotalReaction().getEnergyGridPoints( grid_points );
+
+  if( !d_core.hasSharedEnergyGrid() )
+  {
+    d_core.getTotalAbsorptionReaction().getEnergyGridPoints( grid_points );
+
+    typename ConstReactionMap::const_iterator atomic_reaction =
+      d_core.getScatteringReactions().begin();
+
+    while( atomic_reaction != d_core.getScatteringReactions().end() )
+    {
+      atomic_reaction->second->getEnergyGridPoints( grid_points );
+
+      ++atomic_reaction;
+    }
+
+    atomic_reaction = d_core.getAbsorptionReactions().begin();
+
+    while( atomic_reaction != d_core.getAbsorptionReactions().end() )
+    {
+      atomic_reaction->second->getEnergyGridPoints( grid_points );
+
+      ++atomic_reaction;
+    }
+  }
+
+  this->getNuclearEnergyGridPoints( grid_points );
+}
+
+// Add the energy grid points of the nuclear cross sections
+/*! \details By default, nuclear reactions are not considered.
+ */
+template<typename AtomCore>
+void Atom<AtomCore>::getNuclearEnergyGridPoints( std::vector<double>& grid_points ) const
+{ /* ... */ }
+
 // Get the absorption reaction types
 template<typename AtomCore>
 void Atom<AtomCore>::getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const
@@ -275,7 +275,7 @@ void AtomicRelaxationModelFactory::createAtomicRelaxationModel(
  * ignores relaxation, will be created. To save memory, a relaxation model
  * can be cached. Calling this function multiple times with the same atomic
  * data (same atomic number) will return a pointer to the previously created
- * atomic relaxation model.
+ * atomic relaxation model. The cache can safely be shared by threads.
  */
 void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
                   const Data::XSSEPRDataExtractor& raw_photoatom_data,
@@ -284,14 +284,21 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
                   const double min_electron_energy,
 		  const bool use_atomic_relaxation_data )
 {
+  const unsigned atomic_number = raw_photoatom_data.extractAtomicNumber();
+
   // Check if the model for this atom has already been created
-  if( d_relaxation_models.find( raw_photoatom_data.extractAtomicNumber() ) !=
-      d_relaxation_models.end() )
+  #pragma omp critical( atomic_relaxation_model_cache )
   {
-    atomic_relaxation_model =
-      d_relaxation_models[raw_photoatom_data.extractAtomicNumber()];
+    if( d_relaxation_models.find( atomic_number ) !=
+        d_relaxation_models.end() )
+    {
+      atomic_relaxation_model = d_relaxation_models[atomic_number];
+    }
+    else
+      atomic_relaxation_model.reset();
   }
-  else
+
+  if( !atomic_relaxation_model )
   {
     AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 						  raw_photoatom_data,
@@ -300,11 +307,20 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
                                                   min_electron_energy,
 						  use_atomic_relaxation_data );
 
-    // Cache the relaxation model
+    // Cache the relaxation model (the model created first will be kept if
+    // another thread has already cached a model for this atom)
     if( use_atomic_relaxation_data )
     {
-      d_relaxation_models[raw_photoatom_data.extractAtomicNumber()] =
-	atomic_relaxation_model;
+      #pragma omp critical( atomic_relaxation_model_cache )
+      {
+        std::shared_ptr<const AtomicRelaxationModel>& cached_model =
+          d_relaxation_models[atomic_number];
+
+        if( cached_model )
+          atomic_relaxation_model = cached_model;
+        else
+          cached_model = atomic_relaxation_model;
+      }
     }
   }
 }
@@ -316,7 +332,7 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
  * ignores relaxation, will be created. To save memory, a relaxation model
  * can be cached. Calling this function multiple times with the same atomic
  * data (same atomic number) will return a pointer to the previously created
- * atomic relaxation model.
+ * atomic relaxation model. The cache can safely be shared by threads.
  */
 void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
          const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
@@ -325,14 +341,21 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
          const double min_electron_energy,
 	 const bool use_atomic_relaxation_data )
 {
+  const unsigned atomic_number = raw_photoatom_data.getAtomicNumber();
+
   // Check if the model for this atom has already been created
-  if( d_relaxation_models.find( raw_photoatom_data.getAtomicNumber() ) !=
-      d_relaxation_models.end() )
+  #pragma omp critical( atomic_relaxation_model_cache )
   {
-    atomic_relaxation_model =
-      d_relaxation_models[raw_photoatom_data.getAtomicNumber()];
+    if( d_relaxation_models.find( atomic_number ) !=
+        d_relaxation_models.end() )
+    {
+      atomic_relaxation_model = d_relaxation_models[atomic_number];
+    }
+    else
+      atomic_relaxation_model.reset();
   }
-  else
+
+  if( !atomic_relaxation_model )
   {
     AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 						  raw_photoatom_data,
@@ -341,11 +364,20 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
                                                   min_electron_energy,
 						  use_atomic_relaxation_data );
 
-    // Cache the relaxation model
+    // Cache the relaxation model (the model created first will be kept if
+    // another thread has already cached a model for this atom)
     if( use_atomic_relaxation_data )
     {
-      d_relaxation_models[raw_photoatom_data.getAtomicNumber()] =
-	atomic_relaxation_model;
+      #pragma omp critical( atomic_relaxation_model_cache )
+      {
+        std::shared_ptr<const AtomicRelaxationModel>& cached_model =
+          d_relaxation_models[atomic_number];
+
+        if( cached_model )
+          atomic_relaxation_model = cached_model;
+        else
+          cached_model = atomic_relaxation_model;
+      }
     }
   }
 }
@@ -0,0 +1,27 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DataTableLoadingHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Data table loading helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_DataTableLoadingHelpers.hpp"
+#include "Utility_LoggingMacros.hpp"
+
+namespace MonteCarlo{
+
+// Log the time that it took to load a data table
+void logDataTableLoadTime( const std::string& table_description,
+                           const double table_load_time )
+{
+  FRENSIE_LOG_NOTIFICATION( " Loaded " << table_description << " in "
+                            << table_load_time << " s" );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DataTableLoadingHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,44 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DataTableLoadingHelpers.hpp
+//! \author Alex Robinson
+//! \brief  Data table loading helper functions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DATA_TABLE_LOADING_HELPERS_HPP
+#define MONTE_CARLO_DATA_TABLE_LOADING_HELPERS_HPP
+
+// Std Lib Includes
+#include <string>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+//! Load a set of independent data tables concurrently
+template<typename TableLoader>
+void loadDataTablesConcurrently( const size_t number_of_tables,
+                                 const TableLoader& table_loader,
+                                 std::vector<double>& table_load_times );
+
+//! Log the time that it took to load a data table
+void logDataTableLoadTime( const std::string& table_description,
+                           const double table_load_time );
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_DataTableLoadingHelpers_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_DATA_TABLE_LOADING_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DataTableLoadingHelpers.hpp
+//---------------------------------------------------------------------------//
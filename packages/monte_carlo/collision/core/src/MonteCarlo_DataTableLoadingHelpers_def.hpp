@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DataTableLoadingHelpers_def.hpp
+//! \author Alex Robinson
+//! \brief  Data table loading helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DATA_TABLE_LOADING_HELPERS_DEF_HPP
+#define MONTE_CARLO_DATA_TABLE_LOADING_HELPERS_DEF_HPP
+
+// Std Lib Includes
+#include <exception>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace MonteCarlo{
+
+// Load a set of independent data tables concurrently
+/*! \details The table loader will be called once for each table index in
+ * [0,number_of_tables). Tables are distributed dynamically over the
+ * requested number of OpenMP threads since table sizes (and therefore load
+ * times) can vary by orders of magnitude. The table loader must only modify
+ * data associated with the table index that it is passed (any shared state
+ * must be protected by the loader). Exceptions cannot propagate out of a
+ * parallel region, so the exception thrown while loading the table with the
+ * lowest index will be rethrown as a std::runtime_error once every thread
+ * has finished. The wall time (in seconds) required to load each table will
+ * be stored in the table load times array.
+ */
+template<typename TableLoader>
+void loadDataTablesConcurrently( const size_t number_of_tables,
+                                 const TableLoader& table_loader,
+                                 std::vector<double>& table_load_times )
+{
+  table_load_times.clear();
+  table_load_times.resize( number_of_tables, 0.0 );
+
+  std::vector<std::string> table_errors( number_of_tables );
+
+  #pragma omp parallel for schedule(dynamic) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( long long i = 0; i < (long long)number_of_tables; ++i )
+  {
+    std::shared_ptr<Utility::Timer> timer =
+      Utility::OpenMPProperties::createTimer();
+
+    timer->start();
+
+    try{
+      table_loader( (size_t)i );
+    }
+    catch( const std::exception& exception )
+    {
+      table_errors[i] = exception.what();
+    }
+    catch( ... )
+    {
+      table_errors[i] = "An unknown exception was thrown!";
+    }
+
+    timer->stop();
+
+    table_load_times[i] = timer->elapsed().count();
+  }
+
+  for( size_t i = 0; i < number_of_tables; ++i )
+  {
+    TEST_FOR_EXCEPTION( !table_errors[i].empty(),
+                        std::runtime_error,
+                        table_errors[i] );
+  }
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_DATA_TABLE_LOADING_HELPERS_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DataTableLoadingHelpers_def.hpp
+//---------------------------------------------------------------------------//
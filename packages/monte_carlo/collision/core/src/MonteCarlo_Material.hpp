@@ -16,6 +16,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleBank.hpp"
+#include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_QuantityTraits.hpp"
@@ -72,9 +73,29 @@ public:
   //! Return the scattering center number density
   double getScatteringCenterNumberDensity( const std::string& name ) const;
 
+  //! Return the number of scattering centers
+  size_t getNumberOfScatteringCenters() const;
+
+  //! Unionize the scattering center energy grids
+  void unionizeEnergyGrid( const double convergence_tol = 1e-3 );
+
+  //! Check if the scattering center energy grids have been unionized
+  bool isEnergyGridUnionized() const;
+
+  //! Return the number of points in the unionized energy grid
+  size_t getUnionizedEnergyGridSize() const;
+
+  //! Return the memory used by the unionized energy grid data (bytes)
+  size_t getUnionizedEnergyGridMemoryUsage() const;
+
   //! Return the macroscopic total cross section (1/cm)
   double getMacroscopicTotalCrossSection( const double energy ) const;
 
+  //! Return an upper bound of the macroscopic total cross section (1/cm)
+  double getMacroscopicTotalCrossSectionUpperBound(
+                                       const double lower_energy,
+                                       const double upper_energy ) const;
+
   //! Return the macroscopic absorption cross section (1/cm)
   double getMacroscopicAbsorptionCrossSection( const double energy ) const;
 
@@ -127,6 +148,11 @@ protected:
                                 const MicroscopicCrossSectionEvaluationFunctor&
                                 cs_evaluation_functor ) const;
 
+  //! Return the macroscopic cross section from the unionized energy grid
+  double getUnionizedMacroscopicCrossSection(
+                           const double energy,
+                           const std::vector<double>& cross_section ) const;
+
   //! Sample the collision atom
   size_t sampleCollisionScatteringCenterImpl(
                            const double energy,
@@ -135,9 +161,6 @@ protected:
                            const MicroscopicCrossSectionEvaluationFunctor&
                            total_cs_evaluation_functor ) const;
 
-  //! Return the number of scattering centers
-  size_t getNumberOfScatteringCenters() const;
-
   //! Return the scattering center at the desired index
   const ScatteringCenter& getScatteringCenter( const size_t index ) const;
 
@@ -170,6 +193,19 @@ private:
   // The getMacroscopicTotalCrossSection function wrapper
   MacroscopicCrossSectionEvaluationFunctor
   d_macroscopic_total_cs_evaluation_functor;
+
+  // The unionized energy grid (empty unless the grids have been unionized)
+  std::shared_ptr<const std::vector<double> > d_unionized_energy_grid;
+
+  // The unionized energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_unionized_grid_searcher;
+
+  // The macroscopic total cross section on the unionized energy grid
+  std::vector<double> d_unionized_total_cross_section;
+
+  // The macroscopic absorption cross section on the unionized energy grid
+  std::vector<double> d_unionized_absorption_cross_section;
 };
 
 } // end MonteCarlo namespace
@@ -9,8 +9,16 @@
 #ifndef MONTE_CARLO_MATERIAL_DEF_HPP
 #define MONTE_CARLO_MATERIAL_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 // FRENSIE Includes
 #include "MonteCarlo_MaterialHelpers.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_GridGenerator.hpp"
+#include "Utility_InterpolationPolicy.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -48,7 +56,11 @@ Material<ScatteringCenter>::Material(
     d_macroscopic_total_cs_evaluation_functor(
                  std::bind<double>( &ThisType::getMacroscopicTotalCrossSection,
                                     std::cref(*this),
-                                    std::placeholders::_1 ) )
+                                    std::placeholders::_1 ) ),
+    d_unionized_energy_grid(),
+    d_unionized_grid_searcher(),
+    d_unionized_total_cross_section(),
+    d_unionized_absorption_cross_section()
 {
   // Make sure the id is valid
   testPrecondition( ThisType::isIdValid( id ) );
@@ -176,13 +188,217 @@ double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const std::
   return Utility::get<0>( d_scattering_centers[index] );
 }
 
+// Unionize the scattering center energy grids
+/*! \details A single material energy grid is constructed from the union of
+ * the scattering center total and absorption cross section grids (including
+ * the nuclear reaction grids of atoms, e.g. photonuclear reactions) and the
+ * macroscopic total and absorption cross sections are evaluated on it. Once
+ * the grids have been unionized a single grid search replaces the grid
+ * search done by every scattering center when the macroscopic total or
+ * absorption cross section is requested. The union grid will be refined
+ * wherever lin-lin interpolation of the macroscopic total or absorption
+ * cross section does not reproduce the summed scattering center cross
+ * sections to within the convergence tolerance
+ * (e.g. scattering centers with log-log tabulated data). Energies outside of
+ * the union grid, reaction cross sections and collision scattering center
+ * sampling are still handled by the individual scattering centers.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::unionizeEnergyGrid(
+                                                const double convergence_tol )
+{
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tol > 0.0 );
+  testPrecondition( convergence_tol < 1.0 );
+
+  // Remove the old union grid so that the scattering centers are used to
+  // evaluate the macroscopic cross sections
+  d_unionized_grid_searcher.reset();
+  d_unionized_energy_grid.reset();
+  d_unionized_total_cross_section.clear();
+  d_unionized_absorption_cross_section.clear();
+
+  // Merge the scattering center energy grids - only the energy range that
+  // is shared by every scattering center can be used
+  std::vector<double> union_energy_grid;
+
+  double min_energy = 0.0;
+  double max_energy = std::numeric_limits<double>::max();
+
+  for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+  {
+    std::vector<double> grid_points;
+
+    Utility::get<1>( d_scattering_centers[i] )->getEnergyGridPoints(
+                                                                 grid_points );
+
+    if( !grid_points.empty() )
+    {
+      min_energy = std::max( min_energy, grid_points.front() );
+      max_energy = std::min( max_energy, grid_points.back() );
+
+      union_energy_grid.insert( union_energy_grid.end(),
+                                grid_points.begin(),
+                                grid_points.end() );
+    }
+  }
+
+  std::sort( union_energy_grid.begin(), union_energy_grid.end() );
+
+  union_energy_grid.erase( std::unique( union_energy_grid.begin(),
+                                        union_energy_grid.end() ),
+                           union_energy_grid.end() );
+
+  union_energy_grid.erase(
+          std::remove_if( union_energy_grid.begin(),
+                          union_energy_grid.end(),
+                          [min_energy,max_energy]( const double energy ){
+                            return energy < min_energy || energy > max_energy;
+                          } ),
+          union_energy_grid.end() );
+
+  TEST_FOR_EXCEPTION( union_energy_grid.size() < 2,
+                      std::runtime_error,
+                      "The energy grids of the scattering centers in material "
+                      << d_id << " do not overlap - the grids cannot be "
+                      "unionized!" );
+
+  // Refine the union grid for the macroscopic total cross section
+  Utility::GridGenerator<Utility::LinLin> grid_generator( convergence_tol );
+
+  grid_generator.generateInPlace(
+                          union_energy_grid,
+                          [this]( const double energy ){
+                            return this->getMacroscopicCrossSection(
+                                      energy, s_total_cs_evaluation_functor );
+                          } );
+
+  // Refine the union grid for the macroscopic absorption cross section and
+  // evaluate it (refining does not remove grid points so the total cross
+  // section will still converge on the final grid)
+  grid_generator.generateAndEvaluateInPlace(
+                          union_energy_grid,
+                          d_unionized_absorption_cross_section,
+                          [this]( const double energy ){
+                            return this->getMacroscopicCrossSection(
+                                 energy, s_absorption_cs_evaluation_functor );
+                          } );
+
+  // Evaluate the macroscopic total cross section on the final grid
+  d_unionized_total_cross_section.resize( union_energy_grid.size() );
+
+  for( size_t i = 0u; i < union_energy_grid.size(); ++i )
+  {
+    d_unionized_total_cross_section[i] =
+      this->getMacroscopicCrossSection( union_energy_grid[i],
+                                        s_total_cs_evaluation_functor );
+  }
+
+  d_unionized_energy_grid.reset(
+                  new std::vector<double>( std::move( union_energy_grid ) ) );
+
+  d_unionized_grid_searcher.reset( new Utility::StandardHashBasedGridSearcher<std::vector<double>,false>(
+                                       d_unionized_energy_grid,
+                                       d_unionized_energy_grid->size()/10+1 ) );
+}
+
+// Check if the scattering center energy grids have been unionized
+template<typename ScatteringCenter>
+inline bool Material<ScatteringCenter>::isEnergyGridUnionized() const
+{
+  return d_unionized_grid_searcher.get() != NULL;
+}
+
+// Return the number of points in the unionized energy grid
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::getUnionizedEnergyGridSize() const
+{
+  if( d_unionized_energy_grid )
+    return d_unionized_energy_grid->size();
+  else
+    return 0;
+}
+
+// Return the memory used by the unionized energy grid data (bytes)
+/*! \details The memory used by the union grid, the cross sections evaluated
+ * on the union grid and the union grid searcher (hash grid) will be
+ * estimated.
+ */
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::getUnionizedEnergyGridMemoryUsage() const
+{
+  if( d_unionized_energy_grid )
+  {
+    const size_t grid_size = d_unionized_energy_grid->size();
+    
+    return sizeof(double)*(grid_size +
+                           d_unionized_total_cross_section.size() +
+                           d_unionized_absorption_cross_section.size()) +
+      sizeof(std::vector<double>::const_iterator)*(grid_size/10+1);
+  }
+  else
+    return 0;
+}
+
 // Return the macroscopic total cross section (1/cm)
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicTotalCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection( energy,
-                                           s_total_cs_evaluation_functor );
+  if( this->isEnergyGridUnionized() &&
+      d_unionized_grid_searcher->isValueWithinGridBounds( energy ) )
+  {
+    return this->getUnionizedMacroscopicCrossSection(
+                                    energy, d_unionized_total_cross_section );
+  }
+  else
+  {
+    return this->getMacroscopicCrossSection( energy,
+                                             s_total_cs_evaluation_functor );
+  }
+}
+
+// Return an upper bound of the macroscopic total cross section (1/cm)
+/*! \details The bound is valid for every energy in [lower_energy,
+ * upper_energy] as long as none of the scattering center energy grid points
+ * lie inside of the interval (the total cross section of each scattering
+ * center is then monotonic in the interval). Each scattering center is
+ * evaluated just inside of the interval bounds as well so that
+ * discontinuities at the bounds are captured.
+ */
+template<typename ScatteringCenter>
+double Material<ScatteringCenter>::getMacroscopicTotalCrossSectionUpperBound(
+                                         const double lower_energy,
+                                         const double upper_energy ) const
+{
+  // Make sure the energies are valid
+  testPrecondition( lower_energy > 0.0 );
+  testPrecondition( lower_energy < upper_energy );
+
+  const double energies[4] =
+    {lower_energy,
+     std::nextafter( lower_energy, upper_energy ),
+     std::nextafter( upper_energy, lower_energy ),
+     upper_energy};
+
+  double cross_section_bound = 0.0;
+
+  for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+  {
+    double max_cross_section = 0.0;
+
+    for( size_t j = 0u; j < 4u; ++j )
+    {
+      max_cross_section =
+        std::max( max_cross_section,
+                  Utility::get<1>( d_scattering_centers[i] )->getTotalCrossSection( energies[j] ) );
+    }
+
+    cross_section_bound +=
+      Utility::get<0>( d_scattering_centers[i] )*max_cross_section;
+  }
+
+  return cross_section_bound;
 }
 
 // Return the macroscopic absorption cross section (1/cm)
@@ -190,9 +406,18 @@ template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicAbsorptionCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection(
+  if( this->isEnergyGridUnionized() &&
+      d_unionized_grid_searcher->isValueWithinGridBounds( energy ) )
+  {
+    return this->getUnionizedMacroscopicCrossSection(
+                               energy, d_unionized_absorption_cross_section );
+  }
+  else
+  {
+    return this->getMacroscopicCrossSection(
                                           energy,
                                           s_absorption_cs_evaluation_functor );
+  }
 }
 
 // Return the macroscopic cross section (1/cm) for a specific reaction
@@ -235,6 +460,27 @@ double Material<ScatteringCenter>::getMacroscopicCrossSection(
   return cross_section;
 }
 
+// Return the macroscopic cross section from the unionized energy grid
+template<typename ScatteringCenter>
+inline double Material<ScatteringCenter>::getUnionizedMacroscopicCrossSection(
+                            const double energy,
+                            const std::vector<double>& cross_section ) const
+{
+  // Make sure the energy grid has been unionized
+  testPrecondition( this->isEnergyGridUnionized() );
+  // Make sure the cross section is valid
+  testPrecondition( cross_section.size() == d_unionized_energy_grid->size() );
+
+  const size_t bin_index =
+    d_unionized_grid_searcher->findLowerBinIndex( energy );
+
+  return Utility::LinLin::interpolate( (*d_unionized_energy_grid)[bin_index],
+                                       (*d_unionized_energy_grid)[bin_index+1],
+                                       energy,
+                                       cross_section[bin_index],
+                                       cross_section[bin_index+1] );
+}
+
 // Return the survival probability
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getSurvivalProbability( const double energy ) const
@@ -10,6 +10,7 @@
 #define MONTE_CARLO_REACTION_HPP
 
 #include <cstddef>
+#include <vector>
 
 namespace MonteCarlo{
 
@@ -39,6 +40,9 @@ public:
   //! Return the max energy
   virtual double getMaxEnergy() const = 0;
 
+  //! Add the energy grid points where the cross section is tabulated
+  virtual void getEnergyGridPoints( std::vector<double>& grid_points ) const;
+
   //! Return the cross section at the given energy
   virtual double getCrossSection( const double energy ) const = 0;
 
@@ -58,6 +62,17 @@ inline bool Reaction::isEnergyGridShared( const Reaction& other_reaction ) const
   return this->getEnergyGridHead() == other_reaction.getEnergyGridHead();
 }
 
+// Add the energy grid points where the cross section is tabulated
+/*! \details Only the threshold and max energies are added by default.
+ * Reactions that are tabulated on an energy grid should override this method
+ * so that every grid point between the threshold and max energy is added.
+ */
+inline void Reaction::getEnergyGridPoints( std::vector<double>& grid_points ) const
+{
+  grid_points.push_back( this->getThresholdEnergy() );
+  grid_points.push_back( this->getMaxEnergy() );
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_REACTION_HPP
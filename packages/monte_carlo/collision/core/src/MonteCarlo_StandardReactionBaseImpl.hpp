@@ -75,6 +75,9 @@ public:
   //! Return the threshold energy
   double getThresholdEnergy() const final override;
 
+  //! Add the energy grid points where the cross section is tabulated
+  void getEnergyGridPoints( std::vector<double>& grid_points ) const override;
+
 protected:
 
   //! Return the head of the energy grid
@@ -455,6 +455,24 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
   return Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section>::returnEnergyOfInterest( (*d_incoming_energy_grid)[d_threshold_energy_index] );
 }
 
+// Add the energy grid points where the cross section is tabulated
+/*! \details The grid points are added in ascending order. If the energy
+ * grid has been processed the raw energies will be added.
+ */
+template<typename ReactionBase,
+         typename InterpPolicy,
+         bool processed_cross_section>
+void StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::getEnergyGridPoints( std::vector<double>& grid_points ) const
+{
+  grid_points.reserve( grid_points.size() +
+                       d_max_energy_index - d_threshold_energy_index + 1 );
+
+  for( size_t i = d_threshold_energy_index; i <= d_max_energy_index; ++i )
+  {
+    grid_points.push_back( Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section>::returnEnergyOfInterest( (*d_incoming_energy_grid)[i] ) );
+  }
+}
+
 // Return the head of the energy grid
 template<typename ReactionBase,
          typename InterpPolicy,
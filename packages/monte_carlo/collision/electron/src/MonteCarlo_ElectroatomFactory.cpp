@@ -10,6 +10,7 @@
 #include "MonteCarlo_ElectroatomFactory.hpp"
 #include "MonteCarlo_ElectroatomACEFactory.hpp"
 #include "MonteCarlo_ElectroatomNativeFactory.hpp"
+#include "MonteCarlo_DataTableLoadingHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
@@ -22,6 +23,13 @@
 namespace MonteCarlo{
 
 // Constructor
+/*! \details Each unique data table required by the electroatoms will only be
+ * loaded once (electroatoms that use the same table will share the electroatom
+ * created from it). The unique tables are independent and will be loaded
+ * concurrently using the requested number of OpenMP threads. The resulting
+ * electroatom map is identical to the one that would be created if the tables
+ * were loaded serially.
+ */
 ElectroatomFactory::ElectroatomFactory(
              const boost::filesystem::path& data_directory,
              const ScatteringCenterNameSet& electroatom_names,
@@ -37,7 +45,19 @@ ElectroatomFactory::ElectroatomFactory(
   FRENSIE_LOG_NOTIFICATION( "Starting to load electroatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
-  // Create each electroatom in the set
+  // The data properties and atomic weight of each unique table
+  std::vector<const Data::ElectroatomicDataProperties*> table_data_properties;
+  std::vector<double> table_atomic_weights;
+
+  // The table index of each electroatom in the set
+  std::vector<size_t> electroatom_table_indices;
+  electroatom_table_indices.reserve( electroatom_names.size() );
+
+  // Find the unique table used by each electroatom in the set (ACE tables are
+  // identified by the table name and native tables by the file path)
+  std::map<std::pair<Data::ElectroatomicDataProperties::FileType,std::string>,size_t>
+    table_indices;
+
   ScatteringCenterNameSet::const_iterator electroatom_name =
     electroatom_names.begin();
 
@@ -63,39 +83,17 @@ ElectroatomFactory::ElectroatomFactory(
     const Data::ElectroatomicDataProperties& electroatom_data_properties =
       electroatom_definition.getElectroatomicDataProperties( &atomic_weight );
 
+    std::string table_key;
+
     if( electroatom_data_properties.fileType() ==
         Data::ElectroatomicDataProperties::ACE_EPR_FILE )
     {
-      // Initialize the electroatomic table name map for ACE_EPR files
-      if( d_electroatomic_table_name_map.find( Data::ElectroatomicDataProperties::ACE_EPR_FILE ) ==
-          d_electroatomic_table_name_map.end() )
-      {
-        d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE];
-      }
-
-      this->createElectroatomFromACETable( data_directory,
-                                           *electroatom_name,
-                                           atomic_weight,
-                                           electroatom_data_properties,
-                                           atomic_relaxation_model_factory,
-                                           properties );
+      table_key = electroatom_data_properties.tableName();
     }
     else if( electroatom_data_properties.fileType() ==
              Data::ElectroatomicDataProperties::Native_EPR_FILE )
     {
-      // Initialize the electroatomic table name map for Native_EPR files
-      if( d_electroatomic_table_name_map.find( Data::ElectroatomicDataProperties::Native_EPR_FILE ) ==
-          d_electroatomic_table_name_map.end() )
-      {
-        d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE];
-      }
-
-      this->createElectroatomFromNativeTable( data_directory,
-                                              *electroatom_name,
-                                              atomic_weight,
-                                              electroatom_data_properties,
-                                              atomic_relaxation_model_factory,
-                                              properties );
+      table_key = electroatom_data_properties.filePath().string();
     }
     else
     {
@@ -107,6 +105,106 @@ ElectroatomFactory::ElectroatomFactory(
                        ", which is currently unsupported!" );
     }
 
+    // Check if the table has already been requested
+    const std::pair<Data::ElectroatomicDataProperties::FileType,std::string>
+      table_id( electroatom_data_properties.fileType(), table_key );
+
+    std::map<std::pair<Data::ElectroatomicDataProperties::FileType,std::string>,size_t>::const_iterator
+      table_index_it = table_indices.find( table_id );
+
+    if( table_index_it == table_indices.end() )
+    {
+      table_index_it =
+        table_indices.emplace( table_id, table_data_properties.size() ).first;
+
+      table_data_properties.push_back( &electroatom_data_properties );
+      table_atomic_weights.push_back( atomic_weight );
+    }
+
+    electroatom_table_indices.push_back( table_index_it->second );
+
+    ++electroatom_name;
+  }
+
+  // Load the unique tables
+  std::vector<ElectroatomNameMap::mapped_type>
+    table_electroatoms( table_data_properties.size() );
+
+  std::vector<double> table_load_times;
+
+  loadDataTablesConcurrently(
+             table_data_properties.size(),
+             [&]( const size_t table_index ){
+               if( table_data_properties[table_index]->fileType() ==
+                   Data::ElectroatomicDataProperties::ACE_EPR_FILE )
+               {
+                 this->createElectroatomFromACETable(
+                                       data_directory,
+                                       table_atomic_weights[table_index],
+                                       *table_data_properties[table_index],
+                                       atomic_relaxation_model_factory,
+                                       properties,
+                                       table_electroatoms[table_index] );
+               }
+               else
+               {
+                 this->createElectroatomFromNativeTable(
+                                       data_directory,
+                                       table_atomic_weights[table_index],
+                                       *table_data_properties[table_index],
+                                       atomic_relaxation_model_factory,
+                                       properties,
+                                       table_electroatoms[table_index] );
+               }
+             },
+             table_load_times );
+
+  // Cache the new electroatoms in the table name map
+  std::map<std::pair<Data::ElectroatomicDataProperties::FileType,std::string>,size_t>::const_iterator
+    table_index_it = table_indices.begin();
+
+  while( table_index_it != table_indices.end() )
+  {
+    d_electroatomic_table_name_map[table_index_it->first.first][table_index_it->first.second] =
+      table_electroatoms[table_index_it->second];
+
+    ++table_index_it;
+  }
+
+  if( d_verbose )
+  {
+    for( size_t i = 0; i < table_data_properties.size(); ++i )
+    {
+      if( table_data_properties[i]->fileType() ==
+          Data::ElectroatomicDataProperties::ACE_EPR_FILE )
+      {
+        logDataTableLoadTime( "ACE EPR electroatomic cross section table " +
+                              table_data_properties[i]->tableName() +
+                              " from " +
+                              table_data_properties[i]->filePath().string(),
+                              table_load_times[i] );
+      }
+      else
+      {
+        logDataTableLoadTime( "native EPR cross section table (v " +
+                              Utility::toString( table_data_properties[i]->fileVersion() ) +
+                              ") for " +
+                              Utility::toString( table_data_properties[i]->atom() ) +
+                              " from " +
+                              table_data_properties[i]->filePath().string(),
+                              table_load_times[i] );
+      }
+    }
+  }
+
+  // Assign the electroatoms
+  electroatom_name = electroatom_names.begin();
+
+  for( size_t i = 0; i < electroatom_table_indices.size(); ++i )
+  {
+    d_electroatom_name_map[*electroatom_name] =
+      table_electroatoms[electroatom_table_indices[i]];
+
     ++electroatom_name;
   }
 
@@ -119,163 +217,95 @@ ElectroatomFactory::ElectroatomFactory(
 
 // Create the map of electroatoms
 void ElectroatomFactory::createElectroatomMap(
-                               ElectroatomNameMap& electroatom_name_map ) const
+                                ElectroatomNameMap& electroatom_name_map ) const
 {
   electroatom_name_map = d_electroatom_name_map;
 }
 
-// Create a electroatom from an ACE table
+// Create an electroatom from an ACE table
 void ElectroatomFactory::createElectroatomFromACETable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
-		      const Data::ElectroatomicDataProperties& data_properties,
+                      const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+                      const SimulationProperties& properties,
+                      ElectroatomNameMap::mapped_type& electroatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].end() )
-  {
-    // Construct the the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                " Loading ACE EPR electroatomic cross section "
-                                "table " << data_properties.tableName() <<
-                                " from " << ace_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
-
-    // Create the XSS data extractor
-    Data::XSSEPRDataExtractor xss_data_extractor(
+  // Construct the the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // Create the ACEFileHandler
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         data_properties.fileRecordLength() == 0,
+                                         data_properties.fileRecordLength(),
+                                         data_properties.fileEntriesPerRecord() );
+
+  // Create the XSS data extractor
+  Data::XSSEPRDataExtractor xss_data_extractor(
                                          ace_file_handler.getTableNXSArray(),
                                          ace_file_handler.getTableJXSArray(),
                                          ace_file_handler.getTableXSSArray() );
 
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             xss_data_extractor,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
-
-    // Initialize the new electroatom
-    ElectroatomNameMap::mapped_type& electroatom =
-      d_electroatom_name_map[electroatom_name];
-
-    // Create the new electroatom
-    ElectroatomACEFactory::createElectroatom( xss_data_extractor,
-                                              data_properties.tableName(),
-                                              atomic_weight,
-                                              atomic_relaxation_model,
-                                              properties,
-                                              electroatom );
-
-    // Cache the new electroatom in the table name map
-    d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()] = electroatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_electroatom_name_map[electroatom_name] =
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()];
-  }
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               xss_data_extractor,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
+
+  // Create the new electroatom
+  ElectroatomACEFactory::createElectroatom( xss_data_extractor,
+                                        data_properties.tableName(),
+                                        atomic_weight,
+                                        atomic_relaxation_model,
+                                        properties,
+                                        electroatom );
 }
 
-
 // Create an electroatom from a Native table
 void ElectroatomFactory::createElectroatomFromNativeTable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
                       const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+                      const SimulationProperties& properties,
+                      ElectroatomNameMap::mapped_type& electroatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                     " Loading native EPR cross section table "
-                                     "(v " << data_properties.fileVersion() <<
-                                     ") for " << data_properties.atom() <<
-                                     " from " << native_file_path.string() <<
-                                     " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             data_container,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
-
-    // Initialize the new electroatom
-    ElectroatomNameMap::mapped_type& electroatom =
-      d_electroatom_name_map[electroatom_name];
-
-    // Create the new electroatom
-    ElectroatomNativeFactory::createElectroatom( data_container,
-                                                 data_properties.filePath().string(),
-                                                 atomic_weight,
-                                                 atomic_relaxation_model,
-                                                 properties,
-                                                 electroatom );
-
-    // Cache the new electroatom in the table name map
-    d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = electroatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_electroatom_name_map[electroatom_name] =
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
-  }
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
+
+  // Create the epr data container
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( native_file_path );
+
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               data_container,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
+
+  // Create the new electroatom
+  ElectroatomNativeFactory::createElectroatom( data_container,
+                                           data_properties.filePath().string(),
+                                           atomic_weight,
+                                           atomic_relaxation_model,
+                                           properties,
+                                           electroatom );
 }
 
 } // end MonteCarlo namespace
@@ -59,25 +59,25 @@ public:
 
 private:
 
-  // Create a electroatom from an ACE table
+  // Create an electroatom from an ACE table
   void createElectroatomFromACETable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
-		      const Data::ElectroatomicDataProperties& data_properties,
+                      const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties );
+                      const SimulationProperties& properties,
+                      ElectroatomNameMap::mapped_type& electroatom ) const;
 
-  // Create a electroatom from a Native table
+  // Create an electroatom from a Native table
   void createElectroatomFromNativeTable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
                       const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties );
+                      const SimulationProperties& properties,
+                      ElectroatomNameMap::mapped_type& electroatom ) const;
 
   // The electroatom map
   ElectroatomNameMap d_electroatom_name_map;
@@ -150,7 +150,9 @@ void PositronatomFactory::createPositronatomFromACETable(
     Data::ACEFileHandler ace_file_handler( ace_file_path,
                                            data_properties.tableName(),
                                            data_properties.fileStartLine(),
-                                           true );
+                                           data_properties.fileRecordLength() == 0,
+                                           data_properties.fileRecordLength(),
+                                           data_properties.fileEntriesPerRecord() );
 
     // Create the XSS data extractor
     Data::XSSEPRDataExtractor xss_data_extractor(
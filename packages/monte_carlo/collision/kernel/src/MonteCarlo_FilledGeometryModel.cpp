@@ -8,12 +8,15 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <thread>
+#include <system_error>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // Must included first
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
 #include "MonteCarlo_ParticleModeTypeTraits.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -257,11 +260,17 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
   // Only load the particle materials required by the simulation mode
   ParticleModeType mode = d_properties->getParticleMode();
 
+  // Each particle model is stored in a separate base class so the
+  // particle models can be filled independently
+  ParticleModelFillerArray particle_model_fillers;
+
   // Load the neutron materials
   if( MonteCarlo::isParticleTypeCompatible( mode, NEUTRON ) )
   {
-    try{
-      FilledNeutronGeometryModel::loadMaterialsAndFillModel(
+    particle_model_fillers.push_back( std::make_pair(
+      std::string( "neutron" ),
+      [&](){
+        FilledNeutronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
@@ -271,17 +280,16 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
                                               cell_id_density_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Could not fill the model with neutron "
-                             "materials!" );
+      } ) );
   }
 
   // Load the photon materials
   if( MonteCarlo::isParticleTypeCompatible( mode, PHOTON ) )
   {
-    try{
-      FilledPhotonGeometryModel::loadMaterialsAndFillModel(
+    particle_model_fillers.push_back( std::make_pair(
+      std::string( "photon" ),
+      [&](){
+        FilledPhotonGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
@@ -291,17 +299,16 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
                                               cell_id_density_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Could not fill the model with photon "
-                             "materials!" );
+      } ) );
   }
 
   // Load the adjoint photon materials
   if( MonteCarlo::isParticleTypeCompatible( mode, ADJOINT_PHOTON ) )
   {
-    try{
-      FilledAdjointPhotonGeometryModel::loadMaterialsAndFillModel(
+    particle_model_fillers.push_back( std::make_pair(
+      std::string( "adjoint photon" ),
+      [&](){
+        FilledAdjointPhotonGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
@@ -311,17 +318,16 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
                                               cell_id_density_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Could not fill the model with adjoint photon "
-                             "materials!" );
+      } ) );
   }
 
   // Load the electron materials
   if( MonteCarlo::isParticleTypeCompatible( mode, ELECTRON ) )
   {
-    try{
-      FilledElectronGeometryModel::loadMaterialsAndFillModel(
+    particle_model_fillers.push_back( std::make_pair(
+      std::string( "electron" ),
+      [&](){
+        FilledElectronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
@@ -331,13 +337,16 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
                                               cell_id_density_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Could not fill the model with electron "
-                             "materials!" );
+      } ) );
+  }
 
-    try{
-      FilledPositronGeometryModel::loadMaterialsAndFillModel(
+  // Load the positron materials
+  if( MonteCarlo::isParticleTypeCompatible( mode, ELECTRON ) )
+  {
+    particle_model_fillers.push_back( std::make_pair(
+      std::string( "positron" ),
+      [&](){
+        FilledPositronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
@@ -347,17 +356,16 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
                                               cell_id_density_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Could not fill the model with positron "
-                             "materials!" );
+      } ) );
   }
 
   // Load the adjoint electron materials
   if( MonteCarlo::isParticleTypeCompatible( mode, ADJOINT_ELECTRON ) )
   {
-    try{
-      FilledAdjointElectronGeometryModel::loadMaterialsAndFillModel(
+    particle_model_fillers.push_back( std::make_pair(
+      std::string( "adjoint electron" ),
+      [&](){
+        FilledAdjointElectronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
@@ -367,15 +375,81 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
                                               cell_id_density_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Could not fill the model with adjoint electron "
-                             "materials!" );
+      } ) );
   }
 
+  this->fillParticleModelsConcurrently( particle_model_fillers );
+
   d_filled = true;
 }
 
+// Fill the independent particle models concurrently
+/*! \details Each filler is run on its own thread (the calling thread runs
+ * the first filler). The fillers load their data tables with OpenMP - every
+ * filler thread is an initial OpenMP thread, so the table loads of each
+ * particle model still use the requested number of threads. The fillers are
+ * run serially when only one thread has been requested. Exceptions cannot
+ * propagate out of a thread, so the exception thrown by the first failed
+ * filler will be rethrown as a std::runtime_error once every filler has
+ * finished.
+ */
+void FilledGeometryModel::fillParticleModelsConcurrently(
+                          const ParticleModelFillerArray& particle_model_fillers )
+{
+  std::vector<std::string> fill_errors( particle_model_fillers.size() );
+
+  auto fill_particle_model = [&particle_model_fillers, &fill_errors]( const size_t i ){
+    try{
+      particle_model_fillers[i].second();
+    }
+    catch( const std::exception& exception )
+    {
+      fill_errors[i] = exception.what();
+    }
+    catch( ... )
+    {
+      fill_errors[i] = "An unknown exception was thrown!";
+    }
+  };
+
+  if( Utility::OpenMPProperties::getRequestedNumberOfThreads() > 1 )
+  {
+    std::vector<std::thread> fill_threads;
+
+    for( size_t i = 1; i < particle_model_fillers.size(); ++i )
+    {
+      // Fall back to the calling thread if a new thread can't be created
+      try{
+        fill_threads.emplace_back( fill_particle_model, i );
+      }
+      catch( const std::system_error& )
+      {
+        fill_particle_model( i );
+      }
+    }
+
+    if( !particle_model_fillers.empty() )
+      fill_particle_model( 0 );
+
+    for( size_t i = 0; i < fill_threads.size(); ++i )
+      fill_threads[i].join();
+  }
+  else
+  {
+    for( size_t i = 0; i < particle_model_fillers.size(); ++i )
+      fill_particle_model( i );
+  }
+
+  for( size_t i = 0; i < particle_model_fillers.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( !fill_errors[i].empty(),
+                        std::runtime_error,
+                        "Could not fill the model with "
+                        << particle_model_fillers[i].first << " materials!\n"
+                        << fill_errors[i] );
+  }
+}
+
 // Check if the model is initialized
 bool FilledGeometryModel::isInitialized() const
 {
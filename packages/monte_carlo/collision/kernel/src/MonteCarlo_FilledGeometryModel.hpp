@@ -9,6 +9,11 @@
 #ifndef MONTE_CARLO_FILLED_GEOMETRY_MODEL_HPP
 #define MONTE_CARLO_FILLED_GEOMETRY_MODEL_HPP
 
+// Std Lib Includes
+#include <string>
+#include <vector>
+#include <functional>
+
 // Boost Includes
 #include <boost/filesystem.hpp>
 #include <boost/serialization/split_member.hpp>
@@ -172,6 +177,10 @@ public:
   //! Get the total forward macroscopic cs of a material for positrons
   using FilledPositronGeometryModel::getMacroscopicTotalForwardCrossSectionQuick;
 
+  //! Get the majorant total forward macroscopic cs for the given particle type
+  template<typename ParticleStateType>
+  double getMacroscopicMajorantCrossSection( const double energy ) const;
+
   //! Get the adjoint weight factor of a material for the given particle type
   template<typename ParticleStateType>
   double getAdjointWeightFactor(
@@ -223,6 +232,14 @@ private:
   // Fill the geometry
   void fillGeometry( const bool verbose );
 
+  // The particle model filler array (particle name, filler)
+  typedef std::vector<std::pair<std::string,std::function<void()> > >
+  ParticleModelFillerArray;
+
+  // Fill the independent particle models concurrently
+  static void fillParticleModelsConcurrently(
+                         const ParticleModelFillerArray& particle_model_fillers );
+
   // Initialize the geometry just-in-time
   void initializeJustInTime();
 
@@ -162,6 +162,14 @@ double FilledGeometryModel::getMacroscopicTotalForwardCrossSectionQuick(
   return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMacroscopicTotalForwardCrossSectionQuick( cell, energy );
 }
 
+// Get the majorant total forward macroscopic cs for the given particle type
+template<typename ParticleStateType>
+double FilledGeometryModel::getMacroscopicMajorantCrossSection(
+                                                   const double energy ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMacroscopicMajorantCrossSection( energy );
+}
+
 // Get the adjoint weight factor of a material for the given particle type
 template<typename ParticleStateType>
 double FilledGeometryModel::getAdjointWeightFactor(
@@ -85,6 +85,9 @@ protected:
   //! Process the loaded scattering centers
   void processLoadedScatteringCenters( const ScatteringCenterNameMap& scattering_centers ) final override;
 
+  //! Check if the majorant cross section can be tabulated
+  bool canTabulateMajorantCrossSection() const final override;
+
 private:
 
   // The critical line energies
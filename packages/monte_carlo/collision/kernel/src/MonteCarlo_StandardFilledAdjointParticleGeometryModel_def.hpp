@@ -115,6 +115,18 @@ void StandardFilledAdjointParticleGeometryModel<Material>::processLoadedScatteri
              d_critical_line_energies.end() );
 }
 
+// Check if the majorant cross section can be tabulated
+/*! \details The total forward cross sections of the adjoint scattering
+ * centers are not tabulated on the scattering center energy grids so they
+ * cannot be bounded with the grid points. The majorant will always be
+ * evaluated exactly.
+ */
+template<typename Material>
+bool StandardFilledAdjointParticleGeometryModel<Material>::canTabulateMajorantCrossSection() const
+{
+  return false;
+}
+
 // Get the critical line energies
 template<typename Material>
 const std::vector<double>& StandardFilledAdjointParticleGeometryModel<Material>::getCriticalLineEnergies() const
@@ -21,6 +21,7 @@
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "Geometry_Model.hpp"
+#include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 #include "Utility_Vector.hpp"
@@ -123,6 +124,9 @@ public:
                                 const double energy,
                                 const ReactionEnumType reaction ) const;
 
+  //! Get the majorant total forward macroscopic cross section
+  double getMacroscopicMajorantCrossSection( const double energy ) const;
+
   //! Get the unfilled model
   const Geometry::Model& getUnfilledModel() const;
   
@@ -168,8 +172,19 @@ protected:
   virtual void processLoadedScatteringCenters(
                    const ScatteringCenterNameMap& scattering_centers );
 
+  //! Check if the majorant cross section can be tabulated
+  virtual bool canTabulateMajorantCrossSection() const;
+
 private:
 
+  // Unionize the energy grid of a material
+  void unionizeMaterialEnergyGrid( MaterialType& material,
+                                   const std::string& material_name,
+                                   const bool verbose ) const;
+
+  // Tabulate the majorant total forward macroscopic cross section
+  void tabulateMajorantCrossSection();
+
   // Add a material to the collision kernel
   void addMaterial( const std::shared_ptr<const MaterialType>& material,
                     const std::vector<Geometry::Model::EntityId>&
@@ -191,7 +206,20 @@ private:
   typedef std::unordered_map<Geometry::Model::EntityId,std::shared_ptr<const MaterialType> >
   CellIdMaterialMap;
 
-  CellIdMaterialMap d_cell_id_material_map;  
+  CellIdMaterialMap d_cell_id_material_map;
+
+  // A cell containing each material (used to evaluate the majorant)
+  std::vector<Geometry::Model::EntityId> d_majorant_cells;
+
+  // The majorant energy grid (empty unless the majorant has been tabulated)
+  std::shared_ptr<const std::vector<double> > d_majorant_energy_grid;
+
+  // The majorant energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_majorant_grid_searcher;
+
+  // The majorant cross section in each bin of the majorant energy grid
+  std::vector<double> d_majorant_cross_section;
 };
   
 } // end MonteCarlo namespace
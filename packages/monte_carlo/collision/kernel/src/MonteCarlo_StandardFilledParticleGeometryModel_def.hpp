@@ -9,7 +9,14 @@
 #ifndef MONTE_CARLO_STANDARD_FILLED_PARTICLE_GEOMETRY_MODEL_DEF_HPP
 #define MONTE_CARLO_STANDARD_FILLED_PARTICLE_GEOMETRY_MODEL_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
 // FRENSIE Includes
+#include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_ToStringTraits.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
@@ -29,7 +36,11 @@ StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryMod
   : d_unfilled_model( unfilled_model ),
     d_scattering_center_name_map(),
     d_material_name_map(),
-    d_cell_id_material_map()
+    d_cell_id_material_map(),
+    d_majorant_cells(),
+    d_majorant_energy_grid(),
+    d_majorant_grid_searcher(),
+    d_majorant_cross_section()
 {
   // Make sure that the unfilled model is valid
   testPrecondition( unfilled_model.get() );
@@ -125,11 +136,21 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
           Utility::get<1>( material_definition[i] );
       }
 
-      new_material.reset( new MaterialType( material_id,
-                                            density,
-                                            d_scattering_center_name_map,
-                                            scattering_center_fractions,
-                                            scattering_center_names ) );
+      std::shared_ptr<MaterialType> material(
+                               new MaterialType( material_id,
+                                                 density,
+                                                 d_scattering_center_name_map,
+                                                 scattering_center_fractions,
+                                                 scattering_center_names ) );
+
+      if( properties.isUnionizedEnergyGridModeOn() )
+      {
+        this->unionizeMaterialEnergyGrid( *material,
+                                          material_name,
+                                          verbose_material_construction );
+      }
+
+      new_material = material;
     }
 
     material_name_cell_ids_map[material_name].push_back( cell_id );
@@ -148,6 +169,141 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
     
     ++material_name_it;
   }
+
+  // Tabulate the majorant cross section that every delta tracked flight
+  // will look up
+  if( properties.isDeltaTrackingModeOn() )
+    this->tabulateMajorantCrossSection();
+}
+
+// Unionize the energy grid of a material
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::unionizeMaterialEnergyGrid(
+                                            MaterialType& material,
+                                            const std::string& material_name,
+                                            const bool verbose ) const
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::GlobalMPISession::createTimer();
+
+  timer->start();
+
+  try{
+    material.unionizeEnergyGrid();
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Could not unionize the energy grid of material "
+                           << material_name << "!" );
+
+  timer->stop();
+
+  // Report the memory/speed trade-off of the union grid
+  if( verbose )
+  {
+    FRENSIE_LOG_NOTIFICATION( " Unionized the energy grid of material "
+                              << material_name << ": "
+                              << material.getUnionizedEnergyGridSize()
+                              << " grid points, "
+                              << material.getUnionizedEnergyGridMemoryUsage()/1024.0
+                              << " kB, constructed in "
+                              << timer->elapsed().count() << " s (1 grid "
+                              "search replaces "
+                              << material.getNumberOfScatteringCenters()
+                              << " per macroscopic cross section "
+                              "evaluation)" );
+  }
+}
+
+// Tabulate the majorant total forward macroscopic cross section
+/*! \details The majorant grid is the union of the energy grids of every
+ * loaded scattering center (restricted to the range shared by all of them).
+ * None of the scattering center grid points lie inside of a bin of the union
+ * grid so the upper bound of the total cross section of each material in
+ * each bin can be calculated (see
+ * MonteCarlo::Material::getMacroscopicTotalCrossSectionUpperBound). The
+ * max of the material bounds is stored as the (constant) majorant of the
+ * bin, which allows the majorant to be retrieved with a single grid search.
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::tabulateMajorantCrossSection()
+{
+  d_majorant_grid_searcher.reset();
+  d_majorant_energy_grid.reset();
+  d_majorant_cross_section.clear();
+
+  if( d_majorant_cells.empty() || !this->canTabulateMajorantCrossSection() )
+    return;
+
+  // Merge the scattering center energy grids - only the energy range that
+  // is shared by every scattering center will be tabulated
+  std::vector<double> majorant_energy_grid;
+
+  double min_energy = 0.0;
+  double max_energy = std::numeric_limits<double>::max();
+
+  typename ScatteringCenterNameMap::const_iterator scattering_center_it =
+    d_scattering_center_name_map.begin();
+
+  while( scattering_center_it != d_scattering_center_name_map.end() )
+  {
+    std::vector<double> grid_points;
+
+    scattering_center_it->second->getEnergyGridPoints( grid_points );
+
+    if( !grid_points.empty() )
+    {
+      min_energy = std::max( min_energy, grid_points.front() );
+      max_energy = std::min( max_energy, grid_points.back() );
+
+      majorant_energy_grid.insert( majorant_energy_grid.end(),
+                                   grid_points.begin(),
+                                   grid_points.end() );
+    }
+
+    ++scattering_center_it;
+  }
+
+  std::sort( majorant_energy_grid.begin(), majorant_energy_grid.end() );
+
+  majorant_energy_grid.erase( std::unique( majorant_energy_grid.begin(),
+                                           majorant_energy_grid.end() ),
+                              majorant_energy_grid.end() );
+
+  majorant_energy_grid.erase(
+          std::remove_if( majorant_energy_grid.begin(),
+                          majorant_energy_grid.end(),
+                          [min_energy,max_energy]( const double energy ){
+                            return energy < min_energy || energy > max_energy;
+                          } ),
+          majorant_energy_grid.end() );
+
+  // The majorant will be evaluated exactly if there is no grid to use
+  if( majorant_energy_grid.size() < 2 )
+    return;
+
+  // Bound the material cross sections in each bin
+  d_majorant_cross_section.resize( majorant_energy_grid.size() - 1, 0.0 );
+
+  for( size_t i = 0; i < d_majorant_cross_section.size(); ++i )
+  {
+    for( size_t j = 0; j < d_majorant_cells.size(); ++j )
+    {
+      const double cross_section_bound =
+        this->getMaterial( d_majorant_cells[j] )->getMacroscopicTotalCrossSectionUpperBound(
+                                                   majorant_energy_grid[i],
+                                                   majorant_energy_grid[i+1] );
+
+      if( cross_section_bound > d_majorant_cross_section[i] )
+        d_majorant_cross_section[i] = cross_section_bound;
+    }
+  }
+
+  d_majorant_energy_grid.reset(
+               new std::vector<double>( std::move( majorant_energy_grid ) ) );
+
+  d_majorant_grid_searcher.reset( new Utility::StandardHashBasedGridSearcher<std::vector<double>,false>(
+                                          d_majorant_energy_grid,
+                                          d_majorant_energy_grid->size()/10+1 ) );
 }
 
 // Add a material to the collision kernel
@@ -173,6 +329,8 @@ void StandardFilledParticleGeometryModel<Material>::addMaterial(
 
     d_cell_id_material_map[cells_containing_material[i]] = material;
   }
+
+  d_majorant_cells.push_back( cells_containing_material.front() );
 }
 
 // Get the material contained in a cell
@@ -191,6 +349,16 @@ auto StandardFilledParticleGeometryModel<Material>::getMaterial(
   return d_cell_id_material_map.find( cell )->second;
 }
 
+// Check if the majorant cross section can be tabulated
+/*! \details The majorant can only be tabulated if the total forward cross
+ * section of every material is the material total cross section.
+ */
+template<typename Material>
+bool StandardFilledParticleGeometryModel<Material>::canTabulateMajorantCrossSection() const
+{
+  return true;
+}
+
 // Process loaded scattering centers
 template<typename Material>
 void StandardFilledParticleGeometryModel<Material>::processLoadedScatteringCenters(
@@ -321,6 +489,42 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
   return this->getMaterial( cell )->getMacroscopicTotalCrossSection( energy );
 }
 
+// Get the majorant total forward macroscopic cross section
+/*! \details The majorant is an upper bound of the total forward macroscopic
+ * cross section of all materials in the model at the requested energy (0.0
+ * if the model is void). It can never underestimate the cross section of a
+ * cell, which is required for unbiased delta tracking. When the model has
+ * been filled in delta tracking mode the majorant is tabulated on the union
+ * energy grid of the scattering centers and a single grid search is done
+ * per call. Otherwise (or outside of the union grid) every material is
+ * evaluated exactly at the energy (once regardless of the number of cells
+ * that it fills).
+ */
+template<typename Material>
+double StandardFilledParticleGeometryModel<Material>::getMacroscopicMajorantCrossSection(
+                                                   const double energy ) const
+{
+  if( d_majorant_grid_searcher &&
+      d_majorant_grid_searcher->isValueWithinGridBounds( energy ) )
+  {
+    return d_majorant_cross_section[d_majorant_grid_searcher->findLowerBinIndex( energy )];
+  }
+  
+  double majorant_cross_section = 0.0;
+
+  for( size_t i = 0; i < d_majorant_cells.size(); ++i )
+  {
+    const double cross_section =
+      this->getMacroscopicTotalForwardCrossSectionQuick( d_majorant_cells[i],
+                                                         energy );
+
+    if( cross_section > majorant_cross_section )
+      majorant_cross_section = cross_section;
+  }
+
+  return majorant_cross_section;
+}
+
 // Get the macroscopic reaction cross section for a specific reaction
 template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCrossSection(
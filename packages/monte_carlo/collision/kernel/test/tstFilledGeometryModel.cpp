@@ -743,6 +743,17 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_neutron_mode )
                                       neutron.getCell(), neutron.getEnergy() ),
       1.064473352626745806e-01,
       1e-15 );
+
+    // The majorant of a single material model is the material cross section
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      filled_model.getMacroscopicMajorantCrossSection<MonteCarlo::NeutronState>( 1.0 ),
+      5.565644507161069399e-01,
+      1e-15 );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      filled_model.getMacroscopicMajorantCrossSection<MonteCarlo::NeutronState>( 10.0 ),
+      1.064473352626745806e-01,
+      1e-15 );
   }
 
   // Check the photon cross sections
@@ -751,6 +762,9 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_neutron_mode )
     photon.embedInModel( filled_model );
     photon.setEnergy( 1.0 );
 
+    FRENSIE_CHECK_EQUAL( filled_model.getMacroscopicMajorantCrossSection<MonteCarlo::PhotonState>( 1.0 ),
+                         0.0 );
+
     FRENSIE_CHECK_EQUAL( filled_model.getMacroscopicTotalCrossSection( photon ),
                          0.0 );
     FRENSIE_CHECK_EQUAL( filled_model.getMacroscopicTotalCrossSection<MonteCarlo::PhotonState>( photon.getCell(), photon.getEnergy() ),
@@ -881,6 +895,45 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_neutron_mode )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the majorant cross section can be tabulated
+FRENSIE_UNIT_TEST( FilledGeometryModel,
+                   getMacroscopicMajorantCrossSection_delta_tracking )
+{
+  std::shared_ptr<const Geometry::Model> unfilled_model(
+            new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) );
+
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties( new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+  properties->setDeltaTrackingModeOn();
+
+  MonteCarlo::FilledGeometryModel filled_model( test_scattering_center_database_name,
+                                                scattering_center_definition_database,
+                                                material_definition_database,
+                                                properties,
+                                                unfilled_model,
+                                                true );
+
+  // The tabulated majorant must bound the material cross section
+  const double energies[6] = {1e-8, 1e-5, 1e-3, 1.0, 5.0, 10.0};
+
+  for( size_t i = 0; i < 6; ++i )
+  {
+    const double cross_section =
+      filled_model.getMacroscopicTotalForwardCrossSection<MonteCarlo::NeutronState>( 1, energies[i] );
+
+    const double majorant_cross_section =
+      filled_model.getMacroscopicMajorantCrossSection<MonteCarlo::NeutronState>( energies[i] );
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( majorant_cross_section, cross_section );
+    FRENSIE_CHECK_LESS( majorant_cross_section, 2.0*cross_section );
+  }
+
+  // The photons are void
+  FRENSIE_CHECK_EQUAL( filled_model.getMacroscopicMajorantCrossSection<MonteCarlo::PhotonState>( 1.0 ),
+                       0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the macroscopic total cross section can be returned
 FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_photon_mode )
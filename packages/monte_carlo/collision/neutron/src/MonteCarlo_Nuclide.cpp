@@ -9,6 +9,8 @@
 // Std Lib Includes
 #include <stdexcept>
 #include <sstream>
+#include <algorithm>
+#include <utility>
 
 // FRENSIE Includes
 #include "MonteCarlo_Nuclide.hpp"
@@ -118,6 +120,8 @@ Nuclide::Nuclide(
     d_isomer_number( isomer_number ),
     d_atomic_weight_ratio( atomic_weight_ratio ),
     d_temperature( temperature ),
+    d_grid_searcher( grid_searcher ),
+    d_reaction_energy_grids_shared( true ),
     d_total_reaction(),
     d_total_absorption_reaction()
 {
@@ -145,9 +149,9 @@ Nuclide::Nuclide(
   while( reaction_type_pointer != end_reaction_type_pointer )
   {
     if(Nuclide::absorption_reaction_types.count(reaction_type_pointer->first))
-      d_absorption_reactions.insert( *reaction_type_pointer );
+      d_absorption_reactions.push_back( reaction_type_pointer->second );
     else
-      d_scattering_reactions.insert( *reaction_type_pointer );
+      d_scattering_reactions.push_back( reaction_type_pointer->second );
 
     ++reaction_type_pointer;
   }
@@ -158,18 +162,96 @@ Nuclide::Nuclide(
   while( reaction_type_pointer != end_reaction_type_pointer )
   {
     if(Nuclide::absorption_reaction_types.count(reaction_type_pointer->first))
-      d_absorption_reactions.insert( *reaction_type_pointer );
+      d_absorption_reactions.push_back( reaction_type_pointer->second );
     else
-      d_miscellaneous_reactions.insert( *reaction_type_pointer );
+      d_miscellaneous_reactions.push_back( reaction_type_pointer->second );
 
     ++reaction_type_pointer;
   }
 
+  // Order the reactions so that the cumulative cross section walk done
+  // during reaction sampling terminates as early as possible on average
+  Nuclide::sortReactionsByAverageCrossSection( *energy_grid,
+                                               d_scattering_reactions );
+  Nuclide::sortReactionsByAverageCrossSection( *energy_grid,
+                                               d_absorption_reactions );
+
   // Calculate the total absorption cross section
   this->calculateTotalAbsorptionReaction( energy_grid, grid_searcher );
 
   // Calculate the total cross section
   this->calculateTotalReaction( energy_grid, grid_searcher );
+
+  // Check if the energy grid bin of the total reaction can be used directly
+  // with every reaction (this is always the case with ACE data)
+  for( auto&& reaction : d_scattering_reactions )
+  {
+    if( !reaction->isEnergyGridShared( *d_total_reaction ) )
+      d_reaction_energy_grids_shared = false;
+  }
+
+  for( auto&& reaction : d_absorption_reactions )
+  {
+    if( !reaction->isEnergyGridShared( *d_total_reaction ) )
+      d_reaction_energy_grids_shared = false;
+  }
+}
+
+// Sort the reactions by decreasing average cross section
+/*! \details The average is taken over the points of the energy grid. The
+ * relative order of reactions with the same average is preserved.
+ */
+void Nuclide::sortReactionsByAverageCrossSection(
+                                       const std::vector<double>& energy_grid,
+                                       ConstReactionArray& reactions )
+{
+  std::vector<std::pair<double,std::shared_ptr<const NeutronNuclearReaction> > >
+    weighted_reactions( reactions.size() );
+
+  for( size_t i = 0; i < reactions.size(); ++i )
+  {
+    double cross_section_sum = 0.0;
+
+    for( size_t j = 0; j < energy_grid.size(); ++j )
+      cross_section_sum += reactions[i]->getCrossSection( energy_grid[j] );
+
+    weighted_reactions[i].first = cross_section_sum/energy_grid.size();
+    weighted_reactions[i].second = reactions[i];
+  }
+
+  std::stable_sort( weighted_reactions.begin(),
+                    weighted_reactions.end(),
+                    []( const std::pair<double,std::shared_ptr<const NeutronNuclearReaction> >& a,
+                        const std::pair<double,std::shared_ptr<const NeutronNuclearReaction> >& b )
+                    { return a.first > b.first; } );
+
+  for( size_t i = 0; i < reactions.size(); ++i )
+    reactions[i] = weighted_reactions[i].second;
+}
+
+// Find the reaction of the desired type in a reaction array
+/*! \details A null pointer will be returned if the reaction type is not
+ * present in the array.
+ */
+const NeutronNuclearReaction* Nuclide::findReaction(
+                                       const ConstReactionArray& reactions,
+                                       const NuclearReactionType reaction )
+{
+  for( auto&& nuclear_reaction : reactions )
+  {
+    if( nuclear_reaction->getReactionType() == reaction )
+      return nuclear_reaction.get();
+  }
+
+  return NULL;
+}
+
+// Add the reaction types in a reaction array to the set
+void Nuclide::addReactionTypes( const ConstReactionArray& reactions,
+                                ReactionEnumTypeSet& reaction_types )
+{
+  for( auto&& reaction : reactions )
+    reaction_types.insert( reaction->getReactionType() );
 }
 
 // Return the nuclide name
@@ -220,18 +302,58 @@ double Nuclide::getTemperature() const
   return d_temperature;
 }
 
+// Return the energy grid bin that is shared by every reaction
+size_t Nuclide::findEnergyGridBin( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( d_grid_searcher->isValueWithinGridBounds( energy ) );
+
+  return d_grid_searcher->findLowerBinIndex( energy );
+}
+
 // Return the total cross section at the desired energy
 double Nuclide::getTotalCrossSection( const double energy ) const
 {
   return d_total_reaction->getCrossSection( energy );
 }
 
+// Return the total cross section at the desired energy (efficient)
+double Nuclide::getTotalCrossSection( const double energy,
+                                      const size_t energy_grid_bin ) const
+{
+  return d_total_reaction->getCrossSection( energy, energy_grid_bin );
+}
+
 // Return the total absorption cross section at the desired energy
 double Nuclide::getAbsorptionCrossSection( const double energy ) const
 {
   return d_total_absorption_reaction->getCrossSection( energy );
 }
 
+// Return the total absorption cross section at the desired energy
+// (efficient)
+double Nuclide::getAbsorptionCrossSection( const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  return d_total_absorption_reaction->getCrossSection( energy,
+                                                       energy_grid_bin );
+}
+
+// Return the cross section of a reaction (efficient)
+/*! \details If a reaction is not defined on the total reaction energy grid
+ * the energy grid bin cannot be used and a new grid search will be done.
+ */
+inline double Nuclide::getReactionCrossSection(
+                                 const NeutronNuclearReaction& reaction,
+                                 const double energy,
+                                 const size_t energy_grid_bin ) const
+{
+  if( d_reaction_energy_grids_shared )
+    return reaction.getCrossSection( energy, energy_grid_bin );
+  else
+    return reaction.getCrossSection( energy );
+}
+
 // Return the survival probability at the desired energy
 double Nuclide::getSurvivalProbability( const double energy ) const
 {
@@ -262,66 +384,55 @@ double Nuclide::getReactionCrossSection(
   case N__TOTAL_ABSORPTION_REACTION:
     return d_total_absorption_reaction->getCrossSection( energy );
   default:
-    ConstReactionMap::const_iterator nuclear_reaction =
-      d_scattering_reactions.find( reaction );
+    const NeutronNuclearReaction* nuclear_reaction =
+      Nuclide::findReaction( d_scattering_reactions, reaction );
 
-    if( nuclear_reaction != d_scattering_reactions.end() )
-      return nuclear_reaction->second->getCrossSection( energy );
+    if( nuclear_reaction )
+      return nuclear_reaction->getCrossSection( energy );
 
-    nuclear_reaction = d_absorption_reactions.find( reaction );
+    nuclear_reaction =
+      Nuclide::findReaction( d_absorption_reactions, reaction );
 
-    if( nuclear_reaction != d_absorption_reactions.end() )
-      return nuclear_reaction->second->getCrossSection( energy );
+    if( nuclear_reaction )
+      return nuclear_reaction->getCrossSection( energy );
 
-    nuclear_reaction = d_miscellaneous_reactions.find( reaction );
+    nuclear_reaction =
+      Nuclide::findReaction( d_miscellaneous_reactions, reaction );
 
-    if( nuclear_reaction != d_miscellaneous_reactions.end() )
-      return nuclear_reaction->second->getCrossSection( energy );
+    if( nuclear_reaction )
+      return nuclear_reaction->getCrossSection( energy );
     else // If the reaction does not exist for the nuclide, return 0
       return 0.0;
   }
 }
 
-// Return the absorption reaction types
-void Nuclide::getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const
+// Add the energy grid points of the total and absorption cross sections
+/*! \details Duplicate grid points may be added.
+ */
+void Nuclide::getEnergyGridPoints( std::vector<double>& grid_points ) const
 {
-  ConstReactionMap::const_iterator reaction_it =
-    d_absorption_reactions.begin();
+  d_total_reaction->getEnergyGridPoints( grid_points );
 
-  while( reaction_it != d_absorption_reactions.end() )
-  {
-    reaction_types.insert( reaction_it->first );
+  if( !d_total_absorption_reaction->isEnergyGridShared( *d_total_reaction ) )
+    d_total_absorption_reaction->getEnergyGridPoints( grid_points );
+}
 
-    ++reaction_it;
-  }
+// Return the absorption reaction types
+void Nuclide::getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const
+{
+  Nuclide::addReactionTypes( d_absorption_reactions, reaction_types );
 }
 
 // Return the scattering reaction types
 void Nuclide::getScatteringReactionTypes( ReactionEnumTypeSet& reaction_types ) const
 {
-  ConstReactionMap::const_iterator reaction_it =
-    d_scattering_reactions.begin();
-
-  while( reaction_it != d_scattering_reactions.end() )
-  {
-    reaction_types.insert( reaction_it->first );
-
-    ++reaction_it;
-  }
+  Nuclide::addReactionTypes( d_scattering_reactions, reaction_types );
 }
 
 // Return the miscellaneous reaction types
 void Nuclide::getMiscReactionTypes( ReactionEnumTypeSet& reaction_types ) const
 {
-  ConstReactionMap::const_iterator reaction_it =
-    d_miscellaneous_reactions.begin();
-
-  while( reaction_it != d_miscellaneous_reactions.end() )
-  {
-    reaction_types.insert( reaction_it->first );
-
-    ++reaction_it;
-  }
+  Nuclide::addReactionTypes( d_miscellaneous_reactions, reaction_types );
 }
 
 // Return the reaction types
@@ -340,29 +451,38 @@ void Nuclide::getReactionTypes( ReactionEnumTypeSet& reaction_types ) const
 void Nuclide::collideAnalogue( NeutronState& neutron,
 			       ParticleBank& bank ) const
 {
+  // Make sure the neutron energy is valid
+  testPrecondition( d_grid_searcher->isValueWithinGridBounds( neutron.getEnergy() ) );
+
+  // Find the energy grid bin once - it is shared by every reaction
+  const size_t energy_grid_bin = this->findEnergyGridBin( neutron.getEnergy() );
+
   double total_cross_section =
-    d_total_reaction->getCrossSection( neutron.getEnergy() );
+    this->getTotalCrossSection( neutron.getEnergy(), energy_grid_bin );
 
   double scaled_random_number =
     Utility::RandomNumberGenerator::getRandomNumber<double>()*
     total_cross_section;
 
   double absorption_cross_section =
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+    this->getAbsorptionCrossSection( neutron.getEnergy(), energy_grid_bin );
 
   // Check if absorption occurs
   if( scaled_random_number < absorption_cross_section )
   {
-    sampleAbsorptionReaction( scaled_random_number, neutron, bank );
+    this->sampleAbsorptionReaction( scaled_random_number,
+                                    neutron.getEnergy(),
+                                    energy_grid_bin ).react( neutron, bank );
 
     // Set the neutron as gone regardless of the reaction that occurred.
     neutron.setAsGone();
   }
   else
   {
-    sampleScatteringReaction( scaled_random_number - absorption_cross_section,
-			      neutron,
-			      bank );
+    this->sampleScatteringReaction(
+                                  scaled_random_number - absorption_cross_section,
+                                  neutron.getEnergy(),
+                                  energy_grid_bin ).react( neutron, bank );
   }
 }
 
@@ -370,14 +490,20 @@ void Nuclide::collideAnalogue( NeutronState& neutron,
 void Nuclide::collideSurvivalBias( NeutronState& neutron,
 				   ParticleBank& bank) const
 {
+  // Make sure the neutron energy is valid
+  testPrecondition( d_grid_searcher->isValueWithinGridBounds( neutron.getEnergy() ) );
+
   double random_number =
     Utility::RandomNumberGenerator::getRandomNumber<double>();
 
+  // Find the energy grid bin once - it is shared by every reaction
+  const size_t energy_grid_bin = this->findEnergyGridBin( neutron.getEnergy() );
+
   double total_cross_section =
-    d_total_reaction->getCrossSection( neutron.getEnergy() );
+    this->getTotalCrossSection( neutron.getEnergy(), energy_grid_bin );
 
   double scattering_cross_section = total_cross_section -
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+    this->getAbsorptionCrossSection( neutron.getEnergy(), energy_grid_bin );
 
   double survival_prob = scattering_cross_section/total_cross_section;
 
@@ -386,9 +512,9 @@ void Nuclide::collideSurvivalBias( NeutronState& neutron,
   {
     neutron.multiplyWeight( survival_prob );
 
-    sampleScatteringReaction( random_number*scattering_cross_section,
-			      neutron,
-			      bank );
+    this->sampleScatteringReaction( random_number*scattering_cross_section,
+                                    neutron.getEnergy(),
+                                    energy_grid_bin ).react( neutron, bank );
   }
   else
     neutron.setAsGone();
@@ -400,11 +526,6 @@ void Nuclide::calculateTotalAbsorptionReaction(
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher )
 {
-  ConstReactionMap::const_iterator reaction_type_pointer,
-    end_reaction_type_pointer;
-
-  end_reaction_type_pointer = d_absorption_reactions.end();
-
   std::shared_ptr<std::vector<double> > cross_section(
                               new std::vector<double>( energy_grid->size() ) );
 
@@ -413,15 +534,8 @@ void Nuclide::calculateTotalAbsorptionReaction(
   {
     (*cross_section)[i] = 0.0;
 
-    reaction_type_pointer = d_absorption_reactions.begin();
-
-    while( reaction_type_pointer != end_reaction_type_pointer )
-    {
-      (*cross_section)[i] +=
-	reaction_type_pointer->second->getCrossSection( (*energy_grid)[i] );
-
-      ++reaction_type_pointer;
-    }
+    for( auto&& reaction : d_absorption_reactions )
+      (*cross_section)[i] += reaction->getCrossSection( (*energy_grid)[i] );
   }
 
   // Create the total absorption reaction
@@ -442,11 +556,6 @@ void Nuclide::calculateTotalReaction(
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher )
 {
-  ConstReactionMap::const_iterator reaction_type_pointer,
-    end_reaction_type_pointer;
-
-  end_reaction_type_pointer = d_scattering_reactions.end();
-
   std::shared_ptr<std::vector<double> > cross_section(
                               new std::vector<double>( energy_grid->size() ) );
 
@@ -456,15 +565,8 @@ void Nuclide::calculateTotalReaction(
     (*cross_section)[i] =
       d_total_absorption_reaction->getCrossSection( (*energy_grid)[i] );
 
-    reaction_type_pointer = d_scattering_reactions.begin();
-
-    while( reaction_type_pointer != end_reaction_type_pointer )
-    {
-      (*cross_section)[i] +=
-	reaction_type_pointer->second->getCrossSection( (*energy_grid)[i] );
-
-      ++reaction_type_pointer;
-    }
+    for( auto&& reaction : d_scattering_reactions )
+      (*cross_section)[i] += reaction->getCrossSection( (*energy_grid)[i] );
   }
 
   // Create the total reaction
@@ -479,54 +581,58 @@ void Nuclide::calculateTotalReaction(
 
 // Sample a scattering reaction
 // NOTE: The scaled random number must be a random number multiplied by the
-//       total scattering cross section then subtracted by the absorption xs.
-void Nuclide::sampleScatteringReaction( const double scaled_random_number,
-					NeutronState& neutron,
-					ParticleBank& bank ) const
+//       total scattering cross section.
+const NeutronNuclearReaction& Nuclide::sampleScatteringReaction(
+                                       const double scaled_random_number,
+                                       const double energy,
+                                       const size_t energy_grid_bin ) const
 {
-  double partial_cross_section = 0.0;
-
-  ConstReactionMap::const_iterator nuclear_reaction, nuclear_reaction_end;
-
-  nuclear_reaction = d_scattering_reactions.begin();
-  nuclear_reaction_end = d_scattering_reactions.end();
-
-  while( nuclear_reaction != nuclear_reaction_end )
-  {
-    partial_cross_section +=
-      nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
-
-    if( scaled_random_number < partial_cross_section )
-      break;
-
-    ++nuclear_reaction;
-  }
-
-  // Make sure a reaction was found
-  testPostcondition( nuclear_reaction != nuclear_reaction_end );
-
-  // Undergo reaction selected
-  nuclear_reaction->second->react( neutron, bank );
+  return this->sampleReaction( d_scattering_reactions,
+                               scaled_random_number,
+                               energy,
+                               energy_grid_bin );
 }
 
 // Sample an absorption reaction
 // NOTE: The scaled random number must be a random number multiplied by the
 //       total absorption cross section
-void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
-					NeutronState& neutron,
-					ParticleBank& bank ) const
+const NeutronNuclearReaction& Nuclide::sampleAbsorptionReaction(
+                                       const double scaled_random_number,
+                                       const double energy,
+                                       const size_t energy_grid_bin ) const
+{
+  return this->sampleReaction( d_absorption_reactions,
+                               scaled_random_number,
+                               energy,
+                               energy_grid_bin );
+}
+
+// Sample a reaction from a reaction array
+/*! \details The reaction cross sections are accumulated in the order that
+ * the reactions are stored (decreasing average cross section) until the
+ * scaled random number is exceeded. The order only changes the number of
+ * reactions that must be visited - each reaction still occupies an interval
+ * of the scaled random number equal to its cross section.
+ */
+const NeutronNuclearReaction& Nuclide::sampleReaction(
+                                       const ConstReactionArray& reactions,
+                                       const double scaled_random_number,
+                                       const double energy,
+                                       const size_t energy_grid_bin ) const
 {
   double partial_cross_section = 0.0;
 
-  ConstReactionMap::const_iterator nuclear_reaction, nuclear_reaction_end;
+  ConstReactionArray::const_iterator nuclear_reaction, nuclear_reaction_end;
 
-  nuclear_reaction = d_absorption_reactions.begin();
-  nuclear_reaction_end = d_absorption_reactions.end();
+  nuclear_reaction = reactions.begin();
+  nuclear_reaction_end = reactions.end();
 
   while( nuclear_reaction != nuclear_reaction_end )
   {
     partial_cross_section +=
-      nuclear_reaction->second->getCrossSection( neutron.getEnergy() );
+      this->getReactionCrossSection( **nuclear_reaction,
+                                     energy,
+                                     energy_grid_bin );
 
     if( scaled_random_number < partial_cross_section )
       break;
@@ -537,8 +643,7 @@ void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
   // Make sure a reaction was selected
   testPostcondition( nuclear_reaction != nuclear_reaction_end );
 
-  // Undergo the reaction selected
-  nuclear_reaction->second->react( neutron, bank );
+  return **nuclear_reaction;
 }
 
 } // end MonteCarlo namespace
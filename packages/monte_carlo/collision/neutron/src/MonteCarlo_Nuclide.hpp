@@ -50,6 +50,10 @@ public:
   typedef std::unordered_map<NuclearReactionType,std::shared_ptr<const NeutronNuclearReaction> >
   ConstReactionMap;
 
+  //! Typedef for the const reaction array
+  typedef std::vector<std::shared_ptr<const NeutronNuclearReaction> >
+  ConstReactionArray;
+
   //! Set the nuclear reaction types that will be considered as absorption
   static void setAbsorptionReactionTypes(
 	const std::vector<NuclearReactionType>& absorption_reaction_types );
@@ -116,6 +120,9 @@ public:
   double getReactionCrossSection( const double energy,
 				  const NuclearReactionType reaction ) const;
 
+  //! Add the energy grid points of the total and absorption cross sections
+  void getEnergyGridPoints( std::vector<double>& grid_points ) const;
+
   //! Return the absorption reaction types
   void getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
@@ -134,6 +141,31 @@ public:
   //! Collide with a neutron and survival bias
   virtual void collideSurvivalBias( NeutronState& neutron, ParticleBank& bank ) const;
 
+protected:
+
+  //! Return the energy grid bin that is shared by every reaction
+  size_t findEnergyGridBin( const double energy ) const;
+
+  //! Return the total cross section at the desired energy (efficient)
+  double getTotalCrossSection( const double energy,
+                               const size_t energy_grid_bin ) const;
+
+  //! Return the total absorption cross section at the desired energy (efficient)
+  double getAbsorptionCrossSection( const double energy,
+                                    const size_t energy_grid_bin ) const;
+
+  //! Sample an absorption reaction
+  const NeutronNuclearReaction& sampleAbsorptionReaction(
+                                       const double scaled_random_number,
+                                       const double energy,
+                                       const size_t energy_grid_bin ) const;
+
+  //! Sample a scattering reaction
+  const NeutronNuclearReaction& sampleScatteringReaction(
+                                       const double scaled_random_number,
+                                       const double energy,
+                                       const size_t energy_grid_bin ) const;
+
 private:
 
   // Set the default absorption reaction types
@@ -152,15 +184,31 @@ private:
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher );
 
-  // Sample an absorption reaction
-  void sampleAbsorptionReaction( const double scaled_random_number,
-				 NeutronState& neutron,
-				 ParticleBank& bank ) const;
+  // Sort the reactions by decreasing average cross section
+  static void sortReactionsByAverageCrossSection(
+                                       const std::vector<double>& energy_grid,
+                                       ConstReactionArray& reactions );
+
+  // Find the reaction of the desired type in a reaction array
+  static const NeutronNuclearReaction* findReaction(
+                                       const ConstReactionArray& reactions,
+                                       const NuclearReactionType reaction );
+
+  // Add the reaction types in a reaction array to the set
+  static void addReactionTypes( const ConstReactionArray& reactions,
+                                ReactionEnumTypeSet& reaction_types );
 
-  // Sample a scattering reaction
-  void sampleScatteringReaction( const double scaled_random_number,
-				 NeutronState& neutron,
-				 ParticleBank& bank ) const;
+  // Return the cross section of a reaction (efficient)
+  double getReactionCrossSection( const NeutronNuclearReaction& reaction,
+                                  const double energy,
+                                  const size_t energy_grid_bin ) const;
+
+  // Sample a reaction from a reaction array
+  const NeutronNuclearReaction& sampleReaction(
+                                       const ConstReactionArray& reactions,
+                                       const double scaled_random_number,
+                                       const double energy,
+                                       const size_t energy_grid_bin ) const;
 
   // Reactions that should be treated as absorption
   static std::unordered_set<NuclearReactionType> absorption_reaction_types;
@@ -186,20 +234,27 @@ private:
   // The temperature of the nuclide (MeV)
   double d_temperature;
 
+  // The energy grid searcher (shared by the reactions)
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_grid_searcher;
+
+  // Records if every reaction is defined on the total reaction energy grid
+  bool d_reaction_energy_grids_shared;
+
   // The total reaction
   std::unique_ptr<const NeutronNuclearReaction> d_total_reaction;
 
   // The total absorption reaction
   std::unique_ptr<const NeutronNuclearReaction> d_total_absorption_reaction;
 
-  // The scattering reactions
-  ConstReactionMap d_scattering_reactions;
+  // The scattering reactions (sorted by decreasing average cross section)
+  ConstReactionArray d_scattering_reactions;
 
-  // The absorption reactions
-  ConstReactionMap d_absorption_reactions;
+  // The absorption reactions (sorted by decreasing average cross section)
+  ConstReactionArray d_absorption_reactions;
 
   // Miscellaneous reactions
-  ConstReactionMap d_miscellaneous_reactions;
+  ConstReactionArray d_miscellaneous_reactions;
 };
 
 } // end MonteCarlo namespace
@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
 #include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_DataTableLoadingHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -18,17 +19,37 @@
 namespace MonteCarlo{
 
 // Constructor
+/*! \details Each unique data table required by the nuclides will only be
+ * loaded once (nuclides that use the same table will share the nuclide
+ * created from it). The unique tables are independent and will be loaded
+ * concurrently using the requested number of OpenMP threads. The resulting
+ * nuclide map is identical to the one that would be created if the tables
+ * were loaded serially.
+ */
 NuclideFactory::NuclideFactory(
                  const boost::filesystem::path& data_directory,
                  const ScatteringCenterNameSet& nuclide_names,
                  const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                  const SimulationProperties& properties,
                  const bool verbose )
+  : d_nuclide_name_map(),
+    d_nuclear_table_name_map(),
+    d_verbose( verbose )
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load nuclide data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
-  
-  // Create each nuclide in the set
+
+  // The data properties and atomic weight ratio of each unique table
+  std::vector<const Data::NuclearDataProperties*> table_data_properties;
+  std::vector<double> table_atomic_weight_ratios;
+
+  // The table index of each nuclide in the set
+  std::vector<size_t> nuclide_table_indices;
+  nuclide_table_indices.reserve( nuclide_names.size() );
+
+  // Find the unique table used by each nuclide in the set
+  std::map<std::string,size_t> ace_table_indices;
+
   ScatteringCenterNameSet::const_iterator nuclide_name =
     nuclide_names.begin();
 
@@ -57,18 +78,21 @@ NuclideFactory::NuclideFactory(
     if( nuclear_data_properties.fileType() ==
         Data::NuclearDataProperties::ACE_FILE )
     {
-      // Initialize the nuclear table name map for ACE files
-      if( d_nuclear_table_name_map.find( Data::NuclearDataProperties::ACE_FILE ) ==
-          d_nuclear_table_name_map.end() )
+      // Check if the table has already been requested
+      std::map<std::string,size_t>::const_iterator ace_table_index_it =
+        ace_table_indices.find( nuclear_data_properties.tableName() );
+
+      if( ace_table_index_it == ace_table_indices.end() )
       {
-        d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE];
+        ace_table_index_it = ace_table_indices.emplace(
+                                         nuclear_data_properties.tableName(),
+                                         table_data_properties.size() ).first;
+
+        table_data_properties.push_back( &nuclear_data_properties );
+        table_atomic_weight_ratios.push_back( atomic_weight_ratio );
       }
-      
-      this->createNuclideFromACETable( data_directory,
-                                       *nuclide_name,
-                                       atomic_weight_ratio,
-                                       nuclear_data_properties,
-                                       properties );
+
+      nuclide_table_indices.push_back( ace_table_index_it->second );
     }
     else
     {
@@ -83,6 +107,49 @@ NuclideFactory::NuclideFactory(
     ++nuclide_name;
   }
 
+  // Load the unique tables
+  std::vector<NuclideNameMap::mapped_type>
+    table_nuclides( table_data_properties.size() );
+
+  std::vector<double> table_load_times;
+
+  loadDataTablesConcurrently(
+               table_data_properties.size(),
+               [&]( const size_t table_index ){
+                 this->createNuclideFromACETable(
+                                   data_directory,
+                                   table_atomic_weight_ratios[table_index],
+                                   *table_data_properties[table_index],
+                                   properties,
+                                   table_nuclides[table_index] );
+               },
+               table_load_times );
+
+  // Cache the new nuclides in the table name map
+  for( size_t i = 0; i < table_nuclides.size(); ++i )
+  {
+    d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][table_data_properties[i]->tableName()] = table_nuclides[i];
+
+    if( d_verbose )
+    {
+      logDataTableLoadTime( "ACE cross section table " +
+                            table_data_properties[i]->tableName() + " from " +
+                            table_data_properties[i]->filePath().string(),
+                            table_load_times[i] );
+    }
+  }
+
+  // Assign the nuclides
+  nuclide_name = nuclide_names.begin();
+
+  for( size_t i = 0; i < nuclide_table_indices.size(); ++i )
+  {
+    d_nuclide_name_map[*nuclide_name] =
+      table_nuclides[nuclide_table_indices[i]];
+
+    ++nuclide_name;
+  }
+
   // Make sure that every nuclide has been created
   testPostcondition( d_nuclide_name_map.size() == nuclide_names.size() );
 
@@ -98,47 +165,33 @@ void NuclideFactory::createNuclideMap( NuclideNameMap& nuclide_map ) const
 
 // Create a nuclide from an ACE table
 void NuclideFactory::createNuclideFromACETable(
-                            const boost::filesystem::path& data_directory,
-                            const std::string& nuclide_name,
-                            const double atomic_weight_ratio,
-                            const Data::NuclearDataProperties& data_properties,
-                            const SimulationProperties& properties )
+                       const boost::filesystem::path& data_directory,
+                       const double atomic_weight_ratio,
+                       const Data::NuclearDataProperties& data_properties,
+                       const SimulationProperties& properties,
+                       NuclideNameMap::mapped_type& nuclide ) const
 {
-  // Check if the table has already been loaded
-  if( d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].find( data_properties.tableName() ) ==
-      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].end() )
-  {
-    // Construct the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION( " Loading ACE cross section table "
-                                        << data_properties.tableName() <<
-                                        " from " << ace_file_path.string() <<
-                                        " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // The ACE table reader
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
-    
-    // The XSS neutron data extractor
-    Data::XSSNeutronDataExtractor xss_data_extractor(
+  // Construct the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // The ACE table reader
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         data_properties.fileRecordLength() == 0,
+                                         data_properties.fileRecordLength(),
+                                         data_properties.fileEntriesPerRecord() );
+
+  // The XSS neutron data extractor
+  Data::XSSNeutronDataExtractor xss_data_extractor(
 					 ace_file_handler.getTableNXSArray(),
 					 ace_file_handler.getTableJXSArray(),
 				         ace_file_handler.getTableXSSArray() );
 
-    // Initialize the new nuclide
-    NuclideNameMap::mapped_type& nuclide = d_nuclide_name_map[nuclide_name];
-
-    // Create the new nuclide
-    NuclideACEFactory::createNuclide(
+  // Create the new nuclide
+  NuclideACEFactory::createNuclide(
                           xss_data_extractor,
                           data_properties.tableName(),
                           data_properties.zaid().atomicNumber(),
@@ -148,22 +201,6 @@ void NuclideFactory::createNuclideFromACETable(
                           data_properties.evaluationTemperatureInMeV().value(),
                           properties,
                           nuclide );
-
-    // Cache the new nuclide in the table name map
-    d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()] = nuclide;
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_nuclide_name_map[nuclide_name] =
-      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()];
-  }
 }
 
 } // end MonteCarlo namespace
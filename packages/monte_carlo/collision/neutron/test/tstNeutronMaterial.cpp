@@ -28,6 +28,8 @@ using boost::units::si::kelvin;
 
 std::shared_ptr<const MonteCarlo::NeutronMaterial> material;
 
+std::shared_ptr<MonteCarlo::NeutronMaterial> unionized_material;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -72,6 +74,62 @@ FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen,
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 1.6267115171099e-5, 1e-13 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the energy grid can be unionized
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, unionizeEnergyGrid )
+{
+  FRENSIE_CHECK( !material->isEnergyGridUnionized() );
+  FRENSIE_CHECK_EQUAL( material->getUnionizedEnergyGridSize(), 0 );
+  FRENSIE_CHECK_EQUAL( material->getUnionizedEnergyGridMemoryUsage(), 0 );
+
+  FRENSIE_REQUIRE_NO_THROW( unionized_material->unionizeEnergyGrid() );
+
+  FRENSIE_CHECK( unionized_material->isEnergyGridUnionized() );
+  FRENSIE_CHECK( unionized_material->getUnionizedEnergyGridSize() > 1 );
+  FRENSIE_CHECK( unionized_material->getUnionizedEnergyGridMemoryUsage() > 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the macroscopic cross sections can be returned from the
+// unionized energy grid
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen,
+                   getMacroscopicCrossSection_unionized )
+{
+  unionized_material->unionizeEnergyGrid();
+  
+  double cross_section =
+    unionized_material->getMacroscopicTotalCrossSection( 1.0e-11 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 703.45055504218, 1e-13 );
+
+  cross_section = unionized_material->getMacroscopicTotalCrossSection( 2.0e1 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 0.28847574157342, 1e-9 );
+
+  cross_section =
+    unionized_material->getMacroscopicAbsorptionCrossSection( 1.0e-11 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 9.9795573924326, 1e-13 );
+
+  cross_section =
+    unionized_material->getMacroscopicAbsorptionCrossSection( 2.0e1 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 1.6267115171099e-5, 1e-13 );
+
+  // Lin-lin data on the union grid must be reproduced between grid points
+  for( double energy = 1e-10; energy < 20.0; energy *= 3.7 )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+             unionized_material->getMacroscopicTotalCrossSection( energy ),
+             material->getMacroscopicTotalCrossSection( energy ),
+             1e-9 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+             unionized_material->getMacroscopicAbsorptionCrossSection( energy ),
+             material->getMacroscopicAbsorptionCrossSection( energy ),
+             1e-9 );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the survival probability can be returned
 FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, getSurvivalProbability )
@@ -318,6 +376,13 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                    nuclide_fractions,
                                                    nuclide_names ) );
 
+  unionized_material.reset( new MonteCarlo::NeutronMaterial(
+                                                   0,
+                                                   -1.0, // mass density (g/cm^3)
+                                                   nuclide_map,
+                                                   nuclide_fractions,
+                                                   nuclide_names ) );
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
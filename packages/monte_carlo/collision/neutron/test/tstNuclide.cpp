@@ -8,6 +8,8 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
+#include <map>
 
 // FRENSIE Includes
 #include "MonteCarlo_Nuclide.hpp"
@@ -16,12 +18,133 @@
 #include "Data_XSSNeutronDataExtractor.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
+//---------------------------------------------------------------------------//
+// Testing Structs.
+//---------------------------------------------------------------------------//
+class TestNuclide : public MonteCarlo::Nuclide
+{
+public:
+
+  // Inherit the base class constructor
+  using MonteCarlo::Nuclide::Nuclide;
+
+  ~TestNuclide()
+  { /* ... */ }
+
+  // Allow public access to the protected member functions
+  using MonteCarlo::Nuclide::findEnergyGridBin;
+  using MonteCarlo::Nuclide::getTotalCrossSection;
+  using MonteCarlo::Nuclide::getAbsorptionCrossSection;
+  using MonteCarlo::Nuclide::sampleScatteringReaction;
+  using MonteCarlo::Nuclide::sampleAbsorptionReaction;
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables.
 //---------------------------------------------------------------------------//
 
 std::shared_ptr<const MonteCarlo::Nuclide> h1_nuclide;
-std::shared_ptr<const MonteCarlo::Nuclide> o16_nuclide;
+std::shared_ptr<const TestNuclide> o16_nuclide;
+
+// The o16 reactions in the order that they were passed to the nuclide
+MonteCarlo::Nuclide::ConstReactionArray o16_original_scattering_reactions;
+MonteCarlo::Nuclide::ConstReactionArray o16_original_absorption_reactions;
+
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Sample a reaction by walking the reactions in the order given
+const MonteCarlo::NeutronNuclearReaction& sampleReactionInOrder(
+                       const MonteCarlo::Nuclide::ConstReactionArray& reactions,
+                       const double scaled_random_number,
+                       const double energy )
+{
+  double partial_cross_section = 0.0;
+
+  for( size_t i = 0; i < reactions.size(); ++i )
+  {
+    partial_cross_section += reactions[i]->getCrossSection( energy );
+
+    if( scaled_random_number < partial_cross_section )
+      return *reactions[i];
+  }
+
+  return *reactions.back();
+}
+
+// Calculate the reaction probabilities with evenly spaced random numbers
+/*! \details The probabilities are calculated with the sorted reactions of the
+ * nuclide and with the reactions in their original order. Each reaction
+ * interval is resolved to within one random number at each end.
+ */
+void calculateSampledReactionProbabilities(
+          const MonteCarlo::Nuclide::ConstReactionArray& original_reactions,
+          const bool absorption,
+          const double energy,
+          const size_t number_of_samples,
+          std::vector<double>& sorted_probabilities,
+          std::vector<double>& original_probabilities,
+          std::vector<double>& expected_probabilities )
+{
+  sorted_probabilities.clear();
+  original_probabilities.clear();
+  expected_probabilities.clear();
+
+  const size_t energy_grid_bin = o16_nuclide->findEnergyGridBin( energy );
+
+  double cross_section =
+    o16_nuclide->getAbsorptionCrossSection( energy, energy_grid_bin );
+
+  if( !absorption )
+  {
+    cross_section = o16_nuclide->getTotalCrossSection( energy, energy_grid_bin ) -
+      cross_section;
+  }
+
+  if( cross_section <= 0.0 )
+    return;
+
+  std::map<MonteCarlo::NuclearReactionType,double> sorted_counts;
+  std::map<MonteCarlo::NuclearReactionType,double> original_counts;
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+  {
+    const double scaled_random_number =
+      (i + 0.5)/number_of_samples*cross_section;
+
+    if( absorption )
+    {
+      ++sorted_counts[o16_nuclide->sampleAbsorptionReaction(
+                                          scaled_random_number,
+                                          energy,
+                                          energy_grid_bin ).getReactionType()];
+    }
+    else
+    {
+      ++sorted_counts[o16_nuclide->sampleScatteringReaction(
+                                          scaled_random_number,
+                                          energy,
+                                          energy_grid_bin ).getReactionType()];
+    }
+
+    ++original_counts[sampleReactionInOrder( original_reactions,
+                                             scaled_random_number,
+                                             energy ).getReactionType()];
+  }
+
+  for( auto&& reaction : original_reactions )
+  {
+    const MonteCarlo::NuclearReactionType reaction_type =
+      reaction->getReactionType();
+
+    sorted_probabilities.push_back(
+                            sorted_counts[reaction_type]/number_of_samples );
+    original_probabilities.push_back(
+                          original_counts[reaction_type]/number_of_samples );
+    expected_probabilities.push_back(
+                            reaction->getCrossSection( energy )/cross_section );
+  }
+}
 
 //---------------------------------------------------------------------------//
 // Tests.
@@ -345,6 +468,152 @@ FRENSIE_UNIT_TEST( Nuclide_hydrogen, collideSurvivalBias)
   std::cout << neutron << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+// Check that the energy grid bin shared by the reactions matches an
+// independent lookup at the grid points and at the discontinuities
+FRENSIE_UNIT_TEST( Nuclide_oxygen, findEnergyGridBin )
+{
+  std::vector<double> energy_grid;
+
+  o16_nuclide->getEnergyGridPoints( energy_grid );
+
+  // Only the last of a set of repeated grid points can be a lower bin
+  // boundary - the cross section to the right of the discontinuity is used
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    size_t expected_bin = i;
+
+    while( expected_bin+1 < energy_grid.size() &&
+           energy_grid[expected_bin+1] == energy_grid[i] )
+      ++expected_bin;
+
+    expected_bin = std::min( expected_bin, energy_grid.size()-2 );
+
+    FRENSIE_CHECK_EQUAL( o16_nuclide->findEnergyGridBin( energy_grid[i] ),
+                         expected_bin );
+
+    if( i+1 < energy_grid.size() && energy_grid[i+1] > energy_grid[i] )
+    {
+      const double mid_energy = 0.5*(energy_grid[i] + energy_grid[i+1]);
+
+      FRENSIE_CHECK_EQUAL( o16_nuclide->findEnergyGridBin( mid_energy ), i );
+    }
+  }
+
+  // The reaction thresholds are discontinuities of the reaction cross
+  // sections - the shared bin must give the same cross sections as a
+  // separate search for each reaction
+  MonteCarlo::Nuclide::ConstReactionArray reactions(
+                                     o16_original_scattering_reactions );
+  reactions.insert( reactions.end(),
+                    o16_original_absorption_reactions.begin(),
+                    o16_original_absorption_reactions.end() );
+
+  std::vector<double> discontinuities;
+
+  for( auto&& reaction : reactions )
+    discontinuities.push_back( reaction->getThresholdEnergy() );
+
+  for( size_t i = 1; i < energy_grid.size(); ++i )
+  {
+    if( energy_grid[i] == energy_grid[i-1] )
+      discontinuities.push_back( energy_grid[i] );
+  }
+
+  for( auto&& energy : discontinuities )
+  {
+    const size_t expected_bin =
+      std::min<size_t>( std::distance( energy_grid.begin(),
+                                       std::upper_bound( energy_grid.begin(),
+                                                         energy_grid.end(),
+                                                         energy ) ) - 1,
+                        energy_grid.size()-2 );
+
+    const size_t energy_grid_bin = o16_nuclide->findEnergyGridBin( energy );
+
+    FRENSIE_CHECK_EQUAL( energy_grid_bin, expected_bin );
+
+    FRENSIE_CHECK_EQUAL(
+                 o16_nuclide->getTotalCrossSection( energy, energy_grid_bin ),
+                 o16_nuclide->getTotalCrossSection( energy ) );
+    FRENSIE_CHECK_EQUAL(
+            o16_nuclide->getAbsorptionCrossSection( energy, energy_grid_bin ),
+            o16_nuclide->getAbsorptionCrossSection( energy ) );
+
+    for( auto&& reaction : reactions )
+    {
+      FRENSIE_CHECK_EQUAL(
+                         reaction->getCrossSection( energy, energy_grid_bin ),
+                         o16_nuclide->getReactionCrossSection(
+                                       energy, reaction->getReactionType() ) );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the scattering reaction probabilities are not changed by the
+// reaction ordering
+FRENSIE_UNIT_TEST( Nuclide_oxygen, sampleScatteringReaction )
+{
+  std::vector<double> energies( {1.0e-8, 1.0e-3, 1.0, 7.0, 15.0, 19.0} );
+
+  const size_t number_of_samples = 100000;
+
+  std::vector<double> sorted_probabilities, original_probabilities,
+    expected_probabilities;
+
+  for( auto&& energy : energies )
+  {
+    calculateSampledReactionProbabilities( o16_original_scattering_reactions,
+                                           false,
+                                           energy,
+                                           number_of_samples,
+                                           sorted_probabilities,
+                                           original_probabilities,
+                                           expected_probabilities );
+
+    for( size_t i = 0; i < sorted_probabilities.size(); ++i )
+    {
+      FRENSIE_CHECK_SMALL( sorted_probabilities[i] - original_probabilities[i],
+                           2.0/number_of_samples );
+      FRENSIE_CHECK_SMALL( sorted_probabilities[i] - expected_probabilities[i],
+                           2.0/number_of_samples );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the absorption reaction probabilities are not changed by the
+// reaction ordering
+FRENSIE_UNIT_TEST( Nuclide_oxygen, sampleAbsorptionReaction )
+{
+  std::vector<double> energies( {1.0e-8, 1.0e-3, 1.0, 7.0, 15.0, 19.0} );
+
+  const size_t number_of_samples = 100000;
+
+  std::vector<double> sorted_probabilities, original_probabilities,
+    expected_probabilities;
+
+  for( auto&& energy : energies )
+  {
+    calculateSampledReactionProbabilities( o16_original_absorption_reactions,
+                                           true,
+                                           energy,
+                                           number_of_samples,
+                                           sorted_probabilities,
+                                           original_probabilities,
+                                           expected_probabilities );
+
+    for( size_t i = 0; i < sorted_probabilities.size(); ++i )
+    {
+      FRENSIE_CHECK_SMALL( sorted_probabilities[i] - original_probabilities[i],
+                           2.0/number_of_samples );
+      FRENSIE_CHECK_SMALL( sorted_probabilities[i] - expected_probabilities[i],
+                           2.0/number_of_samples );
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a neutron can collide with a nuclide
 // FRENSIE_UNIT_TEST( Nuclide_oxygen, collideSurvivalBias)
@@ -510,7 +779,7 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
   standard_absorption_reactions.clear();
   reaction_factory->createAbsorptionReactions( standard_absorption_reactions );
 
-  o16_nuclide.reset( new MonteCarlo::Nuclide(
+  o16_nuclide.reset( new TestNuclide(
 			       "8016.70c",
                                1u,
                                1u,
@@ -521,7 +790,28 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                energy_grid_searcher,
                                standard_scattering_reactions,
                                standard_absorption_reactions ) );
-  
+
+  // Record the reaction order used by the nuclide constructor
+  MonteCarlo::Nuclide::ReactionEnumTypeSet absorption_reaction_types;
+  o16_nuclide->getAbsorptionReactionTypes( absorption_reaction_types );
+
+  MonteCarlo::Nuclide::ReactionEnumTypeSet scattering_reaction_types;
+  o16_nuclide->getScatteringReactionTypes( scattering_reaction_types );
+
+  for( auto&& reaction : standard_scattering_reactions )
+  {
+    if( absorption_reaction_types.count( reaction.first ) )
+      o16_original_absorption_reactions.push_back( reaction.second );
+    else if( scattering_reaction_types.count( reaction.first ) )
+      o16_original_scattering_reactions.push_back( reaction.second );
+  }
+
+  for( auto&& reaction : standard_absorption_reactions )
+  {
+    if( absorption_reaction_types.count( reaction.first ) )
+      o16_original_absorption_reactions.push_back( reaction.second );
+  }
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
@@ -10,6 +10,7 @@
 #include "MonteCarlo_PhotoatomFactory.hpp"
 #include "MonteCarlo_PhotoatomACEFactory.hpp"
 #include "MonteCarlo_PhotoatomNativeFactory.hpp"
+#include "MonteCarlo_DataTableLoadingHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
@@ -22,6 +23,13 @@
 namespace MonteCarlo{
 
 // Constructor
+/*! \details Each unique data table required by the photoatoms will only be
+ * loaded once (photoatoms that use the same table will share the photoatom
+ * created from it). The unique tables are independent and will be loaded
+ * concurrently using the requested number of OpenMP threads. The resulting
+ * photoatom map is identical to the one that would be created if the tables
+ * were loaded serially.
+ */
 PhotoatomFactory::PhotoatomFactory(
        const boost::filesystem::path& data_directory,
        const ScatteringCenterNameSet& photoatom_names,
@@ -36,8 +44,20 @@ PhotoatomFactory::PhotoatomFactory(
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load photoatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
-  
-  // Create each photoatom in the set
+
+  // The data properties and atomic weight of each unique table
+  std::vector<const Data::PhotoatomicDataProperties*> table_data_properties;
+  std::vector<double> table_atomic_weights;
+
+  // The table index of each photoatom in the set
+  std::vector<size_t> photoatom_table_indices;
+  photoatom_table_indices.reserve( photoatom_names.size() );
+
+  // Find the unique table used by each photoatom in the set (ACE tables are
+  // identified by the table name and native tables by the file path)
+  std::map<std::pair<Data::PhotoatomicDataProperties::FileType,std::string>,size_t>
+    table_indices;
+
   ScatteringCenterNameSet::const_iterator photoatom_name =
     photoatom_names.begin();
 
@@ -63,50 +83,128 @@ PhotoatomFactory::PhotoatomFactory(
     const Data::PhotoatomicDataProperties& photoatom_data_properties =
       photoatom_definition.getPhotoatomicDataProperties( &atomic_weight );
 
+    std::string table_key;
+
     if( photoatom_data_properties.fileType() ==
         Data::PhotoatomicDataProperties::ACE_EPR_FILE )
     {
-      // Initialize the photoatomic table name map for ACE_EPR files
-      if( d_photoatomic_table_name_map.find( Data::PhotoatomicDataProperties::ACE_EPR_FILE ) ==
-          d_photoatomic_table_name_map.end() )
-      {
-        d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE];
-      }
-        
-      this->createPhotoatomFromACETable( data_directory,
-                                         *photoatom_name,
-                                         atomic_weight,
-                                         photoatom_data_properties,
-                                         atomic_relaxation_model_factory,
-                                         properties );
+      table_key = photoatom_data_properties.tableName();
     }
     else if( photoatom_data_properties.fileType() ==
              Data::PhotoatomicDataProperties::Native_EPR_FILE )
     {
-      // Initialize the photoatomic table name map for Native EPR files
-      if( d_photoatomic_table_name_map.find( Data::PhotoatomicDataProperties::Native_EPR_FILE ) ==
-          d_photoatomic_table_name_map.end() )
-      {
-        d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE];
-      }
-      
-      this->createPhotoatomFromNativeTable( data_directory,
-                                            *photoatom_name,
-                                            atomic_weight,
-                                            photoatom_data_properties,
-                                            atomic_relaxation_model_factory,
-                                            properties );
+      table_key = photoatom_data_properties.filePath().string();
     }
     else
     {
       THROW_EXCEPTION( std::runtime_error,
                        "Photoatom " << *photoatom_name << " cannot be "
-                       "created because its definition specifies the use of a "
-                       "photoatomic data file of type "
+                       "created because its definition specifies the use of "
+                       "a photoatomic data file of type "
                        << photoatom_data_properties.fileType() <<
                        ", which is currently unsupported!" );
     }
 
+    // Check if the table has already been requested
+    const std::pair<Data::PhotoatomicDataProperties::FileType,std::string>
+      table_id( photoatom_data_properties.fileType(), table_key );
+
+    std::map<std::pair<Data::PhotoatomicDataProperties::FileType,std::string>,size_t>::const_iterator
+      table_index_it = table_indices.find( table_id );
+
+    if( table_index_it == table_indices.end() )
+    {
+      table_index_it =
+        table_indices.emplace( table_id, table_data_properties.size() ).first;
+
+      table_data_properties.push_back( &photoatom_data_properties );
+      table_atomic_weights.push_back( atomic_weight );
+    }
+
+    photoatom_table_indices.push_back( table_index_it->second );
+
+    ++photoatom_name;
+  }
+
+  // Load the unique tables
+  std::vector<PhotoatomNameMap::mapped_type>
+    table_photoatoms( table_data_properties.size() );
+
+  std::vector<double> table_load_times;
+
+  loadDataTablesConcurrently(
+             table_data_properties.size(),
+             [&]( const size_t table_index ){
+               if( table_data_properties[table_index]->fileType() ==
+                   Data::PhotoatomicDataProperties::ACE_EPR_FILE )
+               {
+                 this->createPhotoatomFromACETable(
+                                       data_directory,
+                                       table_atomic_weights[table_index],
+                                       *table_data_properties[table_index],
+                                       atomic_relaxation_model_factory,
+                                       properties,
+                                       table_photoatoms[table_index] );
+               }
+               else
+               {
+                 this->createPhotoatomFromNativeTable(
+                                       data_directory,
+                                       table_atomic_weights[table_index],
+                                       *table_data_properties[table_index],
+                                       atomic_relaxation_model_factory,
+                                       properties,
+                                       table_photoatoms[table_index] );
+               }
+             },
+             table_load_times );
+
+  // Cache the new photoatoms in the table name map
+  std::map<std::pair<Data::PhotoatomicDataProperties::FileType,std::string>,size_t>::const_iterator
+    table_index_it = table_indices.begin();
+
+  while( table_index_it != table_indices.end() )
+  {
+    d_photoatomic_table_name_map[table_index_it->first.first][table_index_it->first.second] =
+      table_photoatoms[table_index_it->second];
+
+    ++table_index_it;
+  }
+
+  if( d_verbose )
+  {
+    for( size_t i = 0; i < table_data_properties.size(); ++i )
+    {
+      if( table_data_properties[i]->fileType() ==
+          Data::PhotoatomicDataProperties::ACE_EPR_FILE )
+      {
+        logDataTableLoadTime( "ACE EPR photoatomic cross section table " +
+                              table_data_properties[i]->tableName() +
+                              " from " +
+                              table_data_properties[i]->filePath().string(),
+                              table_load_times[i] );
+      }
+      else
+      {
+        logDataTableLoadTime( "native EPR cross section table (v " +
+                              Utility::toString( table_data_properties[i]->fileVersion() ) +
+                              ") for " +
+                              Utility::toString( table_data_properties[i]->atom() ) +
+                              " from " +
+                              table_data_properties[i]->filePath().string(),
+                              table_load_times[i] );
+      }
+    }
+  }
+
+  // Assign the photoatoms
+  photoatom_name = photoatom_names.begin();
+
+  for( size_t i = 0; i < photoatom_table_indices.size(); ++i )
+  {
+    d_photoatom_name_map[*photoatom_name] =
+      table_photoatoms[photoatom_table_indices[i]];
+
     ++photoatom_name;
   }
 
@@ -119,164 +217,95 @@ PhotoatomFactory::PhotoatomFactory(
 
 // Create the map of photoatoms
 void PhotoatomFactory::createPhotoatomMap(
-                                        PhotoatomNameMap& photoatom_map ) const
+                                PhotoatomNameMap& photoatom_name_map ) const
 {
-  photoatom_map = d_photoatom_name_map;
+  photoatom_name_map = d_photoatom_name_map;
 }
 
 // Create a photoatom from an ACE table
 void PhotoatomFactory::createPhotoatomFromACETable(
-			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
-                        const double atomic_weight,
-			const Data::PhotoatomicDataProperties& data_properties,
-                        const std::shared_ptr<AtomicRelaxationModelFactory>&
-                        atomic_relaxation_model_factory,
-                        const SimulationProperties& properties )
+                      const boost::filesystem::path& data_directory,
+                      const double atomic_weight,
+                      const Data::PhotoatomicDataProperties& data_properties,
+                      const std::shared_ptr<AtomicRelaxationModelFactory>&
+                      atomic_relaxation_model_factory,
+                      const SimulationProperties& properties,
+                      PhotoatomNameMap::mapped_type& photoatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE].end() )
-  {
-    // Construct the the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                   " Loading ACE EPR photoatomic cross section "
-                                   "table " << data_properties.tableName() <<
-                                   " from " << ace_file_path.string() <<
-                                   " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-    
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-					   data_properties.tableName(),
-					   data_properties.fileStartLine(),
-					   true );
-
-    // Create the XSS data extractor
-    Data::XSSEPRDataExtractor xss_data_extractor(
-					 ace_file_handler.getTableNXSArray(),
-					 ace_file_handler.getTableJXSArray(),
-					 ace_file_handler.getTableXSSArray() );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+  // Construct the the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // Create the ACEFileHandler
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         data_properties.fileRecordLength() == 0,
+                                         data_properties.fileRecordLength(),
+                                         data_properties.fileEntriesPerRecord() );
+
+  // Create the XSS data extractor
+  Data::XSSEPRDataExtractor xss_data_extractor(
+                                         ace_file_handler.getTableNXSArray(),
+                                         ace_file_handler.getTableJXSArray(),
+                                         ace_file_handler.getTableXSSArray() );
+
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
                                xss_data_extractor,
                                atomic_relaxation_model,
                                properties.getMinPhotonEnergy(),
                                properties.getMinElectronEnergy(),
-			       properties.isAtomicRelaxationModeOn( PHOTON ) );
-
-    // Initialize the new photoatom
-    PhotoatomNameMap::mapped_type& photoatom =
-      d_photoatom_name_map[photoatom_name];
+                               properties.isAtomicRelaxationModeOn( PHOTON ) );
 
-    // Create the new photoatom
-    PhotoatomACEFactory::createPhotoatom(
-                                        xss_data_extractor,
+  // Create the new photoatom
+  PhotoatomACEFactory::createPhotoatom( xss_data_extractor,
                                         data_properties.tableName(),
                                         atomic_weight,
                                         atomic_relaxation_model,
                                         properties,
                                         photoatom );
-    
-    // Cache the new photoatom in the table name map
-    d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()] = photoatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_photoatom_name_map[photoatom_name] =
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()];
-  }
 }
 
 // Create a photoatom from a Native table
 void PhotoatomFactory::createPhotoatomFromNativeTable(
-			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
-                        const double atomic_weight,
-                        const Data::PhotoatomicDataProperties& data_properties,
-                        const std::shared_ptr<AtomicRelaxationModelFactory>&
-                        atomic_relaxation_model_factory,
-                        const SimulationProperties& properties )
+                      const boost::filesystem::path& data_directory,
+                      const double atomic_weight,
+                      const Data::PhotoatomicDataProperties& data_properties,
+                      const std::shared_ptr<AtomicRelaxationModelFactory>&
+                      atomic_relaxation_model_factory,
+                      const SimulationProperties& properties,
+                      PhotoatomNameMap::mapped_type& photoatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
 
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                " Loading native EPR cross section table "
-                                "(v " << data_properties.fileVersion() <<
-                                ") for " << data_properties.atom() <<
-                                " from " << native_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-    
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+  // Create the epr data container
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( native_file_path );
 
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
 
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
                                data_container,
                                atomic_relaxation_model,
                                properties.getMinPhotonEnergy(),
                                properties.getMinElectronEnergy(),
                                properties.isAtomicRelaxationModeOn( PHOTON ) );
 
-    // Initialize the new photoatom
-    PhotoatomNameMap::mapped_type& photoatom =
-      d_photoatom_name_map[photoatom_name];
-
-    // Create the new photoatom
-    PhotoatomNativeFactory::createPhotoatom(
-                                           data_container,
+  // Create the new photoatom
+  PhotoatomNativeFactory::createPhotoatom( data_container,
                                            data_properties.filePath().string(),
                                            atomic_weight,
                                            atomic_relaxation_model,
                                            properties,
                                            photoatom );
-
-    // Cache the new photoatom in the table name map
-    d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = photoatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_photoatom_name_map[photoatom_name] =
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
-  }
 }
 
 } // end MonteCarlo namespace
@@ -105,6 +105,9 @@ public:
   //! Return the total absorption cross section from nuclear interactions
   double getNuclearAbsorptionCrossSection( const double energy ) const;
 
+  //! Add the energy grid points of the photonuclear cross sections
+  void getNuclearEnergyGridPoints( std::vector<double>& grid_points ) const;
+
   //! Return the cross section for a specific photonuclear reaction
   double getReactionCrossSection(
 			       const double energy
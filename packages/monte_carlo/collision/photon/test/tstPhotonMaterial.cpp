@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomFactory.hpp"
@@ -22,6 +23,8 @@
 
 std::shared_ptr<MonteCarlo::PhotonMaterial> material;
 
+std::shared_ptr<MonteCarlo::PhotonMaterial> unionized_material;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -115,6 +118,75 @@ FRENSIE_UNIT_TEST( PhotonMaterial, getSurvivalProbability )
   FRENSIE_CHECK_FLOATING_EQUALITY( survival_prob, 0.9999996542464503, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the energy grid can be unionized
+FRENSIE_UNIT_TEST( PhotonMaterial, unionizeEnergyGrid )
+{
+  FRENSIE_CHECK( !material->isEnergyGridUnionized() );
+  FRENSIE_CHECK_EQUAL( material->getUnionizedEnergyGridSize(), 0 );
+
+  FRENSIE_REQUIRE_NO_THROW( unionized_material->unionizeEnergyGrid() );
+
+  FRENSIE_CHECK( unionized_material->isEnergyGridUnionized() );
+  FRENSIE_CHECK( unionized_material->getUnionizedEnergyGridMemoryUsage() > 0 );
+
+  // The union grid must contain every atom energy grid point
+  std::vector<double> atom_grid_points;
+
+  unionized_material->getScatteringCenter( "Pb" )->getEnergyGridPoints( atom_grid_points );
+
+  std::sort( atom_grid_points.begin(), atom_grid_points.end() );
+
+  atom_grid_points.erase( std::unique( atom_grid_points.begin(),
+                                       atom_grid_points.end() ),
+                          atom_grid_points.end() );
+
+  FRENSIE_CHECK( unionized_material->getUnionizedEnergyGridSize() >=
+                 atom_grid_points.size() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the macroscopic cross sections can be returned from the
+// unionized energy grid
+FRENSIE_UNIT_TEST( PhotonMaterial, getMacroscopicCrossSection_unionized )
+{
+  unionized_material->unionizeEnergyGrid();
+
+  double cross_section = unionized_material->getMacroscopicTotalCrossSection(
+                                                   exp( -1.381551055796E+01 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 1.823831998305667e-05, 1e-12 );
+
+  cross_section = unionized_material->getMacroscopicTotalCrossSection(
+                                                    exp( 1.151292546497E+01 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 0.11970087585747362, 1e-12 );
+
+  cross_section = unionized_material->getMacroscopicAbsorptionCrossSection(
+                                                   exp( -1.214969212306E+01 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 85114.18059425855, 1e-12 );
+
+  cross_section = unionized_material->getMacroscopicAbsorptionCrossSection(
+                                                    exp( 1.151292546497E+01 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 4.138700272111011e-08, 1e-11 );
+
+  // The log-log data must be reproduced between the union grid points (to
+  // within the convergence tolerance)
+  for( double energy = 1e-4; energy < 1e5; energy *= 3.7 )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+             unionized_material->getMacroscopicTotalCrossSection( energy ),
+             material->getMacroscopicTotalCrossSection( energy ),
+             2e-3 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+             unionized_material->getMacroscopicAbsorptionCrossSection( energy ),
+             material->getMacroscopicAbsorptionCrossSection( energy ),
+             2e-3 );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the macroscopic cross section for a specific reaction can be ret
 FRENSIE_UNIT_TEST( PhotonMaterial, getMacroscopicReactionCrossSection )
@@ -497,6 +569,12 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                     atom_map,
                                                     atom_fractions,
                                                     atom_names ) );
+
+    unionized_material.reset( new MonteCarlo::PhotonMaterial( 0,
+                                                              -1.0,
+                                                              atom_map,
+                                                              atom_fractions,
+                                                              atom_names ) );
   }
 
   // Initialize the random number generator
@@ -18,7 +18,8 @@ namespace MonteCarlo{
 
 // Default Constructor
 ParticleBank::ParticleBank()
-  : d_particle_states()
+  : d_particle_states(),
+    d_recycled_nodes()
 { /* ... */ }
 
 // Check if the bank is empty
@@ -57,7 +58,7 @@ const ParticleState& ParticleBank::top() const
  */
 void ParticleBank::push( const ParticleState& particle )
 {
-  d_particle_states.emplace_back( particle.clone() );
+  this->addToBack( std::shared_ptr<ParticleState>( particle.clone() ) );
 }
 
 // Insert a neutron into the bank after an interaction (Most Efficient/Recommended)
@@ -90,7 +91,43 @@ void ParticleBank::pop()
   // Make sure the bank is not empty
   testPrecondition( !this->isEmpty() );
 
-  d_particle_states.pop_front();
+  // Release the particle and keep the container node for reuse
+  d_particle_states.front().reset();
+
+  d_recycled_nodes.splice( d_recycled_nodes.begin(),
+                           d_particle_states,
+                           d_particle_states.begin() );
+}
+
+// Pop the top particle from the bank and store it in the smart pointer (Most Efficient/Recommended)
+/*! \details If the bank holds the only reference to the top particle the
+ * particle will simply be handed over to the smart pointer. Otherwise a copy
+ * (clone) of the particle will be created. Handing over the particle avoids
+ * the allocation of a new particle state and a new navigator.
+ */
+void ParticleBank::pop( std::shared_ptr<ParticleState>& particle )
+{
+  // Make sure the bank is not empty
+  testPrecondition( !this->isEmpty() );
+
+  if( d_particle_states.front().use_count() == 1 )
+    particle = std::move( d_particle_states.front() );
+  else
+    particle.reset( this->top().clone() );
+
+  this->pop();
+}
+
+// Return the number of container nodes available for reuse
+unsigned long long ParticleBank::getNumberOfRecycledNodes() const
+{
+  return d_recycled_nodes.size();
+}
+
+// Release the container nodes available for reuse
+void ParticleBank::releaseRecycledNodes()
+{
+  d_recycled_nodes.clear();
 }
 
 // Check if the bank is sorted
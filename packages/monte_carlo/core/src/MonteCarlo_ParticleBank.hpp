@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <memory>
 #include <functional>
+#include <utility>
 
 // Boost Includes
 #include <boost/serialization/shared_ptr.hpp>
@@ -27,7 +28,12 @@
 
 namespace MonteCarlo{
 
-//! The particle bank base class (FIFO)
+/*! The particle bank base class (FIFO)
+ * \details The container nodes of popped particles are kept by the bank and
+ * reused by subsequent pushes. A bank that is reused for every history
+ * simulated by a thread will therefore stop allocating container nodes once
+ * it reaches its high-water mark.
+ */
 class ParticleBank
 {
 
@@ -86,6 +92,15 @@ public:
   template<template<typename> class SmartPointer>
   void pop( SmartPointer<ParticleState>& particle );
 
+  //! Pop the top particle from the bank and store it in the smart pointer (Most Efficient/Recommended)
+  void pop( std::shared_ptr<ParticleState>& particle );
+
+  //! Return the number of container nodes available for reuse
+  unsigned long long getNumberOfRecycledNodes() const;
+
+  //! Release the container nodes available for reuse
+  void releaseRecycledNodes();
+
   //! Check if the bank is sorted
   virtual bool isSorted( const CompareFunctionType& compare_function );
 
@@ -110,6 +125,9 @@ private:
   static const ParticleState& dereference(
                                const std::shared_ptr<ParticleState>& pointer );
 
+  // Add a particle to the end of the bank (reusing a node if possible)
+  void addToBack( std::shared_ptr<ParticleState> particle );
+
   // Save the bank to an archive
   template<typename Archive>
   void serialize( Archive& ar, const unsigned version )
@@ -120,6 +138,9 @@ private:
 
   // A list of particle states
   BankContainerType d_particle_states;
+
+  // The container nodes available for reuse (the stored pointers are null)
+  BankContainerType d_recycled_nodes;
 };
 
 // Dereference a smart pointer
@@ -129,6 +150,21 @@ inline const ParticleState& ParticleBank::dereference(
   return *pointer;
 }
 
+// Add a particle to the end of the bank (reusing a node if possible)
+inline void ParticleBank::addToBack( std::shared_ptr<ParticleState> particle )
+{
+  if( d_recycled_nodes.empty() )
+    d_particle_states.emplace_back( std::move( particle ) );
+  else
+  {
+    d_particle_states.splice( d_particle_states.end(),
+                              d_recycled_nodes,
+                              d_recycled_nodes.begin() );
+
+    d_particle_states.back() = std::move( particle );
+  }
+}
+
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_CLASS_VERSION( ParticleBank, MonteCarlo, 0 );
@@ -46,7 +46,7 @@ void ParticleBank::push( std::shared_ptr<State>& particle )
   // If this pointer is unique we can simply take it
   if( particle.use_count() == 1 )
   {
-    d_particle_states.push_back( particle );
+    this->addToBack( particle );
   }
   // The pointer is not unique - make a clone
   else
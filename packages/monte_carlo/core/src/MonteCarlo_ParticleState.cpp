@@ -13,9 +13,57 @@
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_3DCartesianVectorHelpers.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_MemoryBlockPool.hpp"
 
 namespace MonteCarlo{
 
+// Allocate the memory of a particle state (from the thread's state pool)
+void* ParticleState::operator new( const size_t size )
+{
+  Utility::MemoryBlockPool* pool =
+    Utility::MemoryBlockPool::getThreadPool<ParticleState>();
+
+  if( pool )
+    return pool->allocate( size );
+  else
+    return ::operator new( size );
+}
+
+// Return the memory of a particle state to the thread's state pool
+/*! \details The destructor is virtual so the size will always be the size
+ * of the concrete particle state type.
+ */
+void ParticleState::operator delete( void* state, const size_t size ) noexcept
+{
+  Utility::MemoryBlockPool* pool =
+    Utility::MemoryBlockPool::getThreadPool<ParticleState>();
+
+  if( pool )
+  {
+    try{
+      pool->deallocate( state, size );
+    }
+    catch( ... )
+    {
+      ::operator delete( state );
+    }
+  }
+  else
+    ::operator delete( state );
+}
+
+// Return the number of state memory blocks in the thread's state pool
+size_t ParticleState::getNumberOfPooledStates()
+{
+  Utility::MemoryBlockPool* pool =
+    Utility::MemoryBlockPool::getThreadPool<ParticleState>();
+
+  if( pool )
+    return pool->getNumberOfFreeBlocks();
+  else
+    return 0;
+}
+
 // Default constructor
 /*! \details The default constructor should only be called before loading the
  * particle state from an archive.
@@ -302,7 +350,9 @@ void ParticleState::advance( double raw_distance )
   Geometry::Navigator::Length distance =
     Geometry::Navigator::Length::from_value( raw_distance );
 
-  Geometry::Navigator::Length distance_to_surface = d_navigator->fireRay();
+  // The ray only needs to be fired if a boundary could be crossed
+  Geometry::Navigator::Length distance_to_surface =
+    d_navigator->fireRayIfBoundaryIsWithin( distance );
 
   while( distance > distance_to_surface )
   {
@@ -100,6 +100,15 @@ public:
   //! Clone the particle state but change the history number
   ParticleState* clone( const historyNumberType new_history_number ) const;
 
+  //! Allocate the memory of a particle state (from the thread's state pool)
+  static void* operator new( const size_t size );
+
+  //! Return the memory of a particle state to the thread's state pool
+  static void operator delete( void* state, const size_t size ) noexcept;
+
+  //! Return the number of state memory blocks in the thread's state pool
+  static size_t getNumberOfPooledStates();
+
   //! Return the history number
   historyNumberType getHistoryNumber() const;
 
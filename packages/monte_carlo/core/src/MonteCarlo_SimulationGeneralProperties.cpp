@@ -26,7 +26,12 @@ SimulationGeneralProperties::SimulationGeneralProperties()
     d_number_of_batches_per_processor( 1 ),
     d_number_of_snapshots_per_batch( 1 ),
     d_wall_time( Utility::QuantityTraits<double>::inf() ),
-    d_implicit_capture_mode_on( false )
+    d_implicit_capture_mode_on( false ),
+    d_unionized_energy_grid_mode_on( false ),
+    d_event_based_transport_mode_on( false ),
+    d_number_of_event_based_histories_per_thread( 100 ),
+    d_delta_tracking_mode_on( false ),
+    d_delta_tracking_cross_section_ratio_threshold( 0.1 )
 { /* ... */ }
 
 // Set the particle mode
@@ -201,6 +206,127 @@ bool SimulationGeneralProperties::isImplicitCaptureModeOn() const
   return d_implicit_capture_mode_on;
 }
 
+// Set unionized energy grid mode to on (off by default)
+/*! \details When unionized energy grid mode is on the scattering center
+ * energy grids of each material will be unionized when the model is filled.
+ * This trades extra memory for a single grid search per macroscopic cross
+ * section evaluation.
+ */
+void SimulationGeneralProperties::setUnionizedEnergyGridModeOn()
+{
+  d_unionized_energy_grid_mode_on = true;
+}
+
+// Set unionized energy grid mode to off (off by default)
+void SimulationGeneralProperties::setUnionizedEnergyGridModeOff()
+{
+  d_unionized_energy_grid_mode_on = false;
+}
+
+// Return if unionized energy grid mode has been set
+bool SimulationGeneralProperties::isUnionizedEnergyGridModeOn() const
+{
+  return d_unionized_energy_grid_mode_on;
+}
+
+// Set event-based transport mode to on (off by default)
+/*! \details When event-based transport mode is on the particles of a
+ * block of histories will be advanced together one event stage at a time
+ * (cross section lookup, ray fire, surface crossing, collision) instead of
+ * one particle at a time. Only shared memory simulations support this mode.
+ */
+void SimulationGeneralProperties::setEventBasedTransportModeOn()
+{
+  d_event_based_transport_mode_on = true;
+}
+
+// Set event-based transport mode to off (off by default)
+void SimulationGeneralProperties::setEventBasedTransportModeOff()
+{
+  d_event_based_transport_mode_on = false;
+}
+
+// Return if event-based transport mode has been set
+bool SimulationGeneralProperties::isEventBasedTransportModeOn() const
+{
+  return d_event_based_transport_mode_on;
+}
+
+// Set the number of histories that each thread keeps in flight in event-based transport mode
+/*! \details Every history that is in flight has its own random number
+ * stream and its own uncommitted observer data. Larger blocks of histories
+ * give longer event stages at the cost of more per-thread data.
+ */
+void SimulationGeneralProperties::setNumberOfEventBasedHistoriesPerThread(
+                                              const uint64_t number_of_histories )
+{
+  // There must be at least one history per thread
+  TEST_FOR_EXCEPTION( number_of_histories == 0,
+                      std::runtime_error,
+                      "There must be at least one event-based history per "
+                      "thread!" );
+
+  d_number_of_event_based_histories_per_thread = number_of_histories;
+}
+
+// Get the number of histories that each thread keeps in flight in event-based transport mode
+uint64_t SimulationGeneralProperties::getNumberOfEventBasedHistoriesPerThread() const
+{
+  return d_number_of_event_based_histories_per_thread;
+}
+
+// Set delta tracking mode to on (off by default)
+/*! \details When delta tracking mode is on neutral particles will sample
+ * their flight distances using the majorant macroscopic cross section of the
+ * model (the max over all materials at the particle energy). Collisions
+ * with the majorant are accepted as real with probability equal to the
+ * ratio of the cell and majorant cross sections, which means that cell
+ * boundaries only need to be located at candidate collision sites. Cell
+ * boundary crossings are not observed, so surface and cell boundary
+ * estimators will not score in cells that are delta tracked.
+ */
+void SimulationGeneralProperties::setDeltaTrackingModeOn()
+{
+  d_delta_tracking_mode_on = true;
+}
+
+// Set delta tracking mode to off (off by default)
+void SimulationGeneralProperties::setDeltaTrackingModeOff()
+{
+  d_delta_tracking_mode_on = false;
+}
+
+// Return if delta tracking mode has been set
+bool SimulationGeneralProperties::isDeltaTrackingModeOn() const
+{
+  return d_delta_tracking_mode_on;
+}
+
+// Set the delta tracking cross section ratio threshold
+/*! \details In cells where the ratio of the cell and majorant cross
+ * sections is below this threshold most majorant collisions would be
+ * rejected, so surface tracking will be used instead. A threshold of 0.0
+ * will force delta tracking in every non-void cell and a threshold of 1.0
+ * will only allow delta tracking in the cells that set the majorant.
+ */
+void SimulationGeneralProperties::setDeltaTrackingCrossSectionRatioThreshold(
+                                                       const double threshold )
+{
+  // The threshold must be in [0,1]
+  TEST_FOR_EXCEPTION( threshold < 0.0 || threshold > 1.0,
+                      std::runtime_error,
+                      "The delta tracking cross section ratio threshold must "
+                      "be in [0,1]!" );
+
+  d_delta_tracking_cross_section_ratio_threshold = threshold;
+}
+
+// Return the delta tracking cross section ratio threshold
+double SimulationGeneralProperties::getDeltaTrackingCrossSectionRatioThreshold() const
+{
+  return d_delta_tracking_cross_section_ratio_threshold;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationGeneralProperties );
 
 } // end MonteCarlo namespace
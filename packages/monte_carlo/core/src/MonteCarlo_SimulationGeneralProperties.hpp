@@ -101,6 +101,45 @@ public:
   //! Return if implicit capture mode has been set
   bool isImplicitCaptureModeOn() const;
 
+  //! Set unionized energy grid mode to on (off by default)
+  void setUnionizedEnergyGridModeOn();
+
+  //! Set unionized energy grid mode to off (off by default)
+  void setUnionizedEnergyGridModeOff();
+
+  //! Return if unionized energy grid mode has been set
+  bool isUnionizedEnergyGridModeOn() const;
+
+  //! Set event-based transport mode to on (off by default)
+  void setEventBasedTransportModeOn();
+
+  //! Set event-based transport mode to off (off by default)
+  void setEventBasedTransportModeOff();
+
+  //! Return if event-based transport mode has been set
+  bool isEventBasedTransportModeOn() const;
+
+  //! Set the number of histories that each thread keeps in flight in event-based transport mode
+  void setNumberOfEventBasedHistoriesPerThread( const uint64_t number_of_histories );
+
+  //! Get the number of histories that each thread keeps in flight in event-based transport mode
+  uint64_t getNumberOfEventBasedHistoriesPerThread() const;
+
+  //! Set delta tracking mode to on (off by default)
+  void setDeltaTrackingModeOn();
+
+  //! Set delta tracking mode to off (off by default)
+  void setDeltaTrackingModeOff();
+
+  //! Return if delta tracking mode has been set
+  bool isDeltaTrackingModeOn() const;
+
+  //! Set the delta tracking cross section ratio threshold
+  void setDeltaTrackingCrossSectionRatioThreshold( const double threshold );
+
+  //! Return the delta tracking cross section ratio threshold
+  double getDeltaTrackingCrossSectionRatioThreshold() const;
+
 private:
 
   // Save the state to an archive
@@ -145,6 +184,22 @@ private:
 
   // The capture mode (true = implicit, false = analogue - default)
   bool d_implicit_capture_mode_on;
+
+  // The unionized energy grid mode
+  bool d_unionized_energy_grid_mode_on;
+
+  // The transport mode (true = event-based, false = history-based - default)
+  bool d_event_based_transport_mode_on;
+
+  // The number of histories that each thread keeps in flight (event-based)
+  uint64_t d_number_of_event_based_histories_per_thread;
+
+  // The tracking mode (true = delta tracking, false = surface tracking - default)
+  bool d_delta_tracking_mode_on;
+
+  // The cell to majorant cross section ratio below which surface tracking
+  // is used in delta tracking mode
+  double d_delta_tracking_cross_section_ratio_threshold;
 };
 
 // Save the state to an archive
@@ -179,6 +234,11 @@ void SimulationGeneralProperties::save( Archive& ar, const unsigned version ) co
   }
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_event_based_histories_per_thread );
+  ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_cross_section_ratio_threshold );
 }
 
 // Load the state to an archive
@@ -203,6 +263,11 @@ void SimulationGeneralProperties::load( Archive& ar, const unsigned version )
     d_wall_time = Utility::QuantityTraits<double>::inf();
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_event_based_histories_per_thread );
+  ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_cross_section_ratio_threshold );
 }
 
 } // end MonteCarlo namespace
@@ -248,6 +248,93 @@ FRENSIE_UNIT_TEST( ParticleBank, pop_store )
   FRENSIE_CHECK_EQUAL( bank.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a uniquely owned top particle is handed over when it is popped
+FRENSIE_UNIT_TEST( ParticleBank, pop_store_unique )
+{
+  MonteCarlo::ParticleBank bank;
+
+  std::shared_ptr<MonteCarlo::ParticleState> particle(
+                                        new MonteCarlo::PhotonState( 0ull ) );
+
+  const MonteCarlo::ParticleState* raw_particle = particle.get();
+
+  bank.push( particle );
+
+  FRENSIE_CHECK( !particle );
+
+  bank.pop( particle );
+
+  FRENSIE_CHECK_EQUAL( particle.get(), raw_particle );
+  FRENSIE_CHECK_EQUAL( particle.use_count(), 1 );
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the container nodes of popped particles are reused
+FRENSIE_UNIT_TEST( ParticleBank, recycled_nodes )
+{
+  MonteCarlo::ParticleBank bank;
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledNodes(), 0 );
+
+  bank.push( MonteCarlo::PhotonState( 0ull ) );
+  bank.push( MonteCarlo::NeutronState( 1ull ) );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledNodes(), 1 );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledNodes(), 2 );
+
+  bank.push( MonteCarlo::ElectronState( 2ull ) );
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledNodes(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 2ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::ELECTRON );
+
+  bank.releaseRecycledNodes();
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledNodes(), 0 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the memory of popped particles is reused by new particles
+FRENSIE_UNIT_TEST( ParticleBank, pooled_states )
+{
+  MonteCarlo::ParticleBank bank;
+
+  bank.push( MonteCarlo::PhotonState( 0ull ) );
+
+  const MonteCarlo::ParticleState* popped_particle = &bank.top();
+
+  const size_t number_of_pooled_states =
+    MonteCarlo::ParticleState::getNumberOfPooledStates();
+
+  const size_t number_of_pooled_navigators =
+    Geometry::Navigator::getNumberOfPooledNavigators();
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::ParticleState::getNumberOfPooledStates(),
+                       number_of_pooled_states + 1 );
+
+  // The navigator of the popped particle is also recycled
+  FRENSIE_CHECK_EQUAL( Geometry::Navigator::getNumberOfPooledNavigators(),
+                       number_of_pooled_navigators + 1 );
+
+  bank.push( MonteCarlo::PhotonState( 1ull ) );
+
+  FRENSIE_CHECK_EQUAL( &bank.top(), popped_particle );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 1ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::ParticleState::getNumberOfPooledStates(),
+                       number_of_pooled_states );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the bank can be sorted
 FRENSIE_UNIT_TEST( ParticleBank, sort )
@@ -41,6 +41,11 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfEventBasedHistoriesPerThread(), 100 );
+  FRENSIE_CHECK( !properties.isDeltaTrackingModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getDeltaTrackingCrossSectionRatioThreshold(), 0.1 );
 }
 
 //---------------------------------------------------------------------------//
@@ -193,6 +198,85 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that unionized energy grid mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setUnionizedEnergyGridModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+  
+  properties.setUnionizedEnergyGridModeOn();
+
+  FRENSIE_CHECK( properties.isUnionizedEnergyGridModeOn() );
+
+  properties.setUnionizedEnergyGridModeOff();
+
+  FRENSIE_CHECK( !properties.isUnionizedEnergyGridModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that event-based transport mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setEventBasedTransportModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setEventBasedTransportModeOn();
+
+  FRENSIE_CHECK( properties.isEventBasedTransportModeOn() );
+
+  properties.setEventBasedTransportModeOff();
+
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that delta tracking mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setDeltaTrackingModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setDeltaTrackingModeOn();
+
+  FRENSIE_CHECK( properties.isDeltaTrackingModeOn() );
+
+  properties.setDeltaTrackingModeOff();
+
+  FRENSIE_CHECK( !properties.isDeltaTrackingModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the delta tracking cross section ratio threshold can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setDeltaTrackingCrossSectionRatioThreshold )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setDeltaTrackingCrossSectionRatioThreshold( 0.5 );
+
+  FRENSIE_CHECK_EQUAL( properties.getDeltaTrackingCrossSectionRatioThreshold(), 0.5 );
+
+  FRENSIE_CHECK_THROW( properties.setDeltaTrackingCrossSectionRatioThreshold( -0.1 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( properties.setDeltaTrackingCrossSectionRatioThreshold( 1.1 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the number of event-based histories per thread can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setNumberOfEventBasedHistoriesPerThread )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setNumberOfEventBasedHistoriesPerThread( 1000 );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfEventBasedHistoriesPerThread(), 1000 );
+
+  FRENSIE_CHECK_THROW( properties.setNumberOfEventBasedHistoriesPerThread( 0 ),
+                       std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
@@ -226,6 +310,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
     custom_properties.setNumberOfBatchesPerProcessor( 25 );
     custom_properties.setNumberOfSnapshotsPerBatch( 3 );
     custom_properties.setImplicitCaptureModeOn();
+    custom_properties.setUnionizedEnergyGridModeOn();
+    custom_properties.setEventBasedTransportModeOn();
+    custom_properties.setNumberOfEventBasedHistoriesPerThread( 1000 );
+    custom_properties.setDeltaTrackingModeOn();
+    custom_properties.setDeltaTrackingCrossSectionRatioThreshold( 0.25 );
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -257,6 +346,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !default_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !default_properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK( !default_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfEventBasedHistoriesPerThread(), 100 );
+  FRENSIE_CHECK( !default_properties.isDeltaTrackingModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getDeltaTrackingCrossSectionRatioThreshold(), 0.1 );
 
   MonteCarlo::SimulationGeneralProperties custom_properties;
 
@@ -275,6 +369,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfBatchesPerProcessor(), 25 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfSnapshotsPerBatch(), 3 );
   FRENSIE_CHECK( custom_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( custom_properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK( custom_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfEventBasedHistoriesPerThread(), 1000 );
+  FRENSIE_CHECK( custom_properties.isDeltaTrackingModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getDeltaTrackingCrossSectionRatioThreshold(), 0.25 );
 }
 
 //---------------------------------------------------------------------------//
@@ -414,6 +414,14 @@ public:
     d_rhs->commitHistoryContribution();
   }
 
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t histories,
+                     const double time ) final override
+  {
+    d_lhs->takeSnapshot( histories, time );
+    d_rhs->takeSnapshot( histories, time );
+  }
+
   //! Reset the observer data
   void resetData() final override
   {
@@ -565,7 +573,9 @@ ParticleHistorySimulationCompletionCriterion::createMixedCriterion(
 }
 
 // Take a snapshot
-/*! \details The state should never need to be cached.
+/*! \details The state of the history count and wall time criteria never
+ * needs to be cached. Criteria that depend on the observer states (e.g.
+ * estimator relative errors) can override this method.
  */
 void ParticleHistorySimulationCompletionCriterion::takeSnapshot(
                                                  const uint64_t, const double )
@@ -37,7 +37,9 @@ EventHandler::EventHandler()
     d_elapsed_simulation_time( 0.0 ),
     d_estimators(),
     d_particle_trackers(),
-    d_particle_history_observers( {d_simulation_completion_criterion} )
+    d_particle_history_observers( {d_simulation_completion_criterion} ),
+    d_min_masked_cell_id( 0 ),
+    d_cell_event_masks()
 { /* ... */ }
 
 // Constructor
@@ -70,7 +72,9 @@ EventHandler::EventHandler(
     d_elapsed_simulation_time( 0.0 ),
     d_estimators(),
     d_particle_trackers(),
-    d_particle_history_observers( {d_simulation_completion_criterion} )
+    d_particle_history_observers( {d_simulation_completion_criterion} ),
+    d_min_masked_cell_id( 0 ),
+    d_cell_event_masks()
 {
   if( model )
   {
@@ -517,6 +521,84 @@ void EventHandler::enableThreadSupport( const unsigned num_threads )
 
   d_number_of_committed_histories.resize( num_threads, 0 );
   d_number_of_committed_histories_from_last_snapshot.resize( num_threads, 0 );
+
+  this->compileObserverDispatchTables();
+}
+
+// Compile the observer dispatch tables
+/*! \details The observers attached to each entity dispatcher will be
+ * flattened into dense arrays of raw observer pointers. In addition, a mask
+ * of the cell event types that have observers will be created for every
+ * cell so that events in cells without observers can be skipped with a
+ * single bit test. Attaching observers after the tables have been compiled
+ * is allowed but the tables must be compiled again to regain the fast path.
+ * This should only be called by the master thread after all of the
+ * observers have been added.
+ */
+void EventHandler::compileObserverDispatchTables()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->getParticleCollidingInCellEventDispatcher().compileDispatchTable();
+  this->getParticleCrossingSurfaceEventDispatcher().compileDispatchTable();
+  this->getParticleEnteringCellEventDispatcher().compileDispatchTable();
+  this->getParticleLeavingCellEventDispatcher().compileDispatchTable();
+  this->getParticleSubtrackEndingInCellEventDispatcher().compileDispatchTable();
+
+  this->discardCellEventMasks();
+
+  std::map<uint64_t,uint8_t> cell_event_masks;
+
+  EventHandler::addCellEventTypeToMasks(
+                             this->getParticleCollidingInCellEventDispatcher(),
+                             PARTICLE_COLLIDING_IN_CELL_EVENT,
+                             cell_event_masks );
+  EventHandler::addCellEventTypeToMasks(
+                               this->getParticleEnteringCellEventDispatcher(),
+                               PARTICLE_ENTERING_CELL_EVENT,
+                               cell_event_masks );
+  EventHandler::addCellEventTypeToMasks(
+                                this->getParticleLeavingCellEventDispatcher(),
+                                PARTICLE_LEAVING_CELL_EVENT,
+                                cell_event_masks );
+  EventHandler::addCellEventTypeToMasks(
+                       this->getParticleSubtrackEndingInCellEventDispatcher(),
+                       PARTICLE_SUBTRACK_ENDING_IN_CELL_EVENT,
+                       cell_event_masks );
+
+  if( cell_event_masks.empty() )
+  {
+    // No cell has observers - every cell event can be skipped
+    d_min_masked_cell_id = 0;
+    d_cell_event_masks.assign( 1, 0 );
+  }
+  else
+  {
+    const uint64_t min_cell_id = cell_event_masks.begin()->first;
+    const uint64_t cell_id_range =
+      cell_event_masks.rbegin()->first - min_cell_id + 1;
+
+    // Only create dense masks when the cell ids are not too sparse
+    if( cell_id_range <= 65536 || cell_id_range <= 16*cell_event_masks.size() )
+    {
+      d_min_masked_cell_id = min_cell_id;
+      d_cell_event_masks.resize( cell_id_range, 0 );
+
+      for( auto&& cell_event_mask : cell_event_masks )
+      {
+        d_cell_event_masks[cell_event_mask.first - min_cell_id] =
+          cell_event_mask.second;
+      }
+    }
+  }
+}
+
+// Discard the cell event masks
+void EventHandler::discardCellEventMasks()
+{
+  d_min_masked_cell_id = 0;
+  d_cell_event_masks.clear();
 }
 
 // Update observers from particle simulation started event
@@ -594,6 +676,50 @@ void EventHandler::logObserverSummaries() const
   FRENSIE_LOG_NOTIFICATION( oss.str() );
 }
 
+// Export the weight windows produced by the weight window mesh generators
+/*! \details Each weight window mesh generator (estimator) will export its
+ * weight windows to an archive named archive_name_prefix_id.archive_type.
+ * Any existing archives will be overwritten so that the latest weight
+ * windows are always available (e.g. for the next run of an iterative
+ * weight window generation procedure).
+ */
+void EventHandler::exportGeneratedWeightWindows(
+                                        const std::string& archive_name_prefix,
+                                        const std::string& archive_type ) const
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // There is no data to generate weight windows from
+  if( this->getNumberOfCommittedHistories() == 0 )
+    return;
+
+  EstimatorIdMap::const_iterator it = d_estimators.begin();
+
+  while( it != d_estimators.end() )
+  {
+    std::shared_ptr<const WeightWindowMeshGenerator> generator =
+      std::dynamic_pointer_cast<const WeightWindowMeshGenerator>( it->second );
+
+    if( generator )
+    {
+      // The estimator data processing requires the current history count
+      ParticleHistoryObserver::setElapsedTime( this->getElapsedTime() );
+      ParticleHistoryObserver::setNumberOfHistories( this->getNumberOfCommittedHistories() );
+
+      std::string archive_name( archive_name_prefix );
+      archive_name += "_";
+      archive_name += Utility::toString( generator->getId() );
+      archive_name += ".";
+      archive_name += archive_type;
+
+      generator->exportWeightWindows( archive_name );
+    }
+
+    ++it;
+  }
+}
+
 // Print the estimators
 void EventHandler::printObserverSummaries( std::ostream& os ) const
 {
@@ -24,12 +24,14 @@
 #include "MonteCarlo_ParticleGoneGlobalEventHandler.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
 #include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_ParticleState.hpp"
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "Geometry_AdvancedModel.hpp"
 #include "Utility_Vector.hpp"
+#include "Utility_Map.hpp"
 
 namespace MonteCarlo{
 
@@ -121,6 +123,30 @@ public:
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads );
 
+  //! Compile the observer dispatch tables
+  void compileObserverDispatchTables();
+
+  //! Update the observers from a particle colliding in cell event
+  void updateObserversFromParticleCollidingInCellEvent(
+                                    const ParticleState& particle,
+                                    const double inverse_total_cross_section );
+
+  //! Update the observers from a particle entering cell event
+  void updateObserversFromParticleEnteringCellEvent(
+                               const ParticleState& particle,
+                               const Geometry::Model::EntityId cell_entering );
+
+  //! Update the observers from a particle leaving cell event
+  void updateObserversFromParticleLeavingCellEvent(
+                                const ParticleState& particle,
+                                const Geometry::Model::EntityId cell_leaving );
+
+  //! Update the observers from a particle subtrack ending in cell event
+  void updateObserversFromParticleSubtrackEndingInCellEvent(
+                              const ParticleState& particle,
+                              const Geometry::Model::EntityId cell_of_subtrack,
+                              const double particle_subtrack_length );
+
   //! Update observers from particle simulation started event
   void updateObserversFromParticleSimulationStartedEvent();
 
@@ -139,6 +165,10 @@ public:
   //! Log the observer summaries
   void logObserverSummaries() const;
 
+  //! Export the weight windows produced by the weight window mesh generators
+  void exportGeneratedWeightWindows( const std::string& archive_name_prefix,
+                                     const std::string& archive_type ) const;
+
   //! Reset observer data
   void resetObserverData();
 
@@ -158,8 +188,35 @@ public:
   //! Get the elapsed time since the last snapshot
   double getElapsedTimeSinceLastSnapshot() const;
 
+protected:
+
+  //! The cell event types that are tracked by the cell event masks
+  enum CellEventType : uint8_t
+  {
+    PARTICLE_COLLIDING_IN_CELL_EVENT = 1,
+    PARTICLE_ENTERING_CELL_EVENT = 2,
+    PARTICLE_LEAVING_CELL_EVENT = 4,
+    PARTICLE_SUBTRACK_ENDING_IN_CELL_EVENT = 8
+  };
+
+  //! Check if the cell event must be dispatched to the cell observers
+  template<typename EventDispatcher>
+  bool isCellEventDispatchRequired( const Geometry::Model::EntityId cell_id,
+                                    const CellEventType cell_event_type,
+                                    const EventDispatcher& dispatcher ) const;
+
 private:
 
+  // Add the cell event type to the masks of the cells with observers
+  template<typename EventDispatcher>
+  static void addCellEventTypeToMasks(
+                                const EventDispatcher& dispatcher,
+                                const CellEventType cell_event_type,
+                                std::map<uint64_t,uint8_t>& cell_event_masks );
+
+  // Discard the cell event masks
+  void discardCellEventMasks();
+
   // Create a default simulation completion criterion
   static std::shared_ptr<ParticleHistorySimulationCompletionCriterion>
   createDefaultCompletionCriterion( const MonteCarlo::SimulationGeneralProperties& properties );
@@ -378,6 +435,12 @@ private:
 
   // The observers
   ParticleHistoryObservers d_particle_history_observers;
+
+  // The smallest cell id with a cell event mask
+  uint64_t d_min_masked_cell_id;
+
+  // The cell event masks (indexed by cell id - smallest cell id)
+  std::vector<uint8_t> d_cell_event_masks;
 };
 
 } // end MonteCarlo namespace
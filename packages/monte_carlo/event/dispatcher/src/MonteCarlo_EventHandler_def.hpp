@@ -270,6 +270,114 @@ void EventHandler::ObserverRegistrationHelper<EndEventTagIterator,EndEventTagIte
                                  const std::set<ParticleType>& particle_types )
 { /* ... */ }
 
+// Update the observers from a particle colliding in cell event
+inline void EventHandler::updateObserversFromParticleCollidingInCellEvent(
+                                     const ParticleState& particle,
+                                     const double inverse_total_cross_section )
+{
+  if( this->isCellEventDispatchRequired(
+                         particle.getCell(),
+                         PARTICLE_COLLIDING_IN_CELL_EVENT,
+                         this->getParticleCollidingInCellEventDispatcher() ) )
+  {
+    ParticleCollidingInCellEventHandler::updateObserversFromParticleCollidingInCellEvent(
+                                                 particle,
+                                                 inverse_total_cross_section );
+  }
+}
+
+// Update the observers from a particle entering cell event
+inline void EventHandler::updateObserversFromParticleEnteringCellEvent(
+                                const ParticleState& particle,
+                                const Geometry::Model::EntityId cell_entering )
+{
+  if( this->isCellEventDispatchRequired(
+                            cell_entering,
+                            PARTICLE_ENTERING_CELL_EVENT,
+                            this->getParticleEnteringCellEventDispatcher() ) )
+  {
+    ParticleEnteringCellEventHandler::updateObserversFromParticleEnteringCellEvent(
+                                                               particle,
+                                                               cell_entering );
+  }
+}
+
+// Update the observers from a particle leaving cell event
+inline void EventHandler::updateObserversFromParticleLeavingCellEvent(
+                                 const ParticleState& particle,
+                                 const Geometry::Model::EntityId cell_leaving )
+{
+  if( this->isCellEventDispatchRequired(
+                             cell_leaving,
+                             PARTICLE_LEAVING_CELL_EVENT,
+                             this->getParticleLeavingCellEventDispatcher() ) )
+  {
+    ParticleLeavingCellEventHandler::updateObserversFromParticleLeavingCellEvent(
+                                                                particle,
+                                                                cell_leaving );
+  }
+}
+
+// Update the observers from a particle subtrack ending in cell event
+inline void EventHandler::updateObserversFromParticleSubtrackEndingInCellEvent(
+                              const ParticleState& particle,
+                              const Geometry::Model::EntityId cell_of_subtrack,
+                              const double particle_subtrack_length )
+{
+  if( this->isCellEventDispatchRequired(
+                    cell_of_subtrack,
+                    PARTICLE_SUBTRACK_ENDING_IN_CELL_EVENT,
+                    this->getParticleSubtrackEndingInCellEventDispatcher() ) )
+  {
+    ParticleSubtrackEndingInCellEventHandler::updateObserversFromParticleSubtrackEndingInCellEvent(
+                                                    particle,
+                                                    cell_of_subtrack,
+                                                    particle_subtrack_length );
+  }
+}
+
+// Add the cell event type to the masks of the cells with observers
+template<typename EventDispatcher>
+void EventHandler::addCellEventTypeToMasks(
+                                 const EventDispatcher& dispatcher,
+                                 const CellEventType cell_event_type,
+                                 std::map<uint64_t,uint8_t>& cell_event_masks )
+{
+  std::set<uint64_t> cell_ids;
+
+  dispatcher.getEntityIdsWithObservers( cell_ids );
+
+  for( auto&& cell_id : cell_ids )
+    cell_event_masks[cell_id] |= cell_event_type;
+}
+
+// Check if the cell event must be dispatched to the cell observers
+/*! \details When the observer dispatch tables have been compiled, the cell
+ * event only needs to be dispatched if the cell event mask for the cell
+ * has the cell event type bit set. If the dispatcher has been modified since
+ * the tables were compiled (or the tables have not been compiled) the event
+ * must always be dispatched.
+ */
+template<typename EventDispatcher>
+inline bool EventHandler::isCellEventDispatchRequired(
+                                   const Geometry::Model::EntityId cell_id,
+                                   const CellEventType cell_event_type,
+                                   const EventDispatcher& dispatcher ) const
+{
+  if( !d_cell_event_masks.empty() && dispatcher.isDispatchTableCompiled() )
+  {
+    // Note: cell ids below the min masked cell id will wrap around
+    const uint64_t cell_index = cell_id - d_min_masked_cell_id;
+
+    if( cell_index < d_cell_event_masks.size() )
+      return d_cell_event_masks[cell_index] & cell_event_type;
+    else
+      return false;
+  }
+  else
+    return true;
+}
+
 // Save the data to an archive
 template<typename Archive>
 void EventHandler::save( Archive& ar, const unsigned version ) const
@@ -303,6 +411,9 @@ void EventHandler::save( Archive& ar, const unsigned version ) const
 template<typename Archive>
 void EventHandler::load( Archive& ar, const unsigned version )
 {
+  // The dispatch tables are not archived
+  this->discardCellEventMasks();
+  
   // Load the base class data
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingInCellEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCrossingSurfaceEventHandler );
@@ -19,15 +19,33 @@ void ParticleCollidingInCellEventDispatcher::dispatchParticleCollidingInCellEven
                              const Geometry::Model::EntityId cell_of_collision,
                              const double inverse_total_cross_section )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_collision );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObserverRange observers =
+      this->getCompiledObservers( cell_of_collision, particle.getParticleType() );
+
+    while( observers.first != observers.second )
+    {
+      (*observers.first)->updateFromParticleCollidingInCellEvent(
+                                                 particle,
+                                                 cell_of_collision,
+                                                 inverse_total_cross_section );
 
-  if( it != this->getDispatcherMap().end() )
+      ++observers.first;
+    }
+  }
+  else
   {
-    it->second->dispatchParticleCollidingInCellEvent(
+    DispatcherMap::iterator it =
+      this->getDispatcherMap().find( cell_of_collision );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleCollidingInCellEvent(
 						 particle,
 						 cell_of_collision,
 						 inverse_total_cross_section );
+    }
   }
 }
 
@@ -19,13 +19,31 @@ void ParticleCrossingSurfaceEventDispatcher::dispatchParticleCrossingSurfaceEven
                               const Geometry::Model::EntityId surface_crossing,
                               const double angle_cosine )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( surface_crossing );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObserverRange observers =
+      this->getCompiledObservers( surface_crossing, particle.getParticleType() );
+
+    while( observers.first != observers.second )
+    {
+      (*observers.first)->updateFromParticleCrossingSurfaceEvent(
+                                                                particle,
+                                                                surface_crossing,
+                                                                angle_cosine );
 
-  if( it != this->getDispatcherMap().end() )
+      ++observers.first;
+    }
+  }
+  else
   {
-    it->second->dispatchParticleCrossingSurfaceEvent( particle,
+    DispatcherMap::iterator it = this->getDispatcherMap().find( surface_crossing );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleCrossingSurfaceEvent( particle,
 						      surface_crossing,
 						      angle_cosine );
+    }
   }
 }
 
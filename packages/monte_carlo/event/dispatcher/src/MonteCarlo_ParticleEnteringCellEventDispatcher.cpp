@@ -18,10 +18,26 @@ void ParticleEnteringCellEventDispatcher::dispatchParticleEnteringCellEvent(
                                 const ParticleState& particle,
                                 const Geometry::Model::EntityId cell_entering )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_entering );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObserverRange observers =
+      this->getCompiledObservers( cell_entering, particle.getParticleType() );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
+    while( observers.first != observers.second )
+    {
+      (*observers.first)->updateFromParticleEnteringCellEvent( particle,
+                                                               cell_entering );
+
+      ++observers.first;
+    }
+  }
+  else
+  {
+    DispatcherMap::iterator it = this->getDispatcherMap().find( cell_entering );
+
+    if( it != this->getDispatcherMap().end() )
+      it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
+  }
 }
   
 } // end MonteCarlo namespace
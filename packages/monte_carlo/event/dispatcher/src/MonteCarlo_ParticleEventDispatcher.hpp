@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <utility>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -20,9 +21,12 @@
 #include <boost/serialization/shared_ptr.hpp>
 
 // FRENSIE Includes
+#include "MonteCarlo_ParticleType.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_Map.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
 
@@ -64,17 +68,42 @@ public:
   //! Detach all observers
   void detachAllObservers();
 
+  //! Check if any local dispatcher has observers of the particle type
+  bool hasObservers( const ParticleType particle_type ) const;
+
+  //! Get the ids of the entities that have attached observers
+  void getEntityIdsWithObservers( std::set<uint64_t>& entity_ids ) const;
+
+  //! Compile the observer dispatch table
+  void compileDispatchTable();
+
+  //! Check if the observer dispatch table has been compiled
+  bool isDispatchTableCompiled() const;
+
 protected:
 
   // Typedef for the dispatcher map
   typedef typename std::unordered_map<uint64_t,std::unique_ptr<Dispatcher> >
   DispatcherMap;
 
+  // Typedef for a range of compiled observers
+  typedef std::pair<typename Dispatcher::ObserverType* const*,
+                    typename Dispatcher::ObserverType* const*>
+  CompiledObserverRange;
+
   //! Get the dispatcher map
   DispatcherMap& getDispatcherMap();
 
+  //! Get the compiled observers of the particle type attached to the entity
+  CompiledObserverRange getCompiledObservers(
+                                const uint64_t entity_id,
+                                const ParticleType particle_type ) const;
+
 private:
 
+  // Discard the compiled observer dispatch table
+  void discardDispatchTable();
+
   // Serialize the observer
   template<typename Archive>
   void serialize( Archive& ar, const unsigned version );
@@ -82,7 +111,29 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
+  // The number of particle types in each compiled entity table row
+  static const size_t s_number_of_particle_types =
+    ParticleType_END - ParticleType_START;
+
+  // The min entity id range that can always be compiled
+  static const uint64_t s_min_dense_entity_id_range = 65536;
+
   DispatcherMap d_dispatcher_map;
+
+  // Records if the dispatch table has been compiled
+  bool d_dispatch_table_compiled;
+
+  // The smallest entity id in the dispatch table
+  uint64_t d_compiled_min_entity_id;
+
+  // The number of entity ids spanned by the dispatch table
+  uint64_t d_compiled_entity_id_range;
+
+  // The compiled observer offsets (indexed by entity and particle type)
+  std::vector<size_t> d_compiled_observer_offsets;
+
+  // The compiled observers
+  std::vector<typename Dispatcher::ObserverType*> d_compiled_observers;
 };
 
 } // end MonteCarlo namespace
@@ -9,19 +9,42 @@
 #ifndef MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 #define MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
 namespace MonteCarlo{
 
+// Initialize static member data
+template<typename Dispatcher>
+const size_t ParticleEventDispatcher<Dispatcher>::s_number_of_particle_types;
+
+template<typename Dispatcher>
+const uint64_t ParticleEventDispatcher<Dispatcher>::s_min_dense_entity_id_range;
+
 // Constructor
 template<typename Dispatcher>
 ParticleEventDispatcher<Dispatcher>::ParticleEventDispatcher()
-  : d_dispatcher_map()
+  : d_dispatcher_map(),
+    d_dispatch_table_compiled( false ),
+    d_compiled_min_entity_id( 0 ),
+    d_compiled_entity_id_range( 0 ),
+    d_compiled_observer_offsets(),
+    d_compiled_observers()
 { /* ... */ }
 
 // Get the appropriate local dispatcher for the given entity id
+/*! \details The local dispatcher can be modified through the returned
+ * reference so the compiled dispatch table (if any) will be discarded.
+ */
 template<typename Dispatcher>
 inline Dispatcher& ParticleEventDispatcher<Dispatcher>::getLocalDispatcher(
                                                      const uint64_t entity_id )
 {
+  this->discardDispatchTable();
+  
   typename DispatcherMap::iterator it = d_dispatcher_map.find( entity_id );
 
   if( it != d_dispatcher_map.end() )
@@ -71,6 +94,8 @@ template<typename Dispatcher>
 inline void ParticleEventDispatcher<Dispatcher>::detachObserver(
            const std::shared_ptr<typename Dispatcher::ObserverType>& observer )
 {
+  this->discardDispatchTable();
+  
   typename DispatcherMap::iterator it = d_dispatcher_map.begin();
 
   while( it != d_dispatcher_map.end() )
@@ -85,9 +110,122 @@ inline void ParticleEventDispatcher<Dispatcher>::detachObserver(
 template<typename Dispatcher>
 void ParticleEventDispatcher<Dispatcher>::detachAllObservers()
 {
+  this->discardDispatchTable();
+  
   d_dispatcher_map.clear();
 }
 
+// Check if any local dispatcher has observers of the particle type
+template<typename Dispatcher>
+bool ParticleEventDispatcher<Dispatcher>::hasObservers(
+                                   const ParticleType particle_type ) const
+{
+  typename DispatcherMap::const_iterator it = d_dispatcher_map.begin();
+
+  while( it != d_dispatcher_map.end() )
+  {
+    if( it->second->getNumberOfObservers( particle_type ) > 0 )
+      return true;
+
+    ++it;
+  }
+
+  return false;
+}
+
+// Get the ids of the entities that have attached observers
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::getEntityIdsWithObservers(
+                                     std::set<uint64_t>& entity_ids ) const
+{
+  typename DispatcherMap::const_iterator it = d_dispatcher_map.begin();
+
+  while( it != d_dispatcher_map.end() )
+  {
+    for( int i = ParticleType_START; i < ParticleType_END; ++i )
+    {
+      if( it->second->getNumberOfObservers( (ParticleType)i ) > 0 )
+      {
+        entity_ids.insert( it->first );
+
+        break;
+      }
+    }
+
+    ++it;
+  }
+}
+
+// Compile the observer dispatch table
+/*! \details The observers attached to each local dispatcher will be
+ * flattened into a single array of raw observer pointers that is indexed
+ * by (entity id, particle type). Dispatching an event through the compiled
+ * table avoids the hash map lookup and the observer set traversal. The table
+ * is dense in the entity id so it will only be compiled when the entity ids
+ * that have observers are not too sparse - the dispatcher map will be used
+ * otherwise. Attaching or detaching an observer after the table has been
+ * compiled will discard the table (it must be compiled again). This should
+ * only be called after all of the observers have been attached and before
+ * any events are dispatched on multiple threads.
+ */
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::compileDispatchTable()
+{
+  this->discardDispatchTable();
+
+  std::set<uint64_t> entity_ids;
+
+  this->getEntityIdsWithObservers( entity_ids );
+
+  if( entity_ids.empty() )
+  {
+    d_compiled_observer_offsets.assign( 1, 0 );
+    d_dispatch_table_compiled = true;
+
+    return;
+  }
+
+  const uint64_t entity_id_range =
+    *entity_ids.rbegin() - *entity_ids.begin() + 1;
+
+  if( entity_id_range > std::max( s_min_dense_entity_id_range,
+                                  (uint64_t)(16*entity_ids.size()) ) )
+    return;
+
+  d_compiled_min_entity_id = *entity_ids.begin();
+  d_compiled_entity_id_range = entity_id_range;
+
+  d_compiled_observer_offsets.resize(
+                       entity_id_range*s_number_of_particle_types + 1, 0 );
+
+  for( uint64_t i = 0; i < entity_id_range; ++i )
+  {
+    typename DispatcherMap::const_iterator it =
+      d_dispatcher_map.find( d_compiled_min_entity_id + i );
+
+    for( size_t j = 0; j < s_number_of_particle_types; ++j )
+    {
+      if( it != d_dispatcher_map.end() )
+      {
+        it->second->getObservers( (ParticleType)(ParticleType_START+j),
+                                  d_compiled_observers );
+      }
+
+      d_compiled_observer_offsets[i*s_number_of_particle_types+j+1] =
+        d_compiled_observers.size();
+    }
+  }
+
+  d_dispatch_table_compiled = true;
+}
+
+// Check if the observer dispatch table has been compiled
+template<typename Dispatcher>
+inline bool ParticleEventDispatcher<Dispatcher>::isDispatchTableCompiled() const
+{
+  return d_dispatch_table_compiled;
+}
+
 // Get the dispatcher map
 template<typename Dispatcher>
 inline auto ParticleEventDispatcher<Dispatcher>::getDispatcherMap() -> DispatcherMap&
@@ -95,11 +233,59 @@ inline auto ParticleEventDispatcher<Dispatcher>::getDispatcherMap() -> Dispatche
   return d_dispatcher_map;
 }
 
+// Get the compiled observers of the particle type attached to the entity
+template<typename Dispatcher>
+inline auto ParticleEventDispatcher<Dispatcher>::getCompiledObservers(
+                                   const uint64_t entity_id,
+                                   const ParticleType particle_type ) const
+  -> CompiledObserverRange
+{
+  // Make sure that the dispatch table has been compiled
+  testPrecondition( d_dispatch_table_compiled );
+
+  // Note: entity ids below the min entity id will wrap around
+  const uint64_t entity_index = entity_id - d_compiled_min_entity_id;
+
+  if( entity_index < d_compiled_entity_id_range )
+  {
+    const size_t offset_index =
+      entity_index*s_number_of_particle_types +
+      (particle_type - ParticleType_START);
+
+    typename Dispatcher::ObserverType* const* observers =
+      d_compiled_observers.data();
+
+    return CompiledObserverRange(
+                       observers + d_compiled_observer_offsets[offset_index],
+                       observers + d_compiled_observer_offsets[offset_index+1] );
+  }
+  else
+    return CompiledObserverRange( nullptr, nullptr );
+}
+
+// Discard the compiled observer dispatch table
+template<typename Dispatcher>
+inline void ParticleEventDispatcher<Dispatcher>::discardDispatchTable()
+{
+  if( d_dispatch_table_compiled )
+  {
+    d_dispatch_table_compiled = false;
+    d_compiled_min_entity_id = 0;
+    d_compiled_entity_id_range = 0;
+    d_compiled_observer_offsets.clear();
+    d_compiled_observers.clear();
+  }
+}
+
 // Serialize the observer
 template<typename Dispatcher>
 template<typename Archive>
 void ParticleEventDispatcher<Dispatcher>::serialize( Archive& ar, const unsigned version )
 {
+  // The compiled dispatch table is not archived
+  if( Archive::is_loading::value )
+    this->discardDispatchTable();
+  
   ar & BOOST_SERIALIZATION_NVP( d_dispatcher_map );
 }
 
@@ -24,6 +24,7 @@
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_Map.hpp"
+#include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
 
@@ -63,6 +64,10 @@ public:
   //! Get the number of attached observers
   size_t getNumberOfObservers( const ParticleType particle_type ) const;
 
+  //! Append the attached observers of the particle type to the array
+  void getObservers( const ParticleType particle_type,
+                     std::vector<Observer*>& observers ) const;
+
 protected:
 
   // The observers set
@@ -90,6 +90,25 @@ size_t ParticleEventLocalDispatcher<Observer>::getNumberOfObservers(
     return 0;
 }
 
+// Append the attached observers of the particle type to the array
+/*! \details The observers will be appended in the same order that they
+ * would be visited by a derived class when dispatching an event.
+ */
+template<typename Observer>
+void ParticleEventLocalDispatcher<Observer>::getObservers(
+                                     const ParticleType particle_type,
+                                     std::vector<Observer*>& observers ) const
+{
+  typename std::map<int,ObserverSet>::const_iterator
+    particle_observer_sets_it = d_observer_sets.find( particle_type );
+
+  if( particle_observer_sets_it != d_observer_sets.end() )
+  {
+    for( auto&& observer : particle_observer_sets_it->second )
+      observers.push_back( observer.get() );
+  }
+}
+
 // Check if there is an observer set for the particle type
 template<typename Observer>
 inline bool ParticleEventLocalDispatcher<Observer>::hasObserverSet(
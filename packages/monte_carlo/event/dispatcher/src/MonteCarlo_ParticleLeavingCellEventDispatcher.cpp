@@ -18,10 +18,26 @@ void ParticleLeavingCellEventDispatcher::dispatchParticleLeavingCellEvent(
                                  const ParticleState& particle,
 	                         const Geometry::Model::EntityId cell_leaving )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_leaving );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObserverRange observers =
+      this->getCompiledObservers( cell_leaving, particle.getParticleType() );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+    while( observers.first != observers.second )
+    {
+      (*observers.first)->updateFromParticleLeavingCellEvent( particle,
+                                                              cell_leaving );
+
+      ++observers.first;
+    }
+  }
+  else
+  {
+    DispatcherMap::iterator it = this->getDispatcherMap().find( cell_leaving );
+
+    if( it != this->getDispatcherMap().end() )
+      it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+  }
 }
   
 } // end MonteCarlo namespace
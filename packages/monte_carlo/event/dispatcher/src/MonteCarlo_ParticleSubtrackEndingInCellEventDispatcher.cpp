@@ -19,14 +19,32 @@ void ParticleSubtrackEndingInCellEventDispatcher::dispatchParticleSubtrackEnding
                               const Geometry::Model::EntityId cell_of_subtrack,
                               const double track_length )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_subtrack );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObserverRange observers =
+      this->getCompiledObservers( cell_of_subtrack, particle.getParticleType() );
+
+    while( observers.first != observers.second )
+    {
+      (*observers.first)->updateFromParticleSubtrackEndingInCellEvent(
+                                                                particle,
+                                                                cell_of_subtrack,
+                                                                track_length );
 
-  if( it != this->getDispatcherMap().end() )
+      ++observers.first;
+    }
+  }
+  else
   {
-    it->second->dispatchParticleSubtrackEndingInCellEvent( particle,
+    DispatcherMap::iterator it =
+      this->getDispatcherMap().find( cell_of_subtrack );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleSubtrackEndingInCellEvent( particle,
 							   cell_of_subtrack,
 							   track_length );
+    }
   }
 }
 
@@ -33,6 +33,41 @@
 
 typedef TestArchiveHelper::TestArchives TestArchives;
 
+class TestEventHandler : public MonteCarlo::EventHandler
+{
+public:
+
+  // Check if a particle entering cell event must be dispatched
+  bool isParticleEnteringCellEventDispatchRequired(
+                           const Geometry::Model::EntityId cell_id ) const
+  {
+    return this->isCellEventDispatchRequired(
+                              cell_id,
+                              PARTICLE_ENTERING_CELL_EVENT,
+                              this->getParticleEnteringCellEventDispatcher() );
+  }
+
+  // Check if a particle leaving cell event must be dispatched
+  bool isParticleLeavingCellEventDispatchRequired(
+                           const Geometry::Model::EntityId cell_id ) const
+  {
+    return this->isCellEventDispatchRequired(
+                               cell_id,
+                               PARTICLE_LEAVING_CELL_EVENT,
+                               this->getParticleLeavingCellEventDispatcher() );
+  }
+
+  // Check if a particle subtrack ending in cell event must be dispatched
+  bool isParticleSubtrackEndingInCellEventDispatchRequired(
+                           const Geometry::Model::EntityId cell_id ) const
+  {
+    return this->isCellEventDispatchRequired(
+                      cell_id,
+                      PARTICLE_SUBTRACK_ENDING_IN_CELL_EVENT,
+                      this->getParticleSubtrackEndingInCellEventDispatcher() );
+  }
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables
 //---------------------------------------------------------------------------//
@@ -700,6 +735,149 @@ FRENSIE_UNIT_TEST( EventHandler, get_dispatcher )
   FRENSIE_CHECK_EQUAL( event_handler.getParticleGoneGlobalEventDispatcher().getNumberOfObservers( MonteCarlo::ELECTRON ), 1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that cell events are only dispatched to cells with observers once
+// the observer dispatch tables have been compiled
+FRENSIE_UNIT_TEST( EventHandler, compileObserverDispatchTables )
+{
+  TestEventHandler event_handler;
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                                100, 1.0, std::vector<uint64_t>( {2, 3} ) ) );
+
+  event_handler.addEstimator( estimator );
+
+  // Before compiling every cell event must be dispatched
+  FRENSIE_CHECK( event_handler.isParticleEnteringCellEventDispatchRequired( 1 ) );
+  FRENSIE_CHECK( event_handler.isParticleEnteringCellEventDispatchRequired( 2 ) );
+  FRENSIE_CHECK( event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 2 ) );
+
+  event_handler.compileObserverDispatchTables();
+
+  FRENSIE_CHECK( event_handler.getParticleEnteringCellEventDispatcher().isDispatchTableCompiled() );
+  FRENSIE_CHECK( event_handler.getParticleLeavingCellEventDispatcher().isDispatchTableCompiled() );
+  FRENSIE_CHECK( event_handler.getParticleSubtrackEndingInCellEventDispatcher().isDispatchTableCompiled() );
+
+  // Cells with observers
+  FRENSIE_CHECK( event_handler.isParticleEnteringCellEventDispatchRequired( 2 ) );
+  FRENSIE_CHECK( event_handler.isParticleEnteringCellEventDispatchRequired( 3 ) );
+  FRENSIE_CHECK( event_handler.isParticleLeavingCellEventDispatchRequired( 2 ) );
+  FRENSIE_CHECK( event_handler.isParticleLeavingCellEventDispatchRequired( 3 ) );
+
+  // Cells without observers (below, above and inside the masked range)
+  FRENSIE_CHECK( !event_handler.isParticleEnteringCellEventDispatchRequired( 0 ) );
+  FRENSIE_CHECK( !event_handler.isParticleEnteringCellEventDispatchRequired( 1 ) );
+  FRENSIE_CHECK( !event_handler.isParticleEnteringCellEventDispatchRequired( 4 ) );
+  FRENSIE_CHECK( !event_handler.isParticleLeavingCellEventDispatchRequired( 1 ) );
+
+  // Cell event types without observers
+  FRENSIE_CHECK( !event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 2 ) );
+  FRENSIE_CHECK( !event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 3 ) );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 1.0 );
+
+  event_handler.updateObserversFromParticleEnteringCellEvent( photon, 1 );
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  event_handler.updateObserversFromParticleEnteringCellEvent( photon, 2 );
+
+  FRENSIE_CHECK( estimator->hasUncommittedHistoryContribution() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that cell events are dispatched to observers that are attached after
+// the observer dispatch tables have been compiled
+FRENSIE_UNIT_TEST( EventHandler, compileObserverDispatchTables_late_observer )
+{
+  TestEventHandler event_handler;
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator>
+    pulse_height_estimator(
+            new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                                100, 1.0, std::vector<uint64_t>( {1, 2} ) ) );
+
+  event_handler.addEstimator( pulse_height_estimator );
+  event_handler.compileObserverDispatchTables();
+
+  FRENSIE_CHECK( !event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 3 ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+    track_length_estimator(
+             new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                               101,
+                                               1.0,
+                                               std::vector<uint64_t>( {3} ),
+                                               std::vector<double>( {1.0} ) ) );
+  track_length_estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler.addEstimator( track_length_estimator );
+
+  // The modified dispatcher falls back to the map path
+  FRENSIE_CHECK( !event_handler.getParticleSubtrackEndingInCellEventDispatcher().isDispatchTableCompiled() );
+  FRENSIE_CHECK( event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 3 ) );
+  FRENSIE_CHECK( event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 4 ) );
+
+  // The unmodified dispatchers still use the cell event masks
+  FRENSIE_CHECK( event_handler.getParticleEnteringCellEventDispatcher().isDispatchTableCompiled() );
+  FRENSIE_CHECK( !event_handler.isParticleEnteringCellEventDispatchRequired( 3 ) );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 1.0 );
+
+  event_handler.updateObserversFromParticleSubtrackEndingInCellEvent( photon, 3, 1.0 );
+
+  FRENSIE_CHECK( track_length_estimator->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( !pulse_height_estimator->hasUncommittedHistoryContribution() );
+
+  // Compiling again restores the fast path
+  event_handler.compileObserverDispatchTables();
+
+  FRENSIE_CHECK( event_handler.getParticleSubtrackEndingInCellEventDispatcher().isDispatchTableCompiled() );
+  FRENSIE_CHECK( event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 3 ) );
+  FRENSIE_CHECK( !event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 1 ) );
+  FRENSIE_CHECK( !event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 4 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that sparse cell ids keep the map path
+FRENSIE_UNIT_TEST( EventHandler, compileObserverDispatchTables_sparse )
+{
+  TestEventHandler event_handler;
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                          100, 1.0, std::vector<uint64_t>( {1, 1000000} ) ) );
+
+  event_handler.addEstimator( estimator );
+  event_handler.compileObserverDispatchTables();
+
+  FRENSIE_CHECK( !event_handler.getParticleEnteringCellEventDispatcher().isDispatchTableCompiled() );
+  FRENSIE_CHECK( !event_handler.getParticleLeavingCellEventDispatcher().isDispatchTableCompiled() );
+
+  // Without the cell event masks every cell event must be dispatched
+  FRENSIE_CHECK( event_handler.isParticleEnteringCellEventDispatchRequired( 1 ) );
+  FRENSIE_CHECK( event_handler.isParticleEnteringCellEventDispatchRequired( 500000 ) );
+  FRENSIE_CHECK( event_handler.isParticleEnteringCellEventDispatchRequired( 1000000 ) );
+  FRENSIE_CHECK( event_handler.isParticleSubtrackEndingInCellEventDispatchRequired( 1 ) );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 1.0 );
+
+  event_handler.updateObserversFromParticleEnteringCellEvent( photon, 500000 );
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  event_handler.updateObserversFromParticleEnteringCellEvent( photon, 1000000 );
+
+  FRENSIE_CHECK( estimator->hasUncommittedHistoryContribution() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the number of histories can be returned
 FRENSIE_UNIT_TEST( EventHandler, getNumberOfCommittedHistories )
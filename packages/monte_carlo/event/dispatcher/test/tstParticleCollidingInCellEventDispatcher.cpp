@@ -74,6 +74,7 @@ FRENSIE_UNIT_TEST( ParticleCollidingInCellEventDispatcher, manage_observers )
   dispatcher->detachAllObservers();
 
   FRENSIE_CHECK_EQUAL( estimator_1.use_count(), 1 );
+  FRENSIE_CHECK( !dispatcher->hasObservers( MonteCarlo::PHOTON ) );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 0 ).getNumberOfObservers( MonteCarlo::PHOTON ), 0 );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 0 ).getNumberOfObservers( MonteCarlo::ELECTRON ), 0 );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 0 ).getNumberOfObservers( MonteCarlo::POSITRON ), 0 );
@@ -86,6 +87,8 @@ FRENSIE_UNIT_TEST( ParticleCollidingInCellEventDispatcher, manage_observers )
   dispatcher->attachObserver( 0, {MonteCarlo::PHOTON}, estimator_1 );
 
   FRENSIE_CHECK_EQUAL( estimator_1.use_count(), 2 );
+  FRENSIE_CHECK( dispatcher->hasObservers( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !dispatcher->hasObservers( MonteCarlo::NEUTRON ) );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 0 ).getNumberOfObservers( MonteCarlo::PHOTON ), 1 );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 0 ).getNumberOfObservers( MonteCarlo::ELECTRON ), 0 );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 0 ).getNumberOfObservers( MonteCarlo::POSITRON ), 0 );
@@ -318,6 +318,62 @@ FRENSIE_UNIT_TEST( ParticleEnteringCellEventDispatcher,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a particle entering cell event can be dispatched with the
+// compiled dispatch table
+FRENSIE_UNIT_TEST( ParticleEnteringCellEventDispatcher,
+                   dispatchParticleEnteringCellEvent_compiled )
+{
+  std::shared_ptr<MonteCarlo::ParticleEnteringCellEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleEnteringCellEventDispatcher );
+
+  dispatcher->attachObserver( 1, estimator_1->getParticleTypes(), estimator_1 );
+  dispatcher->attachObserver( 1, estimator_2->getParticleTypes(), estimator_2 );
+
+  std::set<uint64_t> entity_ids;
+  dispatcher->getEntityIdsWithObservers( entity_ids );
+
+  FRENSIE_CHECK_EQUAL( entity_ids, std::set<uint64_t>( {1} ) );
+  FRENSIE_CHECK( !dispatcher->isDispatchTableCompiled() );
+
+  dispatcher->compileDispatchTable();
+
+  FRENSIE_CHECK( dispatcher->isDispatchTableCompiled() );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 2.0 );
+
+  dispatcher->dispatchParticleEnteringCellEvent( photon, 0 );
+  dispatcher->dispatchParticleEnteringCellEvent( photon, 2 );
+
+  FRENSIE_CHECK( !estimator_1->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( !estimator_2->hasUncommittedHistoryContribution() );
+
+  dispatcher->dispatchParticleEnteringCellEvent( photon, 1 );
+
+  FRENSIE_CHECK( estimator_1->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( estimator_2->hasUncommittedHistoryContribution() );
+
+  estimator_1->commitHistoryContribution();
+  estimator_2->commitHistoryContribution();
+
+  // Attaching an observer will discard the compiled dispatch table
+  dispatcher->attachObserver( 0, estimator_3->getParticleTypes(), estimator_3 );
+
+  FRENSIE_CHECK( !dispatcher->isDispatchTableCompiled() );
+
+  dispatcher->dispatchParticleEnteringCellEvent( photon, 0 );
+
+  FRENSIE_CHECK( estimator_3->hasUncommittedHistoryContribution() );
+
+  estimator_3->commitHistoryContribution();
+
+  estimator_1->resetData();
+  estimator_2->resetData();
+  estimator_3->resetData();
+}
+
 //---------------------------------------------------------------------------//
 // Check that an event dispatcher can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleEnteringCellEventDispatcher,
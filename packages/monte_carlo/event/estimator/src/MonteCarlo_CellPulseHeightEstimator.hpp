@@ -29,9 +29,9 @@ namespace MonteCarlo{
  * \ingroup particle_entering_cell_event
  * \ingroup particle_leaving_cell_event
  * \details This class has been set up to get correct results with multiple
- * threads. However, the commitHistoryContribution member function call
- * should only appear within an omp critical block. Use the enable thread
- * support member function to set up an instance of this class for the
+ * threads. The commitHistoryContribution member function can be called
+ * concurrently since the moments are updated atomically. Use the enable
+ * thread support member function to set up an instance of this class for the
  * requested number of threads. The classes default initialization is for
  * a single thread.
  */
@@ -6,6 +6,12 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
+// Boost Includes
+#include <boost/functional/hash.hpp>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -16,6 +22,9 @@
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const size_t EntityEstimator::s_max_reduction_buffer_size = 1048576;
+
 // Default constructor
 EntityEstimator::EntityEstimator()
 { /* ... */ }
@@ -26,14 +35,16 @@ EntityEstimator::EntityEstimator( const Id id,
   : Estimator( id, multiplier ),
     d_total_norm_constant( 1.0 ),
     d_supplied_norm_constants( false ),
+    d_entity_ids(),
+    d_entity_indices(),
     d_estimator_total_bin_data( 1 ),
-    d_entity_estimator_moments_map(),
+    d_entity_estimator_bin_data(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
-    d_entity_estimator_moments_snapshots_map(),
+    d_entity_estimator_bin_data_snapshots(),
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
-    d_entity_estimator_histograms_map(),
+    d_entity_estimator_bin_histograms(),
     d_entity_norm_constants_map()
 { /* ... */ }
 
@@ -109,12 +120,13 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataFirstMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const FourEstimatorMomentsCollection& entity_collection =
-    d_entity_estimator_moments_map.find( entity_id )->second;
+  const size_t entity_collection_size =
+    this->getNumberOfBins()*this->getNumberOfResponseFunctions();
 
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<1>( entity_collection ),
-                             entity_collection.size() );
+               Utility::getCurrentScores<1>( d_entity_estimator_bin_data ) +
+               this->getEntityIndex( entity_id )*entity_collection_size,
+               entity_collection_size );
 }
   
 // Get the bin data second moments for an entity
@@ -126,12 +138,13 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataSecondMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const FourEstimatorMomentsCollection& entity_collection =
-    d_entity_estimator_moments_map.find( entity_id )->second;
+  const size_t entity_collection_size =
+    this->getNumberOfBins()*this->getNumberOfResponseFunctions();
 
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<2>( entity_collection ),
-                             entity_collection.size() );
+               Utility::getCurrentScores<2>( d_entity_estimator_bin_data ) +
+               this->getEntityIndex( entity_id )*entity_collection_size,
+               entity_collection_size );
 }
 
 // Get the bin data third moments for an entity
@@ -143,12 +156,13 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataThirdMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const FourEstimatorMomentsCollection& entity_collection =
-    d_entity_estimator_moments_map.find( entity_id )->second;
+  const size_t entity_collection_size =
+    this->getNumberOfBins()*this->getNumberOfResponseFunctions();
 
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<3>( entity_collection ),
-                             entity_collection.size() );
+               Utility::getCurrentScores<3>( d_entity_estimator_bin_data ) +
+               this->getEntityIndex( entity_id )*entity_collection_size,
+               entity_collection_size );
 }
 
 // Get the bin data fourth moments for an entity
@@ -160,12 +174,13 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataFourthMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const FourEstimatorMomentsCollection& entity_collection =
-    d_entity_estimator_moments_map.find( entity_id )->second;
+  const size_t entity_collection_size =
+    this->getNumberOfBins()*this->getNumberOfResponseFunctions();
 
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<4>( entity_collection ),
-                             entity_collection.size() );
+               Utility::getCurrentScores<4>( d_entity_estimator_bin_data ) +
+               this->getEntityIndex( entity_id )*entity_collection_size,
+               entity_collection_size );
 }
 
 // Enable snapshots on entity bins
@@ -173,7 +188,7 @@ void EntityEstimator::enableSnapshotsOnEntityBins()
 {
   d_entity_bin_snapshots_enabled = true;
 
-  this->initializeEntityEstimatorSnapshotsMap();
+  this->resizeEntityEstimatorSnapshots();
   this->resizeEstimatorTotalSnapshots();
 }
 
@@ -192,16 +207,19 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
   
   if( d_entity_bin_snapshots_enabled )
   {
-    d_estimator_total_bin_data_snapshots.takeSnapshot( num_histories_since_last_snapshot,
-                                                       time_since_last_snapshot,
-                                                       d_estimator_total_bin_data );
-
-    for( auto&& entity_data : d_entity_estimator_moments_snapshots_map )
-    {
-      entity_data.second.takeSnapshot( num_histories_since_last_snapshot,
-                                       time_since_last_snapshot,
-                                       d_entity_estimator_moments_map[entity_data.first] );
-    }
+    this->takeCollectionSnapshot( num_histories_since_last_snapshot,
+                                  time_since_last_snapshot,
+                                  d_estimator_total_bin_data,
+                                  TOTAL_BIN_SNAPSHOT_COLLECTION,
+                                  0,
+                                  d_estimator_total_bin_data_snapshots );
+
+    this->takeCollectionSnapshot( num_histories_since_last_snapshot,
+                                  time_since_last_snapshot,
+                                  d_entity_estimator_bin_data,
+                                  ENTITY_BIN_SNAPSHOT_COLLECTION,
+                                  0,
+                                  d_entity_estimator_bin_data_snapshots );
   }
 }
 
@@ -218,11 +236,11 @@ void EntityEstimator::getEntityBinMomentSnapshotHistoryValues(
   
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<uint64_t>& raw_history_values = 
-      d_entity_estimator_moments_snapshots_map.find( entity_id )->second.getSnapshotIndices();
-    
-    history_values.assign( raw_history_values.begin(),
-                           raw_history_values.end() );
+    this->getCollectionSnapshotHistoryValues(
+                                         d_entity_estimator_bin_data_snapshots,
+                                         ENTITY_BIN_SNAPSHOT_COLLECTION,
+                                         0,
+                                         history_values );
   }
 }
 
@@ -239,11 +257,11 @@ void EntityEstimator::getEntityBinMomentSnapshotSamplingTimes(
   
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& raw_sampling_time_values = 
-      d_entity_estimator_moments_snapshots_map.find( entity_id )->second.getSnapshotSamplingTimes();
-    
-    sampling_times.assign( raw_sampling_time_values.begin(),
-                           raw_sampling_time_values.end() );
+    this->getCollectionSnapshotSamplingTimes(
+                                         d_entity_estimator_bin_data_snapshots,
+                                         ENTITY_BIN_SNAPSHOT_COLLECTION,
+                                         0,
+                                         sampling_times );
   }
 }
 
@@ -267,12 +285,12 @@ void EntityEstimator::getEntityBinFirstMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<1>(
-            d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
-            bin_index );
-
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<1>(
+                       d_entity_estimator_bin_data_snapshots,
+                       ENTITY_BIN_SNAPSHOT_COLLECTION,
+                       0,
+                       this->getEntityBinIndex( entity_id, bin_index ),
+                       moments );
   }
 }
 
@@ -296,12 +314,12 @@ void EntityEstimator::getEntityBinSecondMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<2>(
-           d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
-           bin_index );
-
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<2>(
+                       d_entity_estimator_bin_data_snapshots,
+                       ENTITY_BIN_SNAPSHOT_COLLECTION,
+                       0,
+                       this->getEntityBinIndex( entity_id, bin_index ),
+                       moments );
   }
 }
 
@@ -325,12 +343,12 @@ void EntityEstimator::getEntityBinThirdMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<3>(
-           d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
-           bin_index );
-
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<3>(
+                       d_entity_estimator_bin_data_snapshots,
+                       ENTITY_BIN_SNAPSHOT_COLLECTION,
+                       0,
+                       this->getEntityBinIndex( entity_id, bin_index ),
+                       moments );
   }
 }
 
@@ -354,12 +372,12 @@ void EntityEstimator::getEntityBinFourthMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<4>(
-           d_entity_estimator_moments_snapshots_map.find( entity_id )->second,
-           bin_index );
-    
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<4>(
+                       d_entity_estimator_bin_data_snapshots,
+                       ENTITY_BIN_SNAPSHOT_COLLECTION,
+                       0,
+                       this->getEntityBinIndex( entity_id, bin_index ),
+                       moments );
   }
 }
 
@@ -369,11 +387,11 @@ void EntityEstimator::getTotalBinMomentSnapshotHistoryValues(
 {
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<uint64_t>& raw_history_values = 
-      d_estimator_total_bin_data_snapshots.getSnapshotIndices();
-    
-    history_values.assign( raw_history_values.begin(),
-                           raw_history_values.end() );
+    this->getCollectionSnapshotHistoryValues(
+                                          d_estimator_total_bin_data_snapshots,
+                                          TOTAL_BIN_SNAPSHOT_COLLECTION,
+                                          0,
+                                          history_values );
   }
 }
 
@@ -383,11 +401,11 @@ void EntityEstimator::getTotalBinMomentSnapshotSamplingTimes(
 {
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& raw_sampling_time_values = 
-      d_estimator_total_bin_data_snapshots.getSnapshotSamplingTimes();
-    
-    sampling_times.assign( raw_sampling_time_values.begin(),
-                           raw_sampling_time_values.end() );
+    this->getCollectionSnapshotSamplingTimes(
+                                          d_estimator_total_bin_data_snapshots,
+                                          TOTAL_BIN_SNAPSHOT_COLLECTION,
+                                          0,
+                                          sampling_times );
   }
 }
 
@@ -404,11 +422,12 @@ void EntityEstimator::getTotalBinFirstMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<1>( d_estimator_total_bin_data_snapshots,
-                                     bin_index );
-    
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<1>(
+                                          d_estimator_total_bin_data_snapshots,
+                                          TOTAL_BIN_SNAPSHOT_COLLECTION,
+                                          0,
+                                          bin_index,
+                                          moments );
   }
 }
 
@@ -425,11 +444,12 @@ void EntityEstimator::getTotalBinSecondMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<2>( d_estimator_total_bin_data_snapshots,
-                                     bin_index );
-    
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<2>(
+                                          d_estimator_total_bin_data_snapshots,
+                                          TOTAL_BIN_SNAPSHOT_COLLECTION,
+                                          0,
+                                          bin_index,
+                                          moments );
   }
 }
 
@@ -446,11 +466,12 @@ void EntityEstimator::getTotalBinThirdMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<3>( d_estimator_total_bin_data_snapshots,
-                                     bin_index );
-    
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<3>(
+                                          d_estimator_total_bin_data_snapshots,
+                                          TOTAL_BIN_SNAPSHOT_COLLECTION,
+                                          0,
+                                          bin_index,
+                                          moments );
   }
 }
 
@@ -467,11 +488,12 @@ void EntityEstimator::getTotalBinFourthMomentSnapshots(
 
   if( d_entity_bin_snapshots_enabled )
   {
-    const std::list<double>& moment_snapshots =
-      Utility::getScoreSnapshots<4>( d_estimator_total_bin_data_snapshots,
-                                     bin_index );
-
-    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+    this->getCollectionMomentSnapshots<4>(
+                                          d_estimator_total_bin_data_snapshots,
+                                          TOTAL_BIN_SNAPSHOT_COLLECTION,
+                                          0,
+                                          bin_index,
+                                          moments );
   }
 }
 
@@ -480,7 +502,7 @@ void EntityEstimator::enableSampleMomentHistogramsOnEntityBins()
 {
   d_entity_bin_histograms_enabled = true;
 
-  this->initializeEntityEstimatorHistogramsMap();
+  this->resizeEntityEstimatorHistograms();
   this->resizeEstimatorTotalHistograms();
 }
 
@@ -510,7 +532,7 @@ void EntityEstimator::getEntityBinSampleMomentHistogram(
 
   if( d_entity_bin_histograms_enabled )
   {
-    histogram = d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
+    histogram = d_entity_estimator_bin_histograms[this->getEntityBinIndex( entity_id, bin_index )];
   }
 }
 
@@ -536,8 +558,7 @@ void EntityEstimator::resetData()
   d_estimator_total_bin_data.reset();
 
   // Reset the entity bin data
-  for( auto&& entity_data : d_entity_estimator_moments_map )
-    entity_data.second.reset();
+  d_entity_estimator_bin_data.reset();
 
   if( d_entity_bin_snapshots_enabled )
   {
@@ -545,8 +566,7 @@ void EntityEstimator::resetData()
     d_estimator_total_bin_data_snapshots.reset();
 
     // Reset the entity bin snapshot data
-    for( auto&& entity_data : d_entity_estimator_moments_snapshots_map )
-      entity_data.second.reset();
+    d_entity_estimator_bin_data_snapshots.reset();
   }
 
   if( d_entity_bin_histograms_enabled )
@@ -556,11 +576,8 @@ void EntityEstimator::resetData()
       histogram.reset();
 
     // Reset the entity histogram data
-    for( auto&& entity_data : d_entity_estimator_histograms_map )
-    {
-      for( auto&& histogram : entity_data.second )
-        histogram.reset();
-    }
+    for( auto&& histogram : d_entity_estimator_bin_histograms )
+      histogram.reset();
   }
 }
 
@@ -576,7 +593,7 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   {
     // Reduce the entity bin data
     try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_estimator_moments_map );
+      this->reduceEntityCollection( comm, root_process, d_entity_estimator_bin_data );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in entity bin "
@@ -598,7 +615,11 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
     {
       // Reduce the entity bin snapshot data
       try{
-        this->reduceEntitySnapshotMaps( comm, root_process, d_entity_estimator_moments_snapshots_map );
+        this->reduceSnapshots( comm,
+                               root_process,
+                               ENTITY_BIN_SNAPSHOT_COLLECTION,
+                               0,
+                               d_entity_estimator_bin_data_snapshots );
       }
       EXCEPTION_CATCH_RETHROW( std::runtime_error,
                                "Unable to perform mpi reduction in entity "
@@ -607,7 +628,11 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
 
       // Reduce the total bin snapshot data
       try{
-        this->reduceSnapshots( comm, root_process, d_estimator_total_bin_data_snapshots );
+        this->reduceSnapshots( comm,
+                               root_process,
+                               TOTAL_BIN_SNAPSHOT_COLLECTION,
+                               0,
+                               d_estimator_total_bin_data_snapshots );
       }
       EXCEPTION_CATCH_RETHROW( std::runtime_error,
                                "Unable to perform mpi reduction in entity "
@@ -619,7 +644,7 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
     {
       // Reduce the entity bin histogram data
       try{
-        this->reduceEntityHistogramMaps( comm, root_process, d_entity_estimator_histograms_map );
+        this->reduceHistogramArrays( comm, root_process, d_entity_estimator_bin_histograms );
       }
       EXCEPTION_CATCH_RETHROW( std::runtime_error,
                                "Unable to perform mpi reduction in entity "
@@ -640,266 +665,144 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   Estimator::reduceData( comm, root_process );
 }
 
-// Reduce the entity collection maps
-void EntityEstimator::reduceEntityCollectionMaps(
-                    const Utility::Communicator& comm,
-                    const int root_process,
-                    EntityEstimatorMomentsCollectionMap& collection_map ) const
+// Reduce a collection that stores the data of every entity
+/*! \details The moments of the collection are summed on the root process
+ * with a reduce operation, which allows the MPI implementation to use a
+ * tree-based reduction. The moments are reduced in chunks to bound the memory
+ * required on each process.
+ */
+void EntityEstimator::reduceEntityCollection(
+                           const Utility::Communicator& comm,
+                           const int root_process,
+                           FourEstimatorMomentsCollection& collection ) const
 {
-  // Gather all of the entity data on the root process
-  if( comm.rank() == root_process )
-  {
-    std::vector<EntityEstimatorMomentsCollectionMap>
-      gathered_entity_data( comm.size() );
+  // Make sure that the collection layout is the same on every process
+  this->checkReductionDataLayout( comm, collection.size(), 1, "entity moments" );
 
-    std::vector<Utility::Communicator::Request> gathered_requests;
+  // The first, second, third and fourth moments are reduced consecutively
+  std::vector<Utility::ArrayView<double> > moment_arrays( 4 );
 
-    for( size_t i = 0; i < comm.size(); ++i )
-    {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
+  moment_arrays[0] = Utility::ArrayView<double>( Utility::getCurrentScores<1>( collection ), collection.size() );
+  moment_arrays[1] = Utility::ArrayView<double>( Utility::getCurrentScores<2>( collection ), collection.size() );
+  moment_arrays[2] = Utility::ArrayView<double>( Utility::getCurrentScores<3>( collection ), collection.size() );
+  moment_arrays[3] = Utility::ArrayView<double>( Utility::getCurrentScores<4>( collection ), collection.size() );
 
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
-    
-    Utility::wait( gathered_requests, gathered_statuses );
-    
-    this->reduceEntityCollections( gathered_entity_data,
-                                   root_process,
-                                   collection_map );
+  try{
+    this->reduceArrays( comm, root_process, moment_arrays );
   }
-  else
-    Utility::send( comm, root_process, 0, collection_map );
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction over entity "
+                           "moments for estimator " << this->getId() << "!" );
 }
 
-// Reduce the entity moments
-void EntityEstimator::reduceEntityCollections(
-                    const std::vector<EntityEstimatorMomentsCollectionMap>&
-                    other_entity_estimator_moments_maps,
-                    const size_t root_index,
-                    EntityEstimatorMomentsCollectionMap& collection_map ) const
+// Reduce the histogram arrays
+/*! \details The histogram values and the number of scores of every
+ * histogram are packed into flat arrays and summed on the root process with
+ * the same chunked reduce operations that are used for the moments. Every
+ * histogram in the array must have the same bin boundaries, which are set by
+ * the estimator.
+ */
+void EntityEstimator::reduceHistogramArrays(
+                            const Utility::Communicator& comm,
+                            const int root_process,
+                            SampleMomentHistogramArray& histogram_array )
 {
-  // Reduce the data that was on each process
-  for( auto&& entity_data : collection_map )
-  {
-    // Don't double count data on this process (j starts from 1)
-    for( size_t j = 0; j < other_entity_estimator_moments_maps.size(); ++j )
-    {
-      if( j != root_index )
-      {
-        const EntityEstimatorMomentsCollectionMap::value_type&
-          other_entity_data = *other_entity_estimator_moments_maps[j].find( entity_data.first );
+  const size_t histogram_size =
+    histogram_array.empty() ? 0 : histogram_array.front().size();
 
-        for( size_t i = 0; i < entity_data.second.size(); ++i )
-        {
-          Utility::getCurrentScore<1>( entity_data.second, i ) +=
-            Utility::getCurrentScore<1>( other_entity_data.second, i );
+  // Make sure that the histogram layout is the same on every process
+  this->checkReductionDataLayout( comm,
+                                  histogram_array.size(),
+                                  histogram_size,
+                                  "histograms" );
 
-          Utility::getCurrentScore<2>( entity_data.second, i ) +=
-            Utility::getCurrentScore<2>( other_entity_data.second, i );
+  // Pack the histograms
+  std::vector<double> histogram_values( histogram_array.size()*histogram_size );
+  std::vector<uint64_t> histogram_number_of_scores( histogram_array.size() );
 
-          Utility::getCurrentScore<3>( entity_data.second, i ) +=
-            Utility::getCurrentScore<3>( other_entity_data.second, i );
-
-          Utility::getCurrentScore<4>( entity_data.second, i ) +=
-            Utility::getCurrentScore<4>( other_entity_data.second, i );
-        }
-      }
-    }
-  }
-}
-
-// Reduce the entity snapshot maps
-void EntityEstimator::reduceEntitySnapshotMaps(
-            const Utility::Communicator& comm,
-            const int root_process,
-            EntityEstimatorMomentsCollectionSnapshotsMap& snapshots_map ) const
-{
-  // Gather all of the entity data on the root process
-  if( comm.rank() == root_process )
+  for( size_t i = 0; i < histogram_array.size(); ++i )
   {
-    std::vector<EntityEstimatorMomentsCollectionSnapshotsMap>
-      gathered_entity_data( comm.size() );
-
-    std::vector<Utility::Communicator::Request> gathered_requests;
-
-    for( size_t i = 0; i < comm.size(); ++i )
-    {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
+    // Make sure that the histograms have the same number of bins
+    testInvariant( histogram_array[i].size() == histogram_size );
 
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
+    const std::vector<double>& local_histogram_values =
+      histogram_array[i].getHistogramValues();
 
-    Utility::wait( gathered_requests, gathered_statuses );
+    std::copy( local_histogram_values.begin(),
+               local_histogram_values.end(),
+               histogram_values.begin() + i*histogram_size );
 
-    this->reduceEntitySnapshots( gathered_entity_data,
-                                 root_process,
-                                 snapshots_map );
+    histogram_number_of_scores[i] = histogram_array[i].getNumberOfScores();
   }
-  else
-    Utility::send( comm, root_process, 0, snapshots_map );
-}
 
-// Reduce the entity snapshots
-void EntityEstimator::reduceEntitySnapshots(
-            const std::vector<EntityEstimatorMomentsCollectionSnapshotsMap>&
-            other_entity_estimator_snapshots_maps,
-            const size_t root_index,
-            EntityEstimatorMomentsCollectionSnapshotsMap& snapshots_map ) const
-{
-  // Reduce the data that was on each process
-  for( auto&& entity_data : snapshots_map )
-  {
-    // Don't double count data on this process (j starts from 1)
-    for( size_t j = 0; j < other_entity_estimator_snapshots_maps.size(); ++j )
-    {
-      if( j != root_index )
-      {
-        const EntityEstimatorMomentsCollectionSnapshotsMap::value_type&
-          other_entity_data = *other_entity_estimator_snapshots_maps[j].find( entity_data.first );
+  try{
+    this->reduceArrays( comm,
+                        root_process,
+                        std::vector<Utility::ArrayView<double> >( 1, Utility::arrayView( histogram_values ) ) );
 
-        entity_data.second.mergeSnapshots( other_entity_data.second );
-      }
-    }
+    this->reduceArrays( comm,
+                        root_process,
+                        std::vector<Utility::ArrayView<uint64_t> >( 1, Utility::arrayView( histogram_number_of_scores ) ) );
   }
-}
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction over histograms "
+                           "for estimator " << this->getId() << "!" );
 
-// Reduce the entity histogram maps
-void EntityEstimator::reduceEntityHistogramMaps(
-            const Utility::Communicator& comm,
-            const int root_process,
-            EntityEstimatorSampleMomentHistogramArrayMap& histogram_map ) const
-{
-  // Gather all of the entity data on the root process
+  // Unpack the histograms (only the root process stores the reduced values)
   if( comm.rank() == root_process )
   {
-    std::vector<EntityEstimatorSampleMomentHistogramArrayMap>
-      gathered_entity_data( comm.size() );
-
-    std::vector<Utility::Communicator::Request> gathered_requests;
-
-    for( size_t i = 0; i < comm.size(); ++i )
+    for( size_t i = 0; i < histogram_array.size(); ++i )
     {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
-
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
-
-    Utility::wait( gathered_requests, gathered_statuses );
-
-    this->reduceEntityHistograms( gathered_entity_data,
-                                  root_process,
-                                  histogram_map );
-  }
-  else
-    Utility::send( comm, root_process, 0, histogram_map );
-}
+      histogram_array[i].reset();
 
-// Reduce the entity histograms
-void EntityEstimator::reduceEntityHistograms(
-            const std::vector<EntityEstimatorSampleMomentHistogramArrayMap>&
-            gathered_entity_data,
-            const size_t root_index,
-            EntityEstimatorSampleMomentHistogramArrayMap& histogram_map ) const
-{
-  // Reduce the data that was on each process
-  for( auto&& entity_data : histogram_map )
-  {
-    for( size_t i = 0; i < entity_data.second.size(); ++i )
-    {
-      Utility::SampleMomentHistogram<double>& histogram =
-        entity_data.second[i];
-      
-      // Don't double count data on this process (j starts from 1)
-      for( size_t j = 0; j < gathered_entity_data.size(); ++j )
-      {
-        if( j != root_index )
-        {
-          const Utility::SampleMomentHistogram<double>& other_histogram = 
-            gathered_entity_data[j].find( entity_data.first )->second[i];
-
-          histogram.mergeHistograms( other_histogram );
-        }
-      }
+      histogram_array[i].mergeHistogramValues(
+              Utility::ArrayView<const double>( histogram_values.data() +
+                                                i*histogram_size,
+                                                histogram_size ),
+              histogram_number_of_scores[i] );
     }
   }
 }
 
-// Reduce the histogram arrays
-void EntityEstimator::reduceHistogramArrays(
-                            const Utility::Communicator& comm,
-                            const int root_process,
-                            SampleMomentHistogramArray& histogram_array ) const
+// Check that the layout of the reduced data is the same on every process
+/*! \details A hash of the entity ids (in index order), the number of entries
+ * and the size of each entry is compared on every process. Data with the
+ * same total size but a different entity layout (e.g. a different entity
+ * ordering or a different number of bins per entity) will be detected.
+ */
+void EntityEstimator::checkReductionDataLayout(
+                                      const Utility::Communicator& comm,
+                                      const size_t number_of_entries,
+                                      const size_t entry_size,
+                                      const std::string& data_name ) const
 {
-  // Gather all of the entity data on the root process
-  if( comm.rank() == root_process )
-  {
-    std::vector<SampleMomentHistogramArray>
-      gathered_entity_data( comm.size() );
+  size_t layout_hash = 0;
 
-    std::vector<Utility::Communicator::Request> gathered_requests;
+  boost::hash_combine( layout_hash, d_entity_ids.size() );
 
-    for( size_t i = 0; i < comm.size(); ++i )
-    {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
+  for( size_t i = 0; i < d_entity_ids.size(); ++i )
+    boost::hash_combine( layout_hash, d_entity_ids[i] );
 
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
+  boost::hash_combine( layout_hash, number_of_entries );
+  boost::hash_combine( layout_hash, entry_size );
 
-    Utility::wait( gathered_requests, gathered_statuses );
+  uint64_t min_layout_hash, max_layout_hash;
 
-    this->reduceEntityHistograms( gathered_entity_data,
-                                  root_process,
-                                  histogram_array );
-  }
-  else
-    Utility::send( comm, root_process, 0, histogram_array );
-}
+  Utility::allReduce( comm,
+                      (uint64_t)layout_hash,
+                      min_layout_hash,
+                      Utility::minimum<uint64_t>() );
 
-// Reduce the entity histograms
-void EntityEstimator::reduceEntityHistograms(
-                            const std::vector<SampleMomentHistogramArray>&
-                            gathered_entity_data,
-                            const size_t root_index,
-                            SampleMomentHistogramArray& histogram_array ) const
-{
-  // Reduce the data that was on each process
-  for( size_t i = 0; i < histogram_array.size(); ++i )
-  {
-    Utility::SampleMomentHistogram<double>& histogram =
-      histogram_array[i];
-      
-    // Don't double count data on this process (j starts from 1)
-    for( size_t j = 0; j < gathered_entity_data.size(); ++j )
-    {
-      if( j != root_index )
-      {
-        const Utility::SampleMomentHistogram<double>& other_histogram =
-          gathered_entity_data[j][i];
-        
-        histogram.mergeHistograms( other_histogram );
-      }
-    }
-  }
+  Utility::allReduce( comm,
+                      (uint64_t)layout_hash,
+                      max_layout_hash,
+                      Utility::maximum<uint64_t>() );
+
+  TEST_FOR_EXCEPTION( min_layout_hash != max_layout_hash,
+                      std::runtime_error,
+                      "The " << data_name << " of estimator "
+                      << this->getId() << " do not have the same layout on "
+                      "every process!" );
 }
 
 // Assign entities
@@ -913,32 +816,23 @@ void EntityEstimator::assignEntities(
   d_total_norm_constant = 1.0;
   d_supplied_norm_constants = true;
   d_estimator_total_bin_data.clear();
-  d_entity_estimator_moments_map.clear();
+  d_entity_estimator_bin_data.clear();
   d_estimator_total_bin_data_snapshots.clear();
-  d_entity_estimator_moments_snapshots_map.clear();
+  d_entity_estimator_bin_data_snapshots.clear();
   d_estimator_total_bin_histograms.clear();
-  d_entity_estimator_histograms_map.clear();
+  d_entity_estimator_bin_histograms.clear();
   d_entity_norm_constants_map = entity_norm_data;
 
-  // Initialize the entity data
-  for( auto&& entity_data : entity_norm_data )
-  {
-    d_entity_estimator_moments_map[entity_data.first];
-
-    if( d_entity_bin_snapshots_enabled )
-      d_entity_estimator_moments_snapshots_map[entity_data.first];
-
-    if( d_entity_bin_histograms_enabled )
-      d_entity_estimator_histograms_map[entity_data.first];
-  }
+  // Initialize the entity indices
+  this->initializeEntityIndices();
 
   // Calculate the total normalization constant
   this->calculateTotalNormalizationConstant();
 
   // Resize the data
-  this->resizeEntityEstimatorMapCollections();
-  this->resizeEntityEstimatorMapSnapshots();
-  this->resizeEntityEstimatorMapHistograms();
+  this->resizeEntityEstimatorCollection();
+  this->resizeEntityEstimatorSnapshots();
+  this->resizeEntityEstimatorHistograms();
 
   // Resize the total data (it was likely not initialized in the constructor
   // if assignEntities was called)
@@ -957,20 +851,20 @@ void EntityEstimator::assignDiscretization(
 
   Estimator::assignDiscretization( bins, range_dimension );
 
-  // Resize the entity estimator moments map collections
-  this->resizeEntityEstimatorMapCollections();
+  // Resize the entity estimator collection
+  this->resizeEntityEstimatorCollection();
 
   // Resize the total array
   this->resizeEstimatorTotalCollection();
 
-  // Resize the entity estimator moments map snapshots
-  this->resizeEntityEstimatorMapSnapshots();
+  // Resize the entity estimator snapshots
+  this->resizeEntityEstimatorSnapshots();
 
   // Resize the estimator total snapshots
   this->resizeEstimatorTotalSnapshots();
 
   // Resize the entity estimator histograms
-  this->resizeEntityEstimatorMapHistograms();
+  this->resizeEntityEstimatorHistograms();
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
@@ -982,20 +876,20 @@ void EntityEstimator::assignResponseFunction(
 {
   Estimator::assignResponseFunction( response_function );
 
-  // Resize the entity estimator moment map collections
-  this->resizeEntityEstimatorMapCollections();
+  // Resize the entity estimator collection
+  this->resizeEntityEstimatorCollection();
 
   // Resize the total collection
   this->resizeEstimatorTotalCollection();
 
-  // Resize the entity estimator moments map snapshots
-  this->resizeEntityEstimatorMapSnapshots();
+  // Resize the entity estimator snapshots
+  this->resizeEntityEstimatorSnapshots();
 
   // Resize the estimator total snapshots
   this->resizeEstimatorTotalSnapshots();
 
   // Resize the entity estimator histograms
-  this->resizeEntityEstimatorMapHistograms();
+  this->resizeEntityEstimatorHistograms();
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
@@ -1006,16 +900,13 @@ void EntityEstimator::assignSampleMomentHistogramBins( const std::shared_ptr<con
 {
   Estimator::assignSampleMomentHistogramBins( bins );
 
-  if( d_entity_bin_histograms_enabled );
+  if( d_entity_bin_histograms_enabled )
   {
     for( auto&& histogram : d_estimator_total_bin_histograms )
       histogram.setBinBoundaries( bins );
 
-    for( auto&& entity_data : d_entity_estimator_histograms_map )
-    {
-      for( auto&& histogram : entity_data.second )
-        histogram.setBinBoundaries( bins );
-    }
+    for( auto&& histogram : d_entity_estimator_bin_histograms )
+      histogram.setBinBoundaries( bins );
   }
 }
 
@@ -1032,43 +923,31 @@ void EntityEstimator::commitHistoryContributionToBinOfEntity(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  FourEstimatorMomentsCollection& entity_estimator_moments =
-    d_entity_estimator_moments_map.find( entity_id )->second;
-
-  // Update the moments
-  #pragma omp critical
-  {
-    entity_estimator_moments.addRawScore( bin_index, contribution );
-  }
-
-  this->addHistoryContributionToEntityBinHistogram( entity_id,
-                                                    bin_index,
-                                                    contribution );
+  this->commitHistoryContributionToEntityBin(
+                         this->getEntityBinIndex( entity_id, bin_index ),
+                         contribution );
 }
 
-// Add contribution to histogram
-void EntityEstimator::addHistoryContributionToEntityBinHistogram(
-                                                    const EntityId entity_id,
-                                                    const size_t bin_index,
-                                                    const double contribution )
+// Commit history contribution to an entity bin (entity_index*bins+bin)
+/*! \details Callers that already know the entity index should use this
+ * method since it does not need to look up the entity.
+ */
+void EntityEstimator::commitHistoryContributionToEntityBin(
+                                                const size_t entity_bin_index,
+                                                const double contribution )
 {
-  // Make sure the entity is assigned to this estimator
-  testPrecondition( this->isEntityAssigned( entity_id ) );
-  // Make sure the bin index is valid
-  testPrecondition( bin_index <
-		    this->getNumberOfBins()*
-                    this->getNumberOfResponseFunctions() );
+  // Make sure the entity bin index is valid
+  testPrecondition( entity_bin_index < d_entity_estimator_bin_data.size() );
+
+  // Update the moments (atomically)
+  d_entity_estimator_bin_data.addRawScoreAtomic( entity_bin_index,
+                                                 contribution );
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
-
-    // Update the histogram
-    #pragma omp critical
-    {
-      histogram.addRawScore( contribution );
-    }
+    // Update the histogram (atomically)
+    d_entity_estimator_bin_histograms[entity_bin_index].addRawScoreAtomic(
+                                                                contribution );
   }
 }
 
@@ -1082,34 +961,14 @@ void EntityEstimator::commitHistoryContributionToBinOfTotal(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  // Update the moments
-  #pragma omp critical
-  {
-    d_estimator_total_bin_data.addRawScore( bin_index, contribution );
-  }
-
-  this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
-}
-
-// Add contribution to total bin histogram
-void EntityEstimator::addHistoryContributionToTotalBinHistogram(
-                                                    const size_t bin_index,
-                                                    const double contribution )
-{
-  // Make sure the bin index is valid
-  testPrecondition( bin_index <
-		    this->getNumberOfBins()*
-                    this->getNumberOfResponseFunctions() );
+  // Update the moments (atomically)
+  d_estimator_total_bin_data.addRawScoreAtomic( bin_index, contribution );
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_estimator_total_bin_histograms[bin_index];
-
-    #pragma omp critical
-    {
-      histogram.addRawScore( contribution );
-    }
+    // Update the histogram (atomically)
+    d_estimator_total_bin_histograms[bin_index].addRawScoreAtomic(
+                                                                contribution );
   }
 }
 
@@ -1205,77 +1064,64 @@ EntityEstimator::getTotalBinData() const
   return d_estimator_total_bin_data;
 }
 
-// Get the bin data for an entity
-/*! \details This function breaks encapsulation and is therefore not ideal.
- * It is needed by mesh estimators for exporting data in .h5m and .vtk formats.
- */
-const Estimator::FourEstimatorMomentsCollection&
-EntityEstimator::getEntityBinData( const EntityId entity_id ) const
+// Return the number of entities assigned to the estimator
+size_t EntityEstimator::getNumberOfEntities() const
 {
-  // Make sure the entity is valid
-  testPrecondition( d_entity_estimator_moments_map.find( entity_id ) !=
-		    d_entity_estimator_moments_map.end() );
-
-  return d_entity_estimator_moments_map.find( entity_id )->second;
+  return d_entity_ids.size();
 }
 
-// Calculate the total normalization constant
-void EntityEstimator::calculateTotalNormalizationConstant()
+// Return the index of an entity (entities are indexed in id order)
+size_t EntityEstimator::getEntityIndex( const EntityId entity_id ) const
 {
-  d_total_norm_constant = 0.0;
+  // Make sure the entity is assigned to this estimator
+  testPrecondition( this->isEntityAssigned( entity_id ) );
 
-  for( auto&& entity_data : d_entity_norm_constants_map )
-    d_total_norm_constant += entity_data.second;
+  return d_entity_indices.find( entity_id )->second;
 }
 
-// Initialize entity estimator snapshots map
-void EntityEstimator::initializeEntityEstimatorSnapshotsMap()
+// Return the entity bin index of an entity bin
+size_t EntityEstimator::getEntityBinIndex( const EntityId entity_id,
+                                           const size_t bin_index ) const
 {
-  if( d_entity_bin_snapshots_enabled )
-  {
-    if( d_entity_estimator_moments_snapshots_map.size() !=
-        d_entity_norm_constants_map.size() )
-    {
-      size_t size = this->getNumberOfBins()*
-        this->getNumberOfResponseFunctions();
-      
-      for( auto&& entity_data : d_entity_norm_constants_map )
-      {
-        d_entity_estimator_moments_snapshots_map[entity_data.first].resize( size );
-      }
-    }
-  }
+  return this->getEntityIndex( entity_id )*this->getNumberOfBins()*
+    this->getNumberOfResponseFunctions() + bin_index;
 }
 
-// Initialize entity entity estimator histograms map
-void EntityEstimator::initializeEntityEstimatorHistogramsMap()
+// Initialize the entity indices
+/*! \details The entities are indexed in id order so that the entity data
+ * has the same layout on every process.
+ */
+void EntityEstimator::initializeEntityIndices()
 {
-  if( d_entity_bin_histograms_enabled )
-  {
-    if( d_entity_estimator_histograms_map.size() !=
-        d_entity_norm_constants_map.size() )
-    {
-      size_t size = this->getNumberOfBins()*
-        this->getNumberOfResponseFunctions();
-      
-      Utility::SampleMomentHistogram<double>
-        default_histogram( this->getSampleMomentHistogramBins() );
+  d_entity_ids.clear();
+  d_entity_ids.reserve( d_entity_norm_constants_map.size() );
 
-      for( auto&& entity_data : d_entity_norm_constants_map )
-      {
-        d_entity_estimator_histograms_map[entity_data.first].resize( size, default_histogram );
-      }
-    }
-  }
+  for( auto&& entity_data : d_entity_norm_constants_map )
+    d_entity_ids.push_back( entity_data.first );
+
+  std::sort( d_entity_ids.begin(), d_entity_ids.end() );
+
+  d_entity_indices.clear();
+
+  for( size_t i = 0; i < d_entity_ids.size(); ++i )
+    d_entity_indices[d_entity_ids[i]] = i;
 }
 
-// Resize the entity estimator moments map collections
-void EntityEstimator::resizeEntityEstimatorMapCollections()
+// Calculate the total normalization constant
+void EntityEstimator::calculateTotalNormalizationConstant()
 {
-  size_t size = this->getNumberOfBins()*this->getNumberOfResponseFunctions();
-  
-  for( auto&& entity_data : d_entity_estimator_moments_map )
-    entity_data.second.resize( size );
+  d_total_norm_constant = 0.0;
+
+  for( auto&& entity_data : d_entity_norm_constants_map )
+    d_total_norm_constant += entity_data.second;
+}
+
+// Resize the entity estimator collection
+void EntityEstimator::resizeEntityEstimatorCollection()
+{
+  d_entity_estimator_bin_data.resize( d_entity_ids.size()*
+                                      this->getNumberOfBins()*
+                                      this->getNumberOfResponseFunctions() );
 }
 
 // Resize the estimator total collection
@@ -1286,15 +1132,14 @@ void EntityEstimator::resizeEstimatorTotalCollection()
 }
 
 // Resize the entity estimator snapshots
-void EntityEstimator::resizeEntityEstimatorMapSnapshots()
+void EntityEstimator::resizeEntityEstimatorSnapshots()
 {
   if( d_entity_bin_snapshots_enabled )
   {
-    size_t size = this->getNumberOfBins()*
-      this->getNumberOfResponseFunctions();
-    
-    for( auto&& entity_data : d_entity_estimator_moments_snapshots_map )
-      entity_data.second.resize( size );
+    d_entity_estimator_bin_data_snapshots.resize(
+                                        d_entity_ids.size()*
+                                        this->getNumberOfBins()*
+                                        this->getNumberOfResponseFunctions() );
   }
 }
 
@@ -1309,18 +1154,18 @@ void EntityEstimator::resizeEstimatorTotalSnapshots()
 }
 
 // Resize the entity estimator histograms
-void EntityEstimator::resizeEntityEstimatorMapHistograms()
+void EntityEstimator::resizeEntityEstimatorHistograms()
 {
   if( d_entity_bin_histograms_enabled )
   {
-    size_t size = this->getNumberOfBins()*
-      this->getNumberOfResponseFunctions();
-
     Utility::SampleMomentHistogram<double>
       default_histogram( this->getSampleMomentHistogramBins() );
 
-    for( auto&& entity_data : d_entity_estimator_histograms_map )
-      entity_data.second.resize( size, default_histogram );
+    d_entity_estimator_bin_histograms.resize(
+                                        d_entity_ids.size()*
+                                        this->getNumberOfBins()*
+                                        this->getNumberOfResponseFunctions(),
+                                        default_histogram );
   }
 }
 
@@ -1338,7 +1183,137 @@ void EntityEstimator::resizeEstimatorTotalHistograms()
   }
 }
 
-EXPLICIT_CLASS_SERIALIZE_INST( EntityEstimator );
+// Pack the entity collections of a map into a single collection
+/*! \details The collection of each entity will be stored at
+ * entity_index*entity_collection_size.
+ */
+void EntityEstimator::packEntityCollectionMap(
+                   const EntityEstimatorMomentsCollectionMap& collection_map,
+                   const size_t entity_collection_size,
+                   FourEstimatorMomentsCollection& collection )
+{
+  collection.clear();
+  collection.resize( d_entity_ids.size()*entity_collection_size );
+
+  for( auto&& entity_data : collection_map )
+  {
+    const size_t offset =
+      this->getEntityIndex( entity_data.first )*entity_collection_size;
+
+    for( size_t i = 0; i < entity_data.second.size(); ++i )
+    {
+      Utility::getCurrentScore<1>( collection, offset+i ) =
+        Utility::getCurrentScore<1>( entity_data.second, i );
+      Utility::getCurrentScore<2>( collection, offset+i ) =
+        Utility::getCurrentScore<2>( entity_data.second, i );
+      Utility::getCurrentScore<3>( collection, offset+i ) =
+        Utility::getCurrentScore<3>( entity_data.second, i );
+      Utility::getCurrentScore<4>( collection, offset+i ) =
+        Utility::getCurrentScore<4>( entity_data.second, i );
+    }
+  }
+}
+
+// Pack the entity snapshots of a map into a single collection snapshots
+/*! \details Every entity snapshot was taken at the same time. Each snapshot
+ * will be packed into a single collection and the packed collections will be
+ * snapshot in order.
+ */
+void EntityEstimator::packEntitySnapshotMap(
+                const EntityEstimatorMomentsCollectionSnapshotsMap& snapshot_map,
+                const size_t entity_collection_size,
+                FourEstimatorMomentsCollectionSnapshots& snapshots )
+{
+  snapshots.clear();
+  snapshots.resize( d_entity_ids.size()*entity_collection_size );
+
+  if( snapshot_map.empty() )
+    return;
+
+  const FourEstimatorMomentsCollectionSnapshots& first_entity_snapshots =
+    snapshot_map.begin()->second;
+
+  const size_t number_of_snapshots =
+    first_entity_snapshots.getNumberOfSnapshots();
+
+  std::vector<FourEstimatorMomentsCollection> snapshot_collections(
+                                   number_of_snapshots,
+                                   FourEstimatorMomentsCollection( snapshots.size() ) );
+
+  for( auto&& entity_data : snapshot_map )
+  {
+    const size_t offset =
+      this->getEntityIndex( entity_data.first )*entity_collection_size;
+
+    for( size_t i = 0; i < entity_data.second.size(); ++i )
+    {
+      auto first_moment_it =
+        Utility::getScoreSnapshots<1>( entity_data.second, i ).begin();
+      auto second_moment_it =
+        Utility::getScoreSnapshots<2>( entity_data.second, i ).begin();
+      auto third_moment_it =
+        Utility::getScoreSnapshots<3>( entity_data.second, i ).begin();
+      auto fourth_moment_it =
+        Utility::getScoreSnapshots<4>( entity_data.second, i ).begin();
+
+      for( size_t k = 0; k < number_of_snapshots; ++k )
+      {
+        Utility::getCurrentScore<1>( snapshot_collections[k], offset+i ) =
+          *first_moment_it++;
+        Utility::getCurrentScore<2>( snapshot_collections[k], offset+i ) =
+          *second_moment_it++;
+        Utility::getCurrentScore<3>( snapshot_collections[k], offset+i ) =
+          *third_moment_it++;
+        Utility::getCurrentScore<4>( snapshot_collections[k], offset+i ) =
+          *fourth_moment_it++;
+      }
+    }
+  }
+
+  // The snapshot indices and times are stored as running totals
+  auto index_it = first_entity_snapshots.getSnapshotIndices().begin();
+  auto time_it = first_entity_snapshots.getSnapshotSamplingTimes().begin();
+
+  uint64_t last_index = 0;
+  double last_time = 0.0;
+
+  for( size_t k = 0; k < number_of_snapshots; ++k )
+  {
+    snapshots.takeSnapshot( *index_it - last_index,
+                            *time_it - last_time,
+                            snapshot_collections[k] );
+
+    last_index = *index_it++;
+    last_time = *time_it++;
+  }
+}
+
+// Pack the entity histograms of a map into a single histogram array
+/*! \details The histograms of each entity will be stored at
+ * entity_index*entity_collection_size.
+ */
+void EntityEstimator::packEntityHistogramMap(
+               const EntityEstimatorSampleMomentHistogramArrayMap& histogram_map,
+               const size_t entity_collection_size,
+               SampleMomentHistogramArray& histogram_array )
+{
+  Utility::SampleMomentHistogram<double>
+    default_histogram( this->getSampleMomentHistogramBins() );
+
+  histogram_array.clear();
+  histogram_array.resize( d_entity_ids.size()*entity_collection_size,
+                          default_histogram );
+
+  for( auto&& entity_data : histogram_map )
+  {
+    std::copy( entity_data.second.begin(),
+               entity_data.second.end(),
+               histogram_array.begin() +
+               this->getEntityIndex( entity_data.first )*entity_collection_size );
+  }
+}
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::EntityEstimator );
 
 } // end MonteCarlo namespace
 
@@ -16,17 +16,24 @@
 
 namespace MonteCarlo{
 
-//! The entity estimator class
+/*! The entity estimator class
+ * \details The moments of every bin of every entity are stored in a single
+ * collection at entity_index*bins+bin, where the entities are indexed in
+ * id order. The snapshots and the sample moment histograms of the entity bins
+ * use the same layout.
+ */
 class EntityEstimator : public Estimator
 {
 
 protected:
 
   //! Typedef for the map of entity ids and extended estimator moments array
+  //! (version 0 archives)
   typedef std::unordered_map<EntityId,Estimator::FourEstimatorMomentsCollection>
   EntityEstimatorMomentsCollectionMap;
 
   //! Typedef for the map of entity ids and the estimator moments snapshots
+  //! (version 0 archives)
   typedef std::unordered_map<EntityId,Estimator::FourEstimatorMomentsCollectionSnapshots>
   EntityEstimatorMomentsCollectionSnapshotsMap;
 
@@ -34,6 +41,7 @@ protected:
   typedef std::vector<Utility::SampleMomentHistogram<double> > SampleMomentHistogramArray;
 
   //! Typedef for the map of entity ids and the sample moment histogram array
+  //! (version 0 archives)
   typedef std::unordered_map<EntityId,SampleMomentHistogramArray>
   EntityEstimatorSampleMomentHistogramArrayMap;
 
@@ -213,11 +221,21 @@ protected:
   //! Assign the history score pdf bins
   void assignSampleMomentHistogramBins( const std::shared_ptr<const std::vector<double> >& bins ) override;
 
+  //! Return the number of entities assigned to the estimator
+  size_t getNumberOfEntities() const;
+
+  //! Return the index of an entity (entities are indexed in id order)
+  size_t getEntityIndex( const EntityId entity_id ) const;
+
   //! Commit history contribution to a bin of an entity
   void commitHistoryContributionToBinOfEntity( const EntityId entity_id,
 					       const size_t bin_index,
 					       const double contribution );
 
+  //! Commit history contribution to an entity bin (entity_index*bins+bin)
+  void commitHistoryContributionToEntityBin( const size_t entity_bin_index,
+                                             const double contribution );
+
   //! Commit history contribution to a bin of total
   void commitHistoryContributionToBinOfTotal( const size_t bin_index,
 					      const double contribution );
@@ -229,46 +247,42 @@ protected:
   //! Get the total estimator bin data
   const Estimator::FourEstimatorMomentsCollection& getTotalBinData() const;
 
-  //! Get the bin data for an entity
-  const Estimator::FourEstimatorMomentsCollection& getEntityBinData( const EntityId entity_id ) const;
-
-  //! Reduce the entity collection maps
-  void reduceEntityCollectionMaps(
-                   const Utility::Communicator& comm,
-                   const int root_process,
-                   EntityEstimatorMomentsCollectionMap& collection_map ) const;
-
-  //! Reduce the entity snapshot maps
-  void reduceEntitySnapshotMaps(
-            const Utility::Communicator& comm,
-            const int root_process,
-            EntityEstimatorMomentsCollectionSnapshotsMap& snapshot_map ) const;
-
-  //! Reduce the entity histogram maps
-  void reduceEntityHistogramMaps(
-           const Utility::Communicator& comm,
-           const int root_process,
-           EntityEstimatorSampleMomentHistogramArrayMap& histogram_map ) const;
+  //! Reduce a collection that stores the data of every entity
+  void reduceEntityCollection(
+                         const Utility::Communicator& comm,
+                         const int root_process,
+                         FourEstimatorMomentsCollection& collection ) const;
 
   //! Reduce the histogram arrays
   void reduceHistogramArrays(
                            const Utility::Communicator& comm,
                            const int root_process,
-                           SampleMomentHistogramArray& histogram_array ) const;
+                           SampleMomentHistogramArray& histogram_array );
+
+  //! Pack the entity collections of a map into a single collection
+  void packEntityCollectionMap(
+                  const EntityEstimatorMomentsCollectionMap& collection_map,
+                  const size_t entity_collection_size,
+                  FourEstimatorMomentsCollection& collection );
+
+  //! Pack the entity snapshots of a map into a single collection snapshots
+  void packEntitySnapshotMap(
+                  const EntityEstimatorMomentsCollectionSnapshotsMap& snapshot_map,
+                  const size_t entity_collection_size,
+                  FourEstimatorMomentsCollectionSnapshots& snapshots );
+
+  //! Pack the entity histograms of a map into a single histogram array
+  void packEntityHistogramMap(
+                 const EntityEstimatorSampleMomentHistogramArrayMap& histogram_map,
+                 const size_t entity_collection_size,
+                 SampleMomentHistogramArray& histogram_array );
 
 private:
 
-  // Initialize entity estimator moments map
+  // Warn about entity ids that have been specified more than once
   template<typename InputEntityId>
-  void initializeEntityEstimatorMomentsMap(
-                                  const std::vector<InputEntityId>& entity_ids,
-                                  const bool warn_duplicate_ids );
-
-  // Initialize entity estimator snapshots map
-  void initializeEntityEstimatorSnapshotsMap();
-
-  // Initialize entity entity estimator histograms map
-  void initializeEntityEstimatorHistogramsMap();
+  void checkForDuplicateEntityIds(
+                                 const std::vector<InputEntityId>& entity_ids );
 
   // Initialize entity norm constants map
   template<typename InputEntityId>
@@ -281,63 +295,45 @@ private:
                             const std::vector<InputEntityId>& entity_ids,
                             const std::vector<double>& entity_norm_constants );
 
+  // Initialize the entity indices
+  void initializeEntityIndices();
+
   // Calculate the total normalization constant
   void calculateTotalNormalizationConstant();
 
-  // Resize the entity estimator moments map collections
-  void resizeEntityEstimatorMapCollections();
+  // Resize the entity estimator collection
+  void resizeEntityEstimatorCollection();
 
   // Resize the estimator total collection
   void resizeEstimatorTotalCollection();
 
   // Resize the entity estimator snapshots
-  void resizeEntityEstimatorMapSnapshots();
+  void resizeEntityEstimatorSnapshots();
 
   // Resize the estimator total snapshots
   void resizeEstimatorTotalSnapshots();
 
   // Resize the entity estimator histograms
-  void resizeEntityEstimatorMapHistograms();
+  void resizeEntityEstimatorHistograms();
 
   // Resize the estimator total histograms
   void resizeEstimatorTotalHistograms();
 
-  // Add contribution to entity bin histogram
-  void addHistoryContributionToEntityBinHistogram( const EntityId entity_id,
-                                                   const size_t bin_index,
-                                                   const double contribution );
-
-  // Add contribution to total bin histogram
-  void addHistoryContributionToTotalBinHistogram( const size_t bin_index,
-                                                  const double contribution );
-
-  // Reduce the entity collections
-  void reduceEntityCollections(
-                   const std::vector<EntityEstimatorMomentsCollectionMap>&
-                   other_entity_estimator_moments_maps,
-                   const size_t root_index,
-                   EntityEstimatorMomentsCollectionMap& collection_map ) const;
-
-  // Reduce the entity snapshots
-  void reduceEntitySnapshots(
-           const std::vector<EntityEstimatorMomentsCollectionSnapshotsMap>&
-           gathered_entity_data,
-           const size_t root_index,
-           EntityEstimatorMomentsCollectionSnapshotsMap& snapshots_map ) const;
-
-  // Reduce the entity histograms
-  void reduceEntityHistograms(
-           const std::vector<EntityEstimatorSampleMomentHistogramArrayMap>&
-           gathered_entity_data,
-           const size_t root_index,
-           EntityEstimatorSampleMomentHistogramArrayMap& histogram_map ) const;
-
-  // Reduce the entity histograms
-  void reduceEntityHistograms(
-                           const std::vector<SampleMomentHistogramArray>&
-                           gathered_entity_data,
-                           const size_t root_index,
-                           SampleMomentHistogramArray& histogram_array ) const;
+  // Return the entity bin index of an entity bin
+  size_t getEntityBinIndex( const EntityId entity_id,
+                            const size_t bin_index ) const;
+
+  // Check that the layout of the reduced data is the same on every process
+  void checkReductionDataLayout( const Utility::Communicator& comm,
+                                 const size_t number_of_entries,
+                                 const size_t entry_size,
+                                 const std::string& data_name ) const;
+
+  // Sum the arrays on the root process using chunked reductions
+  template<typename T>
+  void reduceArrays( const Utility::Communicator& comm,
+                     const int root_process,
+                     const std::vector<Utility::ArrayView<T> >& arrays ) const;
 
   // Print the entity ids assigned to the estimator
   void printEntityIds( std::ostream& os,
@@ -347,24 +343,40 @@ private:
   void printEntityNormConstants( std::ostream& os,
 				 const std::string& entity_type ) const;
 
-  // Serialize the entity estimator
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
+  // The maximum number of values that will be reduced at once
+  static const size_t s_max_reduction_buffer_size;
+
   // The total normalization constant (sum of all norm constants)
   double d_total_norm_constant;
 
   // Bool that records if entity norm constants were supplied
   bool d_supplied_norm_constants;
 
+  // The entity ids (sorted - the position of an id is the entity index)
+  std::vector<EntityId> d_entity_ids;
+
+  // The entity indices
+  std::unordered_map<EntityId,size_t> d_entity_indices;
+
   // The estimator moments (1st,2nd,3rd,4th) for each bin of the total
   FourEstimatorMomentsCollection d_estimator_total_bin_data;
 
-  // The estimator moments (1st,2nd,3rd,4th) for each bin and each entity
-  EntityEstimatorMomentsCollectionMap d_entity_estimator_moments_map;
+  // The estimator moments (1st,2nd,3rd,4th) for each bin of each entity
+  // (stored at entity_index*bins+bin)
+  FourEstimatorMomentsCollection d_entity_estimator_bin_data;
 
   // Bool that record if entity bin moment snapshots have been enabled
   bool d_entity_bin_snapshots_enabled;
@@ -373,9 +385,9 @@ private:
   // total
   FourEstimatorMomentsCollectionSnapshots d_estimator_total_bin_data_snapshots;
 
-  // The estimator moments (1st,2nd,3rd,4th) snapshots for each bin and
-  // each entity
-  EntityEstimatorMomentsCollectionSnapshotsMap d_entity_estimator_moments_snapshots_map;
+  // The estimator moments (1st,2nd,3rd,4th) snapshots for each bin of each
+  // entity (stored at entity_index*bins+bin)
+  FourEstimatorMomentsCollectionSnapshots d_entity_estimator_bin_data_snapshots;
 
   // Bool that records if entity bin histograms have been enabled
   bool d_entity_bin_histograms_enabled;
@@ -383,9 +395,9 @@ private:
   // The sample moment histograms for each bin of the total
   SampleMomentHistogramArray d_estimator_total_bin_histograms;
 
-  // The estimator sample moment histograms for each bin and each
-  // entity
-  EntityEstimatorSampleMomentHistogramArrayMap d_entity_estimator_histograms_map;
+  // The sample moment histograms for each bin of each entity (stored at
+  // entity_index*bins+bin)
+  SampleMomentHistogramArray d_entity_estimator_bin_histograms;
 
   // The entity normalization constants (surface areas or cell volumes)
   EntityNormConstMap d_entity_norm_constants_map;
@@ -393,7 +405,7 @@ private:
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes.
@@ -12,6 +12,8 @@
 // Std Lib Includes
 #include <sstream>
 #include <vector>
+#include <algorithm>
+#include <functional>
 
 namespace MonteCarlo{
 
@@ -28,14 +30,16 @@ EntityEstimator::EntityEstimator(
   : Estimator( id, multiplier ),
     d_total_norm_constant( 1.0 ),
     d_supplied_norm_constants( true ),
+    d_entity_ids(),
+    d_entity_indices(),
     d_estimator_total_bin_data( 1 ),
-    d_entity_estimator_moments_map(),
+    d_entity_estimator_bin_data(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
-    d_entity_estimator_moments_snapshots_map(),
+    d_entity_estimator_bin_data_snapshots(),
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
-    d_entity_estimator_histograms_map(),
+    d_entity_estimator_bin_histograms(),
     d_entity_norm_constants_map()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
@@ -47,13 +51,15 @@ EntityEstimator::EntityEstimator(
                       "Every entity id must have an associated entity norm "
                       "constant!" );
   
-  this->initializeEntityEstimatorMomentsMap( entity_ids, true );
+  this->checkForDuplicateEntityIds( entity_ids );
   this->initializeEntityNormConstantsMap( entity_ids, entity_norm_constants );
+  this->initializeEntityIndices();
 
   // Calculate the total normalization constant
   this->calculateTotalNormalizationConstant();
 
-  // Initialize the total bin data
+  // Initialize the bin data
+  this->resizeEntityEstimatorCollection();
   this->resizeEstimatorTotalCollection();
 }
 
@@ -68,47 +74,45 @@ EntityEstimator::EntityEstimator( const Id id,
   : Estimator( id, multiplier ),
     d_total_norm_constant( 1.0 ),
     d_supplied_norm_constants( false ),
+    d_entity_ids(),
+    d_entity_indices(),
     d_estimator_total_bin_data( 1 ),
-    d_entity_estimator_moments_map(),
+    d_entity_estimator_bin_data(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
-    d_entity_estimator_moments_snapshots_map(),
+    d_entity_estimator_bin_data_snapshots(),
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
-    d_entity_estimator_histograms_map(),
+    d_entity_estimator_bin_histograms(),
     d_entity_norm_constants_map()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
                       std::runtime_error,
                       "At least one entity id must be specified!" );
   
-  this->initializeEntityEstimatorMomentsMap( entity_ids, true );
+  this->checkForDuplicateEntityIds( entity_ids );
   this->initializeEntityNormConstantsMap( entity_ids );
+  this->initializeEntityIndices();
 
-  // Initialize the total bin data
+  // Initialize the bin data
+  this->resizeEntityEstimatorCollection();
   this->resizeEstimatorTotalCollection();
 }
 
-// Initialize entity estimator moments map
+// Warn about entity ids that have been specified more than once
 template<typename InputEntityId>
-void EntityEstimator::initializeEntityEstimatorMomentsMap(
-                                  const std::vector<InputEntityId>& entity_ids,
-                                  const bool warn_duplicate_ids )
+void EntityEstimator::checkForDuplicateEntityIds(
+                                  const std::vector<InputEntityId>& entity_ids )
 {
   // Make sure there is at least one entity id
   testPrecondition( entity_ids.size() > 0 );
 
+  std::set<EntityId> unique_entity_ids;
+
   for( size_t i = 0; i < entity_ids.size(); ++i )
   {
-    size_t size = this->getNumberOfBins()*
-      this->getNumberOfResponseFunctions();
-    
     // Ignore duplicate entity ids
-    if( d_entity_estimator_moments_map.count( entity_ids[i] ) == 0 )
-    {
-      d_entity_estimator_moments_map[entity_ids[i]].resize( size );
-    }
-    else if( warn_duplicate_ids )
+    if( !unique_entity_ids.insert( entity_ids[i] ).second )
     {
       FRENSIE_LOG_TAGGED_WARNING( "Estimator",
                                   "entity id " << entity_ids[i] <<
@@ -155,31 +159,218 @@ void EntityEstimator::initializeEntityNormConstantsMap(
   }
 }
 
-// Serialize the entity estimator
+// Save the data to an archive
 template<typename Archive>
-void EntityEstimator::serialize( Archive& ar, const unsigned version )
+void EntityEstimator::save( Archive& ar, const unsigned version ) const
 {
-  // Serialize the base class data
+  // Save the base class data
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Estimator );
 
-  // Serialize the local data
+  // Save the local data
   ar & BOOST_SERIALIZATION_NVP( d_total_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_supplied_norm_constants );
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_moments_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_bin_data );
   ar & BOOST_SERIALIZATION_NVP( d_entity_bin_snapshots_enabled );
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data_snapshots );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_moments_snapshots_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_bin_data_snapshots );
   ar & BOOST_SERIALIZATION_NVP( d_entity_bin_histograms_enabled );
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_histograms );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_histograms_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_bin_histograms );
   ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
 }
 
+// Load the data from an archive
+/*! \details Version 0 archives store the entity data in maps. The maps will
+ * be packed into the single entity collections.
+ */
+template<typename Archive>
+void EntityEstimator::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Estimator );
+
+  // Load the local data
+  ar & BOOST_SERIALIZATION_NVP( d_total_norm_constant );
+  ar & BOOST_SERIALIZATION_NVP( d_supplied_norm_constants );
+  ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_bin_data );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_bin_snapshots_enabled );
+    ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data_snapshots );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_bin_data_snapshots );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_bin_histograms_enabled );
+    ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_histograms );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_bin_histograms );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
+
+    this->initializeEntityIndices();
+  }
+  else
+  {
+    EntityEstimatorMomentsCollectionMap entity_moments_map;
+    EntityEstimatorMomentsCollectionSnapshotsMap entity_snapshots_map;
+    EntityEstimatorSampleMomentHistogramArrayMap entity_histograms_map;
+
+    ar & boost::serialization::make_nvp( "d_entity_estimator_moments_map", entity_moments_map );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_bin_snapshots_enabled );
+    ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data_snapshots );
+    ar & boost::serialization::make_nvp( "d_entity_estimator_moments_snapshots_map", entity_snapshots_map );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_bin_histograms_enabled );
+    ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_histograms );
+    ar & boost::serialization::make_nvp( "d_entity_estimator_histograms_map", entity_histograms_map );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
+
+    this->initializeEntityIndices();
+
+    const size_t entity_collection_size =
+      this->getNumberOfBins()*this->getNumberOfResponseFunctions();
+
+    this->packEntityCollectionMap( entity_moments_map,
+                                   entity_collection_size,
+                                   d_entity_estimator_bin_data );
+
+    if( d_entity_bin_snapshots_enabled )
+    {
+      // The streamed snapshots of each entity have their own file id
+      TEST_FOR_EXCEPTION( this->isSnapshotDataStreamed(),
+                          std::runtime_error,
+                          "Estimator " << this->getId() << " cannot be "
+                          "loaded because it was archived with streamed "
+                          "entity bin snapshots by an older version!" );
+
+      this->packEntitySnapshotMap( entity_snapshots_map,
+                                   entity_collection_size,
+                                   d_entity_estimator_bin_data_snapshots );
+    }
+
+    if( d_entity_bin_histograms_enabled )
+    {
+      this->packEntityHistogramMap( entity_histograms_map,
+                                    entity_collection_size,
+                                    d_entity_estimator_bin_histograms );
+    }
+  }
+}
+
+// Sum the arrays on the root process using chunked reductions
+/*! \details The arrays are treated as a single array (the arrays are
+ * reduced consecutively). The values are packed into a buffer and reduced in
+ * chunks to bound the memory required on each process. Only the root process
+ * will store the reduced values.
+ */
+template<typename T>
+void EntityEstimator::reduceArrays(
+                     const Utility::Communicator& comm,
+                     const int root_process,
+                     const std::vector<Utility::ArrayView<T> >& arrays ) const
+{
+  size_t number_of_values = 0;
+
+  for( size_t i = 0; i < arrays.size(); ++i )
+    number_of_values += arrays[i].size();
+
+  if( number_of_values == 0 )
+    return;
+
+  const size_t buffer_size =
+    std::min( number_of_values, s_max_reduction_buffer_size );
+
+  std::vector<T> buffer( buffer_size );
+  std::vector<T> reduced_buffer;
+
+  if( comm.rank() == root_process )
+    reduced_buffer.resize( buffer_size );
+
+  // The position of the next chunk in the arrays
+  size_t array_index = 0, array_offset = 0;
+
+  size_t number_of_reduced_values = 0;
+
+  while( number_of_reduced_values < number_of_values )
+  {
+    const size_t chunk_size =
+      std::min( buffer_size, number_of_values - number_of_reduced_values );
+
+    // Pack the chunk
+    {
+      size_t packed_values = 0, local_index = array_index,
+        local_offset = array_offset;
+
+      while( packed_values < chunk_size )
+      {
+        const size_t copy_size =
+          std::min( chunk_size - packed_values,
+                    arrays[local_index].size() - local_offset );
+
+        std::copy( arrays[local_index].begin() + local_offset,
+                   arrays[local_index].begin() + local_offset + copy_size,
+                   buffer.begin() + packed_values );
+
+        packed_values += copy_size;
+        local_offset += copy_size;
+
+        if( local_offset == arrays[local_index].size() )
+        {
+          ++local_index;
+          local_offset = 0;
+        }
+      }
+    }
+
+    // Reduce the chunk
+    if( comm.rank() == root_process )
+    {
+      Utility::reduce( comm,
+                       Utility::ArrayView<const T>( buffer.data(), chunk_size ),
+                       Utility::ArrayView<T>( reduced_buffer.data(), chunk_size ),
+                       std::plus<T>(),
+                       root_process );
+    }
+    else
+    {
+      Utility::reduce( comm,
+                       Utility::ArrayView<const T>( buffer.data(), chunk_size ),
+                       std::plus<T>(),
+                       root_process );
+    }
+
+    // Unpack the chunk (only the root process stores the reduced values)
+    size_t unpacked_values = 0;
+
+    while( unpacked_values < chunk_size )
+    {
+      const size_t copy_size =
+        std::min( chunk_size - unpacked_values,
+                  arrays[array_index].size() - array_offset );
+
+      if( comm.rank() == root_process )
+      {
+        std::copy( reduced_buffer.begin() + unpacked_values,
+                   reduced_buffer.begin() + unpacked_values + copy_size,
+                   arrays[array_index].begin() + array_offset );
+      }
+
+      unpacked_values += copy_size;
+      array_offset += copy_size;
+
+      if( array_offset == arrays[array_index].size() )
+      {
+        ++array_index;
+        array_offset = 0;
+      }
+    }
+
+    number_of_reduced_values += chunk_size;
+  }
+}
+
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_ASSUME_ABSTRACT_CLASS( EntityEstimator, MonteCarlo );
-EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, EntityEstimator );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, EntityEstimator );
 
 #endif // end MONTE_CARLO_ENTITY_ESTIMATOR_DEF_HPP
 
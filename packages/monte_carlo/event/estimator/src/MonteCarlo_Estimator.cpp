@@ -8,11 +8,13 @@
 
 // Std Lib Includes
 #include <limits>
+#include <sstream>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_Estimator.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
 #include "Utility_LoggingMacros.hpp"
 
 namespace MonteCarlo{
@@ -22,7 +24,8 @@ std::shared_ptr<const std::vector<double> > Estimator::s_default_sample_moment_h
   
 // Default constructor
 Estimator::Estimator()
-  : d_id( std::numeric_limits<Id>::max() )
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_snapshot_data_file_size( 0 )
 { /* ... */ }
   
 // Constructor
@@ -32,7 +35,11 @@ Estimator::Estimator( const Id id, const double multiplier )
     d_particle_types(),
     d_response_functions( 1 ),
     d_sample_moment_histogram_bins( Estimator::getDefaultSampleMomentHistogramBins() ),
-    d_has_uncommitted_history_contribution( 1, false )
+    d_has_uncommitted_history_contribution( 1, false ),
+    d_snapshot_data_output_file_name(),
+    d_snapshot_data_file_size( 0 ),
+    d_snapshot_data_writer(),
+    d_snapshot_data_reader()
 {
   // Make sure the multiplier is valid
   TEST_FOR_EXCEPTION( multiplier == 0.0,
@@ -143,6 +150,58 @@ bool Estimator::isParticleTypeAssigned( const ParticleType particle_type) const
     d_particle_types.end();
 }
 
+// Stream the snapshots to a file
+/*! \details Only the last snapshot of each collection will be kept in
+ * memory. The snapshot history will be loaded from the file when it is
+ * requested. When there is more than one process only the process with
+ * rank 0 writes to the file. The other processes keep their snapshots in
+ * memory until they are reduced, after which the root process writes the
+ * reduced snapshots to the file (the root process of the reduction must be
+ * the process with rank 0). This must be called before the first snapshot
+ * is taken.
+ */
+void Estimator::setSnapshotDataOutputFile(
+                                     const boost::filesystem::path& file_name )
+{
+  // Make sure the file name is valid
+  testPrecondition( !file_name.empty() );
+
+  d_snapshot_data_output_file_name = file_name;
+  d_snapshot_data_file_size = 0;
+
+  d_snapshot_data_reader.reset();
+  d_snapshot_data_writer.reset();
+
+  // Create the file now so that the snapshot history is always readable
+  if( this->isSnapshotDataWrittenLocally() )
+  {
+    d_snapshot_data_writer.reset(
+     new Utility::SampleMomentSnapshotFileWriter( d_snapshot_data_output_file_name ) );
+  }
+}
+
+// Check if the snapshots are streamed to a file
+bool Estimator::isSnapshotDataStreamed() const
+{
+  return !d_snapshot_data_output_file_name.empty();
+}
+
+// Return the snapshot data output file name
+const boost::filesystem::path& Estimator::getSnapshotDataOutputFileName() const
+{
+  return d_snapshot_data_output_file_name;
+}
+
+// Check if the snapshots are written to the file by this process
+/*! \details When there is more than one process only the process with
+ * rank 0 writes the snapshots to the file.
+ */
+bool Estimator::isSnapshotDataWrittenLocally() const
+{
+  return this->isSnapshotDataStreamed() &&
+    Utility::GlobalMPISession::rank() == 0;
+}
+
 // Set the sample moment histogram bins
 void Estimator::setSampleMomentHistogramBins( const std::shared_ptr<const std::vector<double> >& bin_boundaries )
 {
@@ -1130,10 +1189,15 @@ void Estimator::reduceCollection(
 }
 
 // Reduce snapshots
+/*! \details If the snapshots are streamed to a file the reduced snapshots
+ * will be written to the file by the root process.
+ */
 void Estimator::reduceSnapshots(
                      const Utility::Communicator& comm,
                      const int root_process,
-                     FourEstimatorMomentsCollectionSnapshots& snapshots ) const
+                     const SnapshotCollectionType collection_type,
+                     const EntityId entity_id,
+                     FourEstimatorMomentsCollectionSnapshots& snapshots )
 {
   // Make sure that the root process is valid
   testPrecondition( root_process < comm.size() );
@@ -1141,6 +1205,16 @@ void Estimator::reduceSnapshots(
   // Gather all of the collection snapshots on the root process
   if( comm.rank() == root_process )
   {
+    TEST_FOR_EXCEPTION( this->isSnapshotDataStreamed() &&
+                        !this->isSnapshotDataWrittenLocally(),
+                        std::runtime_error,
+                        "The streamed snapshots of estimator "
+                        << this->getId() << " can only be reduced on the "
+                        "process with rank 0!" );
+
+    // The root process snapshots have already been written to the file
+    const size_t first_reduced_snapshot = snapshots.getNumberOfSnapshots();
+
     std::vector<FourEstimatorMomentsCollectionSnapshots>
       gathered_snapshots( comm.size() );
 
@@ -1167,11 +1241,161 @@ void Estimator::reduceSnapshots(
       if( i != root_process )
         snapshots.mergeSnapshots( gathered_snapshots[i] );
     }
+
+    if( this->isSnapshotDataStreamed() )
+    {
+      snapshots.writeSnapshots( first_reduced_snapshot,
+                                this->getSnapshotDataWriter(),
+                                Estimator::getSnapshotCollectionId( collection_type,
+                                                                    entity_id ) );
+
+      // The snapshot history has changed
+      d_snapshot_data_reader.reset();
+    }
   }
   else
     Utility::send( comm, root_process, 0, snapshots );
 }
 
+// Take a snapshot of a collection
+/*! \details If the snapshots are streamed to a file by this process only
+ * the last snapshot will be kept in memory.
+ */
+void Estimator::takeCollectionSnapshot(
+                    const uint64_t num_histories_since_last_snapshot,
+                    const double time_since_last_snapshot,
+                    const FourEstimatorMomentsCollection& collection,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    FourEstimatorMomentsCollectionSnapshots& snapshots )
+{
+  if( this->isSnapshotDataWrittenLocally() )
+  {
+    snapshots.takeSnapshot( num_histories_since_last_snapshot,
+                            time_since_last_snapshot,
+                            collection,
+                            this->getSnapshotDataWriter(),
+                            Estimator::getSnapshotCollectionId( collection_type,
+                                                                entity_id ) );
+
+    // The snapshot history has changed
+    d_snapshot_data_reader.reset();
+  }
+  else
+  {
+    snapshots.takeSnapshot( num_histories_since_last_snapshot,
+                            time_since_last_snapshot,
+                            collection );
+  }
+}
+
+// Get the snapshot history values of a collection
+void Estimator::getCollectionSnapshotHistoryValues(
+                    const FourEstimatorMomentsCollectionSnapshots& snapshots,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    std::vector<uint64_t>& history_values ) const
+{
+  if( this->isSnapshotDataWrittenLocally() )
+  {
+    this->getSnapshotDataReader().getSnapshotIndices(
+                   Estimator::getSnapshotCollectionId( collection_type, entity_id ),
+                   history_values );
+  }
+  else
+  {
+    history_values.assign( snapshots.getSnapshotIndices().begin(),
+                           snapshots.getSnapshotIndices().end() );
+  }
+}
+
+// Get the snapshot sampling times of a collection
+void Estimator::getCollectionSnapshotSamplingTimes(
+                    const FourEstimatorMomentsCollectionSnapshots& snapshots,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    std::vector<double>& sampling_times ) const
+{
+  if( this->isSnapshotDataWrittenLocally() )
+  {
+    this->getSnapshotDataReader().getSnapshotSamplingTimes(
+                   Estimator::getSnapshotCollectionId( collection_type, entity_id ),
+                   sampling_times );
+  }
+  else
+  {
+    sampling_times.assign( snapshots.getSnapshotSamplingTimes().begin(),
+                           snapshots.getSnapshotSamplingTimes().end() );
+  }
+}
+
+// Return the snapshot file id of a collection
+/*! \details The collection type is stored in the upper 8 bits of the id.
+ */
+uint64_t Estimator::getSnapshotCollectionId(
+                                  const SnapshotCollectionType collection_type,
+                                  const EntityId entity_id )
+{
+  // Make sure the entity id is valid
+  testPrecondition( entity_id < (1ull << 56) );
+
+  return ((uint64_t)collection_type << 56) | entity_id;
+}
+
+// Return the snapshot data reader
+/*! \details The snapshot data output file will be flushed before it is
+ * read. The reader is reused until the next snapshot is taken. If no
+ * snapshots have been written since the estimator was loaded from an
+ * archive only the snapshots that were archived with it will be read.
+ */
+const Utility::SampleMomentSnapshotFileReader&
+Estimator::getSnapshotDataReader() const
+{
+  // Make sure the snapshots are written by this process
+  testPrecondition( this->isSnapshotDataWrittenLocally() );
+
+  if( !d_snapshot_data_reader )
+  {
+    if( d_snapshot_data_writer )
+    {
+      d_snapshot_data_writer->flush();
+
+      d_snapshot_data_reader.reset(
+       new Utility::SampleMomentSnapshotFileReader( d_snapshot_data_output_file_name ) );
+    }
+    else
+    {
+      d_snapshot_data_reader.reset(
+       new Utility::SampleMomentSnapshotFileReader( d_snapshot_data_output_file_name,
+                                                    d_snapshot_data_file_size ) );
+    }
+  }
+
+  return *d_snapshot_data_reader;
+}
+
+// Return the snapshot data writer
+/*! \details The writer is opened when the first snapshot is written after
+ * the estimator has been loaded from an archive. The snapshots that were
+ * written to the file after the estimator was archived will be discarded.
+ */
+Utility::SampleMomentSnapshotFileWriter& Estimator::getSnapshotDataWriter()
+{
+  // Make sure the snapshots are written by this process
+  testPrecondition( this->isSnapshotDataWrittenLocally() );
+
+  if( !d_snapshot_data_writer )
+  {
+    d_snapshot_data_reader.reset();
+
+    d_snapshot_data_writer.reset(
+      new Utility::SampleMomentSnapshotFileWriter( d_snapshot_data_output_file_name,
+                                                   d_snapshot_data_file_size ) );
+  }
+
+  return *d_snapshot_data_writer;
+}
+
 // Return the response function name
 const std::string& Estimator::getResponseFunctionName(
 				   const size_t response_function_index ) const
@@ -19,6 +19,7 @@
 #include <boost/serialization/assume_abstract.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
+#include <boost/filesystem/path.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_DiscretizableParticleHistoryObserver.hpp"
@@ -30,6 +31,8 @@
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_SampleMomentCollection.hpp"
 #include "Utility_SampleMomentCollectionSnapshots.hpp"
+#include "Utility_SampleMomentSnapshotFileWriter.hpp"
+#include "Utility_SampleMomentSnapshotFileReader.hpp"
 #include "Utility_SampleMomentHistogram.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_Vector.hpp"
@@ -128,6 +131,15 @@ public:
   //! Check if snapshots have been enabled on entity bins
   virtual bool areSnapshotsOnEntityBinsEnabled() const = 0;
 
+  //! Stream the snapshots to a file
+  void setSnapshotDataOutputFile( const boost::filesystem::path& file_name );
+
+  //! Check if the snapshots are streamed to a file
+  bool isSnapshotDataStreamed() const;
+
+  //! Return the snapshot data output file name
+  const boost::filesystem::path& getSnapshotDataOutputFileName() const;
+
   //! Enable sample moment histograms on entity bins
   virtual void enableSampleMomentHistogramsOnEntityBins() = 0;
 
@@ -455,6 +467,15 @@ public:
 
 protected:
 
+  //! The snapshot collection types (used to identify the snapshot file data)
+  enum SnapshotCollectionType
+  {
+    ENTITY_BIN_SNAPSHOT_COLLECTION = 0,
+    TOTAL_BIN_SNAPSHOT_COLLECTION,
+    ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+    TOTAL_SNAPSHOT_COLLECTION
+  };
+
   //! Default constructor
   Estimator();
 
@@ -495,7 +516,41 @@ protected:
   void reduceSnapshots(
                     const Utility::Communicator& comm,
                     const int root_process,
-                    FourEstimatorMomentsCollectionSnapshots& snapshots ) const;
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    FourEstimatorMomentsCollectionSnapshots& snapshots );
+
+  //! Take a snapshot of a collection
+  void takeCollectionSnapshot(
+                    const uint64_t num_histories_since_last_snapshot,
+                    const double time_since_last_snapshot,
+                    const FourEstimatorMomentsCollection& collection,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    FourEstimatorMomentsCollectionSnapshots& snapshots );
+
+  //! Get the snapshot history values of a collection
+  void getCollectionSnapshotHistoryValues(
+                    const FourEstimatorMomentsCollectionSnapshots& snapshots,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    std::vector<uint64_t>& history_values ) const;
+
+  //! Get the snapshot sampling times of a collection
+  void getCollectionSnapshotSamplingTimes(
+                    const FourEstimatorMomentsCollectionSnapshots& snapshots,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    std::vector<double>& sampling_times ) const;
+
+  //! Get the moment snapshots of a collection bin
+  template<size_t N>
+  void getCollectionMomentSnapshots(
+                    const FourEstimatorMomentsCollectionSnapshots& snapshots,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    const size_t bin_index,
+                    std::vector<double>& moments ) const;
 
   //! Return the response function name
   const std::string& getResponseFunctionName(
@@ -605,6 +660,20 @@ private:
                        double& variance_of_variance,
                        double& figure_of_merit ) const;
 
+  // Check if the snapshots are written to the file by this process
+  bool isSnapshotDataWrittenLocally() const;
+
+  // Return the snapshot file id of a collection
+  static uint64_t getSnapshotCollectionId(
+                                  const SnapshotCollectionType collection_type,
+                                  const EntityId entity_id );
+
+  // Return the snapshot data reader
+  const Utility::SampleMomentSnapshotFileReader& getSnapshotDataReader() const;
+
+  // Return the snapshot data writer
+  Utility::SampleMomentSnapshotFileWriter& getSnapshotDataWriter();
+
   // Reduce a single collection and return the reduced moments
   template<size_t N, typename Collection>
   void reduceCollectionAndReturnReducedMoments(
@@ -649,11 +718,23 @@ private:
   //       unusual thread safety issue that was encountered with
   //       std::vector<bool>.
   std::vector<uint8_t> d_has_uncommitted_history_contribution;
+
+  // The snapshot data output file name
+  boost::filesystem::path d_snapshot_data_output_file_name;
+
+  // The size of the snapshot data output file when the estimator was archived
+  uint64_t d_snapshot_data_file_size;
+
+  // The snapshot data writer (opened when the first snapshot is written)
+  std::shared_ptr<Utility::SampleMomentSnapshotFileWriter> d_snapshot_data_writer;
+
+  // The snapshot data reader (created when the snapshots are requested)
+  mutable std::shared_ptr<const Utility::SampleMomentSnapshotFileReader> d_snapshot_data_reader;
 };
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( Estimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( Estimator, MonteCarlo, 2 );
 BOOST_SERIALIZATION_ASSUME_ABSTRACT_CLASS( Estimator, MonteCarlo );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, Estimator );
 
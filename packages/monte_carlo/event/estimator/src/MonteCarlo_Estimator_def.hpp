@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_ESTIMATOR_DEF_HPP
 #define MONTE_CARLO_ESTIMATOR_DEF_HPP
 
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
 // FRENSIE Includes
 #include "MonteCarlo_DefaultTypedObserverPhaseSpaceDimensionDiscretization.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -65,6 +68,32 @@ void Estimator::reduceCollectionAndReturnReducedMoments(
                            "order " << N << " for estimator " << d_id << "!" );
 }
 
+// Get the moment snapshots of a collection bin
+template<size_t N>
+void Estimator::getCollectionMomentSnapshots(
+                    const FourEstimatorMomentsCollectionSnapshots& snapshots,
+                    const SnapshotCollectionType collection_type,
+                    const EntityId entity_id,
+                    const size_t bin_index,
+                    std::vector<double>& moments ) const
+{
+  if( this->isSnapshotDataWrittenLocally() )
+  {
+    this->getSnapshotDataReader().getScoreSnapshots(
+                   Estimator::getSnapshotCollectionId( collection_type, entity_id ),
+                   N,
+                   bin_index,
+                   moments );
+  }
+  else
+  {
+    const std::list<double>& moment_snapshots =
+      Utility::getScoreSnapshots<N>( snapshots, bin_index );
+
+    moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  }
+}
+
 // Save the data to an archive
 template<typename Archive>
 void Estimator::save( Archive& ar, const unsigned version ) const
@@ -78,6 +107,24 @@ void Estimator::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_particle_types );
   ar & BOOST_SERIALIZATION_NVP( d_response_functions );
   ar & BOOST_SERIALIZATION_NVP( d_sample_moment_histogram_bins );
+
+  // The snapshots must be in the output file before the estimator is
+  // archived. The file will be truncated to its current size on restart.
+  uint64_t snapshot_data_file_size = d_snapshot_data_file_size;
+
+  if( d_snapshot_data_writer )
+  {
+    d_snapshot_data_writer->flush();
+
+    snapshot_data_file_size = d_snapshot_data_writer->getFileSize();
+  }
+
+  std::string raw_snapshot_data_output_file_name =
+    d_snapshot_data_output_file_name.string();
+
+  ar & BOOST_SERIALIZATION_NVP( raw_snapshot_data_output_file_name );
+  ar & BOOST_SERIALIZATION_NVP( snapshot_data_file_size );
+
   // Do not save d_has_uncommited_history_contribution because it is thread
   // specific data - all data should be committed before saving the estimator
 }
@@ -95,9 +142,42 @@ void Estimator::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_particle_types );
   ar & BOOST_SERIALIZATION_NVP( d_response_functions );
   ar & BOOST_SERIALIZATION_NVP( d_sample_moment_histogram_bins );
-  
+
+  if( version > 0 )
+  {
+    std::string raw_snapshot_data_output_file_name;
+
+    ar & BOOST_SERIALIZATION_NVP( raw_snapshot_data_output_file_name );
+
+    d_snapshot_data_output_file_name = raw_snapshot_data_output_file_name;
+  }
+
+  // Version 1 archives did not store the snapshot data output file size -
+  // the entire file will be kept
+  if( version > 1 )
+  {
+    uint64_t snapshot_data_file_size;
+
+    ar & BOOST_SERIALIZATION_NVP( snapshot_data_file_size );
+
+    d_snapshot_data_file_size = snapshot_data_file_size;
+  }
+  else if( !d_snapshot_data_output_file_name.empty() &&
+           boost::filesystem::exists( d_snapshot_data_output_file_name ) )
+  {
+    d_snapshot_data_file_size =
+      boost::filesystem::file_size( d_snapshot_data_output_file_name );
+  }
+  else
+    d_snapshot_data_file_size = 0;
+
   // Initialize the thread data
   d_has_uncommitted_history_contribution.resize( 1, false );
+
+  // The snapshot data output file will only be opened for writing when the
+  // next snapshot is taken (a loaded estimator may only be post-processed)
+  d_snapshot_data_writer.reset();
+  d_snapshot_data_reader.reset();
 }
 
 } // end MonteCarlo namespace
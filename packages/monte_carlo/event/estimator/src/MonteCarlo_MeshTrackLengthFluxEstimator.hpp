@@ -68,6 +68,9 @@ public:
   //! Print the estimator data summary
   void printSummary( std::ostream& os ) const final override;
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
 protected:
 
   //! Default constructor
@@ -120,6 +123,9 @@ private:
   // The mesh object
   std::shared_ptr<const Utility::Mesh> d_mesh;
 
+  // The element track length arrays (one per thread - reused between updates)
+  std::vector<Utility::Mesh::ElementHandleTrackLengthArray> d_element_track_lengths;
+
   // The no-time-bins update method is being used
   bool d_no_time_bins_update_method;
 
@@ -10,6 +10,7 @@
 #define MONTE_CARLO_MESH_TRACK_LENGTH_FLUX_ESTIMATOR_DEF_HPP
 
 // FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ToStringTraits.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -28,6 +29,7 @@ MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::MeshTrackLengthFluxE
                              const std::shared_ptr<const Utility::Mesh>& mesh )
   : StandardEntityEstimator( id, multiplier ),
     d_mesh( mesh ),
+    d_element_track_lengths( 1 ),
     d_no_time_bins_update_method( true ),
     d_update_method()
 {
@@ -85,7 +87,12 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGloba
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  Utility::Mesh::ElementHandleTrackLengthArray contribution_array;
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_element_track_lengths.size() );
+
+  Utility::Mesh::ElementHandleTrackLengthArray& contribution_array =
+    d_element_track_lengths[Utility::OpenMPProperties::getThreadId()];
 
   d_mesh->computeTrackLengths( start_point, end_point, contribution_array );
 
@@ -113,7 +120,12 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGloba
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  Utility::Mesh::ElementHandleTrackLengthArray contribution_array;
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_element_track_lengths.size() );
+
+  Utility::Mesh::ElementHandleTrackLengthArray& contribution_array =
+    d_element_track_lengths[Utility::OpenMPProperties::getThreadId()];
 
   d_mesh->computeTrackLengths( start_point, end_point, contribution_array );
 
@@ -161,6 +173,23 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGloba
   }
 }
 
+// Enable support for multiple threads
+template<typename ContributionMultiplierPolicy>
+void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
+                                                   const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  StandardEntityEstimator::enableThreadSupport( num_threads );
+
+  // Add thread support to the element track length arrays
+  d_element_track_lengths.resize( num_threads );
+
+  // Add thread support to the mesh
+  d_mesh->enableThreadSupport( num_threads );
+}
+
 // Print the estimator data summary
 /*! \details The estimator data will also be exported to a vtk file (e.g.
  * estimator_x.vtk -> x == estimator id).
@@ -451,6 +480,9 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::load( Archive&
   ar & BOOST_SERIALIZATION_NVP( d_mesh );
   ar & BOOST_SERIALIZATION_NVP( d_no_time_bins_update_method );
 
+  // Initialize the thread data
+  d_element_track_lengths.resize( 1 );
+
   this->assignUpdateMethod();
 }
 
@@ -0,0 +1,380 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_RelativeErrorSimulationCompletionCriterion.cpp
+//! \author Alex Robinson
+//! \brief  The relative error simulation completion criterion class def.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <functional>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_RelativeErrorSimulationCompletionCriterion.hpp"
+#include "Utility_SampleMoment.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The simulation will never be considered complete before the
+ * minimum number of histories has been sampled.
+ */
+RelativeErrorSimulationCompletionCriterion::RelativeErrorSimulationCompletionCriterion(
+                               const uint64_t minimum_number_of_histories )
+  : d_minimum_number_of_histories( std::max( minimum_number_of_histories,
+                                             (uint64_t)1 ) ),
+    d_estimators(),
+    d_entity_ids(),
+    d_bin_indices(),
+    d_relative_error_targets(),
+    d_variance_of_variance_targets(),
+    d_number_of_histories( 0 ),
+    d_sampling_time( 0.0 ),
+    d_update_required( true ),
+    d_simulation_complete( false )
+{ /* ... */ }
+
+// Add an estimator entity bin target
+/*! \details The bin index is the index of the bin in the estimator entity
+ * bin data (the response function index is the slowest varying index).
+ * The variance of the variance target is the relative vov, which is ignored
+ * by default.
+ */
+void RelativeErrorSimulationCompletionCriterion::addEstimatorEntityBinTarget(
+                             const std::shared_ptr<const Estimator>& estimator,
+                             const EntityId entity_id,
+                             const size_t bin_index,
+                             const double relative_error,
+                             const double variance_of_variance )
+{
+  // Make sure that the estimator is valid
+  testPrecondition( estimator.get() );
+
+  TEST_FOR_EXCEPTION( !estimator->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << estimator->getId() << "!" );
+
+  TEST_FOR_EXCEPTION( bin_index >=
+                      estimator->getEntityBinDataFirstMoments( entity_id ).size(),
+                      std::runtime_error,
+                      "Bin " << bin_index << " of entity " << entity_id <<
+                      " of estimator " << estimator->getId() <<
+                      " does not exist!" );
+
+  TEST_FOR_EXCEPTION( relative_error <= 0.0,
+                      std::runtime_error,
+                      "The relative error target must be greater than 0.0!" );
+
+  TEST_FOR_EXCEPTION( variance_of_variance <= 0.0,
+                      std::runtime_error,
+                      "The variance of the variance target must be greater "
+                      "than 0.0!" );
+
+  d_estimators.push_back( estimator );
+  d_entity_ids.push_back( entity_id );
+  d_bin_indices.push_back( bin_index );
+  d_relative_error_targets.push_back( relative_error );
+  d_variance_of_variance_targets.push_back( variance_of_variance );
+
+  d_update_required = true;
+}
+
+// Get the number of estimator entity bin targets
+size_t RelativeErrorSimulationCompletionCriterion::getNumberOfTargets() const
+{
+  return d_estimators.size();
+}
+
+// Get the number of histories that the estimator data represents
+uint64_t RelativeErrorSimulationCompletionCriterion::getNumberOfSampledHistories() const
+{
+  return d_number_of_histories;
+}
+
+// Get the sampling time (s) that the estimator data represents
+double RelativeErrorSimulationCompletionCriterion::getSamplingTime() const
+{
+  return d_sampling_time;
+}
+
+// Get the largest ratio of the relative error to the target
+/*! \details A bin that has not been scored in yet has an infinite ratio.
+ */
+double RelativeErrorSimulationCompletionCriterion::getLargestRelativeErrorRatio() const
+{
+  if( d_number_of_histories == 0 )
+    return Utility::QuantityTraits<double>::inf();
+
+  double largest_ratio = 0.0;
+
+  for( size_t i = 0; i < d_estimators.size(); ++i )
+  {
+    double relative_error, variance_of_variance;
+
+    this->calculateTargetStatistics( i, relative_error, variance_of_variance );
+
+    largest_ratio = std::max( largest_ratio,
+                              relative_error/d_relative_error_targets[i] );
+  }
+
+  return largest_ratio;
+}
+
+// Estimate the additional sampling time (s) needed to meet the targets
+/*! \details The figure of merit (1/(R^2*T)) of each bin is assumed to be
+ * constant, which gives an estimated time of T*((R/R_target)^2-1) for each
+ * bin to reach its relative error target. The largest estimate is returned.
+ */
+double RelativeErrorSimulationCompletionCriterion::getEstimatedTimeToCompletion() const
+{
+  const double largest_ratio = this->getLargestRelativeErrorRatio();
+
+  if( largest_ratio == Utility::QuantityTraits<double>::inf() )
+    return largest_ratio;
+  else if( largest_ratio <= 1.0 )
+    return 0.0;
+  else
+    return d_sampling_time*(largest_ratio*largest_ratio - 1.0);
+}
+
+// Calculate the relative error and vov of a target
+/*! \details A bin that has not been scored in yet has an infinite relative
+ * error and vov.
+ */
+void RelativeErrorSimulationCompletionCriterion::calculateTargetStatistics(
+                                           const size_t target_index,
+                                           double& relative_error,
+                                           double& variance_of_variance ) const
+{
+  // Make sure that the target index is valid
+  testPrecondition( target_index < d_estimators.size() );
+  // Make sure that histories have been sampled
+  testPrecondition( d_number_of_histories > 0 );
+
+  const Estimator& estimator = *d_estimators[target_index];
+  const EntityId entity_id = d_entity_ids[target_index];
+  const size_t bin_index = d_bin_indices[target_index];
+
+  Utility::SampleMoment<1,double> first_moment(
+             estimator.getEntityBinDataFirstMoments( entity_id )[bin_index] );
+
+  if( first_moment.getCurrentScore() <= 0.0 )
+  {
+    relative_error = Utility::QuantityTraits<double>::inf();
+    variance_of_variance = Utility::QuantityTraits<double>::inf();
+
+    return;
+  }
+
+  Utility::SampleMoment<2,double> second_moment(
+             estimator.getEntityBinDataSecondMoments( entity_id )[bin_index] );
+
+  relative_error = Utility::calculateRelativeError( first_moment,
+                                                    second_moment,
+                                                    d_number_of_histories );
+
+  // Only process the third and fourth moments when they are needed
+  if( d_variance_of_variance_targets[target_index] <
+      Utility::QuantityTraits<double>::inf() )
+  {
+    Utility::SampleMoment<3,double> third_moment(
+             estimator.getEntityBinDataThirdMoments( entity_id )[bin_index] );
+
+    Utility::SampleMoment<4,double> fourth_moment(
+            estimator.getEntityBinDataFourthMoments( entity_id )[bin_index] );
+
+    variance_of_variance =
+      Utility::calculateRelativeVOV( first_moment,
+                                     second_moment,
+                                     third_moment,
+                                     fourth_moment,
+                                     d_number_of_histories );
+  }
+  else
+    variance_of_variance = 0.0;
+}
+
+// Update the cached completion state
+void RelativeErrorSimulationCompletionCriterion::updateCachedCompletionState() const
+{
+  d_simulation_complete =
+    d_estimators.size() > 0 &&
+    d_number_of_histories >= d_minimum_number_of_histories;
+
+  for( size_t i = 0; i < d_estimators.size() && d_simulation_complete; ++i )
+  {
+    double relative_error, variance_of_variance;
+
+    this->calculateTargetStatistics( i, relative_error, variance_of_variance );
+
+    if( relative_error > d_relative_error_targets[i] ||
+        variance_of_variance > d_variance_of_variance_targets[i] )
+      d_simulation_complete = false;
+  }
+
+  d_update_required = false;
+}
+
+// Check if the simulation is complete
+/*! \details The estimator moments are only processed if a snapshot or a
+ * reduction has occurred since the last check.
+ */
+bool RelativeErrorSimulationCompletionCriterion::isSimulationComplete() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_update_required )
+    this->updateCachedCompletionState();
+
+  return d_simulation_complete;
+}
+
+// Start the criterion
+/*! \details Snapshots are only taken while the simulation is running so
+ * there is nothing to activate.
+ */
+void RelativeErrorSimulationCompletionCriterion::start()
+{ /* ... */ }
+
+// Stop the criterion
+void RelativeErrorSimulationCompletionCriterion::stop()
+{ /* ... */ }
+
+// Clear cached criterion data
+void RelativeErrorSimulationCompletionCriterion::clearCache()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_number_of_histories = 0;
+  d_sampling_time = 0.0;
+  d_update_required = true;
+  d_simulation_complete = false;
+}
+
+// Enable support for multiple threads
+/*! \details The history count is only updated by the root thread when a
+ * snapshot is taken.
+ */
+void RelativeErrorSimulationCompletionCriterion::enableThreadSupport( const unsigned )
+{ /* ... */ }
+
+// Check if the observer has uncommitted history contributions
+bool RelativeErrorSimulationCompletionCriterion::hasUncommittedHistoryContribution() const
+{
+  return false;
+}
+
+// Commit the contribution from the current history to the observer
+void RelativeErrorSimulationCompletionCriterion::commitHistoryContribution()
+{ /* ... */ }
+
+// Take a snapshot
+/*! \details The estimators commit their history contributions immediately,
+ * so the estimator moments always correspond to the histories that have been
+ * reported in the snapshots.
+ */
+void RelativeErrorSimulationCompletionCriterion::takeSnapshot(
+                              const uint64_t num_histories_since_last_snapshot,
+                              const double time_since_last_snapshot )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_number_of_histories += num_histories_since_last_snapshot;
+  d_sampling_time += time_since_last_snapshot;
+
+  if( num_histories_since_last_snapshot > 0 )
+    d_update_required = true;
+}
+
+// Reset the observer data
+void RelativeErrorSimulationCompletionCriterion::resetData()
+{
+  this->clearCache();
+}
+
+// Reduce the object data on all processes in comm and collect on root
+/*! \details Only the history counts are reduced (the estimators reduce their
+ * own moments). The sampling time on the root process is kept since it is
+ * the wall time of the simulation.
+ */
+void RelativeErrorSimulationCompletionCriterion::reduceData(
+                                            const Utility::Communicator& comm,
+                                            const int root_process )
+{
+  if( comm.size() > 1 )
+  {
+    comm.barrier();
+
+    try{
+      if( comm.rank() == root_process )
+      {
+        uint64_t reduced_number_of_histories;
+
+        Utility::reduce( comm,
+                         d_number_of_histories,
+                         reduced_number_of_histories,
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        d_number_of_histories = reduced_number_of_histories;
+        d_update_required = true;
+      }
+      else
+      {
+        Utility::reduce( comm,
+                         d_number_of_histories,
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        this->resetData();
+      }
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in "
+                             "relative error simulation completion "
+                             "criterion!" );
+
+    comm.barrier();
+  }
+}
+
+// Get a description of the criterion
+std::string RelativeErrorSimulationCompletionCriterion::description() const
+{
+  std::string description( "largest relative error/target (" );
+
+  if( d_number_of_histories > 0 )
+    description += Utility::toString( this->getLargestRelativeErrorRatio() );
+  else
+    description += "inf";
+
+  description += ") <= 1 for " +
+    Utility::toString( d_estimators.size() ) + " estimator bins";
+
+  if( d_number_of_histories > 0 )
+  {
+    description += ", estimated time to completion (" +
+      Utility::toString( this->getEstimatedTimeToCompletion() ) + "s)";
+  }
+
+  return description;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( RelativeErrorSimulationCompletionCriterion, MonteCarlo );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::RelativeErrorSimulationCompletionCriterion );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_RelativeErrorSimulationCompletionCriterion.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,220 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_RelativeErrorSimulationCompletionCriterion.hpp
+//! \author Alex Robinson
+//! \brief  The relative error simulation completion criterion class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_RELATIVE_ERROR_SIMULATION_COMPLETION_CRITERION_HPP
+#define MONTE_CARLO_RELATIVE_ERROR_SIMULATION_COMPLETION_CRITERION_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_QuantityTraits.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The relative error simulation completion criterion
+ *
+ * \details The simulation is complete when the relative error (and
+ * optionally the relative variance of the variance) of every watched
+ * estimator entity bin is at or below its target. The estimator moments
+ * are only processed when the observer states have changed (after a
+ * snapshot or a reduction) and not every time the criterion is checked. In
+ * a distributed simulation the estimator data on the root process is only
+ * complete after a rendezvous (reduction) so the criterion will usually be
+ * satisfied at a rendezvous - no additional reductions are done.
+ */
+class RelativeErrorSimulationCompletionCriterion : public ParticleHistorySimulationCompletionCriterion
+{
+
+public:
+
+  //! The entity id type
+  typedef Estimator::EntityId EntityId;
+
+  //! Constructor
+  RelativeErrorSimulationCompletionCriterion(
+                              const uint64_t minimum_number_of_histories = 1 );
+
+  //! Destructor
+  ~RelativeErrorSimulationCompletionCriterion()
+  { /* ... */ }
+
+  //! Add an estimator entity bin target
+  void addEstimatorEntityBinTarget(
+                      const std::shared_ptr<const Estimator>& estimator,
+                      const EntityId entity_id,
+                      const size_t bin_index,
+                      const double relative_error,
+                      const double variance_of_variance =
+                      Utility::QuantityTraits<double>::inf() );
+
+  //! Get the number of estimator entity bin targets
+  size_t getNumberOfTargets() const;
+
+  //! Get the number of histories that the estimator data represents
+  uint64_t getNumberOfSampledHistories() const;
+
+  //! Get the sampling time (s) that the estimator data represents
+  double getSamplingTime() const;
+
+  //! Get the largest ratio of the relative error to the target
+  double getLargestRelativeErrorRatio() const;
+
+  //! Estimate the additional sampling time (s) needed to meet the targets
+  double getEstimatedTimeToCompletion() const;
+
+  //! Check if the simulation is complete
+  bool isSimulationComplete() const final override;
+
+  //! Start the criterion
+  void start() final override;
+
+  //! Stop the criterion
+  void stop() final override;
+
+  //! Clear cached criterion data
+  void clearCache() final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+  //! Check if the observer has uncommitted history contributions
+  bool hasUncommittedHistoryContribution() const final override;
+
+  //! Commit the contribution from the current history to the observer
+  void commitHistoryContribution() final override;
+
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t num_histories_since_last_snapshot,
+                     const double time_since_last_snapshot ) final override;
+
+  //! Reset the observer data
+  void resetData() final override;
+
+  //! Reduce the object data on all processes in comm and collect on root
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process ) final override;
+
+  //! Get a description of the criterion
+  std::string description() const final override;
+
+private:
+
+  // Calculate the relative error and vov of a target
+  void calculateTargetStatistics( const size_t target_index,
+                                  double& relative_error,
+                                  double& variance_of_variance ) const;
+
+  // Update the cached completion state
+  void updateCachedCompletionState() const;
+
+  // Save the completion criterion
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the completion criterion
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The minimum number of histories
+  uint64_t d_minimum_number_of_histories;
+
+  // The watched estimators
+  std::vector<std::shared_ptr<const Estimator> > d_estimators;
+
+  // The watched entity ids
+  std::vector<EntityId> d_entity_ids;
+
+  // The watched bin indices
+  std::vector<size_t> d_bin_indices;
+
+  // The relative error targets
+  std::vector<double> d_relative_error_targets;
+
+  // The relative vov targets
+  std::vector<double> d_variance_of_variance_targets;
+
+  // The number of histories that the estimator data represents
+  uint64_t d_number_of_histories;
+
+  // The sampling time that the estimator data represents
+  double d_sampling_time;
+
+  // Records if the cached completion state must be updated
+  mutable bool d_update_required;
+
+  // The cached completion state
+  mutable bool d_simulation_complete;
+};
+
+// Save the completion criterion
+template<typename Archive>
+void RelativeErrorSimulationCompletionCriterion::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Save the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_minimum_number_of_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_estimators );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_indices );
+  ar & BOOST_SERIALIZATION_NVP( d_relative_error_targets );
+  ar & BOOST_SERIALIZATION_NVP( d_variance_of_variance_targets );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_sampling_time );
+
+  // Don't save the cached completion state - it will be recalculated
+}
+
+// Load the completion criterion
+template<typename Archive>
+void RelativeErrorSimulationCompletionCriterion::load( Archive& ar, const unsigned version )
+{
+  // Load the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Load the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_minimum_number_of_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_estimators );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_indices );
+  ar & BOOST_SERIALIZATION_NVP( d_relative_error_targets );
+  ar & BOOST_SERIALIZATION_NVP( d_variance_of_variance_targets );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_sampling_time );
+
+  d_update_required = true;
+  d_simulation_complete = false;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( RelativeErrorSimulationCompletionCriterion, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( RelativeErrorSimulationCompletionCriterion, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, RelativeErrorSimulationCompletionCriterion );
+
+#endif // end MONTE_CARLO_RELATIVE_ERROR_SIMULATION_COMPLETION_CRITERION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_RelativeErrorSimulationCompletionCriterion.hpp
+//---------------------------------------------------------------------------//
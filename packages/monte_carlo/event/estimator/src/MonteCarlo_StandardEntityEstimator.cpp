@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_StandardEntityEstimator.hpp"
@@ -25,11 +28,11 @@ StandardEntityEstimator::StandardEntityEstimator(
                                        const double multiplier )
   : EntityEstimator( id, multiplier ),
     d_total_estimator_moments( 1 ),
-    d_entity_total_estimator_moments_map(),
+    d_entity_total_estimator_moments(),
     d_total_estimator_moment_snapshots( 1 ),
-    d_entity_total_estimator_moment_snapshots_map(),
+    d_entity_total_estimator_moment_snapshots(),
     d_total_estimator_histograms( 1 ),
-    d_entity_total_estimator_histograms_map(),
+    d_entity_total_estimator_histograms(),
     d_update_tracker( 1 )
 { /* ... */ }
 
@@ -77,12 +80,10 @@ Utility::ArrayView<const double> StandardEntityEstimator::getEntityTotalDataFirs
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
 
-  const Estimator::FourEstimatorMomentsCollection& entity_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
-
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<1>( entity_collection ),
-                             entity_collection.size() );
+          Utility::getCurrentScores<1>( d_entity_total_estimator_moments ) +
+          this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions(),
+          this->getNumberOfResponseFunctions() );
 }
 
 // Get the total data second moments for an entity
@@ -91,12 +92,10 @@ Utility::ArrayView<const double> StandardEntityEstimator::getEntityTotalDataSeco
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
 
-  const Estimator::FourEstimatorMomentsCollection& entity_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
-
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<2>( entity_collection ),
-                             entity_collection.size() );
+          Utility::getCurrentScores<2>( d_entity_total_estimator_moments ) +
+          this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions(),
+          this->getNumberOfResponseFunctions() );
 }
 
 // Get the total data third moments for an entity
@@ -105,12 +104,10 @@ Utility::ArrayView<const double> StandardEntityEstimator::getEntityTotalDataThir
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
 
-  const Estimator::FourEstimatorMomentsCollection& entity_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
-
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<3>( entity_collection ),
-                             entity_collection.size() );
+          Utility::getCurrentScores<3>( d_entity_total_estimator_moments ) +
+          this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions(),
+          this->getNumberOfResponseFunctions() );
 }
 
 // Get the total data fourth moments for an entity
@@ -119,12 +116,10 @@ Utility::ArrayView<const double> StandardEntityEstimator::getEntityTotalDataFour
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
 
-  const Estimator::FourEstimatorMomentsCollection& entity_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
-
   return Utility::ArrayView<const double>(
-                             Utility::getCurrentScores<4>( entity_collection ),
-                             entity_collection.size() );
+          Utility::getCurrentScores<4>( d_entity_total_estimator_moments ) +
+          this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions(),
+          this->getNumberOfResponseFunctions() );
 }
 
 // Take a snapshot (of the moments)
@@ -134,16 +129,19 @@ void StandardEntityEstimator::takeSnapshot( const uint64_t num_histories_since_l
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
   
-  d_total_estimator_moment_snapshots.takeSnapshot( num_histories_since_last_snapshot,
-                                                   time_since_last_snapshot,
-                                                   d_total_estimator_moments );
-
-  for( auto&& entity_data : d_entity_total_estimator_moment_snapshots_map )
-  {
-    entity_data.second.takeSnapshot( num_histories_since_last_snapshot,
-                                     time_since_last_snapshot,
-                                     d_entity_total_estimator_moments_map[entity_data.first] );
-  }
+  this->takeCollectionSnapshot( num_histories_since_last_snapshot,
+                                time_since_last_snapshot,
+                                d_total_estimator_moments,
+                                TOTAL_SNAPSHOT_COLLECTION,
+                                0,
+                                d_total_estimator_moment_snapshots );
+
+  this->takeCollectionSnapshot( num_histories_since_last_snapshot,
+                                time_since_last_snapshot,
+                                d_entity_total_estimator_moments,
+                                ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+                                0,
+                                d_entity_total_estimator_moment_snapshots );
 
   EntityEstimator::takeSnapshot( num_histories_since_last_snapshot,
                                  time_since_last_snapshot );
@@ -160,11 +158,11 @@ void StandardEntityEstimator::getEntityTotalMomentSnapshotHistoryValues(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const std::list<uint64_t>& raw_history_values =
-    d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second.getSnapshotIndices();
-
-  history_values.assign( raw_history_values.begin(),
-                         raw_history_values.end() );
+  this->getCollectionSnapshotHistoryValues(
+                                     d_entity_total_estimator_moment_snapshots,
+                                     ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+                                     0,
+                                     history_values );
 }
 
 //  Get the entity total moment snapshot sampling times
@@ -178,11 +176,11 @@ void StandardEntityEstimator::getEntityTotalMomentSnapshotSamplingTimes(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
-  const std::list<double>& raw_sampling_time_values =
-    d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second.getSnapshotSamplingTimes();
-
-  sampling_times.assign( raw_sampling_time_values.begin(),
-                         raw_sampling_time_values.end() );
+  this->getCollectionSnapshotSamplingTimes(
+                                     d_entity_total_estimator_moment_snapshots,
+                                     ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+                                     0,
+                                     sampling_times );
 }
   
 // Get the total data first moment snapshots for an entity bin index
@@ -203,12 +201,13 @@ void StandardEntityEstimator::getEntityTotalFirstMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<1>(
-       d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
-       response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<1>(
+       d_entity_total_estimator_moment_snapshots,
+       ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+       0,
+       this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions() +
+       response_function_index,
+       moments );
 }
 
 // Get the total data second moment snapshots for an entity bin index
@@ -229,12 +228,13 @@ void StandardEntityEstimator::getEntityTotalSecondMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<2>(
-       d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
-       response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<2>(
+       d_entity_total_estimator_moment_snapshots,
+       ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+       0,
+       this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions() +
+       response_function_index,
+       moments );
 }
 
 // Get the total data third moment snapshots for an entity bin index
@@ -255,12 +255,13 @@ void StandardEntityEstimator::getEntityTotalThirdMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<3>(
-       d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
-       response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<3>(
+       d_entity_total_estimator_moment_snapshots,
+       ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+       0,
+       this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions() +
+       response_function_index,
+       moments );
 }
 
 // Get the total data fourth moment snapshots for an entity bin index
@@ -281,34 +282,33 @@ void StandardEntityEstimator::getEntityTotalFourthMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<4>(
-       d_entity_total_estimator_moment_snapshots_map.find( entity_id )->second,
-       response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<4>(
+       d_entity_total_estimator_moment_snapshots,
+       ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+       0,
+       this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions() +
+       response_function_index,
+       moments );
 }
 
 // Get the total moment snapshot history values
 void StandardEntityEstimator::getTotalMomentSnapshotHistoryValues(
                                   std::vector<uint64_t>& history_values ) const
 {
-  const std::list<uint64_t>& raw_history_values =
-    d_total_estimator_moment_snapshots.getSnapshotIndices();
-
-  history_values.assign( raw_history_values.begin(),
-                         raw_history_values.end() );
+  this->getCollectionSnapshotHistoryValues( d_total_estimator_moment_snapshots,
+                                            TOTAL_SNAPSHOT_COLLECTION,
+                                            0,
+                                            history_values );
 }
 
 // Get the total moment snapshot sampling times
 void StandardEntityEstimator::getTotalMomentSnapshotSamplingTimes(
                                     std::vector<double>& sampling_times ) const
 {
-  const std::list<double>& raw_sampling_time_values =
-    d_total_estimator_moment_snapshots.getSnapshotSamplingTimes();
-
-  sampling_times.assign( raw_sampling_time_values.begin(),
-                         raw_sampling_time_values.end() );
+  this->getCollectionSnapshotSamplingTimes( d_total_estimator_moment_snapshots,
+                                            TOTAL_SNAPSHOT_COLLECTION,
+                                            0,
+                                            sampling_times );
 }
 
 // Get the total data first moment snapshots for a total bin index
@@ -322,11 +322,11 @@ void StandardEntityEstimator::getTotalFirstMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<1>( d_total_estimator_moment_snapshots,
-                                   response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<1>( d_total_estimator_moment_snapshots,
+                                         TOTAL_SNAPSHOT_COLLECTION,
+                                         0,
+                                         response_function_index,
+                                         moments );
 }
 
 // Get the total data second moment snapshots for a total bin index
@@ -340,11 +340,11 @@ void StandardEntityEstimator::getTotalSecondMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<2>( d_total_estimator_moment_snapshots,
-                                   response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<2>( d_total_estimator_moment_snapshots,
+                                         TOTAL_SNAPSHOT_COLLECTION,
+                                         0,
+                                         response_function_index,
+                                         moments );
 }
 
 // Get the total data third moment snapshots for a total bin index
@@ -358,11 +358,11 @@ void StandardEntityEstimator::getTotalThirdMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<3>( d_total_estimator_moment_snapshots,
-                                   response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<3>( d_total_estimator_moment_snapshots,
+                                         TOTAL_SNAPSHOT_COLLECTION,
+                                         0,
+                                         response_function_index,
+                                         moments );
 }
 
 // Get the total data fourth moment snapshots for a total bin index
@@ -376,11 +376,11 @@ void StandardEntityEstimator::getTotalFourthMomentSnapshots(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  const std::list<double>& moment_snapshots =
-    Utility::getScoreSnapshots<4>( d_total_estimator_moment_snapshots,
-                                   response_function_index );
-
-  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+  this->getCollectionMomentSnapshots<4>( d_total_estimator_moment_snapshots,
+                                         TOTAL_SNAPSHOT_COLLECTION,
+                                         0,
+                                         response_function_index,
+                                         moments );
 }
 
 // Get the entity total sample moment histogram
@@ -401,7 +401,9 @@ void StandardEntityEstimator::getEntityTotalSampleMomentHistogram(
                       "The response function index must be less than "
                       << this->getNumberOfResponseFunctions() << "!" );
 
-  histogram = d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
+  histogram = d_entity_total_estimator_histograms[
+                 this->getEntityIndex( entity_id )*this->getNumberOfResponseFunctions() +
+                 response_function_index];
 }
 
 // Get the total sample moment histogram
@@ -419,96 +421,96 @@ void StandardEntityEstimator::getTotalSampleMomentHistogram(
 }
 
 // Commit the contribution from the current history to the estimator
-/*! \details This function must only be called within an omp critical block
- * if multiple threads are being used. Failure to do this may result in
- * race conditions.
+/*! \details This function can be called by multiple threads concurrently.
+ * Each thread only commits its own update tracker data and the moments are
+ * updated atomically. The thread's contribution list is merged in place
+ * twice: first by entity bin, which also groups the contributions by entity
+ * and response function, and then by bin of the total.
  */
 void StandardEntityEstimator::commitHistoryContribution()
 {
   // Thread id
   size_t thread_id = Utility::OpenMPProperties::getThreadId();
 
-  // Number of bins per response function
-  size_t num_bins = this->getNumberOfBins();
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_update_tracker.size() );
 
   // Number of response functions
-  size_t num_response_funcs = this->getNumberOfResponseFunctions();
+  const size_t num_response_funcs = this->getNumberOfResponseFunctions();
 
-  // The entity totals
-  std::vector<double> entity_totals( num_response_funcs, 0.0 );
+  // Number of bins of each entity
+  const size_t num_bins = this->getNumberOfBins();
+  const size_t num_entity_bins = num_bins*num_response_funcs;
 
-  // The totals over all entities
-  std::vector<double> totals( num_response_funcs, 0.0 );
+  SerialUpdateTracker& update_tracker = d_update_tracker[thread_id];
 
-  // The bin totals over all entities
-  BinContributionMap bin_totals;
+  std::vector<EntityBinContribution>& entity_bin_contributions =
+    update_tracker.entity_bin_contributions;
+
+  // The totals over all entities
+  std::vector<double>& totals = update_tracker.response_function_totals;
+  totals.assign( num_response_funcs, 0.0 );
 
-  // Get the entities with updated data
-  typename SerialUpdateTracker::const_iterator entity, end_entity;
+  // Combine the contributions to each bin of each entity
+  this->mergeUpdateTrackerContributions( entity_bin_contributions );
 
-  this->getEntityIteratorFromUpdateTracker( thread_id, entity, end_entity );
+  // Commit the entity bins (grouped by entity and response function)
+  size_t i = 0;
 
-  while( entity != end_entity )
+  while( i < entity_bin_contributions.size() )
   {
-    // Process each updated bin
-    BinContributionMap::const_iterator bin_data, end_bin_data;
+    const size_t entity_index =
+      entity_bin_contributions[i].entity_bin_index/num_entity_bins;
 
-    this->getBinIteratorFromUpdateTrackerIterator( thread_id,
-                                                   entity,
-                                                   bin_data,
-                                                   end_bin_data );
+    const size_t first_entity_bin_index = entity_index*num_entity_bins;
 
-    while( bin_data != end_bin_data )
+    for( size_t r = 0; r < num_response_funcs; ++r )
     {
-      size_t response_func_index =
-	this->calculateResponseFunctionIndex( bin_data->first );
+      const size_t end_entity_bin_index =
+        first_entity_bin_index + (r+1)*num_bins;
 
-      const double bin_contribution = bin_data->second;
+      double entity_total = 0.0;
 
-      entity_totals[response_func_index] += bin_contribution;
+      // Process each updated bin of the entity response function
+      while( i < entity_bin_contributions.size() &&
+             entity_bin_contributions[i].entity_bin_index <
+             end_entity_bin_index )
+      {
+        EntityBinContribution& bin_data = entity_bin_contributions[i];
 
-      totals[response_func_index] += bin_contribution;
+        this->commitHistoryContributionToEntityBin( bin_data.entity_bin_index,
+                                                    bin_data.contribution );
 
-      if( bin_totals.find( bin_data->first ) != bin_totals.end() )
-	bin_totals[bin_data->first] += bin_contribution;
-      else
-	bin_totals[bin_data->first] = bin_contribution;
+        entity_total += bin_data.contribution;
 
-      this->commitHistoryContributionToBinOfEntity( entity->first,
-						    bin_data->first,
-						    bin_contribution );
+        totals[r] += bin_data.contribution;
 
-      ++bin_data;
-    }
+        // Reuse the contribution for the bin of the total
+        bin_data.entity_bin_index -= first_entity_bin_index;
+        bin_data.order = i;
 
-    // Commit the entity totals
-    for( size_t i = 0; i < num_response_funcs; ++i )
-    {
-      this->commitHistoryContributionToTotalOfEntity( entity->first,
-                                                      i,
-                                                      entity_totals[i] );
+        ++i;
+      }
 
-      // Reset the entity totals
-      entity_totals[i] = 0.0;
+      // Commit the entity total
+      this->commitHistoryContributionToTotalOfEntity( entity_index,
+                                                      r,
+                                                      entity_total );
     }
-
-    ++entity;
   }
 
   // Commit the totals over all entities
-  for( size_t i = 0; i < num_response_funcs; ++i )
-    this->commitHistoryContributionToTotalOfEstimator( i, totals[i] );
+  for( size_t r = 0; r < num_response_funcs; ++r )
+    this->commitHistoryContributionToTotalOfEstimator( r, totals[r] );
 
   // Commit the bin totals over all entities
-  BinContributionMap::const_iterator bin_data, end_bin_data;
-  bin_data = bin_totals.begin();
-  end_bin_data = bin_totals.end();
+  this->mergeUpdateTrackerContributions( entity_bin_contributions );
 
-  while( bin_data != end_bin_data )
+  for( size_t j = 0; j < entity_bin_contributions.size(); ++j )
   {
-    this->commitHistoryContributionToBinOfTotal( bin_data->first,
-						 bin_data->second );
-    ++bin_data;
+    this->commitHistoryContributionToBinOfTotal(
+                                   entity_bin_contributions[j].entity_bin_index,
+                                   entity_bin_contributions[j].contribution );
   }
 
   // Reset the update tracker
@@ -542,31 +544,26 @@ void StandardEntityEstimator::resetData()
   d_total_estimator_moments.reset();
 
   // Reset the entity total moments
-  for( auto&& entity_data : d_entity_total_estimator_moments_map )
-    entity_data.second.reset();
+  d_entity_total_estimator_moments.reset();
 
   // Reset the total moment snapshots
   d_total_estimator_moment_snapshots.reset();
 
   // Reset the entity total moment snapshots
-  for( auto&& entity_data : d_entity_total_estimator_moment_snapshots_map )
-    entity_data.second.reset();
+  d_entity_total_estimator_moment_snapshots.reset();
 
   // Reset the total moment histograms
   for( auto&& histogram : d_total_estimator_histograms )
     histogram.reset();
 
   // Reset the entity total moment histograms
-  for( auto&& entity_data : d_entity_total_estimator_histograms_map )
-  {
-    for( auto&& histogram : entity_data.second )
-      histogram.reset();
-  }
+  for( auto&& histogram : d_entity_total_estimator_histograms )
+    histogram.reset();
 
   // Reset the update tracker
   for( size_t i = 0; i < d_update_tracker.size(); ++i )
   {
-    d_update_tracker[i].clear();
+    this->resetUpdateTracker( i );
 
     this->unsetHasUncommittedHistoryContribution( i );
   }
@@ -586,7 +583,7 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
   {
     // Reduce the entity data
     try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_total_estimator_moments_map );
+      this->reduceEntityCollection( comm, root_process, d_entity_total_estimator_moments );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in "
@@ -606,7 +603,11 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
 
     // Reduce the entity snapshot data
     try{
-      this->reduceEntitySnapshotMaps( comm, root_process, d_entity_total_estimator_moment_snapshots_map );
+      this->reduceSnapshots( comm,
+                             root_process,
+                             ENTITY_TOTAL_SNAPSHOT_COLLECTION,
+                             0,
+                             d_entity_total_estimator_moment_snapshots );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in "
@@ -615,7 +616,11 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
 
     // Reduce the total snapshot data
     try{
-      this->reduceSnapshots( comm, root_process, d_total_estimator_moment_snapshots );
+      this->reduceSnapshots( comm,
+                             root_process,
+                             TOTAL_SNAPSHOT_COLLECTION,
+                             0,
+                             d_total_estimator_moment_snapshots );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in "
@@ -624,7 +629,7 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
 
     // Reduce the entity histogram data
     try{
-      this->reduceEntityHistogramMaps( comm, root_process, d_entity_total_estimator_histograms_map );
+      this->reduceHistogramArrays( comm, root_process, d_entity_total_estimator_histograms );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in "
@@ -656,22 +661,14 @@ void StandardEntityEstimator::assignEntities(
 
   // Reset the estimator data
   d_total_estimator_moments.clear();
-  d_entity_total_estimator_moments_map.clear();
+  d_entity_total_estimator_moments.clear();
   d_total_estimator_moment_snapshots.clear();
-  d_entity_total_estimator_moment_snapshots_map.clear();
+  d_entity_total_estimator_moment_snapshots.clear();
   d_total_estimator_histograms.clear();
-  d_entity_total_estimator_histograms_map.clear();
+  d_entity_total_estimator_histograms.clear();
 
-  // Initialize the entity data
-  for( auto&& entity_data : entity_norm_data )
-  {
-    d_entity_total_estimator_moments_map[entity_data.first];
-    d_entity_total_estimator_moment_snapshots_map[entity_data.first];
-    d_entity_total_estimator_histograms_map[entity_data.first];
-  }      
-
-  // Resize the entity total estimator momens map collections
-  this->resizeEntityTotalEstimatorMomentsMapCollections();
+  // Resize the entity total estimator collections
+  this->resizeEntityTotalEstimatorCollections();
 
   // Resize the total estimator moments array
   d_total_estimator_moments.resize( this->getNumberOfResponseFunctions() );
@@ -695,8 +692,8 @@ void StandardEntityEstimator::assignResponseFunction(
 
   EntityEstimator::assignResponseFunction( response_function );
 
-  // Resize the entity total estimator momens map collections
-  this->resizeEntityTotalEstimatorMomentsMapCollections();
+  // Resize the entity total estimator collections
+  this->resizeEntityTotalEstimatorCollections();
 
   // Resize the total estimator moments array
   d_total_estimator_moments.resize( this->getNumberOfResponseFunctions() );
@@ -719,11 +716,8 @@ void StandardEntityEstimator::assignSampleMomentHistogramBins( const std::shared
   for( auto&& histogram : d_total_estimator_histograms )
     histogram.setBinBoundaries( bins );
 
-  for( auto&& entity_data : d_entity_total_estimator_histograms_map )
-  {
-    for( auto&& histogram : entity_data.second )
-      histogram.setBinBoundaries( bins );
-  }
+  for( auto&& histogram : d_entity_total_estimator_histograms )
+    histogram.setBinBoundaries( bins );
 }
 
 // Print the estimator data
@@ -737,15 +731,36 @@ void StandardEntityEstimator::printImplementation(
   EntityEstimator::printImplementation( os, entity_type );
 
   // Print the entity total estimator data
-  for( auto&& entity_id : d_entity_total_estimator_moments_map )
+  std::set<EntityId> entity_ids;
+  this->getEntityIds( entity_ids );
+
+  const size_t num_response_funcs = this->getNumberOfResponseFunctions();
+
+  Estimator::FourEstimatorMomentsCollection
+    entity_total_data( num_response_funcs );
+
+  for( auto&& entity_id : entity_ids )
   {
-    os << entity_type << " " << entity_id.first << " Total Data:\n";
+    const size_t offset = this->getEntityIndex( entity_id )*num_response_funcs;
+
+    for( size_t i = 0; i < num_response_funcs; ++i )
+    {
+      Utility::getCurrentScore<1>( entity_total_data, i ) =
+        Utility::getCurrentScore<1>( d_entity_total_estimator_moments, offset+i );
+      Utility::getCurrentScore<2>( entity_total_data, i ) =
+        Utility::getCurrentScore<2>( d_entity_total_estimator_moments, offset+i );
+      Utility::getCurrentScore<3>( entity_total_data, i ) =
+        Utility::getCurrentScore<3>( d_entity_total_estimator_moments, offset+i );
+      Utility::getCurrentScore<4>( entity_total_data, i ) =
+        Utility::getCurrentScore<4>( d_entity_total_estimator_moments, offset+i );
+    }
+
+    os << entity_type << " " << entity_id << " Total Data:\n";
     os << "--------\n";
 
-    this->printEstimatorTotalData(
-		              os,
-                              entity_id.second,
-		              this->getEntityNormConstant( entity_id.first ) );
+    this->printEstimatorTotalData( os,
+                                   entity_total_data,
+                                   this->getEntityNormConstant( entity_id ) );
 
     os << "\n";
   }
@@ -786,6 +801,9 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
     typename ObserverPhaseSpaceDimensionDiscretization::BinIndexArray
       bin_indices;
 
+    const size_t first_entity_bin_index = this->getEntityIndex( entity_id )*
+      this->getNumberOfBins()*this->getNumberOfResponseFunctions();
+
     for( size_t r = 0; r < this->getNumberOfResponseFunctions(); ++r )
     {
       this->calculateBinIndicesOfPoint( particle_state_wrapper,
@@ -799,8 +817,7 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
       for( size_t i = 0; i < bin_indices.size(); ++i )
       {
         this->addInfoToUpdateTracker( thread_id,
-                                      entity_id,
-                                      bin_indices[i],
+                                      first_entity_bin_index + bin_indices[i],
                                       processed_contribution );
       }
 
@@ -838,6 +855,9 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
     typename ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray
       bin_indices_and_weights;
 
+    const size_t first_entity_bin_index = this->getEntityIndex( entity_id )*
+      this->getNumberOfBins()*this->getNumberOfResponseFunctions();
+
     this->calculateBinIndicesAndWeightsOfRange( particle_state_wrapper,
                                                 0,
                                                 bin_indices_and_weights );
@@ -857,8 +877,7 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
           Utility::get<0>( bin_indices_and_weights[i] ) + bin_index_shift;
 
         this->addInfoToUpdateTracker( thread_id,
-                                      entity_id,
-                                      complete_bin_index,
+                                      first_entity_bin_index + complete_bin_index,
                                       processed_contribution );
       }
     }
@@ -879,89 +898,49 @@ StandardEntityEstimator::getTotalData() const
   return d_total_estimator_moments;
 }
 
-// Get the total data for an entity
-/*! \details This function breaks encapsulation and is therefore not ideal.
- * It is needed by mesh estimators for exporting data in .h5m and .vtk formats.
- */
-const Estimator::FourEstimatorMomentsCollection&
-StandardEntityEstimator::getEntityTotalData( const EntityId entity_id ) const
+// Resize the entity total estimator collections
+void StandardEntityEstimator::resizeEntityTotalEstimatorCollections()
 {
-  // Make sure the entity is valid
-  testPrecondition( d_entity_total_estimator_moments_map.find( entity_id ) !=
-		    d_entity_total_estimator_moments_map.end() );
+  const size_t size =
+    this->getNumberOfEntities()*this->getNumberOfResponseFunctions();
 
-  return d_entity_total_estimator_moments_map.find( entity_id )->second;
-}
+  d_entity_total_estimator_moments.resize( size );
 
-// Resize the entity total estimator moments map arrays
-void StandardEntityEstimator::resizeEntityTotalEstimatorMomentsMapCollections()
-{
-  size_t size = this->getNumberOfResponseFunctions();
-  
-  for( auto&& entity_data : d_entity_total_estimator_moments_map )
-    entity_data.second.resize( size );
-
-  for( auto&& entity_data : d_entity_total_estimator_moment_snapshots_map )
-    entity_data.second.resize( size );
+  d_entity_total_estimator_moment_snapshots.resize( size );
 
   Utility::SampleMomentHistogram<double>
     default_histogram( this->getSampleMomentHistogramBins() );
 
-  for( auto&& entity_data : d_entity_total_estimator_histograms_map )
-    entity_data.second.resize( size, default_histogram );
+  d_entity_total_estimator_histograms.resize( size, default_histogram );
 }
 
 // Commit hist. contr. to the total for a response function of an entity
 void StandardEntityEstimator::commitHistoryContributionToTotalOfEntity(
-					const EntityId entity_id,
+					const size_t entity_index,
 					const size_t response_function_index,
 					const double contribution )
 {
-  // Make sure the entity is assigned to this estimator
-  testPrecondition( this->isEntityAssigned( entity_id ) );
+  // Make sure the entity index is valid
+  testPrecondition( entity_index < this->getNumberOfEntities() );
   // Make sure the response function index is valid
   testPrecondition( response_function_index <
 		    this->getNumberOfResponseFunctions() );
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Estimator::FourEstimatorMomentsCollection&
-    entity_total_estimator_moments_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
+  const size_t entity_total_index =
+    entity_index*this->getNumberOfResponseFunctions() +
+    response_function_index;
 
-  // Update the moments
-  #pragma omp critical
-  {
-    entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
-  }
+  // Update the moments (atomically)
+  d_entity_total_estimator_moments.addRawScoreAtomic( entity_total_index,
+                                                      contribution );
 
-  this->addHistoryContributionToEntityBinHistogram( entity_id, response_function_index, contribution );
+  // Update the histogram (atomically)
+  d_entity_total_estimator_histograms[entity_total_index].addRawScoreAtomic(
+                                                                contribution );
 }
 
-// Add contribution to entity bin histogram
-void StandardEntityEstimator::addHistoryContributionToEntityBinHistogram(
-                                          const EntityId entity_id,
-                                          const size_t response_function_index,
-                                          const double contribution )
-{
-  // Make sure the entity is assigned to this estimator
-  testPrecondition( this->isEntityAssigned( entity_id ) );
-  // Make sure the response function index is valid
-  testPrecondition( response_function_index <
-		    this->getNumberOfResponseFunctions() );
-  // Make sure the contribution is valid
-  testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
-
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
-
-  // Update the histogram
-  #pragma omp critical
-  {
-    histogram.addRawScore( contribution );
-  }
-}  
-
 // Commit history contr. to the total for a response function of an estimator
 void StandardEntityEstimator::commitHistoryContributionToTotalOfEstimator(
 					const size_t response_function_index,
@@ -973,92 +952,99 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEstimator(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  // Update the moments
-  #pragma omp critical
-  {
-    d_total_estimator_moments.addRawScore( response_function_index, contribution );
-  }
+  // Update the moments (atomically)
+  d_total_estimator_moments.addRawScoreAtomic( response_function_index, contribution );
 
-  this->addHistoryContributionToTotalBinHistogram( response_function_index,
-                                                   contribution );
-}
-
-// Add contribution to total bin histogram
-void StandardEntityEstimator::addHistoryContributionToTotalBinHistogram(
-                                          const size_t response_function_index,
-                                          const double contribution )
-{
-  // Make sure the response function index is valid
-  testPrecondition( response_function_index <
-		    this->getNumberOfResponseFunctions() );
-  // Make sure the contribution is valid
-  testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
-
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_total_estimator_histograms[response_function_index];
-  
-  // Update the histogram
-  #pragma omp critical
-  {
-    histogram.addRawScore( contribution );
-  }
+  // Update the histogram (atomically)
+  d_total_estimator_histograms[response_function_index].addRawScoreAtomic(
+                                                                contribution );
 }
 
 // Add info to update tracker
+/*! \details Contributions are simply appended to the thread's contribution
+ * list (the capacity of the list is retained between histories). Repeated
+ * contributions to the same entity bin are only combined when the history
+ * contribution is committed.
+ */
 void StandardEntityEstimator::addInfoToUpdateTracker(
-						    const size_t thread_id,
-						    const EntityId entity_id,
-						    const size_t bin_index,
-						    const double contribution )
+						 const size_t thread_id,
+						 const size_t entity_bin_index,
+						 const double contribution )
 {
   // Make sure the thread id is valid
   testPrecondition( thread_id < d_update_tracker.size() );
 
-  BinContributionMap& thread_entity_bin_contribution_map =
-    d_update_tracker[thread_id][entity_id];
+  std::vector<EntityBinContribution>& entity_bin_contributions =
+    d_update_tracker[thread_id].entity_bin_contributions;
 
-  BinContributionMap::iterator entity_bin_data =
-    thread_entity_bin_contribution_map.find( bin_index );
+  EntityBinContribution entity_bin_contribution;
+  entity_bin_contribution.entity_bin_index = entity_bin_index;
+  entity_bin_contribution.order = entity_bin_contributions.size();
+  entity_bin_contribution.contribution = contribution;
 
-  if( entity_bin_data != thread_entity_bin_contribution_map.end() )
-    entity_bin_data->second += contribution;
-  else
-    thread_entity_bin_contribution_map[bin_index] = contribution;
+  entity_bin_contributions.push_back( entity_bin_contribution );
 }
 
-// Get the bin iterator from an update tracker iterator
-void StandardEntityEstimator::getEntityIteratorFromUpdateTracker(
-              const size_t thread_id,
-	      typename SerialUpdateTracker::const_iterator& start_entity,
-	      typename SerialUpdateTracker::const_iterator& end_entity ) const
+// Merge the update tracker contributions to each bin
+/*! \details After merging, the contributions will be sorted by bin index and
+ * each bin will only appear once. The contributions are sorted in place by
+ * bin index and then by order so that the contributions to a bin are summed
+ * in the order that they were added without the temporary buffer that a
+ * stable sort requires.
+ */
+void StandardEntityEstimator::mergeUpdateTrackerContributions(
+               std::vector<EntityBinContribution>& entity_bin_contributions )
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  if( entity_bin_contributions.size() > 1 )
+  {
+    std::sort( entity_bin_contributions.begin(),
+               entity_bin_contributions.end(),
+               []( const EntityBinContribution& a,
+                   const EntityBinContribution& b )
+               {
+                 return a.entity_bin_index < b.entity_bin_index ||
+                   (a.entity_bin_index == b.entity_bin_index &&
+                    a.order < b.order);
+               } );
+
+    // Combine the contributions to the same bin
+    size_t merged_size = 0;
+
+    for( size_t i = 1; i < entity_bin_contributions.size(); ++i )
+    {
+      EntityBinContribution& merged_contribution =
+        entity_bin_contributions[merged_size];
 
-  start_entity = d_update_tracker[thread_id].begin();
-  end_entity = d_update_tracker[thread_id].end();
-}
+      const EntityBinContribution& contribution =
+        entity_bin_contributions[i];
 
-// Get the bin iterator from an update tracker iterator
-void StandardEntityEstimator::getBinIteratorFromUpdateTrackerIterator(
-           const size_t thread_id,
-	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
-	   BinContributionMap::const_iterator& start_bin,
-	   BinContributionMap::const_iterator& end_bin ) const
-{
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
-  // Make sure the entity iterator is valid
-  testPrecondition( entity_iterator != d_update_tracker[thread_id].end() );
+      if( contribution.entity_bin_index ==
+          merged_contribution.entity_bin_index )
+      {
+        merged_contribution.contribution += contribution.contribution;
+      }
+      else
+      {
+        ++merged_size;
 
-  start_bin = entity_iterator->second.begin();
-  end_bin = entity_iterator->second.end();
+        entity_bin_contributions[merged_size] = contribution;
+      }
+    }
+
+    entity_bin_contributions.resize( merged_size+1 );
+  }
 }
 
 // Reset the update tracker
+/*! \details The update tracker contribution list is cleared but its
+ * capacity is retained so that subsequent histories do not need to allocate.
+ */
 void StandardEntityEstimator::resetUpdateTracker( const size_t thread_id )
 {
-  d_update_tracker[thread_id].clear();
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_update_tracker.size() );
+
+  d_update_tracker[thread_id].entity_bin_contributions.clear();
 }
 
 EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::StandardEntityEstimator );
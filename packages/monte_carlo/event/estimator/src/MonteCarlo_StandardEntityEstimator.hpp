@@ -19,18 +19,40 @@ namespace MonteCarlo{
 
 /*! The standard entity estimator class
  * \details This class has been set up to get correct results with multiple
- * threads. However, the commitHistoryContribution member function call should
- * only appear within an omp critical block. Use the enable thread support
- * member function to set up an instance of this class for the requested number
- * of threads. The classes default initialization is for a single thread.
+ * threads. The commitHistoryContribution member function can be called
+ * concurrently since the moments are updated atomically. Use the enable
+ * thread support member function to set up an instance of this class for the
+ * requested number of threads. The classes default initialization is for a
+ * single thread. Partial history contributions are appended to a flat
+ * per-thread list of the touched entity bins so that the cost of an update
+ * does not depend on the number of entities (e.g. mesh elements) assigned to
+ * the estimator. The entity totals are stored in a single collection at
+ * entity_index*response_functions+response_function.
  */
 class StandardEntityEstimator : public EntityEstimator
 {
-  // Typedef for bin contribution map
-  typedef std::unordered_map<size_t,double> BinContributionMap;
+  // The partial history contribution to an entity bin
+  struct EntityBinContribution
+  {
+    // The entity bin index (entity_index*bins+bin)
+    size_t entity_bin_index;
 
-  // Typedef for serial update tracker
-  typedef std::unordered_map<EntityId,BinContributionMap> SerialUpdateTracker;
+    // The order that the contribution was added in
+    size_t order;
+
+    // The contribution
+    double contribution;
+  };
+
+  // The serial update tracker
+  struct SerialUpdateTracker
+  {
+    // The partial history contributions to the entity bins
+    std::vector<EntityBinContribution> entity_bin_contributions;
+
+    // The history contributions to the total of each response function
+    std::vector<double> response_function_totals;
+  };
 
   // Typedef for parallel update tracker
   typedef std::vector<SerialUpdateTracker> ParallelUpdateTracker;
@@ -180,7 +202,7 @@ public:
   void commitHistoryContribution() final override;
 
   //! Enable support for multiple threads
-  void enableThreadSupport( const unsigned num_threads ) final override;
+  void enableThreadSupport( const unsigned num_threads ) override;
 
   //! Reset estimator data
   void resetData() final override;
@@ -225,18 +247,14 @@ protected:
   //! Get the total estimator data
   const Estimator::FourEstimatorMomentsCollection& getTotalData() const;
 
-  //! Get the total data for an entity
-  const Estimator::FourEstimatorMomentsCollection&
-  getEntityTotalData( const EntityId entity_id ) const;
-
 private:
 
-  // Resize the entity total estimator moments map collections
-  void resizeEntityTotalEstimatorMomentsMapCollections();
+  // Resize the entity total estimator collections
+  void resizeEntityTotalEstimatorCollections();
 
   // Commit history contr. to the total for a response function of an entity
   void commitHistoryContributionToTotalOfEntity(
-					const EntityId entity_id,
+					const size_t entity_index,
 					const size_t response_function_index,
 					const double contribution );
 
@@ -245,39 +263,14 @@ private:
 					const size_t response_function_index,
 					const double contribution );
 
-  // Add contribution to entity bin histogram
-  void addHistoryContributionToEntityBinHistogram(
-                                          const EntityId entity_id,
-                                          const size_t response_function_index,
-                                          const double contribution );
-
-  // Add contribution to total bin histogram
-  void addHistoryContributionToTotalBinHistogram(
-                                          const size_t response_function_index,
-                                          const double contribution );
-
-  // Initialize the moments maps
-  template<typename InputEntityId>
-  void initializeMomentsMaps( const std::vector<InputEntityId>& entity_ids );
-
   // Add info to update tracker
   void addInfoToUpdateTracker( const size_t thread_id,
-                               const EntityId entity_id,
-                               const size_t bin_index,
+                               const size_t entity_bin_index,
                                const double contribution );
 
-  // Get entity iterators from update tracker
-  void getEntityIteratorFromUpdateTracker(
-	      const size_t thread_id,
-	      typename SerialUpdateTracker::const_iterator& start_entity,
-	      typename SerialUpdateTracker::const_iterator& end_entity ) const;
-
-  // Get the bin iterator from an update tracker iterator
-  void getBinIteratorFromUpdateTrackerIterator(
-	   const size_t thread_id,
-	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
-	   BinContributionMap::const_iterator& start_bin,
-	   BinContributionMap::const_iterator& end_bin ) const;
+  // Merge the update tracker contributions to each bin
+  static void mergeUpdateTrackerContributions(
+              std::vector<EntityBinContribution>& entity_bin_contributions );
 
   // Reset the update tracker
   void resetUpdateTracker( const size_t thread_id );
@@ -298,20 +291,23 @@ private:
   // The total estimator moments across all entities and response functions
   Estimator::FourEstimatorMomentsCollection d_total_estimator_moments;
 
-  // The total estimator moments for each entity and response functions
-  EntityEstimatorMomentsCollectionMap d_entity_total_estimator_moments_map;
+  // The total estimator moments for each entity and response function
+  // (stored at entity_index*response_functions+response_function)
+  Estimator::FourEstimatorMomentsCollection d_entity_total_estimator_moments;
 
   // The total estimator moment snapshots across all entities and resp. funcs.
   Estimator::FourEstimatorMomentsCollectionSnapshots d_total_estimator_moment_snapshots;
 
   // The total estimator moment snapshots for each entity and response func.
-  EntityEstimatorMomentsCollectionSnapshotsMap d_entity_total_estimator_moment_snapshots_map;
+  // (stored at entity_index*response_functions+response_function)
+  Estimator::FourEstimatorMomentsCollectionSnapshots d_entity_total_estimator_moment_snapshots;
 
   // The sample moment histograms across all entities and response functions
   SampleMomentHistogramArray d_total_estimator_histograms;
 
   // The total estimator moment histograms for each entity and response func.
-  EntityEstimatorSampleMomentHistogramArrayMap d_entity_total_estimator_histograms_map;
+  // (stored at entity_index*response_functions+response_function)
+  SampleMomentHistogramArray d_entity_total_estimator_histograms;
 
   // The entities/bins that have been updated
   ParallelUpdateTracker d_update_tracker;
@@ -319,7 +315,7 @@ private:
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( StandardEntityEstimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( StandardEntityEstimator, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes.
@@ -20,14 +20,14 @@ StandardEntityEstimator::StandardEntityEstimator(
                              const std::vector<double>& entity_norm_constants )
   : EntityEstimator( id, multiplier, entity_ids, entity_norm_constants ),
     d_total_estimator_moments( 1 ),
-    d_entity_total_estimator_moments_map(),
+    d_entity_total_estimator_moments(),
     d_total_estimator_moment_snapshots( 1 ),
-    d_entity_total_estimator_moment_snapshots_map(),
+    d_entity_total_estimator_moment_snapshots(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
-    d_entity_total_estimator_histograms_map(),
+    d_entity_total_estimator_histograms(),
     d_update_tracker( 1 )
 {
-  this->initializeMomentsMaps( entity_ids );
+  this->resizeEntityTotalEstimatorCollections();
 }
 
 // Constructor (for non-flux estimators)
@@ -38,42 +38,14 @@ StandardEntityEstimator::StandardEntityEstimator(
                                  const std::vector<InputEntityId>& entity_ids )
   : EntityEstimator( id, multiplier, entity_ids ),
     d_total_estimator_moments( 1 ),
-    d_entity_total_estimator_moments_map(),
+    d_entity_total_estimator_moments(),
     d_total_estimator_moment_snapshots( 1 ),
-    d_entity_total_estimator_moment_snapshots_map(),
+    d_entity_total_estimator_moment_snapshots(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
-    d_entity_total_estimator_histograms_map(),
+    d_entity_total_estimator_histograms(),
     d_update_tracker( 1 )
 {
-  this->initializeMomentsMaps( entity_ids );
-}
-
-// Initialize the moments maps
-template<typename InputEntityId>
-void StandardEntityEstimator::initializeMomentsMaps(
-                                 const std::vector<InputEntityId>& entity_ids )
-{
-  // Set up the entity maps
-  for( size_t i = 0; i < entity_ids.size(); ++i )
-  {
-    // Ignore duplicate entity ids
-    if( d_entity_total_estimator_moments_map.find( entity_ids[i] ) ==
-        d_entity_total_estimator_moments_map.end() )
-    {
-      d_entity_total_estimator_moments_map[entity_ids[i]].resize(
-				        this->getNumberOfResponseFunctions() );
-
-      d_entity_total_estimator_moment_snapshots_map[entity_ids[i]].resize(
-                                        this->getNumberOfResponseFunctions() );
-
-      Utility::SampleMomentHistogram<double>
-        default_histogram( this->getSampleMomentHistogramBins() );
-
-      d_entity_total_estimator_histograms_map[entity_ids[i]].resize(
-                                          this->getNumberOfResponseFunctions(),
-                                          default_histogram );
-    }
-  }
+  this->resizeEntityTotalEstimatorCollections();
 }
 
 // Save the data to an archive
@@ -85,14 +57,17 @@ void StandardEntityEstimator::save( Archive& ar, const unsigned version ) const
 
   // Save the local data
   ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moments );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moments_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moments );
   ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moment_snapshots );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moment_snapshots_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moment_snapshots );
   ar & BOOST_SERIALIZATION_NVP( d_total_estimator_histograms );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_histograms_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_histograms );
 }
 
 // Load the data from an archive
+/*! \details Version 0 archives store the entity total data in maps. The
+ * maps will be packed into the single entity total collections.
+ */
 template<typename Archive>
 void StandardEntityEstimator::load( Archive& ar, const unsigned version )
 {
@@ -101,11 +76,46 @@ void StandardEntityEstimator::load( Archive& ar, const unsigned version )
 
   // Load the local data
   ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moments );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moments_map );
-  ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moment_snapshots );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moment_snapshots_map );
-  ar & BOOST_SERIALIZATION_NVP( d_total_estimator_histograms );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_histograms_map );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moments );
+    ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moment_snapshots );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moment_snapshots );
+    ar & BOOST_SERIALIZATION_NVP( d_total_estimator_histograms );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_histograms );
+  }
+  else
+  {
+    EntityEstimatorMomentsCollectionMap entity_moments_map;
+    EntityEstimatorMomentsCollectionSnapshotsMap entity_snapshots_map;
+    EntityEstimatorSampleMomentHistogramArrayMap entity_histograms_map;
+
+    ar & boost::serialization::make_nvp( "d_entity_total_estimator_moments_map", entity_moments_map );
+    ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moment_snapshots );
+    ar & boost::serialization::make_nvp( "d_entity_total_estimator_moment_snapshots_map", entity_snapshots_map );
+    ar & BOOST_SERIALIZATION_NVP( d_total_estimator_histograms );
+    ar & boost::serialization::make_nvp( "d_entity_total_estimator_histograms_map", entity_histograms_map );
+
+    // The streamed snapshots of each entity have their own file id
+    TEST_FOR_EXCEPTION( this->isSnapshotDataStreamed(),
+                        std::runtime_error,
+                        "Estimator " << this->getId() << " cannot be loaded "
+                        "because it was archived with streamed entity total "
+                        "snapshots by an older version!" );
+
+    this->packEntityCollectionMap( entity_moments_map,
+                                   this->getNumberOfResponseFunctions(),
+                                   d_entity_total_estimator_moments );
+
+    this->packEntitySnapshotMap( entity_snapshots_map,
+                                 this->getNumberOfResponseFunctions(),
+                                 d_entity_total_estimator_moment_snapshots );
+
+    this->packEntityHistogramMap( entity_histograms_map,
+                                  this->getNumberOfResponseFunctions(),
+                                  d_entity_total_estimator_histograms );
+  }
 
   // Initialize the thread data
   d_update_tracker.resize( 1 );
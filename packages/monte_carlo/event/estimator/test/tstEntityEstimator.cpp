@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <numeric>
 
 // FRENSIE Includes
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -1661,6 +1662,54 @@ FRENSIE_UNIT_TEST( EntityEstimator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that no history contributions are lost when the threads commit
+// contributions concurrently
+FRENSIE_UNIT_TEST( EntityEstimator, commitHistoryContribution_concurrent )
+{
+  std::shared_ptr<TestEntityEstimator> entity_estimator;
+  initializeEntityEstimator( entity_estimator, true );
+
+  const size_t num_estimator_bins = entity_estimator->getNumberOfBins()*
+    entity_estimator->getNumberOfResponseFunctions();
+
+  const int histories = 10000;
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( int history = 0; history < histories; ++history )
+  {
+    const size_t bin_index = history % num_estimator_bins;
+
+    entity_estimator->commitHistoryContributionToBinOfEntity( history % 5,
+                                                              bin_index,
+                                                              1.0 );
+    entity_estimator->commitHistoryContributionToBinOfTotal( bin_index, 1.0 );
+  }
+
+  Utility::ArrayView<const double> total_bin_first_moments =
+    entity_estimator->getTotalBinDataFirstMoments();
+
+  FRENSIE_CHECK_EQUAL( std::accumulate( total_bin_first_moments.begin(),
+                                        total_bin_first_moments.end(),
+                                        0.0 ),
+                       (double)histories );
+
+  double entity_first_moment_sum = 0.0;
+
+  for( uint64_t entity_id = 0; entity_id < 5; ++entity_id )
+  {
+    Utility::ArrayView<const double> entity_bin_first_moments =
+      entity_estimator->getEntityBinDataFirstMoments( entity_id );
+
+    entity_first_moment_sum +=
+      std::accumulate( entity_bin_first_moments.begin(),
+                       entity_bin_first_moments.end(),
+                       0.0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( entity_first_moment_sum, (double)histories );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a history contribution can be committed to a bin of the total
 FRENSIE_UNIT_TEST( EntityEstimator,
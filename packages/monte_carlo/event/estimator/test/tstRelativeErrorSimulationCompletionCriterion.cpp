@@ -0,0 +1,261 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstRelativeErrorSimulationCompletionCriterion.cpp
+//! \author Alex Robinson
+//! \brief  Relative error simulation completion criterion unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_RelativeErrorSimulationCompletionCriterion.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+typedef MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier>
+TestEstimator;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create an estimator with two cells (only cell 0 will be scored in)
+std::shared_ptr<TestEstimator> createEstimator()
+{
+  std::vector<MonteCarlo::StandardCellEstimator::CellIdType>
+    cell_ids( {0, 1} );
+
+  std::vector<double> cell_norm_consts( {1.0, 1.0} );
+
+  std::shared_ptr<TestEstimator> estimator(
+                    new TestEstimator( 0u, 1.0, cell_ids, cell_norm_consts ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::ELECTRON} ) );
+
+  return estimator;
+}
+
+// Simulate histories with alternating weights of 1.0 and 3.0
+/*! \details The relative error of cell 0 after n histories (n even) will be
+ * 0.5/sqrt(n-1).
+ */
+void simulateHistories( TestEstimator& estimator, const size_t num_histories )
+{
+  MonteCarlo::ElectronState particle( 0ull );
+  particle.setEnergy( 1.0 );
+
+  for( size_t i = 0; i < num_histories; ++i )
+  {
+    particle.setWeight( i%2 == 0 ? 1.0 : 3.0 );
+
+    estimator.updateFromParticleCollidingInCellEvent( particle, 0, 1.0 );
+    estimator.commitHistoryContribution();
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that targets can be added
+FRENSIE_UNIT_TEST( RelativeErrorSimulationCompletionCriterion,
+                   addEstimatorEntityBinTarget )
+{
+  std::shared_ptr<TestEstimator> estimator = createEstimator();
+
+  MonteCarlo::RelativeErrorSimulationCompletionCriterion criterion;
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfTargets(), 0 );
+
+  FRENSIE_CHECK_NO_THROW( criterion.addEstimatorEntityBinTarget( estimator, 0, 0, 0.1 ) );
+  FRENSIE_CHECK_NO_THROW( criterion.addEstimatorEntityBinTarget( estimator, 1, 0, 0.1, 0.05 ) );
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfTargets(), 2 );
+
+  // Unassigned entity
+  FRENSIE_CHECK_THROW( criterion.addEstimatorEntityBinTarget( estimator, 2, 0, 0.1 ),
+                       std::runtime_error );
+
+  // Invalid bin
+  FRENSIE_CHECK_THROW( criterion.addEstimatorEntityBinTarget( estimator, 0, 1, 0.1 ),
+                       std::runtime_error );
+
+  // Invalid targets
+  FRENSIE_CHECK_THROW( criterion.addEstimatorEntityBinTarget( estimator, 0, 0, 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( criterion.addEstimatorEntityBinTarget( estimator, 0, 0, 0.1, 0.0 ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfTargets(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the criterion can be satisfied
+FRENSIE_UNIT_TEST( RelativeErrorSimulationCompletionCriterion,
+                   isSimulationComplete )
+{
+  std::shared_ptr<TestEstimator> estimator = createEstimator();
+
+  MonteCarlo::RelativeErrorSimulationCompletionCriterion criterion;
+
+  // A criterion without targets is never satisfied
+  criterion.takeSnapshot( 10, 1.0 );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  criterion.resetData();
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfSampledHistories(), 0 );
+  FRENSIE_CHECK_EQUAL( criterion.getSamplingTime(), 0.0 );
+
+  criterion.addEstimatorEntityBinTarget( estimator, 0, 0, 0.1 );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  // RE = 0.5/sqrt(9) > 0.1
+  simulateHistories( *estimator, 10 );
+  criterion.takeSnapshot( 10, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfSampledHistories(), 10 );
+  FRENSIE_CHECK_EQUAL( criterion.getSamplingTime(), 1.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( criterion.getLargestRelativeErrorRatio(),
+                                   5.0/3.0,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( criterion.getEstimatedTimeToCompletion(),
+                                   16.0/9.0,
+                                   1e-12 );
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  // RE = 0.5/sqrt(29) < 0.1
+  simulateHistories( *estimator, 20 );
+  criterion.takeSnapshot( 20, 2.0 );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfSampledHistories(), 30 );
+  FRENSIE_CHECK_EQUAL( criterion.getSamplingTime(), 3.0 );
+  FRENSIE_CHECK_EQUAL( criterion.getEstimatedTimeToCompletion(), 0.0 );
+  FRENSIE_CHECK( criterion.isSimulationComplete() );
+
+  // A bin that has not been scored in will never be converged
+  criterion.addEstimatorEntityBinTarget( estimator, 1, 0, 0.1 );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  FRENSIE_CHECK_EQUAL( criterion.getEstimatedTimeToCompletion(),
+                       std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the minimum number of histories must be sampled
+FRENSIE_UNIT_TEST( RelativeErrorSimulationCompletionCriterion,
+                   isSimulationComplete_minimum_histories )
+{
+  std::shared_ptr<TestEstimator> estimator = createEstimator();
+
+  MonteCarlo::RelativeErrorSimulationCompletionCriterion criterion( 40 );
+
+  criterion.addEstimatorEntityBinTarget( estimator, 0, 0, 0.1 );
+
+  simulateHistories( *estimator, 30 );
+  criterion.takeSnapshot( 30, 1.0 );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  simulateHistories( *estimator, 10 );
+  criterion.takeSnapshot( 10, 1.0 );
+
+  FRENSIE_CHECK( criterion.isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the criterion can be combined with other criteria
+FRENSIE_UNIT_TEST( RelativeErrorSimulationCompletionCriterion,
+                   combined_criterion )
+{
+  std::shared_ptr<TestEstimator> estimator = createEstimator();
+
+  std::shared_ptr<MonteCarlo::RelativeErrorSimulationCompletionCriterion>
+    re_criterion( new MonteCarlo::RelativeErrorSimulationCompletionCriterion );
+
+  re_criterion->addEstimatorEntityBinTarget( estimator, 0, 0, 0.1 );
+
+  std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+    criterion = MonteCarlo::ParticleHistorySimulationCompletionCriterion::createHistoryCountCriterion( 100 ) || std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>( re_criterion );
+
+  criterion->start();
+
+  // The snapshots must be forwarded to the relative error criterion
+  simulateHistories( *estimator, 30 );
+  criterion->takeSnapshot( 30, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( re_criterion->getNumberOfSampledHistories(), 30 );
+  FRENSIE_CHECK( criterion->isSimulationComplete() );
+
+  criterion->stop();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the criterion can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( RelativeErrorSimulationCompletionCriterion,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_relative_error_simulation_completion_criterion" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<TestEstimator> estimator = createEstimator();
+
+    std::shared_ptr<MonteCarlo::RelativeErrorSimulationCompletionCriterion>
+      criterion( new MonteCarlo::RelativeErrorSimulationCompletionCriterion( 20 ) );
+
+    criterion->addEstimatorEntityBinTarget( estimator, 0, 0, 0.1 );
+
+    simulateHistories( *estimator, 30 );
+    criterion->takeSnapshot( 30, 1.0 );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( criterion ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived criterion
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::RelativeErrorSimulationCompletionCriterion>
+    criterion;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( criterion ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfTargets(), 1 );
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfSampledHistories(), 30 );
+  FRENSIE_CHECK_EQUAL( criterion->getSamplingTime(), 1.0 );
+  FRENSIE_CHECK( criterion->isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstRelativeErrorSimulationCompletionCriterion.cpp
+//---------------------------------------------------------------------------//
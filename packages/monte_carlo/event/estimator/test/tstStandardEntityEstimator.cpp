@@ -2354,6 +2354,104 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that repeated contributions to the same bins of different entities
+// are combined before they are committed
+FRENSIE_UNIT_TEST( StandardEntityEstimator,
+                   commitHistoryContribution_repeated_bins )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+  // bin 0 (E=0, Mu=0, T=0, Col=0)
+  particle.setEnergy( 1e-2 );
+  particle_wrapper.setAngleCosine( -0.5 );
+  particle.setTime( 5e-6 );
+
+  estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+  estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+  estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 2.0 );
+
+  // bin 1 (E=1, Mu=0, T=0, Col=0)
+  particle.setEnergy( 0.11 );
+
+  estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 2.0 );
+
+  // bin 0 (E=0, Mu=0, T=0, Col=0)
+  particle.setEnergy( 1e-2 );
+
+  estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 3.0 );
+
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  // Check the entity bin data moments
+  std::vector<double> expected_first_moments( 32, 0.0 );
+  std::vector<double> expected_second_moments( 32, 0.0 );
+  expected_first_moments[0] = 4.0;
+  expected_first_moments[1] = 2.0;
+  expected_first_moments[16] = 4.0;
+  expected_first_moments[17] = 2.0;
+  expected_second_moments[0] = 16.0;
+  expected_second_moments[1] = 4.0;
+  expected_second_moments[16] = 16.0;
+  expected_second_moments[17] = 4.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                       expected_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 0 ),
+                       expected_second_moments );
+
+  expected_first_moments.assign( 32, 0.0 );
+  expected_second_moments.assign( 32, 0.0 );
+  expected_first_moments[0] = 3.0;
+  expected_first_moments[16] = 3.0;
+  expected_second_moments[0] = 9.0;
+  expected_second_moments[16] = 9.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1 ),
+                       expected_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 1 ),
+                       expected_second_moments );
+
+  // Check the total bin data moments
+  expected_first_moments.assign( 32, 0.0 );
+  expected_second_moments.assign( 32, 0.0 );
+  expected_first_moments[0] = 7.0;
+  expected_first_moments[1] = 2.0;
+  expected_first_moments[16] = 7.0;
+  expected_first_moments[17] = 2.0;
+  expected_second_moments[0] = 49.0;
+  expected_second_moments[1] = 4.0;
+  expected_second_moments[16] = 49.0;
+  expected_second_moments[17] = 4.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       expected_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataSecondMoments(),
+                       expected_second_moments );
+
+  // Check the entity total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 0 ),
+                       std::vector<double>( 2, 6.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 0 ),
+                       std::vector<double>( 2, 36.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 1 ),
+                       std::vector<double>( 2, 3.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 1 ),
+                       std::vector<double>( 2, 9.0 ) );
+
+  // Check the total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 9.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataSecondMoments(),
+                       std::vector<double>( 2, 81.0 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a snapshot of the estimator state can be made
 FRENSIE_UNIT_TEST( StandardEntityEstimator, takeSnapshot_no_bin_snapshots )
@@ -3104,6 +3202,200 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator, takeSnapshot_with_bin_snapshots )
   FRENSIE_CHECK_FLOATING_EQUALITY( processed_snapshots["fom"], std::vector<double>( {0.5, 0.5625} ), 1e-15 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the snapshots of the estimator state can be streamed to a file
+FRENSIE_UNIT_TEST( StandardEntityEstimator, takeSnapshot_streamed )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  estimator->enableSnapshotsOnEntityBins();
+
+  // Only the process with rank 0 writes to the file - the other processes
+  // keep their snapshots in memory until they are reduced
+  estimator->setSnapshotDataOutputFile( "test_standard_entity_estimator_snapshots.snap" );
+
+  FRENSIE_CHECK( estimator->isSnapshotDataStreamed() );
+  FRENSIE_CHECK_EQUAL( estimator->getSnapshotDataOutputFileName().string(),
+                       "test_standard_entity_estimator_snapshots.snap" );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    // bin 0 (E=0, Mu=0, T=0, Col=0)
+    MonteCarlo::PhotonState particle( 0ull );
+    MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+  
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-6 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 1 (E=1, Mu=0, T=0, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 2 (E=0, Mu=1, T=0, Col=0)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 3 (E=1, Mu=1, T=0, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 4 (E=0, Mu=0, T=1, Col=0)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 5 (E=1, Mu=0, T=1, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 6 (E=0, Mu=1, T=1, Col=0)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 7 (E=1, Mu=1, T=1, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 8 (E=0, Mu=0, T=0, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-6 );
+    particle.incrementCollisionNumber();
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 9 (E=1, Mu=0, T=0, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 10 (E=0, Mu=1, T=0, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 11 (E=1, Mu=1, T=0, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 12 (E=0, Mu=0, T=1, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 13 (E=1, Mu=0, T=1, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 14 (E=0, Mu=1, T=1, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 15 (E=1, Mu=1, T=1, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+    // Commit the contributions
+    estimator->commitHistoryContribution();
+
+    // Take a snapshot
+    estimator->takeSnapshot( 5, 2.0 );
+  }
+
+  // Check the entity bin moment snapshots
+  std::vector<uint64_t> history_values;
+  std::vector<double> sampling_times;
+
+  std::vector<double> first_moments, second_moments, third_moments,
+    fourth_moments;
+
+  estimator->getEntityBinMomentSnapshotHistoryValues( 1, history_values );
+  estimator->getEntityBinMomentSnapshotSamplingTimes( 1, sampling_times );
+
+  FRENSIE_CHECK_EQUAL( history_values, std::vector<uint64_t>({5, 10}) );
+  FRENSIE_CHECK_EQUAL( sampling_times, std::vector<double>({2.0, 4.0}) );
+
+  size_t num_estimator_bins = estimator->getNumberOfBins()*
+    estimator->getNumberOfResponseFunctions();
+
+  for( size_t j = 0; j < num_estimator_bins; ++j )
+  {
+    estimator->getEntityBinFirstMomentSnapshots( 1, j, first_moments );
+    estimator->getEntityBinFourthMomentSnapshots( 1, j, fourth_moments );
+
+    FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>({1.0, 2.0}) );
+    FRENSIE_CHECK_EQUAL( fourth_moments, std::vector<double>({1.0, 2.0}) );
+
+    estimator->getTotalBinSecondMomentSnapshots( j, second_moments );
+    estimator->getTotalBinThirdMomentSnapshots( j, third_moments );
+
+    FRENSIE_CHECK_EQUAL( second_moments, std::vector<double>({4.0, 8.0}) );
+    FRENSIE_CHECK_EQUAL( third_moments, std::vector<double>({8.0, 16.0}) );
+  }
+
+  // Check the entity total moment snapshots
+  estimator->getEntityTotalMomentSnapshotHistoryValues( 0, history_values );
+  estimator->getEntityTotalMomentSnapshotSamplingTimes( 0, sampling_times );
+
+  FRENSIE_CHECK_EQUAL( history_values, std::vector<uint64_t>( {5, 10} ) );
+  FRENSIE_CHECK_EQUAL( sampling_times, std::vector<double>( {2.0, 4.0} ) );
+
+  estimator->getEntityTotalFirstMomentSnapshots( 0, 1, first_moments );
+  estimator->getEntityTotalSecondMomentSnapshots( 0, 1, second_moments );
+
+  FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {16.0, 32.0} )  );
+  FRENSIE_CHECK_EQUAL( second_moments, std::vector<double>( {256, 512} ) );
+
+  // Check the total processed snapshots
+  std::vector<double> mean_snapshots, re_snapshots, vov_snapshots,
+    fom_snapshots;
+
+  estimator->getTotalProcessedSnapshots( 0, mean_snapshots, re_snapshots, vov_snapshots, fom_snapshots );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( mean_snapshots, std::vector<double>( {64.0/3, 64.0/3} ), 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( re_snapshots, std::vector<double>( {1.0, 2.0/3} ), 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( vov_snapshots, std::vector<double>( {0.45, 0.225} ), 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( fom_snapshots, std::vector<double>( {0.5, 0.5625} ), 1e-15 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a partial history contribution can be added to the estimator
 FRENSIE_UNIT_TEST( StandardEntityEstimator, resetData_no_additional_bin_stats )
@@ -5728,6 +6020,192 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator, reduceData_with_additional_bin_stats
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the reduced snapshots can be streamed to a file
+FRENSIE_UNIT_TEST( StandardEntityEstimator, reduceData_streamed_snapshots )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  estimator->enableSnapshotsOnEntityBins();
+  estimator->setSnapshotDataOutputFile( "test_standard_entity_estimator_reduced_snapshots.snap" );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    // bin 0 (E=0, Mu=0, T=0, Col=0)
+    MonteCarlo::PhotonState particle( 0ull );
+    MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+  
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-6 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 1 (E=1, Mu=0, T=0, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 2 (E=0, Mu=1, T=0, Col=0)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 3 (E=1, Mu=1, T=0, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 4 (E=0, Mu=0, T=1, Col=0)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 5 (E=1, Mu=0, T=1, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 6 (E=0, Mu=1, T=1, Col=0)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 7 (E=1, Mu=1, T=1, Col=0)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 8 (E=0, Mu=0, T=0, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-6 );
+    particle.incrementCollisionNumber();
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 9 (E=1, Mu=0, T=0, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 10 (E=0, Mu=1, T=0, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 11 (E=1, Mu=1, T=0, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 12 (E=0, Mu=0, T=1, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 13 (E=1, Mu=0, T=1, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 14 (E=0, Mu=1, T=1, Col=1)
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( 0.5 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+    
+    // bin 15 (E=1, Mu=1, T=1, Col=1)
+    particle.setEnergy( 0.11 );
+    
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+    // Commit the contributions
+    estimator->commitHistoryContribution();
+
+    // Take a snapshot
+    estimator->takeSnapshot( 5, 2.0 );
+  }
+
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  comm->barrier();
+
+  estimator->reduceData( *comm, 0 );
+
+  unsigned procs = comm->size();
+
+  if( comm->rank() == 0 )
+  {
+    // The snapshots of each process are appended to the snapshots of the
+    // root process
+    std::vector<uint64_t> expected_history_values;
+    std::vector<double> expected_sampling_times, expected_first_moments;
+
+    for( size_t i = 1; i <= 2*procs; ++i )
+    {
+      expected_history_values.push_back( 5*i );
+      expected_sampling_times.push_back( 2.0*i );
+      expected_first_moments.push_back( i );
+    }
+
+    std::vector<uint64_t> history_values;
+    std::vector<double> sampling_times;
+
+    estimator->getEntityBinMomentSnapshotHistoryValues( 1, history_values );
+    estimator->getEntityBinMomentSnapshotSamplingTimes( 1, sampling_times );
+
+    FRENSIE_CHECK_EQUAL( history_values, expected_history_values );
+    FRENSIE_CHECK_EQUAL( sampling_times, expected_sampling_times );
+
+    std::vector<double> first_moments;
+
+    estimator->getEntityBinFirstMomentSnapshots( 1, 0, first_moments );
+
+    FRENSIE_CHECK_EQUAL( first_moments, expected_first_moments );
+
+    estimator->getTotalBinMomentSnapshotHistoryValues( history_values );
+
+    FRENSIE_CHECK_EQUAL( history_values, expected_history_values );
+
+    estimator->getEntityTotalMomentSnapshotHistoryValues( 0, history_values );
+
+    FRENSIE_CHECK_EQUAL( history_values, expected_history_values );
+
+    for( size_t i = 0; i < expected_first_moments.size(); ++i )
+      expected_first_moments[i] *= 16.0;
+
+    estimator->getEntityTotalFirstMomentSnapshots( 0, 1, first_moments );
+
+    FRENSIE_CHECK_EQUAL( first_moments, expected_first_moments );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that an estimator can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( StandardEntityEstimator,
@@ -9,17 +9,23 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_ParticleTrackerHistoryWriter.hpp"
 #include "MonteCarlo_ObserverParticleStateWrapper.hpp"
 #include "MonteCarlo_ParticleType.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
 // Default constructor
 ParticleTracker::ParticleTracker()
-  : d_id( std::numeric_limits<Id>::max() )
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_history_sampling_rate( 1 ),
+    d_history_buffer_size( 100 )
 { /* ... */ }
 
 // Constructor
@@ -27,8 +33,17 @@ ParticleTracker::ParticleTracker( const Id id,
                                   const uint64_t number_of_histories )
   : d_id( id ),
     d_histories_to_track(),
+    d_history_sampling_rate( 1 ),
+    d_particle_types_to_track(),
+    d_cells_to_track(),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_uncommitted_history_map( 1 ),
+    d_history_number_map(),
+    d_history_data_output_file_name(),
+    d_history_buffer_size( 100 ),
+    d_history_buffers( 1 ),
+    d_history_data_file_size( 0 ),
+    d_history_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( number_of_histories >= 0 );
@@ -42,13 +57,40 @@ ParticleTracker::ParticleTracker( const Id id,
                                   const std::set<uint64_t>& history_numbers )
   : d_id( id ),
     d_histories_to_track( history_numbers ),
+    d_history_sampling_rate( 1 ),
+    d_particle_types_to_track(),
+    d_cells_to_track(),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_uncommitted_history_map( 1 ),
+    d_history_number_map(),
+    d_history_data_output_file_name(),
+    d_history_buffer_size( 100 ),
+    d_history_buffers( 1 ),
+    d_history_data_file_size( 0 ),
+    d_history_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( history_numbers.size() > 0 )
 }
 
+// Destructor
+ParticleTracker::~ParticleTracker()
+{
+  if( this->isHistoryDataStreamed() )
+  {
+    try{
+      this->flushBufferedHistoryData();
+    }
+    catch( const std::exception& exception )
+    {
+      FRENSIE_LOG_TAGGED_ERROR( "ParticleTracker",
+                                "Particle tracker " << this->getId() <<
+                                " could not write the buffered history "
+                                "data: " << exception.what() );
+    }
+  }
+}
+
 // Return the estimator id
 auto ParticleTracker::getId() const -> Id
 {
@@ -61,6 +103,208 @@ const std::set<uint64_t>& ParticleTracker::getTrackedHistories() const
   return d_histories_to_track;
 }
 
+// Set the history sampling rate (only every nth history will be tracked)
+void ParticleTracker::setHistorySamplingRate( const uint64_t sampling_rate )
+{
+  TEST_FOR_EXCEPTION( sampling_rate == 0,
+                      std::runtime_error,
+                      "The particle tracker history sampling rate must be "
+                      "greater than zero!" );
+
+  d_history_sampling_rate = sampling_rate;
+}
+
+// Return the history sampling rate
+uint64_t ParticleTracker::getHistorySamplingRate() const
+{
+  return d_history_sampling_rate;
+}
+
+// Set the particle types that will be tracked
+/*! \details An empty set indicates that all particle types will be tracked.
+ */
+void ParticleTracker::setParticleTypeFilter(
+                                const std::set<ParticleType>& particle_types )
+{
+  d_particle_types_to_track = particle_types;
+}
+
+// Return the particle types that will be tracked (empty if all)
+const std::set<ParticleType>& ParticleTracker::getParticleTypeFilter() const
+{
+  return d_particle_types_to_track;
+}
+
+// Set the cells that will be tracked
+/*! \details Only the subtracks that end in one of the cells will be
+ * recorded. An empty set indicates that all cells will be tracked.
+ */
+void ParticleTracker::setCellFilter(
+                            const std::set<Geometry::Model::EntityId>& cells )
+{
+  d_cells_to_track = cells;
+}
+
+// Return the cells that will be tracked (empty if all)
+const std::set<Geometry::Model::EntityId>&
+ParticleTracker::getCellFilter() const
+{
+  return d_cells_to_track;
+}
+
+// Stream the history data to a file
+/*! \details Each thread will buffer the specified number of completed
+ * histories before handing them over to the background writer. If there is
+ * more than one process the rank will be appended to the file name (e.g.
+ * tracks_rank1.ptrk) so that each process writes its own file. Any history
+ * data that is already stored in memory will remain there.
+ */
+void ParticleTracker::setHistoryDataOutputFile(
+                                     const boost::filesystem::path& file_name,
+                                     const size_t history_buffer_size )
+{
+  // Make sure the file name is valid
+  testPrecondition( !file_name.empty() );
+  // Make sure the buffer size is valid
+  testPrecondition( history_buffer_size > 0 );
+
+  if( this->isHistoryDataStreamed() )
+  {
+    this->flushBufferedHistoryData();
+
+    d_history_writer.reset();
+  }
+
+  d_history_data_output_file_name = file_name;
+
+  if( Utility::GlobalMPISession::size() > 1 )
+  {
+    std::ostringstream oss;
+
+    oss << file_name.stem().string() << "_rank"
+        << Utility::GlobalMPISession::rank()
+        << file_name.extension().string();
+
+    d_history_data_output_file_name.remove_filename();
+    d_history_data_output_file_name /= oss.str();
+  }
+
+  d_history_buffer_size = history_buffer_size;
+  d_history_data_file_size = 0;
+
+  // Create the file now so that it exists even if no history is tracked
+  d_history_writer.reset(
+         new ParticleTrackerHistoryWriter( d_history_data_output_file_name ) );
+}
+
+// Check if the history data is streamed to a file
+bool ParticleTracker::isHistoryDataStreamed() const
+{
+  return !d_history_data_output_file_name.empty();
+}
+
+// Return the history data output file name
+const boost::filesystem::path&
+ParticleTracker::getHistoryDataOutputFileName() const
+{
+  return d_history_data_output_file_name;
+}
+
+// Write all buffered history data to the output file
+/*! \details This method blocks until the background writer has written all
+ * of the history data to the output file.
+ */
+void ParticleTracker::flushHistoryData()
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( this->isHistoryDataStreamed() )
+    this->flushBufferedHistoryData();
+}
+
+// Check if the particle subtrack should be tracked
+bool ParticleTracker::isSubtrackTracked( const ParticleState& particle ) const
+{
+  if( particle.getHistoryNumber() % d_history_sampling_rate != 0 )
+    return false;
+
+  if( d_histories_to_track.find( particle.getHistoryNumber() ) ==
+      d_histories_to_track.end() )
+    return false;
+
+  if( !d_particle_types_to_track.empty() )
+  {
+    if( d_particle_types_to_track.find( particle.getParticleType() ) ==
+        d_particle_types_to_track.end() )
+      return false;
+  }
+
+  if( !d_cells_to_track.empty() )
+  {
+    if( d_cells_to_track.find( particle.getCell() ) ==
+        d_cells_to_track.end() )
+      return false;
+  }
+
+  return true;
+}
+
+// Hand over the thread's buffered history data to the writer
+void ParticleTracker::writeBufferedHistoryData( const unsigned thread_id ) const
+{
+  if( !d_history_buffers[thread_id].empty() )
+    this->getHistoryWriter().write( d_history_buffers[thread_id] );
+}
+
+// Write all buffered history data to the output file
+void ParticleTracker::flushBufferedHistoryData() const
+{
+  if( this->isHistoryDataStreamed() )
+  {
+    for( size_t i = 0; i < d_history_buffers.size(); ++i )
+      this->writeBufferedHistoryData( i );
+
+    if( d_history_writer )
+      d_history_writer->flush();
+  }
+}
+
+// Return the history data writer
+/*! \details The writer is opened when the first history data is written
+ * after the tracker has been loaded from an archive. The history data that
+ * was written to the file after the tracker was archived will be discarded.
+ * This method is thread safe.
+ */
+ParticleTrackerHistoryWriter& ParticleTracker::getHistoryWriter() const
+{
+  // Make sure the history data is streamed
+  testPrecondition( this->isHistoryDataStreamed() );
+
+  #pragma omp critical( particle_tracker_history_writer_open )
+  {
+    if( !d_history_writer )
+    {
+      d_history_writer.reset(
+         new ParticleTrackerHistoryWriter( d_history_data_output_file_name,
+                                           d_history_data_file_size ) );
+    }
+  }
+
+  return *d_history_writer;
+}
+
+// Return the size of the history data output file that has been written
+/*! \details The buffered history data must be flushed first.
+ */
+uint64_t ParticleTracker::getHistoryDataFileSize() const
+{
+  if( d_history_writer )
+    return d_history_writer->getFileSize();
+  else
+    return d_history_data_file_size;
+}
+
 // Add current history estimator contribution
 void ParticleTracker::updateFromGlobalParticleSubtrackEndingEvent(
 						 const ParticleState& particle,
@@ -68,8 +312,7 @@ void ParticleTracker::updateFromGlobalParticleSubtrackEndingEvent(
 						 const double end_point[3] )
 {
   // Check if we still need to be tracking particles
-  if( d_histories_to_track.find( particle.getHistoryNumber() ) !=
-      d_histories_to_track.end() )
+  if( this->isSubtrackTracked( particle ) )
   {
     unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
@@ -121,26 +364,27 @@ void ParticleTracker::updateFromGlobalParticleGoneEvent(
 {
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  if( d_partial_history_map[thread_id].find( &particle ) !=
-      d_partial_history_map[thread_id].end() )
+  PartialHistorySubmap::iterator partial_history_it =
+    d_partial_history_map[thread_id].find( &particle );
+
+  if( partial_history_it != d_partial_history_map[thread_id].end() )
   {
-    #pragma omp critical
-    {
-      IndividualParticleSubmap& particle_data = 
-        d_history_number_map[particle.getHistoryNumber()][particle.getParticleType()][particle.getGenerationNumber()];
+    // The particle data is only merged with the other tracked history data
+    // when the history is committed
+    IndividualParticleSubmap& particle_data =
+      d_uncommitted_history_map[thread_id][particle.getHistoryNumber()][particle.getParticleType()][particle.getGenerationNumber()];
 
-      // Get the unique id of this particle state
-      unsigned i = 0u;
+    // Get the unique id of this particle state
+    unsigned i = 0u;
 
-      while( particle_data.count( i ) )
-        ++i;
+    while( particle_data.count( i ) )
+      ++i;
 
-      // Add the particle state data
-      particle_data[i] = d_partial_history_map[thread_id][&particle];
+    // Add the particle state data
+    particle_data[i].swap( partial_history_it->second );
 
-      // Remove the particle state data from the partial data map
-      d_partial_history_map[thread_id].erase( &particle );
-    }
+    // Remove the particle state data from the partial data map
+    d_partial_history_map[thread_id].erase( partial_history_it );
   }
 }
 
@@ -157,7 +401,11 @@ void ParticleTracker::resetData()
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
   for( size_t i = 0; i < d_partial_history_map.size(); ++i )
+  {
     d_partial_history_map[i].clear();
+    d_uncommitted_history_map[i].clear();
+    d_history_buffers[i].clear();
+  }
 
   // Clear the history number map
   d_history_number_map.clear();
@@ -168,18 +416,100 @@ void ParticleTracker::enableThreadSupport( const unsigned num_threads )
 {
   testPrecondition( num_threads > 0 );
   
+  // Hand over any buffered history data before the buffers are resized
+  this->flushBufferedHistoryData();
+
   d_partial_history_map.resize( num_threads );
+  d_uncommitted_history_map.resize( num_threads );
+  d_history_buffers.resize( num_threads );
 }
 
 // Has Uncommited History Contribution
 bool ParticleTracker::hasUncommittedHistoryContribution() const
 {
-  return false;
+  return !d_uncommitted_history_map[Utility::OpenMPProperties::getThreadId()].empty();
 }
 
 // Commit History Contribution
+/*! \details When the history data is streamed to a file the completed
+ * histories are added to the thread's buffer, which is handed over to the
+ * background writer once it is full. Otherwise the completed histories are
+ * merged with the tracked history data (one critical section per history).
+ */
 void ParticleTracker::commitHistoryContribution()
-{ /* ... */ }
+{
+  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+  OverallHistoryMap& thread_uncommitted_history_map =
+    d_uncommitted_history_map[thread_id];
+
+  if( thread_uncommitted_history_map.empty() )
+    return;
+
+  if( this->isHistoryDataStreamed() )
+  {
+    HistoryDataArray& thread_history_buffer = d_history_buffers[thread_id];
+
+    OverallHistoryMap::iterator history_it =
+      thread_uncommitted_history_map.begin();
+
+    while( history_it != thread_uncommitted_history_map.end() )
+    {
+      thread_history_buffer.emplace_back( history_it->first,
+                                          ParticleTypeSubmap() );
+      thread_history_buffer.back().second.swap( history_it->second );
+
+      ++history_it;
+    }
+
+    if( thread_history_buffer.size() >= d_history_buffer_size )
+      this->writeBufferedHistoryData( thread_id );
+  }
+  else
+  {
+    #pragma omp critical( particle_tracker_history_update )
+    {
+      OverallHistoryMap::iterator history_it =
+        thread_uncommitted_history_map.begin();
+
+      while( history_it != thread_uncommitted_history_map.end() )
+      {
+        ParticleTypeSubmap& history_data =
+          d_history_number_map[history_it->first];
+
+        if( history_data.empty() )
+          history_data.swap( history_it->second );
+        else
+        {
+          // Merge the particle data with the previously committed data
+          for( auto&& particle_type_data : history_it->second )
+          {
+            for( auto&& generation_data : particle_type_data.second )
+            {
+              IndividualParticleSubmap& particle_data =
+                history_data[particle_type_data.first][generation_data.first];
+
+              for( auto&& individual_particle_data : generation_data.second )
+              {
+                // Get the unique id of this particle state
+                unsigned i = 0u;
+
+                while( particle_data.count( i ) )
+                  ++i;
+
+                particle_data[i].swap( individual_particle_data.second );
+              }
+            }
+          }
+        }
+
+        ++history_it;
+      }
+    }
+  }
+
+  thread_uncommitted_history_map.clear();
+}
 
 // Reduce data
 void ParticleTracker::reduceData( const Utility::Communicator& comm,
@@ -190,6 +520,10 @@ void ParticleTracker::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Each process streams the history data to its own file
+  if( this->isHistoryDataStreamed() )
+    this->flushBufferedHistoryData();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -9,7 +9,12 @@
 #ifndef MONTE_CARLO_PARTICLE_TRACKER_HPP
 #define MONTE_CARLO_PARTICLE_TRACKER_HPP
 
+// Std Lib Includes
+#include <memory>
+
 // Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
 #include <boost/serialization/split_member.hpp>
 #include <boost/serialization/version.hpp>
 #include <boost/serialization/assume_abstract.hpp>
@@ -31,7 +36,18 @@
 
 namespace MonteCarlo{
 
+// Forward declare the history writer
+class ParticleTrackerHistoryWriter;
+
 /*! The particle tracking class, similar to the PTRAC function in MCNP
+ *
+ * \details By default the data of every tracked history is stored in memory
+ * until the tracker is archived. When a history data output file is set the
+ * completed histories are buffered per thread and then handed over to a
+ * MonteCarlo::ParticleTrackerHistoryWriter, which appends them to the file
+ * in the background (see MonteCarlo::ParticleTrackerHistoryReader). Only a
+ * subset of the histories, particle types and cells can be tracked to
+ * further reduce the amount of data that is generated.
  */
 class ParticleTracker : public ParticleSubtrackEndingGlobalEventObserver,
                         public ParticleGoneGlobalEventObserver,
@@ -69,6 +85,10 @@ public:
   typedef std::unordered_map<ParticleState::historyNumberType,ParticleTypeSubmap>
     OverallHistoryMap;
 
+  //! Typedef for the completed history data array
+  typedef std::vector<std::pair<ParticleState::historyNumberType,ParticleTypeSubmap> >
+    HistoryDataArray;
+
   //! Typedef for event tags used for quick dispatcher registering
   typedef boost::mpl::vector<ParticleSubtrackEndingGlobalEventObserver::EventTag,ParticleGoneGlobalEventObserver::EventTag>
   EventTags;
@@ -82,8 +102,7 @@ public:
                    const std::set<uint64_t>& history_numbers );
 
   //! Destructor
-  ~ParticleTracker()
-  { /* ... */ }
+  ~ParticleTracker();
 
   //! Return the estimator id
   Id getId() const;
@@ -91,6 +110,37 @@ public:
   //! Return the histories that will be tracked
   const std::set<uint64_t>& getTrackedHistories() const;
 
+  //! Set the history sampling rate (only every nth history will be tracked)
+  void setHistorySamplingRate( const uint64_t sampling_rate );
+
+  //! Return the history sampling rate
+  uint64_t getHistorySamplingRate() const;
+
+  //! Set the particle types that will be tracked
+  void setParticleTypeFilter( const std::set<ParticleType>& particle_types );
+
+  //! Return the particle types that will be tracked (empty if all)
+  const std::set<ParticleType>& getParticleTypeFilter() const;
+
+  //! Set the cells that will be tracked
+  void setCellFilter( const std::set<Geometry::Model::EntityId>& cells );
+
+  //! Return the cells that will be tracked (empty if all)
+  const std::set<Geometry::Model::EntityId>& getCellFilter() const;
+
+  //! Stream the history data to a file
+  void setHistoryDataOutputFile( const boost::filesystem::path& file_name,
+                                 const size_t history_buffer_size = 100 );
+
+  //! Check if the history data is streamed to a file
+  bool isHistoryDataStreamed() const;
+
+  //! Return the history data output file name
+  const boost::filesystem::path& getHistoryDataOutputFileName() const;
+
+  //! Write all buffered history data to the output file
+  void flushHistoryData();
+
   //! Add current history contribution
   void updateFromGlobalParticleSubtrackEndingEvent(
                                     const ParticleState& particle,
@@ -143,6 +193,21 @@ private:
 
   BOOST_SERIALIZATION_SPLIT_MEMBER();
 
+  // Check if the particle subtrack should be tracked
+  bool isSubtrackTracked( const ParticleState& particle ) const;
+
+  // Hand over the thread's buffered history data to the writer
+  void writeBufferedHistoryData( const unsigned thread_id ) const;
+
+  // Write all buffered history data to the output file
+  void flushBufferedHistoryData() const;
+
+  // Return the history data writer
+  ParticleTrackerHistoryWriter& getHistoryWriter() const;
+
+  // Return the size of the history data output file that has been written
+  uint64_t getHistoryDataFileSize() const;
+
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
@@ -152,12 +217,39 @@ private:
   // The histories to be tracked
   std::set<uint64_t> d_histories_to_track;
 
+  // The history sampling rate
+  uint64_t d_history_sampling_rate;
+
+  // The particle types to be tracked (empty if all)
+  std::set<ParticleType> d_particle_types_to_track;
+
+  // The cells to be tracked (empty if all)
+  std::set<Geometry::Model::EntityId> d_cells_to_track;
+
   // The partial tracked history info
   typedef std::map<const ParticleState*,ParticleDataArray> PartialHistorySubmap;
   std::vector<PartialHistorySubmap> d_partial_history_map;
 
+  // The uncommitted tracked history info
+  std::vector<OverallHistoryMap> d_uncommitted_history_map;
+
   // The tracked history info
   OverallHistoryMap d_history_number_map;
+
+  // The history data output file name (empty if the data is not streamed)
+  boost::filesystem::path d_history_data_output_file_name;
+
+  // The number of completed histories that each thread buffers
+  size_t d_history_buffer_size;
+
+  // The buffered completed history data
+  mutable std::vector<HistoryDataArray> d_history_buffers;
+
+  // The size of the history data output file when the tracker was archived
+  uint64_t d_history_data_file_size;
+
+  // The history data writer (opened when the first history data is written)
+  mutable std::shared_ptr<ParticleTrackerHistoryWriter> d_history_writer;
 };
 
 // Save the estimator data
@@ -172,7 +264,24 @@ void ParticleTracker::save( Archive& ar, const unsigned version ) const
   // Save the local data
   ar & BOOST_SERIALIZATION_NVP( d_id );
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
+  ar & BOOST_SERIALIZATION_NVP( d_history_sampling_rate );
+  ar & BOOST_SERIALIZATION_NVP( d_particle_types_to_track );
+  ar & BOOST_SERIALIZATION_NVP( d_cells_to_track );
   ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
+
+  // The buffered history data must be in the output file before the
+  // tracker is archived. The file will be truncated to its current size on
+  // restart.
+  this->flushBufferedHistoryData();
+
+  std::string raw_history_data_output_file_name =
+    d_history_data_output_file_name.string();
+
+  uint64_t history_data_file_size = this->getHistoryDataFileSize();
+
+  ar & BOOST_SERIALIZATION_NVP( raw_history_data_output_file_name );
+  ar & BOOST_SERIALIZATION_NVP( d_history_buffer_size );
+  ar & BOOST_SERIALIZATION_NVP( history_data_file_size );
 }
 
 // Load the estimator data
@@ -187,14 +296,62 @@ void ParticleTracker::load( Archive& ar, const unsigned version )
   // Load the local data
   ar & BOOST_SERIALIZATION_NVP( d_id );
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_sampling_rate );
+    ar & BOOST_SERIALIZATION_NVP( d_particle_types_to_track );
+    ar & BOOST_SERIALIZATION_NVP( d_cells_to_track );
+  }
+  else
+    d_history_sampling_rate = 1;
+
   ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
 
+  if( version > 0 )
+  {
+    std::string raw_history_data_output_file_name;
+
+    ar & BOOST_SERIALIZATION_NVP( raw_history_data_output_file_name );
+    ar & BOOST_SERIALIZATION_NVP( d_history_buffer_size );
+
+    d_history_data_output_file_name = raw_history_data_output_file_name;
+  }
+  else
+    d_history_buffer_size = 100;
+
+  // Version 1 archives did not store the history data output file size -
+  // the entire file will be kept
+  if( version > 1 )
+  {
+    uint64_t history_data_file_size;
+
+    ar & BOOST_SERIALIZATION_NVP( history_data_file_size );
+
+    d_history_data_file_size = history_data_file_size;
+  }
+  else if( !d_history_data_output_file_name.empty() &&
+           boost::filesystem::exists( d_history_data_output_file_name ) )
+  {
+    d_history_data_file_size =
+      boost::filesystem::file_size( d_history_data_output_file_name );
+  }
+  else
+    d_history_data_file_size = 0;
+
   d_partial_history_map.resize( 1 );
+  d_uncommitted_history_map.resize( 1 );
+  d_history_buffers.resize( 1 );
+
+  // The history data output file will only be opened for writing when the
+  // next history data is written (a loaded tracker may only be
+  // post-processed)
+  d_history_writer.reset();
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleTracker, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleTracker, MonteCarlo, 2 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ParticleTracker, MonteCarlo );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, ParticleTracker );
 
@@ -0,0 +1,238 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackerHistoryReader.cpp
+//! \author Alex Robinson
+//! \brief  Particle tracker history file reader definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+#include <limits>
+
+// Boost Includes
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/array.hpp>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // This must be included first
+#include "MonteCarlo_ParticleTrackerHistoryReader.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleTrackerHistoryReader::ParticleTrackerHistoryReader(
+                                     const boost::filesystem::path& file_name )
+  : d_file_name( file_name ),
+    d_file( file_name.string(), std::ios::binary ),
+    d_chunks(),
+    d_history_numbers(),
+    d_history_chunk_indices(),
+    d_cached_chunk_index( std::numeric_limits<size_t>::max() ),
+    d_cached_chunk_history_data()
+{
+  TEST_FOR_EXCEPTION( !d_file.is_open(),
+                      std::runtime_error,
+                      "Could not open particle tracker history file "
+                      << file_name.string() << "!" );
+
+  // Verify the file header
+  {
+    char file_format_id[8];
+    uint32_t file_format_version;
+
+    d_file.read( file_format_id, sizeof(file_format_id) );
+    d_file.read( (char*)&file_format_version, sizeof(file_format_version) );
+
+    TEST_FOR_EXCEPTION( !d_file ||
+                        std::memcmp( file_format_id,
+                                     ParticleTrackerHistoryWriter::s_file_format_id,
+                                     sizeof(file_format_id) ) != 0,
+                        std::runtime_error,
+                        "File " << file_name.string() << " is not a particle "
+                        "tracker history file!" );
+
+    TEST_FOR_EXCEPTION( file_format_version !=
+                        ParticleTrackerHistoryWriter::s_file_format_version,
+                        std::runtime_error,
+                        "Particle tracker history file " << file_name.string()
+                        << " has an unsupported format version ("
+                        << file_format_version << ")!" );
+  }
+
+  // Index the chunks - a chunk that was only partially written (e.g. the
+  // simulation was killed) will be ignored
+  d_file.seekg( 0, std::ios::end );
+
+  const uint64_t file_size = d_file.tellg();
+
+  d_file.seekg( sizeof(ParticleTrackerHistoryWriter::s_file_format_id) +
+                sizeof(ParticleTrackerHistoryWriter::s_file_format_version) );
+
+  while( true )
+  {
+    uint64_t number_of_histories;
+
+    d_file.read( (char*)&number_of_histories, sizeof(number_of_histories) );
+
+    if( !d_file )
+      break;
+
+    std::vector<uint64_t> chunk_history_numbers;
+
+    if( (uint64_t)d_file.tellg() + number_of_histories*sizeof(uint64_t) <=
+        file_size )
+    {
+      chunk_history_numbers.resize( number_of_histories );
+
+      d_file.read( (char*)chunk_history_numbers.data(),
+                   number_of_histories*sizeof(uint64_t) );
+    }
+    else
+      break;
+
+    Chunk chunk;
+
+    d_file.read( (char*)&chunk.compressed_data_size,
+                 sizeof(chunk.compressed_data_size) );
+
+    if( !d_file )
+      break;
+
+    chunk.compressed_data_offset = d_file.tellg();
+
+    if( chunk.compressed_data_offset + chunk.compressed_data_size > file_size )
+      break;
+
+    for( size_t i = 0; i < chunk_history_numbers.size(); ++i )
+    {
+      d_history_numbers.push_back( chunk_history_numbers[i] );
+      d_history_chunk_indices[chunk_history_numbers[i]] = d_chunks.size();
+    }
+
+    d_chunks.push_back( chunk );
+
+    d_file.seekg( chunk.compressed_data_offset + chunk.compressed_data_size );
+  }
+
+  d_file.clear();
+}
+
+// Return the file name
+const boost::filesystem::path& ParticleTrackerHistoryReader::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the number of histories in the file
+size_t ParticleTrackerHistoryReader::getNumberOfHistories() const
+{
+  return d_history_numbers.size();
+}
+
+// Return the history numbers in the file (in the order they were written)
+const std::vector<ParticleState::historyNumberType>&
+ParticleTrackerHistoryReader::getHistoryNumbers() const
+{
+  return d_history_numbers;
+}
+
+// Check if the file has data for a history
+bool ParticleTrackerHistoryReader::hasHistoryData(
+                       const ParticleState::historyNumberType history ) const
+{
+  return d_history_chunk_indices.find( history ) !=
+    d_history_chunk_indices.end();
+}
+
+// Get the data of a history
+void ParticleTrackerHistoryReader::getHistoryData(
+                      const ParticleState::historyNumberType history,
+                      ParticleTracker::ParticleTypeSubmap& history_data ) const
+{
+  std::unordered_map<ParticleState::historyNumberType,size_t>::const_iterator
+    history_chunk_index_it = d_history_chunk_indices.find( history );
+
+  TEST_FOR_EXCEPTION( history_chunk_index_it == d_history_chunk_indices.end(),
+                      std::runtime_error,
+                      "Particle tracker history file " << d_file_name.string()
+                      << " has no data for history " << history << "!" );
+
+  this->readChunk( history_chunk_index_it->second );
+
+  for( size_t i = 0; i < d_cached_chunk_history_data.size(); ++i )
+  {
+    if( d_cached_chunk_history_data[i].first == history )
+    {
+      history_data = d_cached_chunk_history_data[i].second;
+
+      return;
+    }
+  }
+}
+
+// Get the data of every history in the file
+void ParticleTrackerHistoryReader::getHistoryData(
+                        ParticleTracker::OverallHistoryMap& history_map ) const
+{
+  history_map.clear();
+
+  for( size_t i = 0; i < d_chunks.size(); ++i )
+  {
+    this->readChunk( i );
+
+    for( size_t j = 0; j < d_cached_chunk_history_data.size(); ++j )
+    {
+      history_map[d_cached_chunk_history_data[j].first] =
+        d_cached_chunk_history_data[j].second;
+    }
+  }
+}
+
+// Read the history data of a chunk
+void ParticleTrackerHistoryReader::readChunk( const size_t chunk_index ) const
+{
+  // Make sure the chunk index is valid
+  testPrecondition( chunk_index < d_chunks.size() );
+
+  if( chunk_index == d_cached_chunk_index )
+    return;
+
+  const Chunk& chunk = d_chunks[chunk_index];
+
+  std::vector<char> compressed_data( chunk.compressed_data_size );
+
+  d_file.seekg( chunk.compressed_data_offset );
+  d_file.read( compressed_data.data(), compressed_data.size() );
+
+  TEST_FOR_EXCEPTION( !d_file,
+                      std::runtime_error,
+                      "Could not read history data from particle tracker "
+                      "history file " << d_file_name.string() << "!" );
+
+  d_cached_chunk_history_data.clear();
+
+  {
+    boost::iostreams::filtering_istream compressed_data_stream;
+
+    compressed_data_stream.push( boost::iostreams::zlib_decompressor() );
+    compressed_data_stream.push(
+                      boost::iostreams::array_source( compressed_data.data(),
+                                                      compressed_data.size() ) );
+
+    boost::archive::binary_iarchive archive( compressed_data_stream );
+
+    archive >> d_cached_chunk_history_data;
+  }
+
+  d_cached_chunk_index = chunk_index;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackerHistoryReader.cpp
+//---------------------------------------------------------------------------//
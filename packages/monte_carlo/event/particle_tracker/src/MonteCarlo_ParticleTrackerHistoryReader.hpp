@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackerHistoryReader.hpp
+//! \author Alex Robinson
+//! \brief  Particle tracker history file reader declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_TRACKER_HISTORY_READER_HPP
+#define MONTE_CARLO_PARTICLE_TRACKER_HISTORY_READER_HPP
+
+// Std Lib Includes
+#include <fstream>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackerHistoryWriter.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle tracker history file reader
+ *
+ * \details The file is indexed when the reader is constructed (only the
+ * chunk headers are read). The data of a history is read and decompressed
+ * on request. The last chunk that was decompressed is cached since
+ * histories are usually processed in the order that they were written.
+ */
+class ParticleTrackerHistoryReader
+{
+
+public:
+
+  //! Constructor
+  ParticleTrackerHistoryReader( const boost::filesystem::path& file_name );
+
+  //! Destructor
+  ~ParticleTrackerHistoryReader()
+  { /* ... */ }
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the number of histories in the file
+  size_t getNumberOfHistories() const;
+
+  //! Return the history numbers in the file (in the order they were written)
+  const std::vector<ParticleState::historyNumberType>& getHistoryNumbers() const;
+
+  //! Check if the file has data for a history
+  bool hasHistoryData( const ParticleState::historyNumberType history ) const;
+
+  //! Get the data of a history
+  void getHistoryData( const ParticleState::historyNumberType history,
+                       ParticleTracker::ParticleTypeSubmap& history_data ) const;
+
+  //! Get the data of every history in the file
+  void getHistoryData( ParticleTracker::OverallHistoryMap& history_map ) const;
+
+private:
+
+  // The chunk data
+  struct Chunk
+  {
+    // The offset of the compressed data in the file
+    uint64_t compressed_data_offset;
+
+    // The compressed data size
+    uint64_t compressed_data_size;
+  };
+
+  // Read the history data of a chunk
+  void readChunk( const size_t chunk_index ) const;
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The file stream
+  mutable std::ifstream d_file;
+
+  // The chunks in the file
+  std::vector<Chunk> d_chunks;
+
+  // The history numbers in the file
+  std::vector<ParticleState::historyNumberType> d_history_numbers;
+
+  // The chunk that contains each history
+  std::unordered_map<ParticleState::historyNumberType,size_t> d_history_chunk_indices;
+
+  // The index of the cached chunk
+  mutable size_t d_cached_chunk_index;
+
+  // The cached chunk history data
+  mutable ParticleTrackerHistoryWriter::HistoryDataArray d_cached_chunk_history_data;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_TRACKER_HISTORY_READER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackerHistoryReader.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,319 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackerHistoryWriter.cpp
+//! \author Alex Robinson
+//! \brief  Particle tracker history file writer definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+
+// Boost Includes
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/filesystem/operations.hpp>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // This must be included first
+#include "MonteCarlo_ParticleTrackerHistoryWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+const char ParticleTrackerHistoryWriter::s_file_format_id[8] =
+  {'F','R','N','S','P','T','R','K'};
+
+const uint32_t ParticleTrackerHistoryWriter::s_file_format_version = 1;
+
+const size_t ParticleTrackerHistoryWriter::s_max_queued_chunks = 4;
+
+// Constructor
+/*! \details If the resume file size is not zero the existing file will be
+ * truncated to the resume file size and new history data will be added to
+ * the end of it (e.g. when a simulation is restarted from a rendezvous, the
+ * history data written after the rendezvous is discarded). Otherwise the
+ * file will be overwritten.
+ */
+ParticleTrackerHistoryWriter::ParticleTrackerHistoryWriter(
+                                     const boost::filesystem::path& file_name,
+                                     const uint64_t resume_file_size )
+  : d_file_name( file_name ),
+    d_file(),
+    d_file_size( 0 ),
+    d_queued_history_data(),
+    d_chunks_being_written( 0 ),
+    d_write_error(),
+    d_stop( false ),
+    d_queue_mutex(),
+    d_queue_not_empty(),
+    d_queue_not_full(),
+    d_writer_thread()
+{
+  const uint64_t header_size =
+    sizeof(s_file_format_id) + sizeof(s_file_format_version);
+
+  if( resume_file_size > 0 )
+  {
+    TEST_FOR_EXCEPTION( resume_file_size < header_size ||
+                        !boost::filesystem::exists( file_name ) ||
+                        boost::filesystem::file_size( file_name ) <
+                        resume_file_size,
+                        std::runtime_error,
+                        "Cannot resume particle tracker history file "
+                        << file_name.string() << " at byte "
+                        << resume_file_size << " because the file is "
+                        "missing or too small!" );
+
+    // Verify the file header before adding data to the file
+    {
+      std::ifstream existing_file( file_name.string(), std::ios::binary );
+
+      char file_format_id[8];
+      uint32_t file_format_version;
+
+      existing_file.read( file_format_id, sizeof(file_format_id) );
+      existing_file.read( (char*)&file_format_version,
+                          sizeof(file_format_version) );
+
+      TEST_FOR_EXCEPTION( !existing_file ||
+                          std::memcmp( file_format_id,
+                                       s_file_format_id,
+                                       sizeof(file_format_id) ) != 0 ||
+                          file_format_version != s_file_format_version,
+                          std::runtime_error,
+                          "Cannot append to particle tracker history file "
+                          << file_name.string() << " because it is not a "
+                          "valid particle tracker history file!" );
+    }
+
+    // Discard the data written after the resume point
+    boost::filesystem::resize_file( file_name, resume_file_size );
+
+    d_file.open( file_name.string(), std::ios::binary | std::ios::app );
+
+    d_file_size = resume_file_size;
+  }
+  else
+    d_file.open( file_name.string(), std::ios::binary | std::ios::trunc );
+
+  TEST_FOR_EXCEPTION( !d_file.is_open(),
+                      std::runtime_error,
+                      "Could not open particle tracker history file "
+                      << file_name.string() << "!" );
+
+  if( resume_file_size == 0 )
+  {
+    d_file.write( s_file_format_id, sizeof(s_file_format_id) );
+    d_file.write( (const char*)&s_file_format_version,
+                  sizeof(s_file_format_version) );
+    d_file.flush();
+
+    d_file_size = header_size;
+  }
+
+  d_writer_thread =
+    std::thread( &ParticleTrackerHistoryWriter::writeQueuedHistoryData, this );
+}
+
+// Destructor
+ParticleTrackerHistoryWriter::~ParticleTrackerHistoryWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+    d_stop = true;
+  }
+
+  d_queue_not_empty.notify_all();
+
+  // The background thread writes all queued data before it stops
+  d_writer_thread.join();
+
+  if( !d_write_error.empty() )
+  {
+    FRENSIE_LOG_TAGGED_ERROR( "ParticleTrackerHistoryWriter",
+                              d_write_error );
+  }
+}
+
+// Return the file name
+const boost::filesystem::path& ParticleTrackerHistoryWriter::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the size of the data that has been written to the file (bytes)
+/*! \details The history data that is still queued is not included (call
+ * flush first).
+ */
+uint64_t ParticleTrackerHistoryWriter::getFileSize() const
+{
+  std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+  return d_file_size;
+}
+
+// Append the history data to the file (the array will be emptied)
+/*! \details The history data is handed over to the background thread
+ * without copying it. This method is thread safe.
+ */
+void ParticleTrackerHistoryWriter::write( HistoryDataArray& history_data )
+{
+  this->checkForWriteError();
+
+  if( history_data.empty() )
+    return;
+
+  {
+    std::unique_lock<std::mutex> lock( d_queue_mutex );
+
+    d_queue_not_full.wait( lock, [this]{
+        return d_queued_history_data.size() < s_max_queued_chunks; } );
+
+    d_queued_history_data.emplace_back();
+    d_queued_history_data.back().swap( history_data );
+  }
+
+  d_queue_not_empty.notify_one();
+}
+
+// Wait until all history data has been written to the file
+void ParticleTrackerHistoryWriter::flush()
+{
+  {
+    std::unique_lock<std::mutex> lock( d_queue_mutex );
+
+    d_queue_not_full.wait( lock, [this]{
+        return d_queued_history_data.empty() && d_chunks_being_written == 0; } );
+  }
+
+  this->checkForWriteError();
+}
+
+// Write the queued history data
+void ParticleTrackerHistoryWriter::writeQueuedHistoryData()
+{
+  HistoryDataArray history_data;
+
+  while( true )
+  {
+    {
+      std::unique_lock<std::mutex> lock( d_queue_mutex );
+
+      d_queue_not_empty.wait( lock, [this]{
+          return !d_queued_history_data.empty() || d_stop; } );
+
+      if( d_queued_history_data.empty() )
+        break;
+
+      history_data.swap( d_queued_history_data.front() );
+      d_queued_history_data.pop_front();
+
+      ++d_chunks_being_written;
+    }
+
+    d_queue_not_full.notify_all();
+
+    std::string write_error;
+    uint64_t chunk_size = 0;
+
+    try{
+      chunk_size = this->writeChunk( history_data );
+    }
+    catch( const std::exception& exception )
+    {
+      write_error = exception.what();
+    }
+
+    history_data.clear();
+
+    {
+      std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+      --d_chunks_being_written;
+
+      if( write_error.empty() )
+        d_file_size += chunk_size;
+
+      if( !write_error.empty() && d_write_error.empty() )
+        d_write_error = write_error;
+    }
+
+    d_queue_not_full.notify_all();
+  }
+}
+
+// Write a chunk of history data to the file and return its size
+/*! \details The chunk layout is the number of histories (uint64), the
+ * history numbers (uint64 each), the compressed data size (uint64) and the
+ * compressed data.
+ */
+uint64_t ParticleTrackerHistoryWriter::writeChunk(
+                                        const HistoryDataArray& history_data )
+{
+  std::string compressed_data;
+
+  {
+    boost::iostreams::filtering_ostream compressed_data_stream;
+
+    compressed_data_stream.push( boost::iostreams::zlib_compressor() );
+    compressed_data_stream.push(
+                      boost::iostreams::back_inserter( compressed_data ) );
+
+    {
+      boost::archive::binary_oarchive archive( compressed_data_stream );
+
+      archive << history_data;
+    }
+
+    boost::iostreams::close( compressed_data_stream );
+  }
+
+  const uint64_t number_of_histories = history_data.size();
+
+  std::vector<uint64_t> history_numbers( history_data.size() );
+
+  for( size_t i = 0; i < history_data.size(); ++i )
+    history_numbers[i] = history_data[i].first;
+
+  const uint64_t compressed_data_size = compressed_data.size();
+
+  d_file.write( (const char*)&number_of_histories,
+                sizeof(number_of_histories) );
+  d_file.write( (const char*)history_numbers.data(),
+                history_numbers.size()*sizeof(uint64_t) );
+  d_file.write( (const char*)&compressed_data_size,
+                sizeof(compressed_data_size) );
+  d_file.write( compressed_data.data(), compressed_data.size() );
+  d_file.flush();
+
+  TEST_FOR_EXCEPTION( !d_file,
+                      std::runtime_error,
+                      "Could not write history data to particle tracker "
+                      "history file " << d_file_name.string() << "!" );
+
+  return sizeof(number_of_histories) +
+    history_numbers.size()*sizeof(uint64_t) +
+    sizeof(compressed_data_size) + compressed_data_size;
+}
+
+// Check if an error occurred in the background thread
+void ParticleTrackerHistoryWriter::checkForWriteError() const
+{
+  std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+  TEST_FOR_EXCEPTION( !d_write_error.empty(),
+                      std::runtime_error,
+                      d_write_error );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackerHistoryWriter.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackerHistoryWriter.hpp
+//! \author Alex Robinson
+//! \brief  Particle tracker history file writer declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_TRACKER_HISTORY_WRITER_HPP
+#define MONTE_CARLO_PARTICLE_TRACKER_HISTORY_WRITER_HPP
+
+// Std Lib Includes
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTracker.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle tracker history file writer
+ *
+ * \details Completed histories are appended to a binary file in chunks. Each
+ * chunk stores the history numbers that it contains (uncompressed) followed
+ * by the zlib compressed history data, which allows the
+ * MonteCarlo::ParticleTrackerHistoryReader to index the file without
+ * decompressing it. The chunks are compressed and written by a background
+ * thread. At most a few chunks are queued at any time - threads that hand
+ * over a chunk while the queue is full will wait, which bounds the memory
+ * used by the writer.
+ */
+class ParticleTrackerHistoryWriter
+{
+
+public:
+
+  //! The history data array
+  typedef ParticleTracker::HistoryDataArray HistoryDataArray;
+
+  //! Constructor
+  ParticleTrackerHistoryWriter( const boost::filesystem::path& file_name,
+                                const uint64_t resume_file_size = 0 );
+
+  //! Destructor
+  ~ParticleTrackerHistoryWriter();
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the size of the data that has been written to the file (bytes)
+  uint64_t getFileSize() const;
+
+  //! Append the history data to the file (the array will be emptied)
+  void write( HistoryDataArray& history_data );
+
+  //! Wait until all history data has been written to the file
+  void flush();
+
+  //! The file format identifier
+  static const char s_file_format_id[8];
+
+  //! The file format version
+  static const uint32_t s_file_format_version;
+
+private:
+
+  // Write the queued history data
+  void writeQueuedHistoryData();
+
+  // Write a chunk of history data to the file and return its size
+  uint64_t writeChunk( const HistoryDataArray& history_data );
+
+  // Check if an error occurred in the background thread
+  void checkForWriteError() const;
+
+  // The max number of history data chunks that can be queued
+  static const size_t s_max_queued_chunks;
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The file stream
+  std::ofstream d_file;
+
+  // The size of the data that has been written to the file
+  uint64_t d_file_size;
+
+  // The queued history data
+  std::deque<HistoryDataArray> d_queued_history_data;
+
+  // The number of chunks that are currently being written
+  size_t d_chunks_being_written;
+
+  // The write error message (empty if no error has occurred)
+  std::string d_write_error;
+
+  // Stop the background thread
+  bool d_stop;
+
+  // The queue mutex
+  mutable std::mutex d_queue_mutex;
+
+  // The queue condition variable (new data or stop request)
+  std::condition_variable d_queue_not_empty;
+
+  // The queue condition variable (space available or all data written)
+  std::condition_variable d_queue_not_full;
+
+  // The background writer thread
+  std::thread d_writer_thread;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_TRACKER_HISTORY_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackerHistoryWriter.hpp
+//---------------------------------------------------------------------------//
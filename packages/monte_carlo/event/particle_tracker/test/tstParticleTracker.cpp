@@ -12,6 +12,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_ParticleTrackerHistoryReader.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
 #include "Utility_OpenMPProperties.hpp"
@@ -346,6 +347,214 @@ FRENSIE_UNIT_TEST( ParticleTracker, reduceData )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that only every nth history can be tracked
+FRENSIE_UNIT_TEST( ParticleTracker, setHistorySamplingRate )
+{
+  MonteCarlo::ParticleTracker particle_tracker( 0, 100 );
+
+  FRENSIE_CHECK_EQUAL( particle_tracker.getHistorySamplingRate(), 1 );
+  FRENSIE_CHECK_THROW( particle_tracker.setHistorySamplingRate( 0 ),
+                       std::runtime_error );
+
+  particle_tracker.setHistorySamplingRate( 3 );
+
+  FRENSIE_CHECK_EQUAL( particle_tracker.getHistorySamplingRate(), 3 );
+
+  for( size_t i = 0; i < 7; ++i )
+  {
+    MonteCarlo::PhotonState particle( i );
+
+    particle.setPosition( 2.0, 1.0, 1.0 );
+    particle.setDirection( 1.0, 0.0, 0.0 );
+    particle.setEnergy( 2.5 );
+    particle.setTime( 5e-11 );
+    particle.setWeight( 1.0 );
+
+    double start_point[3] = { 1.0, 1.0, 1.0 };
+    double end_point[3] = { 2.0, 1.0, 1.0 };
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                                  start_point,
+                                                                  end_point );
+
+    particle.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( particle );
+
+    FRENSIE_CHECK_EQUAL( particle_tracker.hasUncommittedHistoryContribution(),
+                         i%3 == 0 );
+
+    particle_tracker.commitHistoryContribution();
+
+    FRENSIE_CHECK( !particle_tracker.hasUncommittedHistoryContribution() );
+  }
+
+  MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+  particle_tracker.getHistoryData( history_map );
+
+  FRENSIE_CHECK_EQUAL( history_map.size(), 3 );
+  FRENSIE_CHECK( history_map.count( 0 ) );
+  FRENSIE_CHECK( history_map.count( 3 ) );
+  FRENSIE_CHECK( history_map.count( 6 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the particle types and cells that are tracked can be filtered
+FRENSIE_UNIT_TEST( ParticleTracker, setParticleTypeFilter_setCellFilter )
+{
+  MonteCarlo::ParticleTracker particle_tracker( 0, 100 );
+
+  FRENSIE_CHECK( particle_tracker.getParticleTypeFilter().empty() );
+  FRENSIE_CHECK( particle_tracker.getCellFilter().empty() );
+
+  particle_tracker.setParticleTypeFilter( {MonteCarlo::PHOTON} );
+
+  FRENSIE_CHECK_EQUAL( particle_tracker.getParticleTypeFilter().size(), 1 );
+  FRENSIE_CHECK( particle_tracker.getParticleTypeFilter().count( MonteCarlo::PHOTON ) );
+
+  // The particles are in cell 0 of the default (infinite medium) model
+  for( size_t i = 0; i < 4; ++i )
+  {
+    if( i == 2 )
+      particle_tracker.setCellFilter( {1} );
+    else if( i == 3 )
+      particle_tracker.setCellFilter( {0, 1} );
+
+    std::unique_ptr<MonteCarlo::ParticleState> particle;
+
+    if( i == 1 )
+      particle.reset( new MonteCarlo::ElectronState( i ) );
+    else
+      particle.reset( new MonteCarlo::PhotonState( i ) );
+
+    particle->setPosition( 2.0, 1.0, 1.0 );
+    particle->setDirection( 1.0, 0.0, 0.0 );
+    particle->setEnergy( 2.5 );
+    particle->setTime( 5e-11 );
+    particle->setWeight( 1.0 );
+
+    double start_point[3] = { 1.0, 1.0, 1.0 };
+    double end_point[3] = { 2.0, 1.0, 1.0 };
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( *particle,
+                                                                  start_point,
+                                                                  end_point );
+
+    particle->setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( *particle );
+    particle_tracker.commitHistoryContribution();
+  }
+
+  FRENSIE_CHECK_EQUAL( particle_tracker.getCellFilter().size(), 2 );
+
+  MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+  particle_tracker.getHistoryData( history_map );
+
+  FRENSIE_CHECK_EQUAL( history_map.size(), 2 );
+  FRENSIE_CHECK( history_map.count( 0 ) );
+  FRENSIE_CHECK( history_map.count( 3 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the history data can be streamed to a file
+FRENSIE_UNIT_TEST( ParticleTracker, setHistoryDataOutputFile )
+{
+  MonteCarlo::ParticleTracker particle_tracker( 0, 100 );
+
+  FRENSIE_CHECK( !particle_tracker.isHistoryDataStreamed() );
+
+  particle_tracker.setHistoryDataOutputFile( "test_particle_tracker.ptrk", 2 );
+
+  FRENSIE_CHECK( particle_tracker.isHistoryDataStreamed() );
+
+  unsigned threads = Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  particle_tracker.enableThreadSupport( threads );
+
+  #pragma omp parallel for num_threads( threads )
+  for( size_t i = 0; i < 9; ++i )
+  {
+    std::unique_ptr<MonteCarlo::ParticleState> particle;
+
+    if( i%2 == 0 )
+      particle.reset( new MonteCarlo::PhotonState( i ) );
+    else
+      particle.reset( new MonteCarlo::ElectronState( i ) );
+
+    particle->setPosition( 2.0, 1.0, 1.0 );
+    particle->setDirection( 1.0, 0.0, 0.0 );
+    particle->setEnergy( 2.5 );
+    particle->setTime( 5e-11 );
+    particle->setWeight( 1.0 );
+
+    double start_point[3] = { 1.0, 1.0, 1.0 };
+    double end_point[3] = { 2.0, 1.0, 1.0 };
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( *particle,
+                                                                  start_point,
+                                                                  end_point );
+
+    particle->setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( *particle );
+    particle_tracker.commitHistoryContribution();
+  }
+
+  particle_tracker.flushHistoryData();
+
+  // Streamed history data is not stored in memory
+  MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+  particle_tracker.getHistoryData( history_map );
+
+  FRENSIE_CHECK( history_map.empty() );
+
+  MonteCarlo::ParticleTrackerHistoryReader
+    history_reader( particle_tracker.getHistoryDataOutputFileName() );
+
+  FRENSIE_CHECK_EQUAL( history_reader.getNumberOfHistories(), 9 );
+  FRENSIE_CHECK( !history_reader.hasHistoryData( 9 ) );
+
+  for( size_t i = 0; i < 9; ++i )
+  {
+    FRENSIE_REQUIRE( history_reader.hasHistoryData( i ) );
+
+    MonteCarlo::ParticleTracker::ParticleTypeSubmap history_data;
+
+    history_reader.getHistoryData( i, history_data );
+
+    MonteCarlo::ParticleType particle_type =
+      (i%2 == 0 ? MonteCarlo::PHOTON : MonteCarlo::ELECTRON);
+
+    FRENSIE_REQUIRE( history_data.find( particle_type ) !=
+                     history_data.end() );
+    FRENSIE_REQUIRE( history_data[particle_type].find( 0 ) !=
+                     history_data[particle_type].end() );
+    FRENSIE_REQUIRE( history_data[particle_type][0].find( 0 ) !=
+                     history_data[particle_type][0].end() );
+
+    const MonteCarlo::ParticleTracker::ParticleDataArray& particle_data =
+      history_data[particle_type][0][0];
+
+    FRENSIE_REQUIRE_EQUAL( particle_data.size(), 2 );
+    FRENSIE_CHECK_EQUAL( Utility::get<0>( particle_data[0] ),
+                         (std::array<double,3>( {1.0, 1.0, 1.0} )) );
+    FRENSIE_CHECK_EQUAL( Utility::get<0>( particle_data[1] ),
+                         (std::array<double,3>( {2.0, 1.0, 1.0} )) );
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<3>( particle_data[1] ),
+                                     5.0e-11,
+                                     1e-15 );
+  }
+
+  history_reader.getHistoryData( history_map );
+
+  FRENSIE_CHECK_EQUAL( history_map.size(), 9 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an estimator can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceFluxEstimator,
@@ -524,6 +733,119 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceFluxEstimator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a streaming tracker can be archived and restarted
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleTracker,
+                                   archive_streamed,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  // Track a single photon history
+  auto track_history = []( MonteCarlo::ParticleTracker& particle_tracker,
+                           const uint64_t history )
+  {
+    MonteCarlo::PhotonState particle( history );
+
+    particle.setPosition( 2.0, 1.0, 1.0 );
+    particle.setDirection( 1.0, 0.0, 0.0 );
+    particle.setEnergy( 2.5 );
+    particle.setTime( 5e-11 );
+    particle.setWeight( 1.0 );
+
+    double start_point[3] = { 1.0, 1.0, 1.0 };
+    double end_point[3] = { 2.0, 1.0, 1.0 };
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                                  start_point,
+                                                                  end_point );
+
+    particle.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( particle );
+    particle_tracker.commitHistoryContribution();
+  };
+
+  std::string archive_base_name( "test_particle_tracker_streamed" );
+  std::ostringstream archive_ostream;
+
+  boost::filesystem::path history_file_name;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::ParticleTracker>
+      particle_tracker( new MonteCarlo::ParticleTracker( 0, 100 ) );
+
+    particle_tracker->setHistoryDataOutputFile(
+                               "test_particle_tracker_restart.ptrk", 1 );
+
+    history_file_name = particle_tracker->getHistoryDataOutputFileName();
+
+    for( size_t i = 0; i < 4; ++i )
+      track_history( *particle_tracker, i );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( particle_tracker ) );
+
+    // These histories were tracked after the rendezvous - they must be
+    // discarded on restart
+    track_history( *particle_tracker, 4 );
+    track_history( *particle_tracker, 5 );
+
+    particle_tracker->flushHistoryData();
+  }
+
+  {
+    MonteCarlo::ParticleTrackerHistoryReader history_reader( history_file_name );
+
+    FRENSIE_REQUIRE_EQUAL( history_reader.getNumberOfHistories(), 6 );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::ParticleTracker> particle_tracker;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( particle_tracker ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK( particle_tracker->isHistoryDataStreamed() );
+  FRENSIE_CHECK_EQUAL( particle_tracker->getHistoryDataOutputFileName().string(),
+                       history_file_name.string() );
+
+  // Loading the tracker must not modify the history data output file
+  {
+    MonteCarlo::ParticleTrackerHistoryReader history_reader( history_file_name );
+
+    FRENSIE_CHECK_EQUAL( history_reader.getNumberOfHistories(), 6 );
+  }
+
+  // Restart the tracking
+  track_history( *particle_tracker, 6 );
+
+  particle_tracker->flushHistoryData();
+
+  MonteCarlo::ParticleTrackerHistoryReader history_reader( history_file_name );
+
+  FRENSIE_CHECK_EQUAL( history_reader.getNumberOfHistories(), 5 );
+  FRENSIE_CHECK( history_reader.hasHistoryData( 0 ) );
+  FRENSIE_CHECK( history_reader.hasHistoryData( 3 ) );
+  FRENSIE_CHECK( !history_reader.hasHistoryData( 4 ) );
+  FRENSIE_CHECK( !history_reader.hasHistoryData( 5 ) );
+  FRENSIE_CHECK( history_reader.hasHistoryData( 6 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
@@ -6,55 +6,547 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_WeightWindowMesh.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const std::string WeightWindowMesh::s_archive_name( "weight_windows" );
+
 // Constructor
 WeightWindowMesh::WeightWindowMesh()
-  : d_meshes()
+  : d_weight_windows(),
+    d_max_split_number( 5 )
 { /* ... */ }
 
-// Set the mesh for a particle
-void WeightWindowMesh::setMesh(
+// Set the weight windows for a particle type
+/*! \details The lower and upper bounds must be ordered by element index
+ * first and then by energy bin index (i.e. the energy bins of an element are
+ * stored contiguously). The element index is the position of the element
+ * handle in the mesh element handle list.
+ */
+void WeightWindowMesh::setWeightWindows(
+                              const ParticleType particle_type,
                               const std::shared_ptr<const Utility::Mesh>& mesh,
-                              const ParticleType particle_type )
+                              const std::vector<double>& energy_bin_boundaries,
+                              const std::vector<double>& lower_bounds,
+                              const std::vector<double>& upper_bounds )
 {
   // Make sure that the mesh pointer is valid
   testPrecondition( mesh.get() );
-  
-  d_meshes[particle_type] = mesh;
+
+  TEST_FOR_EXCEPTION( energy_bin_boundaries.size() < 2,
+                      std::runtime_error,
+                      "At least one weight window energy bin must be "
+                      "specified!" );
+
+  TEST_FOR_EXCEPTION( !Utility::Sort::isSortedAscending(
+                                               energy_bin_boundaries.begin(),
+                                               energy_bin_boundaries.end() ),
+                      std::runtime_error,
+                      "The weight window energy bin boundaries must be "
+                      "sorted!" );
+
+  const size_t number_of_windows =
+    mesh->getNumberOfElements()*(energy_bin_boundaries.size()-1);
+
+  TEST_FOR_EXCEPTION( lower_bounds.size() != number_of_windows,
+                      std::runtime_error,
+                      "There must be " << number_of_windows << " weight "
+                      "window lower bounds (" << lower_bounds.size() <<
+                      " were specified)!" );
+
+  TEST_FOR_EXCEPTION( upper_bounds.size() != number_of_windows,
+                      std::runtime_error,
+                      "There must be " << number_of_windows << " weight "
+                      "window upper bounds (" << upper_bounds.size() <<
+                      " were specified)!" );
+
+  for( size_t i = 0; i < number_of_windows; ++i )
+  {
+    TEST_FOR_EXCEPTION( lower_bounds[i] < 0.0,
+                        std::runtime_error,
+                        "The weight window lower bounds must not be "
+                        "negative!" );
+
+    TEST_FOR_EXCEPTION( lower_bounds[i] > 0.0 &&
+                        upper_bounds[i] <= lower_bounds[i],
+                        std::runtime_error,
+                        "The weight window upper bounds must be greater "
+                        "than the lower bounds!" );
+  }
+
+  ParticleTypeWeightWindowData& ww_data = d_weight_windows[particle_type];
+
+  ww_data.mesh = mesh;
+  ww_data.energy_bin_boundaries = energy_bin_boundaries;
+  ww_data.lower_bounds = lower_bounds;
+  ww_data.upper_bounds = upper_bounds;
+
+  this->initializeElementIndices( ww_data );
+}
+
+// Import the weight windows from an MCNP style weight window file
+/*! \details Only rectangular, time independent weight window files (wwinp)
+ * are supported. The particle indices 1, 2 and 3 in the file correspond to
+ * neutrons, photons and electrons respectively. The file only stores the
+ * lower bounds - the upper bounds will be set to the lower bounds multiplied
+ * by the upper bound ratio.
+ */
+void WeightWindowMesh::importWeightWindowFile(
+                                   const boost::filesystem::path& ww_file_name,
+                                   const double upper_bound_ratio )
+{
+  // Make sure that the upper bound ratio is valid
+  testPrecondition( upper_bound_ratio > 1.0 );
+
+  std::ifstream ww_file( ww_file_name.string() );
+
+  TEST_FOR_EXCEPTION( !ww_file.good(),
+                      std::runtime_error,
+                      "The weight window file " << ww_file_name.string() <<
+                      " could not be opened!" );
+
+  // Read a value from the file (all values are read as floating point
+  // values since integers are written in floating point format in some
+  // blocks)
+  auto read_value = [&ww_file, &ww_file_name]() -> double
+  {
+    double value;
+
+    ww_file >> value;
+
+    TEST_FOR_EXCEPTION( ww_file.fail(),
+                        std::runtime_error,
+                        "The weight window file " << ww_file_name.string() <<
+                        " is not valid!" );
+
+    return value;
+  };
+
+  auto read_int = [&read_value]() -> int
+  { return (int)std::round( read_value() ); };
+
+  // Read the header (if iv ni nr probid)
+  std::string header;
+
+  std::getline( ww_file, header );
+
+  int file_type, time_flag, number_of_particles, mesh_type;
+
+  {
+    std::istringstream header_stream( header );
+
+    header_stream >> file_type >> time_flag >> number_of_particles
+                  >> mesh_type;
+
+    TEST_FOR_EXCEPTION( header_stream.fail(),
+                        std::runtime_error,
+                        "The weight window file " << ww_file_name.string() <<
+                        " has an invalid header!" );
+  }
+
+  TEST_FOR_EXCEPTION( time_flag != 1,
+                      std::runtime_error,
+                      "Time dependent weight window files are not "
+                      "supported!" );
+
+  TEST_FOR_EXCEPTION( mesh_type != 10,
+                      std::runtime_error,
+                      "Only rectangular weight window meshes are "
+                      "supported!" );
+
+  // Read the number of energy bins of each particle type
+  std::vector<int> number_of_energy_bins( number_of_particles );
+
+  for( size_t i = 0; i < number_of_energy_bins.size(); ++i )
+    number_of_energy_bins[i] = read_int();
+
+  // Read the mesh info (nfx nfy nfz x0 y0 z0 ncx ncy ncz nwg)
+  int number_of_fine_meshes[3];
+
+  for( size_t d = 0; d < 3; ++d )
+    number_of_fine_meshes[d] = read_int();
+
+  for( size_t d = 0; d < 3; ++d )
+    read_value();
+
+  int number_of_coarse_meshes[3];
+
+  for( size_t d = 0; d < 3; ++d )
+    number_of_coarse_meshes[d] = read_int();
+
+  TEST_FOR_EXCEPTION( read_int() != 1,
+                      std::runtime_error,
+                      "Only rectangular weight window meshes are "
+                      "supported!" );
+
+  // Read the coarse mesh data of each dimension (x0 (q p s)...) and
+  // construct the fine mesh planes
+  std::vector<double> planes[3];
+
+  for( size_t d = 0; d < 3; ++d )
+  {
+    planes[d].push_back( read_value() );
+
+    for( int i = 0; i < number_of_coarse_meshes[d]; ++i )
+    {
+      const int number_of_intervals = read_int();
+      const double coarse_mesh_upper_bound = read_value();
+
+      // The fine mesh ratio is always one
+      read_value();
+
+      TEST_FOR_EXCEPTION( number_of_intervals < 1 ||
+                          coarse_mesh_upper_bound <= planes[d].back(),
+                          std::runtime_error,
+                          "The weight window file " << ww_file_name.string() <<
+                          " has an invalid coarse mesh!" );
+
+      const double coarse_mesh_lower_bound = planes[d].back();
+
+      for( int j = 1; j < number_of_intervals; ++j )
+      {
+        planes[d].push_back( coarse_mesh_lower_bound +
+                             j*(coarse_mesh_upper_bound -
+                                coarse_mesh_lower_bound)/number_of_intervals );
+      }
+
+      planes[d].push_back( coarse_mesh_upper_bound );
+    }
+
+    TEST_FOR_EXCEPTION( planes[d].size() !=
+                        (size_t)number_of_fine_meshes[d] + 1,
+                        std::runtime_error,
+                        "The weight window file " << ww_file_name.string() <<
+                        " has an inconsistent fine mesh!" );
+  }
+
+  std::shared_ptr<const Utility::Mesh> mesh(
+               new Utility::StructuredHexMesh( planes[0], planes[1], planes[2] ) );
+
+  const size_t number_of_elements = mesh->getNumberOfElements();
+
+  // Read the energy bins and the lower bounds of each particle type
+  for( int p = 0; p < number_of_particles; ++p )
+  {
+    if( number_of_energy_bins[p] == 0 )
+      continue;
+
+    std::vector<double> energy_bin_boundaries( 1, 0.0 );
+
+    for( int e = 0; e < number_of_energy_bins[p]; ++e )
+      energy_bin_boundaries.push_back( read_value() );
+
+    // The file stores the lower bounds by energy bin first (with the x
+    // index varying fastest)
+    std::vector<double> lower_bounds( number_of_elements*number_of_energy_bins[p] );
+    std::vector<double> upper_bounds( lower_bounds.size() );
+
+    for( int e = 0; e < number_of_energy_bins[p]; ++e )
+    {
+      for( size_t i = 0; i < number_of_elements; ++i )
+      {
+        const size_t window_index = i*number_of_energy_bins[p] + e;
+
+        lower_bounds[window_index] = read_value();
+
+        // Negative bounds are used to indicate that a mesh element is
+        // outside of the geometry
+        if( lower_bounds[window_index] < 0.0 )
+          lower_bounds[window_index] = 0.0;
+
+        upper_bounds[window_index] =
+          lower_bounds[window_index]*upper_bound_ratio;
+      }
+    }
+
+    ParticleType particle_type;
+
+    if( p == 0 )
+      particle_type = NEUTRON;
+    else if( p == 1 )
+      particle_type = PHOTON;
+    else if( p == 2 )
+      particle_type = ELECTRON;
+    else
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "WeightWindowMesh",
+                                  "The weight windows for particle index "
+                                  << p+1 << " in weight window file "
+                                  << ww_file_name.string() <<
+                                  " will be ignored!" );
+
+      continue;
+    }
+
+    this->setWeightWindows( particle_type,
+                            mesh,
+                            energy_bin_boundaries,
+                            lower_bounds,
+                            upper_bounds );
+  }
+}
+
+// Check if weight windows have been set for the particle type
+bool WeightWindowMesh::hasWeightWindows(
+                                       const ParticleType particle_type ) const
+{
+  return d_weight_windows.find( particle_type ) != d_weight_windows.end();
+}
+
+// Return the particle types that have weight windows
+void WeightWindowMesh::getParticleTypes(
+                                 std::set<ParticleType>& particle_types ) const
+{
+  ParticleTypeWeightWindowDataMap::const_iterator ww_data_it =
+    d_weight_windows.begin();
+
+  while( ww_data_it != d_weight_windows.end() )
+  {
+    particle_types.insert( ww_data_it->first );
+
+    ++ww_data_it;
+  }
+}
+
+// Return the mesh for a particle type
+const Utility::Mesh& WeightWindowMesh::getMesh(
+                                       const ParticleType particle_type ) const
+{
+  // Make sure that there are weight windows for the particle type
+  testPrecondition( this->hasWeightWindows( particle_type ) );
+
+  return *d_weight_windows.find( particle_type )->second.mesh;
+}
+
+// Return the energy bin boundaries for a particle type
+const std::vector<double>& WeightWindowMesh::getEnergyBinBoundaries(
+                                       const ParticleType particle_type ) const
+{
+  // Make sure that there are weight windows for the particle type
+  testPrecondition( this->hasWeightWindows( particle_type ) );
+
+  return d_weight_windows.find( particle_type )->second.energy_bin_boundaries;
+}
+
+// Return the weight window bounds at a phase space point
+/*! \details If there is no weight window at the phase space point false will
+ * be returned.
+ */
+bool WeightWindowMesh::getWeightWindowBounds( const ParticleType particle_type,
+                                              const double position[3],
+                                              const double energy,
+                                              double& lower_bound,
+                                              double& upper_bound ) const
+{
+  ParticleTypeWeightWindowDataMap::const_iterator ww_data_it =
+    d_weight_windows.find( particle_type );
+
+  if( ww_data_it != d_weight_windows.end() )
+  {
+    size_t window_index;
+
+    if( this->findWeightWindowIndex( ww_data_it->second,
+                                     position,
+                                     energy,
+                                     window_index ) )
+    {
+      lower_bound = ww_data_it->second.lower_bounds[window_index];
+      upper_bound = ww_data_it->second.upper_bounds[window_index];
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Set the max number of particles that a particle can be split into
+void WeightWindowMesh::setMaxSplitNumber( const unsigned max_split_number )
+{
+  // Make sure that the max split number is valid
+  testPrecondition( max_split_number > 0 );
+
+  d_max_split_number = max_split_number;
+}
+
+// Return the max number of particles that a particle can be split into
+unsigned WeightWindowMesh::getMaxSplitNumber() const
+{
+  return d_max_split_number;
+}
+
+// The name that will be used when archiving the object
+const char* WeightWindowMesh::getArchiveName() const
+{
+  return s_archive_name.c_str();
+}
+
+// Initialize the mesh element indices
+/*! \details The element index map is only needed when the element handles
+ * are not already the element indices (e.g. tet meshes).
+ */
+void WeightWindowMesh::initializeElementIndices(
+                                        ParticleTypeWeightWindowData& ww_data )
+{
+  ww_data.element_indices.clear();
+
+  Utility::Mesh::ElementHandleIterator element_it =
+    ww_data.mesh->getStartElementHandleIterator();
+
+  bool handles_are_indices = true;
+  size_t index = 0;
+
+  while( element_it != ww_data.mesh->getEndElementHandleIterator() )
+  {
+    ww_data.element_indices[*element_it] = index;
+
+    if( *element_it != index )
+      handles_are_indices = false;
+
+    ++element_it;
+    ++index;
+  }
+
+  if( handles_are_indices )
+    ww_data.element_indices.clear();
+}
+
+// Find the weight window index at a phase space point
+bool WeightWindowMesh::findWeightWindowIndex(
+                                 const ParticleTypeWeightWindowData& ww_data,
+                                 const double position[3],
+                                 const double energy,
+                                 size_t& window_index )
+{
+  const std::vector<double>& energy_bin_boundaries =
+    ww_data.energy_bin_boundaries;
+
+  if( energy < energy_bin_boundaries.front() ||
+      energy > energy_bin_boundaries.back() )
+    return false;
+
+  if( !ww_data.mesh->isPointInMesh( position ) )
+    return false;
+
+  const ElementHandle element = ww_data.mesh->whichElementIsPointIn( position );
+
+  size_t element_index;
+
+  if( ww_data.element_indices.empty() )
+    element_index = element;
+  else
+  {
+    std::unordered_map<ElementHandle,size_t>::const_iterator element_it =
+      ww_data.element_indices.find( element );
+
+    if( element_it == ww_data.element_indices.end() )
+      return false;
+
+    element_index = element_it->second;
+  }
+
+  size_t energy_bin;
+
+  if( energy == energy_bin_boundaries.back() )
+    energy_bin = energy_bin_boundaries.size() - 2;
+  else
+  {
+    energy_bin =
+      Utility::Search::binaryLowerBoundIndex( energy_bin_boundaries.begin(),
+                                              energy_bin_boundaries.end(),
+                                              energy );
+  }
+
+  window_index = element_index*(energy_bin_boundaries.size()-1) + energy_bin;
+
+  return true;
 }
 
 // Update the particle state and bank
+/*! \details A particle with a weight below the window will survive roulette
+ * with probability 'weight'/'survival weight'. A particle with a weight
+ * above the window will be split into ceil('weight'/'upper bound')
+ * particles (no more than the max split number). The split particles will be
+ * added to the bank.
+ */
 void WeightWindowMesh::updateParticleState( ParticleState& particle,
                                             ParticleBank& bank ) const
 {
-  ParticleTypeMeshMap::const_iterator mesh_it =
-    d_meshes.find( particle.getParticleType() );
-  
-  if( mesh_it != d_meshes.end() )
+  ParticleTypeWeightWindowDataMap::const_iterator ww_data_it =
+    d_weight_windows.find( particle.getParticleType() );
+
+  if( ww_data_it == d_weight_windows.end() )
+    return;
+
+  const ParticleTypeWeightWindowData& ww_data = ww_data_it->second;
+
+  size_t window_index;
+
+  if( !this->findWeightWindowIndex( ww_data,
+                                    particle.getPosition(),
+                                    particle.getEnergy(),
+                                    window_index ) )
+    return;
+
+  const double lower_bound = ww_data.lower_bounds[window_index];
+
+  // A lower bound of zero indicates that there is no window
+  if( lower_bound <= 0.0 )
+    return;
+
+  const double upper_bound = ww_data.upper_bounds[window_index];
+  const double weight = particle.getWeight();
+
+  // Roulette
+  if( weight < lower_bound )
   {
-    // Determine if the particle needs to be killed, split or left alone
-    std::shared_ptr<ParticleState> split_particle;
-  
-    // Killed
-    // particle.setAsGone();
-
-    // Split
-    // particle.setWeight( x );
-    // split_particle.reset( particle.clone() );
-
-    // Add the split particle to the bank
-    if( split_particle )
-      bank.push( split_particle );
+    const double survival_weight = 0.5*(lower_bound + upper_bound);
+
+    if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+        survival_weight < weight )
+      particle.setWeight( survival_weight );
+    else
+      particle.setAsGone();
+  }
+  // Split
+  else if( weight > upper_bound )
+  {
+    const double split_ratio = weight/upper_bound;
+
+    const unsigned number_of_particles =
+      (split_ratio >= d_max_split_number ? d_max_split_number :
+       (unsigned)std::ceil( split_ratio ));
+
+    if( number_of_particles > 1 )
+    {
+      particle.setWeight( weight/number_of_particles );
+
+      for( unsigned i = 1; i < number_of_particles; ++i )
+      {
+        std::shared_ptr<ParticleState> split_particle( particle.clone() );
+
+        bank.push( split_particle );
+      }
+    }
   }
 }
-  
+
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( WeightWindowMesh, MonteCarlo );
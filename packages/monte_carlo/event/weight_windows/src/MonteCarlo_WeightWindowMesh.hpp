@@ -12,19 +12,39 @@
 // Std Lib Includes
 #include <memory>
 
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
 // FRENSIE Includes
 #include "MonteCarlo_WeightWindow.hpp"
 #include "Utility_Mesh.hpp"
+#include "Utility_ArchivableObject.hpp"
 #include "Utility_Map.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
 
-//! The weight window mesh class
-class WeightWindowMesh : public WeightWindow
+/*! The weight window mesh class
+ * \details Energy dependent lower and upper weight bounds are stored for
+ * every element of a (structured hex or tet) mesh. The windows of each
+ * particle type are stored in a single flat array with the energy bins of
+ * an element stored contiguously. A particle with a weight below the lower
+ * bound of its window will undergo Russian roulette (the survival weight is
+ * the center of the window). A particle with a weight above the upper bound
+ * will be split. Windows with a lower bound of zero are ignored. The
+ * weight windows can be saved to and loaded from an archive file (e.g. to
+ * reuse the windows produced by a weight window mesh generator).
+ */
+class WeightWindowMesh : public WeightWindow,
+                         public Utility::ArchivableObject<WeightWindowMesh>
 {
 
 public:
 
+  //! The mesh element handle
+  typedef Utility::Mesh::ElementHandle ElementHandle;
+
   //! Constructor
   WeightWindowMesh();
 
@@ -32,21 +52,97 @@ public:
   ~WeightWindowMesh()
   { /* ... */ }
 
-  //! Set the mesh for a particle
-  void setMesh( const std::shared_ptr<const Utility::Mesh>& mesh,
-                const ParticleType particle_type );
+  //! Set the weight windows for a particle type
+  void setWeightWindows( const ParticleType particle_type,
+                         const std::shared_ptr<const Utility::Mesh>& mesh,
+                         const std::vector<double>& energy_bin_boundaries,
+                         const std::vector<double>& lower_bounds,
+                         const std::vector<double>& upper_bounds );
+
+  //! Import the weight windows from an MCNP style weight window file
+  void importWeightWindowFile( const boost::filesystem::path& ww_file_name,
+                               const double upper_bound_ratio = 5.0 );
+
+  //! Check if weight windows have been set for the particle type
+  bool hasWeightWindows( const ParticleType particle_type ) const;
+
+  //! Return the particle types that have weight windows
+  void getParticleTypes( std::set<ParticleType>& particle_types ) const;
+
+  //! Return the mesh for a particle type
+  const Utility::Mesh& getMesh( const ParticleType particle_type ) const;
+
+  //! Return the energy bin boundaries for a particle type
+  const std::vector<double>& getEnergyBinBoundaries(
+                                       const ParticleType particle_type ) const;
+
+  //! Return the weight window bounds at a phase space point
+  bool getWeightWindowBounds( const ParticleType particle_type,
+                              const double position[3],
+                              const double energy,
+                              double& lower_bound,
+                              double& upper_bound ) const;
+
+  //! Set the max number of particles that a particle can be split into
+  void setMaxSplitNumber( const unsigned max_split_number );
+
+  //! Return the max number of particles that a particle can be split into
+  unsigned getMaxSplitNumber() const;
 
   //! Update the particle state and bank
   void updateParticleState( ParticleState& particle,
                             ParticleBank& bank ) const final override;
 
+  //! The name that will be used when archiving the object
+  const char* getArchiveName() const final override;
+
 private:
 
-  // Save the collision forcer data to an archive
+  // The weight window data of a particle type
+  struct ParticleTypeWeightWindowData
+  {
+    // The mesh
+    std::shared_ptr<const Utility::Mesh> mesh;
+
+    // The energy bin boundaries
+    std::vector<double> energy_bin_boundaries;
+
+    // The lower bounds (element index, energy bin index)
+    std::vector<double> lower_bounds;
+
+    // The upper bounds (element index, energy bin index)
+    std::vector<double> upper_bounds;
+
+    // The mesh element indices (empty if the handles are the indices)
+    std::unordered_map<ElementHandle,size_t> element_indices;
+
+    // Serialize the data (the element indices are not archived)
+    template<typename Archive>
+    void serialize( Archive& ar, const unsigned version )
+    {
+      ar & BOOST_SERIALIZATION_NVP( mesh );
+      ar & BOOST_SERIALIZATION_NVP( energy_bin_boundaries );
+      ar & BOOST_SERIALIZATION_NVP( lower_bounds );
+      ar & BOOST_SERIALIZATION_NVP( upper_bounds );
+    }
+  };
+
+  // Initialize the mesh element indices
+  static void initializeElementIndices(
+                                    ParticleTypeWeightWindowData& ww_data );
+
+  // Find the weight window index at a phase space point
+  static bool findWeightWindowIndex(
+                                 const ParticleTypeWeightWindowData& ww_data,
+                                 const double position[3],
+                                 const double energy,
+                                 size_t& window_index );
+
+  // Save the weight window data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
 
-  // Load the collision forcer data from an archive
+  // Load the weight window data from an archive
   template<typename Archive>
   void load( Archive& ar, const unsigned version );
 
@@ -55,25 +151,39 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
-  // The weight window meshes
-  typedef std::map<ParticleType,std::shared_ptr<const Utility::Mesh> > ParticleTypeMeshMap;
-  ParticleTypeMeshMap d_meshes;
+  // The archive name
+  static const std::string s_archive_name;
+
+  // The weight window data
+  typedef std::map<ParticleType,ParticleTypeWeightWindowData> ParticleTypeWeightWindowDataMap;
+  ParticleTypeWeightWindowDataMap d_weight_windows;
+
+  // The max number of particles that a particle can be split into
+  unsigned d_max_split_number;
 };
 
-// Save the collision forcer data to an archive
+// Save the weight window data to an archive
 template<typename Archive>
 void WeightWindowMesh::save( Archive& ar, const unsigned version ) const
 {
-  ar & BOOST_SERIALIZATION_NVP( d_meshes );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindow );
+  ar & BOOST_SERIALIZATION_NVP( d_weight_windows );
+  ar & BOOST_SERIALIZATION_NVP( d_max_split_number );
 }
 
-// Load the collision forcer data from an archive
+// Load the weight window data from an archive
 template<typename Archive>
 void WeightWindowMesh::load( Archive& ar, const unsigned version )
 {
-  ar & BOOST_SERIALIZATION_NVP( d_meshes );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindow );
+  ar & BOOST_SERIALIZATION_NVP( d_weight_windows );
+  ar & BOOST_SERIALIZATION_NVP( d_max_split_number );
+
+  // Rebuild the mesh element indices
+  for( auto&& ww_data : d_weight_windows )
+    this->initializeElementIndices( ww_data.second );
 }
-  
+
 } // end MonteCarlo namespace
 
 BOOST_CLASS_VERSION( MonteCarlo::WeightWindowMesh, 0 );
@@ -0,0 +1,267 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+WeightWindowMeshGenerator::WeightWindowMeshGenerator()
+{ /* ... */ }
+
+// Constructor
+WeightWindowMeshGenerator::WeightWindowMeshGenerator(
+                              const Id id,
+                              const std::shared_ptr<const Utility::Mesh>& mesh,
+                              const std::vector<double>& energy_bin_boundaries,
+                              const ImportanceType importance_type )
+  : WeightMultipliedMeshTrackLengthFluxEstimator( id, 1.0, mesh ),
+    d_mesh( mesh ),
+    d_energy_bin_boundaries( energy_bin_boundaries ),
+    d_importance_type( importance_type ),
+    d_reference_lower_bound( 0.5 ),
+    d_upper_bound_ratio( 5.0 ),
+    d_max_relative_error( 1.0 )
+{
+  TEST_FOR_EXCEPTION( energy_bin_boundaries.size() < 2,
+                      std::runtime_error,
+                      "At least one weight window energy bin must be "
+                      "specified!" );
+
+  this->setDiscretization<OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+}
+
+// Return the importance type
+WeightWindowMeshGenerator::ImportanceType
+WeightWindowMeshGenerator::getImportanceType() const
+{
+  return d_importance_type;
+}
+
+// Set the reference lower bound
+/*! \details The most important element (in each energy group for the
+ * forward flux importance) will have this lower bound.
+ */
+void WeightWindowMeshGenerator::setReferenceLowerBound(
+                                           const double reference_lower_bound )
+{
+  TEST_FOR_EXCEPTION( reference_lower_bound <= 0.0,
+                      std::runtime_error,
+                      "The reference lower bound must be greater than "
+                      "zero!" );
+
+  d_reference_lower_bound = reference_lower_bound;
+}
+
+// Return the reference lower bound
+double WeightWindowMeshGenerator::getReferenceLowerBound() const
+{
+  return d_reference_lower_bound;
+}
+
+// Set the upper bound ratio
+void WeightWindowMeshGenerator::setUpperBoundRatio(
+                                               const double upper_bound_ratio )
+{
+  TEST_FOR_EXCEPTION( upper_bound_ratio <= 1.0,
+                      std::runtime_error,
+                      "The upper bound ratio must be greater than one!" );
+
+  d_upper_bound_ratio = upper_bound_ratio;
+}
+
+// Return the upper bound ratio
+double WeightWindowMeshGenerator::getUpperBoundRatio() const
+{
+  return d_upper_bound_ratio;
+}
+
+// Set the max relative error of an element flux that will be used
+void WeightWindowMeshGenerator::setMaxRelativeError(
+                                              const double max_relative_error )
+{
+  TEST_FOR_EXCEPTION( max_relative_error <= 0.0,
+                      std::runtime_error,
+                      "The max relative error must be greater than zero!" );
+
+  d_max_relative_error = max_relative_error;
+}
+
+// Return the max relative error of an element flux that will be used
+double WeightWindowMeshGenerator::getMaxRelativeError() const
+{
+  return d_max_relative_error;
+}
+
+// Return the particle type that the weight windows will be generated for
+/*! \details When the adjoint flux is used as the importance the weight
+ * windows will be generated for the forward particle type that corresponds
+ * to the adjoint particle type assigned to the generator.
+ */
+ParticleType WeightWindowMeshGenerator::getWeightWindowParticleType() const
+{
+  TEST_FOR_EXCEPTION( this->getParticleTypes().empty(),
+                      std::runtime_error,
+                      "Weight window mesh generator " << this->getId() <<
+                      " does not have a particle type assigned!" );
+
+  const ParticleType particle_type = *this->getParticleTypes().begin();
+
+  if( d_importance_type == ADJOINT_FLUX_IMPORTANCE )
+  {
+    switch( particle_type )
+    {
+      case ADJOINT_PHOTON: return PHOTON;
+      case ADJOINT_NEUTRON: return NEUTRON;
+      case ADJOINT_ELECTRON: return ELECTRON;
+      case ADJOINT_POSITRON: return POSITRON;
+      default:
+      {
+        THROW_EXCEPTION( std::runtime_error,
+                         "Weight window mesh generator " << this->getId() <<
+                         " uses the adjoint flux as the importance but a "
+                         "forward particle type (" << particle_type <<
+                         ") has been assigned!" );
+      }
+    }
+  }
+
+  return particle_type;
+}
+
+// Generate the weight windows from the current estimator data
+std::shared_ptr<WeightWindowMesh>
+WeightWindowMeshGenerator::generateWeightWindows() const
+{
+  const size_t num_energy_bins = d_energy_bin_boundaries.size() - 1;
+
+  TEST_FOR_EXCEPTION( this->getNumberOfBins() != num_energy_bins,
+                      std::runtime_error,
+                      "Weight window mesh generator " << this->getId() <<
+                      " can only have energy bins!" );
+
+  const ParticleType ww_particle_type = this->getWeightWindowParticleType();
+
+  // Collect the element importances (the mean of the first response
+  // function) - unusable elements will have an importance of zero
+  std::vector<double> importances;
+  importances.reserve( d_mesh->getNumberOfElements()*num_energy_bins );
+
+  Utility::Mesh::ElementHandleIterator element_it =
+    d_mesh->getStartElementHandleIterator();
+
+  Utility::Mesh::ElementHandleIterator end_element_it =
+    d_mesh->getEndElementHandleIterator();
+
+  while( element_it != end_element_it )
+  {
+    std::vector<double> mean, relative_error, variance_of_variance,
+      figure_of_merit;
+
+    this->getEntityBinProcessedData( *element_it,
+                                     mean,
+                                     relative_error,
+                                     variance_of_variance,
+                                     figure_of_merit );
+
+    for( size_t i = 0; i < num_energy_bins; ++i )
+    {
+      if( mean[i] > 0.0 && relative_error[i] <= d_max_relative_error )
+        importances.push_back( mean[i] );
+      else
+        importances.push_back( 0.0 );
+    }
+
+    ++element_it;
+  }
+
+  // Calculate the normalization constants (max forward flux in each energy
+  // group or max adjoint flux over all energy groups)
+  std::vector<double> max_importances( num_energy_bins, 0.0 );
+
+  for( size_t i = 0; i < importances.size(); ++i )
+  {
+    double& max_importance = max_importances[i%num_energy_bins];
+
+    max_importance = std::max( max_importance, importances[i] );
+  }
+
+  if( d_importance_type == ADJOINT_FLUX_IMPORTANCE )
+  {
+    std::fill( max_importances.begin(),
+               max_importances.end(),
+               *std::max_element( max_importances.begin(),
+                                  max_importances.end() ) );
+  }
+
+  // Calculate the bounds
+  std::vector<double> lower_bounds( importances.size(), 0.0 );
+  std::vector<double> upper_bounds( importances.size(), 0.0 );
+
+  for( size_t i = 0; i < importances.size(); ++i )
+  {
+    if( importances[i] > 0.0 )
+    {
+      const double max_importance = max_importances[i%num_energy_bins];
+
+      if( d_importance_type == FORWARD_FLUX_IMPORTANCE )
+      {
+        lower_bounds[i] =
+          d_reference_lower_bound*importances[i]/max_importance;
+      }
+      else
+      {
+        lower_bounds[i] =
+          d_reference_lower_bound*max_importance/importances[i];
+      }
+
+      upper_bounds[i] = lower_bounds[i]*d_upper_bound_ratio;
+    }
+  }
+
+  std::shared_ptr<WeightWindowMesh> weight_windows( new WeightWindowMesh );
+
+  weight_windows->setWeightWindows( ww_particle_type,
+                                    d_mesh,
+                                    d_energy_bin_boundaries,
+                                    lower_bounds,
+                                    upper_bounds );
+
+  return weight_windows;
+}
+
+// Generate the weight windows and save them to an archive file
+/*! \details The file extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin, .h5fa). Any existing file will be overwritten.
+ */
+void WeightWindowMeshGenerator::exportWeightWindows(
+                  const boost::filesystem::path& archive_name_with_path ) const
+{
+  this->generateWeightWindows()->saveToFile( archive_name_with_path, true );
+
+  FRENSIE_LOG_NOTIFICATION( "Weight window mesh generator " << this->getId()
+                            << " weight windows exported to "
+                            << archive_name_with_path.string() );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( WeightWindowMeshGenerator, MonteCarlo );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::WeightWindowMeshGenerator );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
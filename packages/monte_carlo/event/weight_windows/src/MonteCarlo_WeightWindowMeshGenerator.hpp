@@ -0,0 +1,182 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh generator class
+ * \details The generator is a mesh track-length flux estimator (with one
+ * energy bin per weight window energy group) that converts its flux
+ * estimates into weight windows. When the forward flux is used as the
+ * importance (MAGIC method) the lower bound in an element is proportional to
+ * the flux in the element (normalized to the max flux in each energy group).
+ * When the adjoint flux is used as the importance (e.g. from an adjoint
+ * photon or electron run) the lower bound in an element is inversely
+ * proportional to the adjoint flux in the element and the windows will be
+ * generated for the corresponding forward particle type. Elements with no
+ * score or with a relative error above the max relative error will not have
+ * a window. Because the generator is an estimator, its data will be
+ * snapshotted, reduced and archived with the other estimators.
+ * \ingroup particle_subtrack_ending_global_event
+ */
+class WeightWindowMeshGenerator : public WeightMultipliedMeshTrackLengthFluxEstimator
+{
+
+public:
+
+  //! The importance types
+  enum ImportanceType{
+    FORWARD_FLUX_IMPORTANCE = 0,
+    ADJOINT_FLUX_IMPORTANCE
+  };
+
+  //! Constructor
+  WeightWindowMeshGenerator(
+                      const Id id,
+                      const std::shared_ptr<const Utility::Mesh>& mesh,
+                      const std::vector<double>& energy_bin_boundaries,
+                      const ImportanceType importance_type =
+                      FORWARD_FLUX_IMPORTANCE );
+
+  //! Destructor
+  ~WeightWindowMeshGenerator()
+  { /* ... */ }
+
+  //! Return the importance type
+  ImportanceType getImportanceType() const;
+
+  //! Set the reference lower bound
+  void setReferenceLowerBound( const double reference_lower_bound );
+
+  //! Return the reference lower bound
+  double getReferenceLowerBound() const;
+
+  //! Set the upper bound ratio
+  void setUpperBoundRatio( const double upper_bound_ratio );
+
+  //! Return the upper bound ratio
+  double getUpperBoundRatio() const;
+
+  //! Set the max relative error of an element flux that will be used
+  void setMaxRelativeError( const double max_relative_error );
+
+  //! Return the max relative error of an element flux that will be used
+  double getMaxRelativeError() const;
+
+  //! Return the particle type that the weight windows will be generated for
+  ParticleType getWeightWindowParticleType() const;
+
+  //! Generate the weight windows from the current estimator data
+  std::shared_ptr<WeightWindowMesh> generateWeightWindows() const;
+
+  //! Generate the weight windows and save them to an archive file
+  void exportWeightWindows(
+                 const boost::filesystem::path& archive_name_with_path ) const;
+
+private:
+
+  // Default constructor
+  WeightWindowMeshGenerator();
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The mesh
+  std::shared_ptr<const Utility::Mesh> d_mesh;
+
+  // The energy bin boundaries
+  std::vector<double> d_energy_bin_boundaries;
+
+  // The importance type
+  ImportanceType d_importance_type;
+
+  // The reference lower bound
+  double d_reference_lower_bound;
+
+  // The upper bound ratio
+  double d_upper_bound_ratio;
+
+  // The max relative error
+  double d_max_relative_error;
+};
+
+// Save the data to an archive
+template<typename Archive>
+void WeightWindowMeshGenerator::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightMultipliedMeshTrackLengthFluxEstimator );
+
+  // Save the local data
+  ar & BOOST_SERIALIZATION_NVP( d_mesh );
+  ar & BOOST_SERIALIZATION_NVP( d_energy_bin_boundaries );
+
+  int importance_type = (int)d_importance_type;
+
+  ar & BOOST_SERIALIZATION_NVP( importance_type );
+  ar & BOOST_SERIALIZATION_NVP( d_reference_lower_bound );
+  ar & BOOST_SERIALIZATION_NVP( d_upper_bound_ratio );
+  ar & BOOST_SERIALIZATION_NVP( d_max_relative_error );
+}
+
+// Load the data from an archive
+template<typename Archive>
+void WeightWindowMeshGenerator::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightMultipliedMeshTrackLengthFluxEstimator );
+
+  // Load the local data
+  ar & BOOST_SERIALIZATION_NVP( d_mesh );
+  ar & BOOST_SERIALIZATION_NVP( d_energy_bin_boundaries );
+
+  int importance_type;
+
+  ar & BOOST_SERIALIZATION_NVP( importance_type );
+
+  d_importance_type = (ImportanceType)importance_type;
+
+  ar & BOOST_SERIALIZATION_NVP( d_reference_lower_bound );
+  ar & BOOST_SERIALIZATION_NVP( d_upper_bound_ratio );
+  ar & BOOST_SERIALIZATION_NVP( d_max_relative_error );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::WeightWindowMeshGenerator, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightWindowMeshGenerator, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, WeightWindowMeshGenerator );
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,467 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMesh.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_wwinp_file_name;
+
+std::shared_ptr<const Utility::Mesh> mesh;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the test weight windows
+/*! \details The mesh has two elements ([0,1]x[0,1]x[0,1] and
+ * [1,2]x[0,1]x[0,1]) and there are two energy bins ([0,1] and [1,20]). There
+ * is no window in the second element, second energy bin.
+ */
+std::shared_ptr<MonteCarlo::WeightWindowMesh> createWeightWindows()
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    weight_windows( new MonteCarlo::WeightWindowMesh );
+
+  weight_windows->setWeightWindows( MonteCarlo::NEUTRON,
+                                    mesh,
+                                    std::vector<double>( {0.0, 1.0, 20.0} ),
+                                    std::vector<double>( {0.5, 1.0, 0.25, 0.0} ),
+                                    std::vector<double>( {2.5, 5.0, 1.25, 0.0} ) );
+
+  return weight_windows;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be set
+FRENSIE_UNIT_TEST( WeightWindowMesh, setWeightWindows )
+{
+  MonteCarlo::WeightWindowMesh weight_windows;
+
+  FRENSIE_CHECK( !weight_windows.hasWeightWindows( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK_EQUAL( weight_windows.getMaxSplitNumber(), 5 );
+
+  FRENSIE_CHECK_NO_THROW( weight_windows.setWeightWindows(
+                                MonteCarlo::NEUTRON,
+                                mesh,
+                                std::vector<double>( {0.0, 1.0, 20.0} ),
+                                std::vector<double>( {0.5, 1.0, 0.25, 0.0} ),
+                                std::vector<double>( {2.5, 5.0, 1.25, 0.0} ) ) );
+
+  FRENSIE_CHECK( weight_windows.hasWeightWindows( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( !weight_windows.hasWeightWindows( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK_EQUAL( weight_windows.getMesh( MonteCarlo::NEUTRON ).getNumberOfElements(), 2 );
+  FRENSIE_CHECK_EQUAL( weight_windows.getEnergyBinBoundaries( MonteCarlo::NEUTRON ),
+                       std::vector<double>( {0.0, 1.0, 20.0} ) );
+
+  std::set<MonteCarlo::ParticleType> particle_types;
+
+  weight_windows.getParticleTypes( particle_types );
+
+  FRENSIE_CHECK_EQUAL( particle_types, std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+
+  // Invalid energy bins
+  FRENSIE_CHECK_THROW( weight_windows.setWeightWindows(
+                                MonteCarlo::PHOTON,
+                                mesh,
+                                std::vector<double>( {1.0} ),
+                                std::vector<double>(),
+                                std::vector<double>() ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_THROW( weight_windows.setWeightWindows(
+                                MonteCarlo::PHOTON,
+                                mesh,
+                                std::vector<double>( {20.0, 1.0, 0.0} ),
+                                std::vector<double>( {0.5, 1.0, 0.25, 0.0} ),
+                                std::vector<double>( {2.5, 5.0, 1.25, 0.0} ) ),
+                       std::runtime_error );
+
+  // Invalid number of bounds
+  FRENSIE_CHECK_THROW( weight_windows.setWeightWindows(
+                                MonteCarlo::PHOTON,
+                                mesh,
+                                std::vector<double>( {0.0, 1.0, 20.0} ),
+                                std::vector<double>( {0.5, 1.0, 0.25} ),
+                                std::vector<double>( {2.5, 5.0, 1.25, 0.0} ) ),
+                       std::runtime_error );
+
+  // Invalid bounds
+  FRENSIE_CHECK_THROW( weight_windows.setWeightWindows(
+                                MonteCarlo::PHOTON,
+                                mesh,
+                                std::vector<double>( {0.0, 1.0, 20.0} ),
+                                std::vector<double>( {0.5, 1.0, 0.25, 0.0} ),
+                                std::vector<double>( {2.5, 1.0, 1.25, 0.0} ) ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK( !weight_windows.hasWeightWindows( MonteCarlo::PHOTON ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight window bounds at a phase space point can be returned
+FRENSIE_UNIT_TEST( WeightWindowMesh, getWeightWindowBounds )
+{
+  std::shared_ptr<const MonteCarlo::WeightWindowMesh> weight_windows =
+    createWeightWindows();
+
+  double position[3] = {0.5, 0.5, 0.5};
+  double lower_bound, upper_bound;
+
+  FRENSIE_CHECK( weight_windows->getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                                        position,
+                                                        0.5,
+                                                        lower_bound,
+                                                        upper_bound ) );
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.5 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 2.5 );
+
+  FRENSIE_CHECK( weight_windows->getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                                        position,
+                                                        20.0,
+                                                        lower_bound,
+                                                        upper_bound ) );
+  FRENSIE_CHECK_EQUAL( lower_bound, 1.0 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 5.0 );
+
+  position[0] = 1.5;
+
+  FRENSIE_CHECK( weight_windows->getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                                        position,
+                                                        0.0,
+                                                        lower_bound,
+                                                        upper_bound ) );
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.25 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 1.25 );
+
+  // Outside of the energy bins
+  FRENSIE_CHECK( !weight_windows->getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                                         position,
+                                                         21.0,
+                                                         lower_bound,
+                                                         upper_bound ) );
+
+  // Outside of the mesh
+  position[0] = 2.5;
+
+  FRENSIE_CHECK( !weight_windows->getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                                         position,
+                                                         0.5,
+                                                         lower_bound,
+                                                         upper_bound ) );
+
+  // No weight windows for the particle type
+  position[0] = 0.5;
+
+  FRENSIE_CHECK( !weight_windows->getWeightWindowBounds( MonteCarlo::PHOTON,
+                                                         position,
+                                                         0.5,
+                                                         lower_bound,
+                                                         upper_bound ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that particles below the window will be rouletted
+FRENSIE_UNIT_TEST( WeightWindowMesh, updateParticleState_roulette )
+{
+  std::shared_ptr<const MonteCarlo::WeightWindow> weight_windows =
+    createWeightWindows();
+
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::NeutronState neutron( 0 );
+  neutron.setPosition( 0.5, 0.5, 0.5 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 0.5 );
+  neutron.setWeight( 0.3 );
+
+  // The survival weight is 1.5 so the survival probability is 0.2
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.19; // Particle survives
+  fake_stream[1] = 0.21; // Particle is rouletted
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  weight_windows->updateParticleState( neutron, bank );
+
+  FRENSIE_CHECK( !neutron.isGone() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(), 1.5, 1e-15 );
+  FRENSIE_CHECK( bank.isEmpty() );
+
+  neutron.setWeight( 0.3 );
+
+  weight_windows->updateParticleState( neutron, bank );
+
+  FRENSIE_CHECK( neutron.isGone() );
+  FRENSIE_CHECK( bank.isEmpty() );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // Particles in elements without a window are ignored
+  MonteCarlo::NeutronState neutron_2( 1 );
+  neutron_2.setPosition( 1.5, 0.5, 0.5 );
+  neutron_2.setDirection( 0.0, 0.0, 1.0 );
+  neutron_2.setEnergy( 10.0 );
+  neutron_2.setWeight( 1e-3 );
+
+  weight_windows->updateParticleState( neutron_2, bank );
+
+  FRENSIE_CHECK( !neutron_2.isGone() );
+  FRENSIE_CHECK_EQUAL( neutron_2.getWeight(), 1e-3 );
+
+  // Particles without windows are ignored
+  MonteCarlo::PhotonState photon( 2 );
+  photon.setPosition( 0.5, 0.5, 0.5 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setEnergy( 0.5 );
+  photon.setWeight( 1e-3 );
+
+  weight_windows->updateParticleState( photon, bank );
+
+  FRENSIE_CHECK( !photon.isGone() );
+  FRENSIE_CHECK_EQUAL( photon.getWeight(), 1e-3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that particles above the window will be split
+FRENSIE_UNIT_TEST( WeightWindowMesh, updateParticleState_split )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+    createWeightWindows();
+
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::NeutronState neutron( 0 );
+  neutron.setPosition( 0.5, 0.5, 0.5 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 0.5 );
+  neutron.setWeight( 9.0 );
+
+  weight_windows->updateParticleState( neutron, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(), 2.25, 1e-15 );
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 3 );
+
+  while( !bank.isEmpty() )
+  {
+    FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+    FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0 );
+    FRENSIE_CHECK_EQUAL( bank.top().getXPosition(), 0.5 );
+    FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 0.5 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( bank.top().getWeight(), 2.25, 1e-15 );
+
+    bank.pop();
+  }
+
+  // The number of split particles is limited
+  weight_windows->setMaxSplitNumber( 2 );
+
+  neutron.setWeight( 9.0 );
+
+  weight_windows->updateParticleState( neutron, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(), 4.5, 1e-15 );
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( bank.top().getWeight(), 4.5, 1e-15 );
+
+  bank.pop();
+
+  // Particles in the window are not changed
+  neutron.setWeight( 2.0 );
+
+  weight_windows->updateParticleState( neutron, bank );
+
+  FRENSIE_CHECK_EQUAL( neutron.getWeight(), 2.0 );
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be imported from a wwinp file
+FRENSIE_UNIT_TEST( WeightWindowMesh, importWeightWindowFile )
+{
+  MonteCarlo::WeightWindowMesh weight_windows;
+
+  FRENSIE_REQUIRE_NO_THROW( weight_windows.importWeightWindowFile( test_wwinp_file_name ) );
+
+  FRENSIE_CHECK( weight_windows.hasWeightWindows( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( !weight_windows.hasWeightWindows( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK_EQUAL( weight_windows.getEnergyBinBoundaries( MonteCarlo::NEUTRON ),
+                       std::vector<double>( {0.0, 1.0, 20.0} ) );
+
+  const Utility::StructuredHexMesh& hex_mesh =
+    dynamic_cast<const Utility::StructuredHexMesh&>(
+                               weight_windows.getMesh( MonteCarlo::NEUTRON ) );
+
+  FRENSIE_REQUIRE_EQUAL( hex_mesh.getNumberOfXPlanes(), 4 );
+  FRENSIE_CHECK_EQUAL( hex_mesh.getXPlaneLocation( 0 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( hex_mesh.getXPlaneLocation( 1 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( hex_mesh.getXPlaneLocation( 2 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( hex_mesh.getXPlaneLocation( 3 ), 4.0 );
+  FRENSIE_CHECK_EQUAL( hex_mesh.getNumberOfYPlanes(), 2 );
+  FRENSIE_CHECK_EQUAL( hex_mesh.getNumberOfZPlanes(), 2 );
+
+  double position[3] = {0.5, 0.5, 0.5};
+  double lower_bound, upper_bound;
+
+  FRENSIE_CHECK( weight_windows.getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                                       position,
+                                                       0.5,
+                                                       lower_bound,
+                                                       upper_bound ) );
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.5 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 2.5 );
+
+  weight_windows.getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                        position,
+                                        10.0,
+                                        lower_bound,
+                                        upper_bound );
+
+  FRENSIE_CHECK_EQUAL( lower_bound, 1.0 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 5.0 );
+
+  position[0] = 1.5;
+
+  weight_windows.getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                        position,
+                                        0.5,
+                                        lower_bound,
+                                        upper_bound );
+
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.25 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 1.25 );
+
+  // Negative bounds indicate that there is no window
+  position[0] = 3.0;
+
+  weight_windows.getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                        position,
+                                        0.5,
+                                        lower_bound,
+                                        upper_bound );
+
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.0 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 0.0 );
+
+  // Invalid file
+  FRENSIE_CHECK_THROW( weight_windows.importWeightWindowFile( "dummy_wwinp" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( WeightWindowMesh,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_weight_window_mesh" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+      createWeightWindows();
+
+    weight_windows->setMaxSplitNumber( 10 );
+
+    std::shared_ptr<const MonteCarlo::WeightWindow> base_weight_windows =
+      weight_windows;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( weight_windows ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( base_weight_windows ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived weight windows
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows;
+  std::shared_ptr<const MonteCarlo::WeightWindow> base_weight_windows;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( weight_windows ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( base_weight_windows ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK( weight_windows.get() == base_weight_windows.get() );
+  FRENSIE_CHECK_EQUAL( weight_windows->getMaxSplitNumber(), 10 );
+  FRENSIE_CHECK( weight_windows->hasWeightWindows( MonteCarlo::NEUTRON ) );
+
+  double position[3] = {1.5, 0.5, 0.5};
+  double lower_bound, upper_bound;
+
+  FRENSIE_CHECK( weight_windows->getWeightWindowBounds( MonteCarlo::NEUTRON,
+                                                        position,
+                                                        0.5,
+                                                        lower_bound,
+                                                        upper_bound ) );
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.25 );
+  FRENSIE_CHECK_EQUAL( upper_bound, 1.25 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_wwinp_file",
+                                        test_wwinp_file_name, "",
+                                        "Test wwinp file name with path" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  mesh.reset( new Utility::StructuredHexMesh( {0.0, 1.0, 2.0},
+                                              {0.0, 1.0},
+                                              {0.0, 1.0} ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMesh.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,379 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_AdjointPhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> mesh;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a generator
+std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> createGenerator(
+              const MonteCarlo::ParticleType particle_type,
+              const MonteCarlo::WeightWindowMeshGenerator::ImportanceType
+              importance_type )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator(
+             new MonteCarlo::WeightWindowMeshGenerator(
+                                       0u,
+                                       mesh,
+                                       std::vector<double>( {0.0, 1.0, 20.0} ),
+                                       importance_type ) );
+
+  generator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {particle_type} ) );
+
+  return generator;
+}
+
+// Simulate two histories
+/*! \details The element 0 mean will be 1.0 in both energy bins (RE = 0.0).
+ * The element 1 mean will be 0.5 in the first energy bin (RE = 1.0)
+ * and 0.0 in the second energy bin.
+ */
+void simulateHistories( MonteCarlo::WeightWindowMeshGenerator& generator,
+                        MonteCarlo::ParticleState& particle )
+{
+  particle.setWeight( 1.0 );
+
+  double start_point[3] = {0.0, 0.5, 0.5};
+  double end_point_1[3] = {1.0, 0.5, 0.5};
+  double end_point_2[3] = {2.0, 0.5, 0.5};
+
+  // History 1
+  particle.setEnergy( 0.5 );
+
+  generator.updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                         start_point,
+                                                         end_point_2 );
+
+  particle.setEnergy( 10.0 );
+
+  generator.updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                         start_point,
+                                                         end_point_1 );
+
+  generator.commitHistoryContribution();
+
+  // History 2
+  particle.setEnergy( 0.5 );
+
+  generator.updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                         start_point,
+                                                         end_point_1 );
+
+  particle.setEnergy( 10.0 );
+
+  generator.updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                         start_point,
+                                                         end_point_1 );
+
+  generator.commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+}
+
+// Get the weight window bounds in an element and energy bin
+/*! \details Negative bounds will be returned if there is no window at the
+ * phase space point.
+ */
+std::pair<double,double> getBounds(
+                          const MonteCarlo::WeightWindowMesh& weight_windows,
+                          const MonteCarlo::ParticleType particle_type,
+                          const double x_position,
+                          const double energy )
+{
+  double position[3] = {x_position, 0.5, 0.5};
+  std::pair<double,double> bounds( -1.0, -1.0 );
+
+  weight_windows.getWeightWindowBounds( particle_type,
+                                        position,
+                                        energy,
+                                        bounds.first,
+                                        bounds.second );
+
+  return bounds;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the generator is a mesh estimator with energy bins
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, constructor )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator =
+    createGenerator( MonteCarlo::PHOTON,
+                     MonteCarlo::WeightWindowMeshGenerator::FORWARD_FLUX_IMPORTANCE );
+
+  FRENSIE_CHECK( generator->isMeshEstimator() );
+  FRENSIE_CHECK_EQUAL( generator->getNumberOfBins( MonteCarlo::OBSERVER_ENERGY_DIMENSION ), 2 );
+  FRENSIE_CHECK_EQUAL( generator->getImportanceType(),
+                       MonteCarlo::WeightWindowMeshGenerator::FORWARD_FLUX_IMPORTANCE );
+  FRENSIE_CHECK_EQUAL( generator->getReferenceLowerBound(), 0.5 );
+  FRENSIE_CHECK_EQUAL( generator->getUpperBoundRatio(), 5.0 );
+  FRENSIE_CHECK_EQUAL( generator->getMaxRelativeError(), 1.0 );
+  FRENSIE_CHECK_EQUAL( generator->getWeightWindowParticleType(),
+                       MonteCarlo::PHOTON );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::WeightWindowMeshGenerator( 1u, mesh, std::vector<double>( {1.0} ) ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generation parameters can be set
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, set_parameters )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator =
+    createGenerator( MonteCarlo::PHOTON,
+                     MonteCarlo::WeightWindowMeshGenerator::FORWARD_FLUX_IMPORTANCE );
+
+  generator->setReferenceLowerBound( 0.1 );
+  generator->setUpperBoundRatio( 2.0 );
+  generator->setMaxRelativeError( 0.1 );
+
+  FRENSIE_CHECK_EQUAL( generator->getReferenceLowerBound(), 0.1 );
+  FRENSIE_CHECK_EQUAL( generator->getUpperBoundRatio(), 2.0 );
+  FRENSIE_CHECK_EQUAL( generator->getMaxRelativeError(), 0.1 );
+
+  FRENSIE_CHECK_THROW( generator->setReferenceLowerBound( 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator->setUpperBoundRatio( 1.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator->setMaxRelativeError( 0.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that weight windows can be generated from the forward flux
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateWeightWindows_forward )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator =
+    createGenerator( MonteCarlo::PHOTON,
+                     MonteCarlo::WeightWindowMeshGenerator::FORWARD_FLUX_IMPORTANCE );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setDirection( 1.0, 0.0, 0.0 );
+
+  simulateHistories( *generator, photon );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+    generator->generateWeightWindows();
+
+  FRENSIE_REQUIRE( weight_windows->hasWeightWindows( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK_EQUAL( weight_windows->getEnergyBinBoundaries( MonteCarlo::PHOTON ),
+                       std::vector<double>( {0.0, 1.0, 20.0} ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 0.5, 0.5 ),
+                                   std::make_pair( 0.5, 2.5 ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 0.5, 10.0 ),
+                                   std::make_pair( 0.5, 2.5 ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 1.5, 0.5 ),
+                                   std::make_pair( 0.25, 1.25 ),
+                                   1e-12 );
+
+  // Elements without scores do not have windows
+  FRENSIE_CHECK_EQUAL( getBounds( *weight_windows, MonteCarlo::PHOTON, 1.5, 10.0 ),
+                       std::make_pair( 0.0, 0.0 ) );
+
+  // Elements with a relative error above the max do not have windows
+  generator->setMaxRelativeError( 0.5 );
+  generator->setReferenceLowerBound( 1.0 );
+  generator->setUpperBoundRatio( 2.0 );
+
+  weight_windows = generator->generateWeightWindows();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 0.5, 0.5 ),
+                                   std::make_pair( 1.0, 2.0 ),
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( getBounds( *weight_windows, MonteCarlo::PHOTON, 1.5, 0.5 ),
+                       std::make_pair( 0.0, 0.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that weight windows can be generated from the adjoint flux
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateWeightWindows_adjoint )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator =
+    createGenerator( MonteCarlo::ADJOINT_PHOTON,
+                     MonteCarlo::WeightWindowMeshGenerator::ADJOINT_FLUX_IMPORTANCE );
+
+  FRENSIE_CHECK_EQUAL( generator->getWeightWindowParticleType(),
+                       MonteCarlo::PHOTON );
+
+  MonteCarlo::AdjointPhotonState adjoint_photon( 0 );
+  adjoint_photon.setDirection( 1.0, 0.0, 0.0 );
+
+  simulateHistories( *generator, adjoint_photon );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+    generator->generateWeightWindows();
+
+  FRENSIE_CHECK( !weight_windows->hasWeightWindows( MonteCarlo::ADJOINT_PHOTON ) );
+  FRENSIE_REQUIRE( weight_windows->hasWeightWindows( MonteCarlo::PHOTON ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 0.5, 0.5 ),
+                                   std::make_pair( 0.5, 2.5 ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 0.5, 10.0 ),
+                                   std::make_pair( 0.5, 2.5 ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 1.5, 0.5 ),
+                                   std::make_pair( 1.0, 5.0 ),
+                                   1e-12 );
+
+  // The adjoint flux importance requires an adjoint particle type
+  generator = createGenerator( MonteCarlo::PHOTON,
+                               MonteCarlo::WeightWindowMeshGenerator::ADJOINT_FLUX_IMPORTANCE );
+
+  FRENSIE_CHECK_THROW( generator->generateWeightWindows(),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generated weight windows can be exported
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, exportWeightWindows )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator =
+    createGenerator( MonteCarlo::PHOTON,
+                     MonteCarlo::WeightWindowMeshGenerator::FORWARD_FLUX_IMPORTANCE );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setDirection( 1.0, 0.0, 0.0 );
+
+  simulateHistories( *generator, photon );
+
+  FRENSIE_REQUIRE_NO_THROW( generator->exportWeightWindows( "test_generated_weight_windows.xml" ) );
+
+  MonteCarlo::WeightWindowMesh weight_windows;
+
+  FRENSIE_REQUIRE_NO_THROW( weight_windows.loadFromFile( "test_generated_weight_windows.xml" ) );
+
+  FRENSIE_REQUIRE( weight_windows.hasWeightWindows( MonteCarlo::PHOTON ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( weight_windows, MonteCarlo::PHOTON, 0.5, 0.5 ),
+                                   std::make_pair( 0.5, 2.5 ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( weight_windows, MonteCarlo::PHOTON, 1.5, 0.5 ),
+                                   std::make_pair( 0.25, 1.25 ),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( WeightWindowMeshGenerator,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_weight_window_mesh_generator" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator =
+      createGenerator( MonteCarlo::ADJOINT_PHOTON,
+                       MonteCarlo::WeightWindowMeshGenerator::ADJOINT_FLUX_IMPORTANCE );
+
+    generator->setReferenceLowerBound( 0.1 );
+    generator->setUpperBoundRatio( 2.0 );
+    generator->setMaxRelativeError( 2.0 );
+
+    MonteCarlo::AdjointPhotonState adjoint_photon( 0 );
+    adjoint_photon.setDirection( 1.0, 0.0, 0.0 );
+
+    simulateHistories( *generator, adjoint_photon );
+
+    std::shared_ptr<MonteCarlo::Estimator> estimator = generator;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( generator ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( estimator ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived generator
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator;
+  std::shared_ptr<MonteCarlo::Estimator> estimator;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( generator ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( estimator ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK( generator.get() == estimator.get() );
+  FRENSIE_CHECK_EQUAL( generator->getImportanceType(),
+                       MonteCarlo::WeightWindowMeshGenerator::ADJOINT_FLUX_IMPORTANCE );
+  FRENSIE_CHECK_EQUAL( generator->getReferenceLowerBound(), 0.1 );
+  FRENSIE_CHECK_EQUAL( generator->getUpperBoundRatio(), 2.0 );
+  FRENSIE_CHECK_EQUAL( generator->getMaxRelativeError(), 2.0 );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+    generator->generateWeightWindows();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 0.5, 0.5 ),
+                                   std::make_pair( 0.1, 0.2 ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getBounds( *weight_windows, MonteCarlo::PHOTON, 1.5, 0.5 ),
+                                   std::make_pair( 0.2, 0.4 ),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  mesh.reset( new Utility::StructuredHexMesh( {0.0, 1.0, 2.0},
+                                              {0.0, 1.0},
+                                              {0.0, 1.0} ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -61,6 +61,14 @@ protected:
   //! The signal handler
   void signalHandler( int signal ) final override;
 
+  //! Calculate the batch size for a worker
+  static uint64_t calculateWorkerBatchSize(
+                          const std::vector<double>& worker_history_rates,
+                          const int worker,
+                          const uint64_t nominal_batch_size,
+                          const uint64_t number_of_unassigned_histories,
+                          const uint64_t number_of_workers );
+
 private:
 
   // Coorindate workers
@@ -69,11 +77,15 @@ private:
   // Tell workers to stop working
   void stopWorkersAndRecordWork( const bool simulation_complete,
                                  const bool rendezvous_required,
-                                 const uint64_t batch_number );
+                                 const uint64_t number_of_assigned_histories );
 
   // Check for idle worker
   bool isIdleWorkerPresent( Utility::Communicator::Status& idle_worker_info );
 
+  // Receive the idle message from an idle worker
+  void receiveIdleWorkerMessage(
+                        const Utility::Communicator::Status& idle_worker_info );
+
   // Assign work to idle worker
   void assignWorkToIdleWorker( const Utility::Communicator::Status& idle_worker_info,
                                const std::pair<uint64_t,uint64_t>& task );
@@ -86,6 +98,12 @@ private:
 
   // The number of batches per rendezvous
   uint64_t d_batches_per_rendezvous;
+
+  // The size of the batches that the root process runs between dispatches
+  uint64_t d_root_batch_size;
+
+  // The measured history rate (histories/s) of each worker
+  std::vector<double> d_worker_history_rates;
 };
   
 } // end MonteCarlo namespace
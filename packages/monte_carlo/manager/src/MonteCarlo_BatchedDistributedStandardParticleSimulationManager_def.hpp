@@ -9,7 +9,11 @@
 #ifndef MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -41,16 +45,18 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                                              rendezvous_number,
                                              use_single_rendezvous_file ),
   d_comm( comm ),
-  d_batches_per_rendezvous( 0 )
+  d_batches_per_rendezvous( 0 ),
+  d_root_batch_size( 0 ),
+  d_worker_history_rates( comm->size(), 0.0 )
 {
   // Make sure that the communicator pointer is valid
   testPrecondition( comm.get() );
   // Make sure that the communicator is not a serial communicator
   testPrecondition( comm->size() > 1 );
 
-  // Calculate the batch size
+  // Calculate the batch size (the root process also runs histories)
   d_batches_per_rendezvous =
-    properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+    properties->getNumberOfBatchesPerProcessor()*comm->size();
 
   // Calculate the batch size
   uint64_t batch_size =
@@ -63,6 +69,10 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                       "least 1 is calculated." );
 
   this->setBatchSize( batch_size );
+
+  // The root process runs small batches so that idle workers are not kept
+  // waiting for long
+  d_root_batch_size = std::max( batch_size/comm->size(), (uint64_t)1 );
 }
 
 // Run the simulation set up by the user with the ability to interrupt
@@ -127,6 +137,9 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
   if( d_comm->rank() == 0 )
   {
     FRENSIE_LOG_NOTIFICATION( "Simulation finished. " );
+
+    // Only the navigation statistics of the root process are logged
+    this->getModel().getUnfilledModel().logNavigationSummary();
     
     FRENSIE_FLUSH_ALL_LOGS();
   }
@@ -135,11 +148,22 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
 }
 
 // Coorindate workers
+/*! \details The root process hands out the histories of each rendezvous
+ * interval in batches. Idle workers are served first. When there are no
+ * idle workers the root process runs a small batch of histories itself
+ * instead of polling for idle workers. The size of each worker batch is
+ * proportional to the worker's measured history rate so that heterogeneous
+ * workers finish the rendezvous interval at roughly the same time.
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorkers()
 {
-  // The current batch number
-  uint64_t batch_number = 0;
+  // The first history that has not been assigned yet
+  uint64_t next_unassigned_history = this->getNextHistory();
+
+  // The end of the rendezvous interval
+  uint64_t rendezvous_end_history =
+    this->getNextHistory() + this->getRendezvousBatchSize();
 
   // The batch info (start history, end history + 1)
   std::pair<uint64_t,uint64_t> task;
@@ -153,56 +177,125 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorker
   {
     if( this->isSimulationComplete() )
     {
-      this->stopWorkersAndRecordWork( true, rendezvous_required, batch_number );
+      this->stopWorkersAndRecordWork( true, rendezvous_required, next_unassigned_history - this->getNextHistory() );
 
       break;
     }
-    else if( batch_number == d_batches_per_rendezvous )
+    else if( next_unassigned_history == rendezvous_end_history )
     {
-      this->stopWorkersAndRecordWork( false, true, batch_number );
+      this->stopWorkersAndRecordWork( false, true, this->getRendezvousBatchSize() );
       
       // The rendezvous is complete
       rendezvous_required = false;
-      
-      // Reset the batch number
-      batch_number = 0;
+
+      // Start the next rendezvous interval
+      next_unassigned_history = this->getNextHistory();
+
+      rendezvous_end_history =
+        this->getNextHistory() + this->getRendezvousBatchSize();
       
       continue;
     }
     else if( this->isIdleWorkerPresent( idle_worker_info ) )
     {
-      // Set the batch start history
-      task.first = this->getNextHistory() + batch_number*this->getBatchSize();
+      this->receiveIdleWorkerMessage( idle_worker_info );
+      
+      task.first = next_unassigned_history;
+
+      task.second = task.first +
+        this->calculateWorkerBatchSize( d_worker_history_rates,
+                                        idle_worker_info.source(),
+                                        this->getBatchSize(),
+                                        rendezvous_end_history - next_unassigned_history,
+                                        d_comm->size()-1 );
       
-      task.second = task.first + this->getBatchSize();
+      this->assignWorkToIdleWorker( idle_worker_info, task );
+    }
+    else
+    {
+      // Run histories on the root process while the workers are busy
+      task.first = next_unassigned_history;
+
+      task.second = std::min( task.first + d_root_batch_size,
+                              rendezvous_end_history );
 
-      // Check if the size of the last batch is correct
-      if( batch_number == d_batches_per_rendezvous - 1 )
+      this->runSimulationBatch( task.first, task.second );
+    }
+
+    next_unassigned_history = task.second;
+
+    // A rendezvous is required
+    rendezvous_required = true;
+  }
+}
+
+// Calculate the batch size for a worker
+/*! \details The nominal batch size is scaled by the ratio of the worker's
+ * history rate to the average history rate of all workers with a measured
+ * rate (the scaling is limited to a factor of 4). A worker without a
+ * measured rate (a rate of zero) gets the nominal batch size. The batch size
+ * is also limited to an equal share of the unassigned histories so that the
+ * last batches of a rendezvous interval are small (guided scheduling). The
+ * first history rate belongs to the root process and is ignored.
+ */
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::calculateWorkerBatchSize(
+                           const std::vector<double>& worker_history_rates,
+                           const int worker,
+                           const uint64_t nominal_batch_size,
+                           const uint64_t number_of_unassigned_histories,
+                           const uint64_t number_of_workers )
+{
+  // Make sure the worker is valid
+  testPrecondition( worker > 0 );
+  testPrecondition( (size_t)worker < worker_history_rates.size() );
+  // Make sure there are unassigned histories
+  testPrecondition( number_of_unassigned_histories > 0 );
+  // Make sure there are workers
+  testPrecondition( number_of_workers > 0 );
+
+  double batch_size = nominal_batch_size;
+
+  // Scale the batch size by the relative worker history rate
+  if( worker_history_rates[worker] > 0.0 )
+  {
+    double rate_sum = 0.0;
+    unsigned number_of_rates = 0;
+
+    for( size_t i = 1; i < worker_history_rates.size(); ++i )
+    {
+      if( worker_history_rates[i] > 0.0 )
       {
-        task.second += this->getRendezvousBatchSize() -
-          d_batches_per_rendezvous*this->getBatchSize();
+        rate_sum += worker_history_rates[i];
+        ++number_of_rates;
       }
+    }
 
-      this->assignWorkToIdleWorker( idle_worker_info, task );
+    double relative_rate =
+      worker_history_rates[worker]*number_of_rates/rate_sum;
 
-      // Increment the batch number
-      ++batch_number;
+    relative_rate = std::max( std::min( relative_rate, 4.0 ), 0.25 );
 
-      // A rendezvous is required
-      rendezvous_required = true;
-    }
+    batch_size *= relative_rate;
   }
+
+  // Limit the batch size to an equal share of the unassigned histories
+  batch_size = std::min( batch_size,
+                         (double)number_of_unassigned_histories/number_of_workers );
+
+  return std::min( std::max( (uint64_t)batch_size, (uint64_t)1 ),
+                   number_of_unassigned_histories );
 }
 
 // Tell workers to stop working
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRecordWork(
-                                                const bool simulation_complete,
-                                                const bool rendezvous_required,
-                                                const uint64_t batch_number )
+                                const bool simulation_complete,
+                                const bool rendezvous_required,
+                                const uint64_t number_of_assigned_histories )
 {
-  // The idle worker messages
-  std::vector<int> idle_worker_messages( d_comm->size()-1 );
+  // The idle worker messages (measured history rates)
+  std::vector<double> idle_worker_messages( d_comm->size()-1 );
   
   // The request for each worker
   std::vector<Utility::Communicator::Request> requests;
@@ -247,11 +340,15 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRe
 
   Utility::wait( requests, statuses );
 
+  // Record the worker history rates
+  for( int i = 1; i < d_comm->size(); ++i )
+  {
+    if( idle_worker_messages[i-1] > 0.0 )
+      d_worker_history_rates[i] = idle_worker_messages[i-1];
+  }
+
   // Increment the next history
-  if( batch_number == d_batches_per_rendezvous )
-    this->incrementNextHistory( this->getRendezvousBatchSize() );
-  else
-    this->incrementNextHistory( batch_number*this->getBatchSize() );
+  this->incrementNextHistory( number_of_assigned_histories );
 
   // Rendezvous after rendezvous batch completed
   if( !simulation_complete )
@@ -268,7 +365,7 @@ bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPres
 {
   // Probe for an idle worker
   try{
-    idle_worker_info = Utility::iprobe<int>( *d_comm );
+    idle_worker_info = Utility::iprobe<double>( *d_comm );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "Unable to probe for idle worker on root "
@@ -277,14 +374,15 @@ bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPres
   return idle_worker_info.hasMessageDetails();
 }
 
-// Assign work to idle worker
+// Receive the idle message from an idle worker
+/*! \details The idle message stores the history rate (histories/s) of the
+ * last batch that the worker completed (0 if it has not completed a batch).
+ */
 template<ParticleModeType mode>
-void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
-                         const Utility::Communicator::Status& idle_worker_info,
-                         const std::pair<uint64_t,uint64_t>& task )
+void BatchedDistributedStandardParticleSimulationManager<mode>::receiveIdleWorkerMessage(
+                        const Utility::Communicator::Status& idle_worker_info )
 {
-  // Contact the idle worker
-  int idle_worker_message;
+  double idle_worker_message;
   
   try{
     Utility::receive( *d_comm,
@@ -297,6 +395,16 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdle
                            "worker process "
                            << idle_worker_info.source() << "!" );
 
+  if( idle_worker_message > 0.0 )
+    d_worker_history_rates[idle_worker_info.source()] = idle_worker_message;
+}
+
+// Assign work to idle worker
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
+                         const Utility::Communicator::Status& idle_worker_info,
+                         const std::pair<uint64_t,uint64_t>& task )
+{
   // Assign the task to the worker
   try{
     Utility::send( *d_comm,
@@ -316,7 +424,11 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
 {
   std::pair<uint64_t,uint64_t> task;
 
-  int idle_message = 1;
+  // The history rate of the last batch (sent with each work request)
+  double idle_message = 0.0;
+
+  std::shared_ptr<Utility::Timer> batch_timer =
+    Utility::OpenMPProperties::createTimer();
   
   while( true )
   {
@@ -338,7 +450,18 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
 
     // Run the simulation batch
     if( task.first != task.second )
+    {
+      batch_timer->start();
+      
       this->runSimulationBatch( task.first, task.second );
+
+      batch_timer->stop();
+
+      const double batch_time = batch_timer->elapsed().count();
+
+      if( batch_time > 0.0 )
+        idle_message = (task.second - task.first)/batch_time;
+    }
     else
     {
       // Rendezvous with the root process
@@ -0,0 +1,199 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EventBasedParticleSimulationManager.hpp
+//! \author Alex Robinson
+//! \brief  Event-based particle simulation manager class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_HPP
+#define MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <utility>
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardParticleSimulationManager.hpp"
+
+namespace MonteCarlo{
+
+namespace Details{
+
+//! The in-flight particle (event-based transport) struct
+template<typename State>
+struct InFlightParticle
+{
+  //! The particle
+  std::shared_ptr<State> particle;
+
+  //! The thread id assigned to the particle's history
+  unsigned thread_id;
+
+  //! The remaining optical path of the current track
+  double remaining_track_op;
+
+  //! The start point of the current track
+  double track_start_point[3];
+
+  //! Records if the particle needs to start a new track
+  bool starting_new_track;
+
+  //! Records if the current track is starting from a source point
+  bool starting_from_source;
+
+  //! Records if the global subtrack ending event has been dispatched
+  bool global_subtrack_ending_event_dispatched;
+};
+
+//! The event stage scratch data (one per thread)
+struct EventStageData
+{
+  //! The total macroscopic cross section of each particle's cell
+  std::vector<double> cell_total_macro_cross_sections;
+
+  //! The distance to the next surface hit of each particle
+  std::vector<double> distances_to_surface_hit;
+
+  //! The next surface hit by each particle
+  std::vector<Geometry::Model::EntityId> surfaces_hit;
+
+  //! The indices of the particles that will collide in the current stage
+  std::vector<size_t> collision_indices;
+
+  //! The particles created in the current stage (and their history thread ids)
+  std::vector<std::pair<std::shared_ptr<ParticleState>,unsigned> > new_particles;
+
+  //! The first thread id assigned to the histories of the thread
+  unsigned first_history_thread_id;
+
+  //! The number of particles in flight for each history of the thread
+  std::vector<size_t> history_particle_counts;
+
+  //! The thread ids of the histories that were completed in the current stage
+  std::vector<unsigned> completed_history_thread_ids;
+};
+
+//! The in-flight particle banks struct (one bank per active particle type)
+template<typename BeginParticleIterator, typename EndParticleIterator>
+struct InFlightParticleBanks;
+
+} // end Details namespace
+
+/*! The event-based particle simulation manager class
+ * \details Instead of following each particle of a history from birth to
+ * death, each thread pulls a block of histories and keeps all of their
+ * particles in flight in per-type banks. The banks are advanced together one
+ * event stage at a time: track initialization, cross section lookup, ray
+ * fire, surface crossing and collision. Each stage is executed over a whole
+ * bank before the next stage starts, which keeps the cross section and
+ * geometry data of each stage hot. Every history in flight is assigned its
+ * own virtual thread id (see Utility::OpenMPProperties::setVirtualThreadId)
+ * so that it has its own random number stream and its own uncommitted
+ * observer data. The history contributions are committed as soon as the last
+ * particle of the history is gone. Particle types that require forced
+ * collisions are simulated with the history-based "alternative" tracking
+ * method and delta tracked particle types are simulated with the
+ * history-based delta tracking method.
+ */
+template<ParticleModeType mode>
+class EventBasedParticleSimulationManager : public StandardParticleSimulationManager<mode>
+{
+
+public:
+
+  //! Constructor
+  EventBasedParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<const WeightWindow> weight_windows,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file );
+
+  //! Destructor
+  ~EventBasedParticleSimulationManager()
+  { /* ... */ }
+
+protected:
+
+  //! Run the simulation micro batch
+  void runSimulationMicroBatch( const uint64_t batch_start_history,
+                                const uint64_t batch_end_history ) override;
+
+  //! Get the number of thread ids used by the micro batches
+  unsigned getRequiredNumberOfThreadIds() const override;
+
+private:
+
+  // The in-flight particle banks
+  typedef Details::InFlightParticleBanks<typename boost::mpl::begin<typename ParticleModeTypeTraits<mode>::ActiveParticles>::type,typename boost::mpl::end<typename ParticleModeTypeTraits<mode>::ActiveParticles>::type> InFlightParticleBanks;
+
+  // Add the source particles of a history to the in-flight particle banks
+  void addSourceParticles( ParticleBank& source_bank,
+                           const unsigned history_thread_id,
+                           InFlightParticleBanks& in_flight_particle_banks,
+                           Details::EventStageData& stage_data );
+
+  // Add the particles created in the last stage to the in-flight banks
+  void addNewParticles( InFlightParticleBanks& in_flight_particle_banks,
+                        Details::EventStageData& stage_data );
+
+  // Commit the contributions of the histories completed in the last stage
+  void commitCompletedHistories( Details::EventStageData& stage_data );
+
+  // Move the particles in the bank to the new particle list
+  static void collectNewParticles( const unsigned history_thread_id,
+                                   ParticleBank& bank,
+                                   Details::EventStageData& stage_data );
+
+  // Execute one stage of events for a resolved in-flight particle bank
+  template<typename State>
+  void simulateParticleEvents(
+                  std::vector<Details::InFlightParticle<State> >& particles,
+                  Details::EventStageData& stage_data,
+                  ParticleBank& bank );
+
+  // Execute one stage of events for a surface tracked particle bank
+  template<typename State>
+  void simulateParticleEventsSurfaceTracking(
+                  std::vector<Details::InFlightParticle<State> >& particles,
+                  Details::EventStageData& stage_data,
+                  ParticleBank& bank );
+
+  // Start a new track for a resolved in-flight particle
+  template<typename State>
+  void startParticleTrack( Details::InFlightParticle<State>& in_flight_particle );
+
+  // End the current track of a resolved in-flight particle
+  template<typename State>
+  void endParticleTrack( Details::InFlightParticle<State>& in_flight_particle );
+
+  // Add the in-flight particle banks as a friend
+  template<typename T, typename U>
+  friend struct Details::InFlightParticleBanks;
+
+  // The number of histories that each thread keeps in flight
+  unsigned d_histories_per_thread;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_EventBasedParticleSimulationManager_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EventBasedParticleSimulationManager.hpp
+//---------------------------------------------------------------------------//
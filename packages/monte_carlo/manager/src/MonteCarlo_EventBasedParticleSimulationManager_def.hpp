@@ -0,0 +1,691 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EventBasedParticleSimulationManager_def.hpp
+//! \author Alex Robinson
+//! \brief  Event-based particle simulation manager definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+#define MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace Details{
+
+//! The in-flight particle banks struct
+template<typename BeginParticleIterator, typename EndParticleIterator>
+struct InFlightParticleBanks
+{
+  //! The particle state type of this bank
+  typedef typename boost::mpl::deref<BeginParticleIterator>::type ParticleStateType;
+
+  //! The banks of the remaining particle state types
+  typedef InFlightParticleBanks<typename boost::mpl::next<BeginParticleIterator>::type,EndParticleIterator> RemainingBanks;
+
+  //! The in-flight particles of this type
+  std::vector<InFlightParticle<ParticleStateType> > particles;
+
+  //! The in-flight particles of the remaining types
+  RemainingBanks remaining_banks;
+
+  //! Check if there are no particles in flight
+  bool empty() const
+  {
+    return particles.empty() && remaining_banks.empty();
+  }
+
+  //! Add a particle to the bank of its type
+  bool addParticle( const std::shared_ptr<ParticleState>& particle,
+                    const unsigned history_thread_id,
+                    const bool source_particle )
+  {
+    // The particle type uniquely determines the particle state type so the
+    // particle only needs to be resolved once
+    if( particle->getParticleType() == ParticleStateType::type )
+    {
+      particles.emplace_back();
+
+      InFlightParticle<ParticleStateType>& in_flight_particle =
+        particles.back();
+
+      in_flight_particle.particle =
+        std::static_pointer_cast<ParticleStateType>( particle );
+      in_flight_particle.thread_id = history_thread_id;
+      in_flight_particle.remaining_track_op = 0.0;
+      in_flight_particle.starting_new_track = true;
+      in_flight_particle.starting_from_source = source_particle;
+      in_flight_particle.global_subtrack_ending_event_dispatched = false;
+
+      return true;
+    }
+    else
+    {
+      return remaining_banks.addParticle( particle,
+                                          history_thread_id,
+                                          source_particle );
+    }
+  }
+
+  //! Execute one stage of events for every in-flight particle
+  template<typename Manager>
+  void simulateEvents( Manager& manager,
+                       EventStageData& stage_data,
+                       ParticleBank& bank )
+  {
+    if( !particles.empty() )
+    {
+      manager.template simulateParticleEvents<ParticleStateType>( particles,
+                                                                  stage_data,
+                                                                  bank );
+    }
+
+    remaining_banks.simulateEvents( manager, stage_data, bank );
+  }
+
+  //! Remove the particles that are gone
+  void removeFinishedParticles( EventStageData& stage_data )
+  {
+    particles.erase(
+       std::remove_if( particles.begin(),
+                       particles.end(),
+                       [&stage_data]( const InFlightParticle<ParticleStateType>& in_flight_particle ){
+                         if( *in_flight_particle.particle )
+                           return false;
+
+                         size_t& history_particle_count =
+                           stage_data.history_particle_counts[in_flight_particle.thread_id - stage_data.first_history_thread_id];
+
+                         --history_particle_count;
+
+                         if( history_particle_count == 0 )
+                         {
+                           stage_data.completed_history_thread_ids.push_back(
+                                                 in_flight_particle.thread_id );
+                         }
+
+                         return true; } ),
+       particles.end() );
+
+    remaining_banks.removeFinishedParticles( stage_data );
+  }
+};
+
+//! The in-flight particle banks struct (end of the particle types)
+template<typename EndParticleIterator>
+struct InFlightParticleBanks<EndParticleIterator,EndParticleIterator>
+{
+  //! Check if there are no particles in flight
+  bool empty() const
+  { return true; }
+
+  //! Add a particle to the bank of its type
+  bool addParticle( const std::shared_ptr<ParticleState>&,
+                    const unsigned,
+                    const bool )
+  { return false; }
+
+  //! Execute one stage of events for every in-flight particle
+  template<typename Manager>
+  void simulateEvents( Manager&, EventStageData&, ParticleBank& )
+  { /* ... */ }
+
+  //! Remove the particles that are gone
+  void removeFinishedParticles( EventStageData& )
+  { /* ... */ }
+};
+
+} // end Details namespace
+
+// Constructor
+template<ParticleModeType mode>
+EventBasedParticleSimulationManager<mode>::EventBasedParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<const WeightWindow> weight_windows,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file )
+  : StandardParticleSimulationManager<mode>( simulation_name,
+                                             archive_type,
+                                             model,
+                                             source,
+                                             event_handler,
+                                             weight_windows,
+                                             collision_forcer,
+                                             properties,
+                                             next_history,
+                                             rendezvous_number,
+                                             use_single_rendezvous_file ),
+    d_histories_per_thread( properties->getNumberOfEventBasedHistoriesPerThread() )
+{ /* ... */ }
+
+// Run the simulation micro batch
+/*! \details The histories of the micro batch are divided into blocks that
+ * are distributed over the threads. The particles of every history in a
+ * block (including all progeny) are kept in the in-flight particle banks.
+ * Event stages are executed over the banks until they are empty. The
+ * contributions of a history are committed as soon as its last particle is
+ * gone.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::runSimulationMicroBatch(
+                                            const uint64_t batch_start_history,
+                                            const uint64_t batch_end_history )
+{
+  // Make sure the history range is valid
+  testPrecondition( batch_start_history < batch_end_history );
+
+  const uint64_t number_of_blocks =
+    (batch_end_history - batch_start_history + d_histories_per_thread - 1)/
+    d_histories_per_thread;
+
+  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  {
+    // Create the banks and the event stage data for each thread (they are
+    // reused for every block of histories)
+    ParticleBank source_bank, bank;
+
+    InFlightParticleBanks in_flight_particle_banks;
+
+    Details::EventStageData stage_data;
+
+    // Every history in a block is assigned one of the thread ids owned by
+    // this thread
+    stage_data.first_history_thread_id =
+      Utility::OpenMPProperties::getThreadId()*d_histories_per_thread;
+
+    stage_data.history_particle_counts.resize( d_histories_per_thread );
+
+    #pragma omp for schedule( dynamic )
+    for( uint64_t block = 0; block < number_of_blocks; ++block )
+    {
+      // End the simulation if requested (by the signal handler)
+      if( this->hasExitSimulationRequestBeenMade() )
+        continue;
+
+      const uint64_t block_start_history =
+        batch_start_history + block*d_histories_per_thread;
+
+      const uint64_t block_end_history =
+        std::min( block_start_history + d_histories_per_thread,
+                  batch_end_history );
+
+      // Sample the source particles of every history in the block
+      for( uint64_t history = block_start_history; history < block_end_history; ++history )
+      {
+        const unsigned history_thread_id = stage_data.first_history_thread_id +
+          (history - block_start_history);
+
+        Utility::OpenMPProperties::setVirtualThreadId( history_thread_id );
+
+        // Initialize the random number generator for this history
+        Utility::RandomNumberGenerator::initialize( history );
+
+        if( !this->sampleSourceParticles( source_bank, history ) )
+          continue;
+
+        this->addSourceParticles( source_bank,
+                                  history_thread_id,
+                                  in_flight_particle_banks,
+                                  stage_data );
+      }
+
+      this->commitCompletedHistories( stage_data );
+
+      // The block only ends when there are no particles in flight
+      while( !in_flight_particle_banks.empty() )
+      {
+        in_flight_particle_banks.simulateEvents( *this, stage_data, bank );
+
+        // The progeny created in this stage will start their first track
+        // in the next stage
+        this->addNewParticles( in_flight_particle_banks, stage_data );
+
+        in_flight_particle_banks.removeFinishedParticles( stage_data );
+
+        // Commit the contributions of the histories without particles
+        this->commitCompletedHistories( stage_data );
+      }
+    }
+
+    Utility::OpenMPProperties::unsetVirtualThreadId();
+  }
+}
+
+// Get the number of thread ids used by the micro batches
+/*! \details Every history that a thread keeps in flight has its own thread
+ * id.
+ */
+template<ParticleModeType mode>
+unsigned EventBasedParticleSimulationManager<mode>::getRequiredNumberOfThreadIds() const
+{
+  return Utility::OpenMPProperties::getRequestedNumberOfThreads()*
+    d_histories_per_thread;
+}
+
+// Add the source particles of a history to the in-flight particle banks
+/*! \details Particles with a type that is not active in the mode will be
+ * ignored.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::addSourceParticles(
+                               ParticleBank& source_bank,
+                               const unsigned history_thread_id,
+                               InFlightParticleBanks& in_flight_particle_banks,
+                               Details::EventStageData& stage_data )
+{
+  size_t& history_particle_count =
+    stage_data.history_particle_counts[history_thread_id -
+                                       stage_data.first_history_thread_id];
+
+  history_particle_count = 0;
+
+  std::shared_ptr<ParticleState> particle;
+
+  while( !source_bank.isEmpty() )
+  {
+    source_bank.pop( particle );
+
+    if( in_flight_particle_banks.addParticle( particle, history_thread_id, true ) )
+      ++history_particle_count;
+  }
+
+  if( history_particle_count == 0 )
+    stage_data.completed_history_thread_ids.push_back( history_thread_id );
+}
+
+// Add the particles created in the last stage to the in-flight banks
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::addNewParticles(
+                               InFlightParticleBanks& in_flight_particle_banks,
+                               Details::EventStageData& stage_data )
+{
+  for( size_t i = 0; i < stage_data.new_particles.size(); ++i )
+  {
+    const unsigned history_thread_id = stage_data.new_particles[i].second;
+
+    if( in_flight_particle_banks.addParticle( stage_data.new_particles[i].first,
+                                              history_thread_id,
+                                              false ) )
+    {
+      ++stage_data.history_particle_counts[history_thread_id -
+                                           stage_data.first_history_thread_id];
+    }
+  }
+
+  stage_data.new_particles.clear();
+}
+
+// Commit the contributions of the histories completed in the last stage
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::commitCompletedHistories(
+                                         Details::EventStageData& stage_data )
+{
+  for( size_t i = 0; i < stage_data.completed_history_thread_ids.size(); ++i )
+  {
+    Utility::OpenMPProperties::setVirtualThreadId(
+                                   stage_data.completed_history_thread_ids[i] );
+
+    this->getEventHandler().commitObserverHistoryContributions();
+  }
+
+  stage_data.completed_history_thread_ids.clear();
+}
+
+// Move the particles in the bank to the new particle list
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::collectNewParticles(
+                                         const unsigned history_thread_id,
+                                         ParticleBank& bank,
+                                         Details::EventStageData& stage_data )
+{
+  while( !bank.isEmpty() )
+  {
+    stage_data.new_particles.emplace_back( std::shared_ptr<ParticleState>(),
+                                           history_thread_id );
+
+    bank.pop( stage_data.new_particles.back().first );
+  }
+}
+
+// Execute one stage of events for a resolved in-flight particle bank
+/*! \details Forced collisions branch particle tracks recursively, which
+ * cannot be staged, and delta tracking does not have ray fire or surface
+ * crossing stages. Particles of a type that uses either method will be
+ * simulated until they are gone.
+ */
+template<ParticleModeType mode>
+template<typename State>
+void EventBasedParticleSimulationManager<mode>::simulateParticleEvents(
+                    std::vector<Details::InFlightParticle<State> >& particles,
+                    Details::EventStageData& stage_data,
+                    ParticleBank& bank )
+{
+  const bool use_delta_tracking = this->template isDeltaTrackingUsed<State>();
+
+  if( use_delta_tracking ||
+      this->getCollisionForcer().hasForcedCollisionCells( State::type ) )
+  {
+    for( size_t i = 0; i < particles.size(); ++i )
+    {
+      Details::InFlightParticle<State>& in_flight_particle = particles[i];
+
+      Utility::OpenMPProperties::setVirtualThreadId(
+                                                 in_flight_particle.thread_id );
+
+      if( use_delta_tracking )
+      {
+        this->template simulateParticleDeltaTracking<State>(
+                                     *in_flight_particle.particle,
+                                     bank,
+                                     in_flight_particle.starting_from_source );
+      }
+      else
+      {
+        this->template simulateParticleAlternative<State>(
+                                     *in_flight_particle.particle,
+                                     bank,
+                                     in_flight_particle.starting_from_source );
+      }
+
+      this->collectNewParticles( in_flight_particle.thread_id,
+                                 bank,
+                                 stage_data );
+    }
+  }
+  else
+  {
+    this->template simulateParticleEventsSurfaceTracking<State>( particles,
+                                                                 stage_data,
+                                                                 bank );
+  }
+}
+
+// Execute one stage of events for a surface tracked particle bank
+/*! \details The stages mirror the steps of the history-based particle track
+ * (see ParticleSimulationManager::simulateParticleTrack). A particle that
+ * crosses a surface stays in its track and continues in the next stage.
+ * The thread id of a particle's history must be set before any step that
+ * samples random numbers or updates the observers.
+ */
+template<ParticleModeType mode>
+template<typename State>
+void EventBasedParticleSimulationManager<mode>::simulateParticleEventsSurfaceTracking(
+                    std::vector<Details::InFlightParticle<State> >& particles,
+                    Details::EventStageData& stage_data,
+                    ParticleBank& bank )
+{
+  const FilledGeometryModel& model = this->getModel();
+
+  const size_t number_of_particles = particles.size();
+
+  stage_data.cell_total_macro_cross_sections.resize( number_of_particles );
+  stage_data.distances_to_surface_hit.resize( number_of_particles );
+  stage_data.surfaces_hit.resize( number_of_particles );
+  stage_data.collision_indices.clear();
+
+  // Stage 1: start a new track for particles that have finished their last
+  //          track (cutoffs, weight roulette, optical path sampling)
+  for( size_t i = 0; i < number_of_particles; ++i )
+  {
+    if( particles[i].starting_new_track )
+    {
+      Utility::OpenMPProperties::setVirtualThreadId( particles[i].thread_id );
+
+      this->template startParticleTrack<State>( particles[i] );
+    }
+  }
+
+  // Stage 2: look up the total cross section of each particle's cell
+  for( size_t i = 0; i < number_of_particles; ++i )
+  {
+    const State& particle = *particles[i].particle;
+
+    if( !particle )
+      continue;
+
+    if( !model.isCellVoid<State>( particle.getCell() ) )
+    {
+      stage_data.cell_total_macro_cross_sections[i] =
+        model.getMacroscopicTotalForwardCrossSectionQuick( particle );
+    }
+    else
+      stage_data.cell_total_macro_cross_sections[i] = 0.0;
+  }
+
+  // Stage 3: fire a ray through the cell currently containing each particle
+  for( size_t i = 0; i < number_of_particles; ++i )
+  {
+    Details::InFlightParticle<State>& in_flight_particle = particles[i];
+
+    State& particle = *in_flight_particle.particle;
+
+    if( !particle )
+      continue;
+
+    Utility::OpenMPProperties::setVirtualThreadId( in_flight_particle.thread_id );
+
+    const double cell_distance_to_collision =
+      in_flight_particle.remaining_track_op/
+      stage_data.cell_total_macro_cross_sections[i];
+
+    try{
+      stage_data.distances_to_surface_hit[i] =
+        Details::RaySafetyHelper<State>::getDistanceToSurfaceHit(
+                                                particle,
+                                                stage_data.surfaces_hit[i],
+                                                cell_distance_to_collision );
+    }
+    CATCH_LOST_PARTICLE_AND_CONTINUE( particle, this->template endParticleTrack<State>( in_flight_particle ) );
+
+    // A collision occurs in this cell
+    if( !(stage_data.distances_to_surface_hit[i]*
+          stage_data.cell_total_macro_cross_sections[i] <
+          in_flight_particle.remaining_track_op) )
+    {
+      stage_data.collision_indices.push_back( i );
+    }
+  }
+
+  // Stage 4: advance the particles that pass through their cell to the
+  //          cell boundary
+  typename std::vector<size_t>::const_iterator collision_index_it =
+    stage_data.collision_indices.begin();
+
+  for( size_t i = 0; i < number_of_particles; ++i )
+  {
+    // Skip the particles that will collide in this stage
+    if( collision_index_it != stage_data.collision_indices.end() &&
+        *collision_index_it == i )
+    {
+      ++collision_index_it;
+
+      continue;
+    }
+
+    Details::InFlightParticle<State>& in_flight_particle = particles[i];
+
+    State& particle = *in_flight_particle.particle;
+
+    if( !particle )
+      continue;
+
+    Utility::OpenMPProperties::setVirtualThreadId( in_flight_particle.thread_id );
+
+    try{
+      this->advanceParticleToCellBoundary( particle,
+                                           stage_data.surfaces_hit[i],
+                                           stage_data.distances_to_surface_hit[i] );
+    }
+    CATCH_LOST_PARTICLE_AND_CONTINUE( particle, this->template endParticleTrack<State>( in_flight_particle ) );
+
+    // The particle has exited the geometry
+    if( model.isTerminationCell( particle.getCell() ) )
+    {
+      particle.setAsGone();
+
+      this->template endParticleTrack<State>( in_flight_particle );
+
+      continue;
+    }
+
+    // Update the remaining subtrack mfp
+    in_flight_particle.remaining_track_op -=
+      stage_data.distances_to_surface_hit[i]*
+      stage_data.cell_total_macro_cross_sections[i];
+
+    // Set the ray safety distance to zero
+    particle.setRaySafetyDistance( 0.0 );
+
+    // After the first subtrack the particle can no longer be starting from
+    // a source point
+    in_flight_particle.starting_from_source = false;
+  }
+
+  // Stage 5: collide the remaining particles
+  for( size_t j = 0; j < stage_data.collision_indices.size(); ++j )
+  {
+    const size_t i = stage_data.collision_indices[j];
+
+    Details::InFlightParticle<State>& in_flight_particle = particles[i];
+
+    State& particle = *in_flight_particle.particle;
+
+    Utility::OpenMPProperties::setVirtualThreadId( in_flight_particle.thread_id );
+
+    const double cell_distance_to_collision =
+      in_flight_particle.remaining_track_op/
+      stage_data.cell_total_macro_cross_sections[i];
+
+    this->advanceParticleToCollisionSite(
+                  particle,
+                  in_flight_particle.remaining_track_op,
+                  cell_distance_to_collision,
+                  in_flight_particle.track_start_point,
+                  in_flight_particle.global_subtrack_ending_event_dispatched );
+
+    // Update the particle's ray safety distance
+    Details::RaySafetyHelper<State>::updateRaySafetyDistance(
+                                                  particle,
+                                                  cell_distance_to_collision );
+
+    this->collideWithCellMaterial( particle, bank );
+
+    this->collectNewParticles( in_flight_particle.thread_id, bank, stage_data );
+
+    // This track is finished
+    this->template endParticleTrack<State>( in_flight_particle );
+  }
+}
+
+// Start a new track for a resolved in-flight particle
+template<ParticleModeType mode>
+template<typename State>
+void EventBasedParticleSimulationManager<mode>::startParticleTrack(
+                          Details::InFlightParticle<State>& in_flight_particle )
+{
+  State& particle = *in_flight_particle.particle;
+
+  const SimulationProperties& properties = this->getSimulationProperties();
+
+  if( in_flight_particle.starting_from_source )
+  {
+    // Check if the particle energy is below the cutoff
+    if( particle.getEnergy() < properties.getMinParticleEnergy<State>() )
+    {
+      FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                           " born below global cutoff energy. Check source "
+                           "definition!\n" << particle );
+
+      particle.setAsGone();
+    }
+    // Check if the particle energy is above the max energy
+    else if( particle.getEnergy() > properties.getMaxParticleEnergy<State>() )
+    {
+      FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                           " born above global max energy. Check source "
+                           "definition!\n" << particle );
+
+      particle.setAsGone();
+    }
+  }
+  else
+  {
+    // Check if the particle energy is outside of the energy limits
+    if( particle.getEnergy() < properties.getMinParticleEnergy<State>() ||
+        particle.getEnergy() > properties.getMaxParticleEnergy<State>() )
+      particle.setAsGone();
+
+    // Roulette the particle if it is below the threshold weight
+    else
+      this->getWeightCutoffRoulette().rouletteParticleWeight( particle );
+  }
+
+  if( particle )
+  {
+    in_flight_particle.remaining_track_op =
+      TransportKernel::sampleOpticalPathLengthToNextCollisionSite();
+
+    in_flight_particle.track_start_point[0] = particle.getXPosition();
+    in_flight_particle.track_start_point[1] = particle.getYPosition();
+    in_flight_particle.track_start_point[2] = particle.getZPosition();
+
+    in_flight_particle.starting_new_track = false;
+    in_flight_particle.global_subtrack_ending_event_dispatched = false;
+
+    // If the particle started from a source point, update the relevant
+    // particle entering cell event observers
+    if( in_flight_particle.starting_from_source )
+    {
+      this->getEventHandler().updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+    }
+  }
+}
+
+// End the current track of a resolved in-flight particle
+template<ParticleModeType mode>
+template<typename State>
+void EventBasedParticleSimulationManager<mode>::endParticleTrack(
+                          Details::InFlightParticle<State>& in_flight_particle )
+{
+  State& particle = *in_flight_particle.particle;
+
+  EventHandler& event_handler = this->getEventHandler();
+
+  if( !in_flight_particle.global_subtrack_ending_event_dispatched )
+  {
+    event_handler.updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                      particle,
+                                      in_flight_particle.track_start_point,
+                                      particle.getPosition() );
+  }
+
+  if( !particle )
+    event_handler.updateObserversFromParticleGoneGlobalEvent( particle );
+
+  in_flight_particle.starting_new_track = true;
+  in_flight_particle.starting_from_source = false;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EventBasedParticleSimulationManager_def.hpp
+//---------------------------------------------------------------------------//
@@ -13,10 +13,12 @@
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManager.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "Geometry_AdvancedModel.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_JustInTimeInitializer.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 // The registered managers (these must be global so that the custom signal
@@ -111,6 +113,77 @@ ParticleSimulationManager::ParticleSimulationManager(
 
   // Set the cutoff weight roulette
   this->setCutoffWeightRoulette();
+
+  if( d_properties->isDeltaTrackingModeOn() )
+  {
+    this->checkDeltaTrackingModelCompatibility();
+    
+    this->reportDeltaTrackingIncompatibleObservers();
+  }
+}
+
+// Check that the model is compatible with delta tracking
+/*! \details A delta tracked flight can end on the far side of any surface
+ * in the model, not only the surfaces of the cell where it starts. A
+ * reflecting surface would therefore be crossed instead of reflecting the
+ * particle, so delta tracking cannot be used with models that have
+ * reflecting surfaces.
+ */
+void ParticleSimulationManager::checkDeltaTrackingModelCompatibility() const
+{
+  const Geometry::Model& model = d_model->getUnfilledModel();
+
+  if( model.isAdvanced() )
+  {
+    const Geometry::AdvancedModel& advanced_model =
+      dynamic_cast<const Geometry::AdvancedModel&>( model );
+
+    Geometry::AdvancedModel::SurfaceIdSet surfaces;
+
+    advanced_model.getSurfaces( surfaces );
+
+    for( auto&& surface_id : surfaces )
+    {
+      TEST_FOR_EXCEPTION( advanced_model.isReflectingSurface( surface_id ),
+                          std::runtime_error,
+                          "Delta tracking mode cannot be used with a model "
+                          "that has reflecting surfaces (surface "
+                          << surface_id << " is reflecting)!" );
+    }
+  }
+}
+
+// Report the observers that are not compatible with delta tracking
+/*! \details Collision estimators and global subtrack ending (e.g. mesh
+ * track-length) estimators are compatible with delta tracking. Observers of
+ * surface crossing, cell entering/leaving and subtrack ending in cell
+ * events will only be updated in cells that are surface tracked.
+ */
+void ParticleSimulationManager::reportDeltaTrackingIncompatibleObservers() const
+{
+  const ParticleType neutral_particle_types[3] =
+    {NEUTRON, PHOTON, ADJOINT_PHOTON};
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    const ParticleType particle_type = neutral_particle_types[i];
+
+    if( d_event_handler->getParticleCrossingSurfaceEventDispatcher().hasObservers( particle_type ) ||
+        d_event_handler->getParticleEnteringCellEventDispatcher().hasObservers( particle_type ) ||
+        d_event_handler->getParticleLeavingCellEventDispatcher().hasObservers( particle_type ) ||
+        d_event_handler->getParticleSubtrackEndingInCellEventDispatcher().hasObservers( particle_type ) )
+    {
+      FRENSIE_LOG_WARNING( "Delta tracking mode is on but there are "
+                           << particle_type << " surface, cell entering/"
+                           "leaving or cell track-length observers. These "
+                           "observers will only be updated in cells where "
+                           "surface tracking is used (cell to majorant cross "
+                           "section ratio below "
+                           << d_properties->getDeltaTrackingCrossSectionRatioThreshold()
+                           << "). Use collision or mesh track-length "
+                           "estimators with delta tracking!" );
+    }
+  }
 }
 
 // Return the next history that will be completed
@@ -423,6 +496,9 @@ void ParticleSimulationManager::runSimulation()
     FRENSIE_LOG_NOTIFICATION( "Simulation terminated. " );
   }
 
+  // Log the navigation statistics collected by the model (e.g. ray fires)
+  d_model->getUnfilledModel().logNavigationSummary();
+
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -462,17 +538,34 @@ const CollisionForcer& ParticleSimulationManager::getCollisionForcer() const
   return *d_collision_forcer;
 }
 
+// Get the weight cutoff roulette
+const WeightCutoffRoulette& ParticleSimulationManager::getWeightCutoffRoulette() const
+{
+  return *d_weight_roulette;
+}
+
 // Enable thread support
 void ParticleSimulationManager::enableThreadSupport()
 {
-  // Set up the random number generator for the number of threads requested
-  Utility::RandomNumberGenerator::createStreams();
+  const unsigned number_of_thread_ids = this->getRequiredNumberOfThreadIds();
+  
+  // Set up the random number generator for the number of thread ids
+  Utility::RandomNumberGenerator::createStreams( number_of_thread_ids );
 
   // Enable source thread support
-  d_source->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+  d_source->enableThreadSupport( number_of_thread_ids );
 
   // Enable event handler thread support
-  d_event_handler->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+  d_event_handler->enableThreadSupport( number_of_thread_ids );
+}
+
+// Get the number of thread ids used by the micro batches
+/*! \details By default every thread simulates one history at a time so
+ * the number of thread ids is the number of threads requested.
+ */
+unsigned ParticleSimulationManager::getRequiredNumberOfThreadIds() const
+{
+  return Utility::OpenMPProperties::getRequestedNumberOfThreads();
 }
 
 // Reset data
@@ -517,6 +610,11 @@ void ParticleSimulationManager::rendezvous()
 {
   this->basicRendezvous();
 
+  // Export the weight windows produced by the weight window mesh generators
+  d_event_handler->exportGeneratedWeightWindows(
+                                          d_simulation_name + "_weight_windows",
+                                          d_archive_type );
+
   ++d_rendezvous_number;
 }
 
@@ -636,41 +734,15 @@ void ParticleSimulationManager::runSimulationMicroBatch(
       // Note: Conformal OpenMP code cannot have a break statement. Therefore
       //       we will simply loop through remaining histories without doing
       //       anything if the simulation needs to be ended.
-      if( d_exit_simulation )
+      if( this->hasExitSimulationRequestBeenMade() )
         continue;
 
       // Initialize the random number generator for this history
       Utility::RandomNumberGenerator::initialize( history );
 
       // Sample a particle state from the source
-      try{
-        d_source->sampleParticleState( source_bank, history );
-      }
-      catch( const Geometry::GeometryError& exception )
-      {
-        LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
-
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
-
-        continue;
-      }
-      catch( const std::runtime_error& exception )
-      {
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
-
-        continue;
-      }
-      // The source has likely been constructed incorrectly
-      catch( const std::logic_error& exception )
-      {
-        FRENSIE_LOG_ERROR( "There is an issue with the source!" );
-
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
-
-        d_exit_simulation = true;
-
+      if( !this->sampleSourceParticles( source_bank, history ) )
         continue;
-      }
 
       // Simulate the particles generated by the source first
       while( source_bank.size() > 0 )
@@ -694,6 +766,53 @@ void ParticleSimulationManager::runSimulationMicroBatch(
   }
 }
 
+// Sample the source particles of a history
+/*! \details If the source fails to generate a particle state the error will
+ * be logged and false will be returned. A source that has been constructed
+ * incorrectly will also cause an exit simulation request to be made.
+ */
+bool ParticleSimulationManager::sampleSourceParticles(
+                                                     ParticleBank& source_bank,
+                                                     const uint64_t history )
+{
+  try{
+    d_source->sampleParticleState( source_bank, history );
+  }
+  catch( const Geometry::GeometryError& exception )
+  {
+    LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  // The source has likely been constructed incorrectly
+  catch( const std::logic_error& exception )
+  {
+    FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    d_exit_simulation = true;
+
+    return false;
+  }
+
+  return true;
+}
+
+// Check if the simulation must be exited immediately
+bool ParticleSimulationManager::hasExitSimulationRequestBeenMade() const
+{
+  return d_exit_simulation;
+}
+
 // The signal handler
 /*! \details The first signal will cause the simulation to finish. The
  * second signal will cause the simulation to end without caching its state.
@@ -155,12 +155,60 @@ protected:
                                     ParticleBank& bank,
                                     const bool source_particle );
 
+  //! Simulate a resolved particle using delta tracking
+  template<typename State>
+  void simulateParticleDeltaTracking( ParticleState& unresolved_particle,
+                                      ParticleBank& bank,
+                                      const bool source_particle );
+
+  //! Check if delta tracking will be used for the particle type
+  template<typename State>
+  bool isDeltaTrackingUsed() const;
+
+  //! Run the simulation micro batch
+  virtual void runSimulationMicroBatch( const uint64_t batch_start_history,
+                                        const uint64_t batch_end_history );
+
+  //! Sample the source particles of a history
+  bool sampleSourceParticles( ParticleBank& source_bank,
+                              const uint64_t history );
+
+  //! Check if the simulation must be exited immediately
+  bool hasExitSimulationRequestBeenMade() const;
+
+  //! Advance a particle to the cell boundary
+  template<typename State>
+  void advanceParticleToCellBoundary(
+                              State& particle,
+                              const Geometry::Model::EntityId surface_to_cross,
+                              const double distance_to_surface );
+
+  //! Advance a particle to a collision site
+  template<typename State>
+  void advanceParticleToCollisionSite(
+                               State& particle,
+                               const double op_to_collision_site,
+                               const double distance_to_collision_site,
+                               const double track_start_position[3],
+                               bool& global_subtrack_ending_event_dispatched );
+
+  //! Collide with the cell material
+  template<typename State>
+  void collideWithCellMaterial( State& particle,
+                                ParticleBank& bank );
+
   //! Get the collision forcer
   const CollisionForcer& getCollisionForcer() const;
 
+  //! Get the weight cutoff roulette
+  const WeightCutoffRoulette& getWeightCutoffRoulette() const;
+
   //! Enable thread support
   void enableThreadSupport();
 
+  //! Get the number of thread ids used by the micro batches
+  virtual unsigned getRequiredNumberOfThreadIds() const;
+
   //! Reset data
   void resetData();
 
@@ -206,10 +254,6 @@ private:
   // Set the adjoint electron cutoff weight roulette
   void setAdjointElectronCutoffWeightRoulette();
 
-  //! Run the simulation batch
-  void runSimulationMicroBatch( const uint64_t batch_start_history,
-                                const uint64_t batch_end_history );
-
   // Simulate a resolved particle implementation
   template<typename State, typename SimulateParticleTrackMethod>
   void simulateParticleImpl( ParticleState& unresolved_particle,
@@ -248,26 +292,18 @@ private:
                                          const double optical_path,
                                          const bool starting_from_source );
 
-  // Advance a particle to the cell boundary
+  // Simulate a resolved particle track using delta tracking
   template<typename State>
-  void advanceParticleToCellBoundary(
-                              State& particle,
-                              const Geometry::Model::EntityId surface_to_cross,
-                              const double distance_to_surface );
+  void simulateParticleTrackDeltaTracking( State& particle,
+                                           ParticleBank& bank,
+                                           const double optical_path,
+                                           const bool starting_from_source );
 
-  // Advance a particle to a collision site
-  template<typename State>
-  void advanceParticleToCollisionSite(
-                               State& particle,
-                               const double op_to_collision_site,
-                               const double distance_to_collision_site,
-                               const double track_start_position[3],
-                               bool& global_subtrack_ending_event_dispatched );
+  // Check that the model is compatible with delta tracking
+  void checkDeltaTrackingModelCompatibility() const;
 
-  // Collide with the cell material
-  template<typename State>
-  void collideWithCellMaterial( State& particle,
-                                ParticleBank& bank );
+  // Report the observers that are not compatible with delta tracking
+  void reportDeltaTrackingIncompatibleObservers() const;
 
   // Conduct a basic rendezvous
   void basicRendezvous() const;
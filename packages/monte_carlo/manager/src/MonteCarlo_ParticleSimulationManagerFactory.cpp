@@ -10,6 +10,7 @@
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_EventBasedParticleSimulationManager.hpp"
 #include "MonteCarlo_BatchedDistributedStandardParticleSimulationManager.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_GlobalMPISession.hpp"
@@ -284,6 +285,14 @@ struct ParticleSimulationManagerFactoryCreateHelper
   {
     if( factory.d_comm->size() > 1 )
     {
+      if( factory.d_properties->isEventBasedTransportModeOn() )
+      {
+        FRENSIE_LOG_TAGGED_WARNING( "ParticleSimulationManagerFactory",
+                                    "Event-based transport is not supported "
+                                    "by distributed simulations - "
+                                    "history-based transport will be used!" );
+      }
+      
       factory.d_simulation_manager.reset(
                  new BatchedDistributedStandardParticleSimulationManager<mode>(
                                           factory.d_simulation_name,
@@ -299,6 +308,22 @@ struct ParticleSimulationManagerFactoryCreateHelper
                                           factory.d_use_single_rendezvous_file,
                                           factory.d_comm ) );
     }
+    else if( factory.d_properties->isEventBasedTransportModeOn() )
+    {
+      factory.d_simulation_manager.reset(
+                 new EventBasedParticleSimulationManager<mode>(
+                                      factory.d_simulation_name,
+                                      factory.d_archive_type,
+                                      factory.d_model,
+                                      factory.d_source,
+                                      factory.d_event_handler,
+                                      factory.d_weight_windows,
+                                      factory.d_collision_forcer,
+                                      factory.d_properties,
+                                      factory.d_next_history,
+                                      factory.d_rendezvous_number,
+                                      factory.d_use_single_rendezvous_file ) );
+    }
     else
     {
       factory.d_simulation_manager.reset(
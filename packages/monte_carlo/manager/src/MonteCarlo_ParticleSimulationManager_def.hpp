@@ -13,6 +13,9 @@
 #include <functional>
 #include <type_traits>
 
+// FRENSIE Includes
+#include "Utility_RandomNumberGenerator.hpp"
+
 //! Log lost particle details
 #define LOG_LOST_PARTICLE_DETAILS( particle )   \
   FRENSIE_LOG_TAGGED_WARNING(                   \
@@ -77,9 +80,13 @@ struct RaySafetyHelper
   static inline double getDistanceToSurfaceHit(
                                 State& particle,
                                 Geometry::Model::EntityId& surface_hit,
-                                const double )
+                                const double remaining_track )
   {
-    return particle.navigator().fireRay( surface_hit ).value();
+    // The navigator can skip the ray fire if the collision site is closer
+    // than the closest boundary
+    return particle.navigator().fireRayIfBoundaryIsWithin(
+              Geometry::Navigator::Length::from_value( remaining_track ),
+              surface_hit ).value();
   }
 
   //! Update the ray safety distance
@@ -170,6 +177,41 @@ void ParticleSimulationManager::simulateParticleAlternative(
                                                       std::placeholders::_4 ) );
 }
 
+// Simulate a resolved particle using delta tracking
+template<typename State>
+void ParticleSimulationManager::simulateParticleDeltaTracking(
+                                            ParticleState& unresolved_particle,
+                                            ParticleBank& bank,
+                                            const bool source_particle )
+{
+  // Make sure that the particle is embedded in the model
+  testPrecondition( unresolved_particle.isEmbeddedInModel( *d_model ) );
+
+  this->simulateParticleImpl<State>( unresolved_particle,
+                                     bank,
+                                     source_particle,
+                                     std::bind<void>( &ParticleSimulationManager::simulateParticleTrackDeltaTracking<State>,
+                                                      std::ref( *this ),
+                                                      std::placeholders::_1,
+                                                      std::placeholders::_2,
+                                                      std::placeholders::_3,
+                                                      std::placeholders::_4 ) );
+}
+
+// Check if delta tracking will be used for the particle type
+/*! \details Delta tracking is only used for neutral particles (charged
+ * particles have condensed history steps that must stop at cell
+ * boundaries). Particle types with forced collision cells must use the
+ * "alternative" tracking method.
+ */
+template<typename State>
+bool ParticleSimulationManager::isDeltaTrackingUsed() const
+{
+  return d_properties->isDeltaTrackingModeOn() &&
+    !std::is_base_of<MonteCarlo::ChargedParticleState,State>::value &&
+    !d_collision_forcer->hasForcedCollisionCells( State::type );
+}
+
 // Simulate a resolved particle implementation
 template<typename State, typename SimulateParticleTrackMethod>
 void ParticleSimulationManager::simulateParticleImpl(
@@ -566,6 +608,203 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
 }
 
+// Simulate a resolved particle track using delta tracking
+// Note: Flight distances are sampled using the majorant cross section of the
+//       model, which is constant along the track since the energy is
+//       constant. The cell containing the particle is only located at the
+//       majorant collision sites, where the collision is accepted as real
+//       with probability sigma_cell/sigma_majorant. Cells where this
+//       probability would be below the ratio threshold are surface tracked
+//       instead. Surface crossing, cell entering/leaving and subtrack ending
+//       in cell events are only dispatched in surface tracked cells. Models
+//       with reflecting surfaces are rejected when the manager is
+//       constructed (see checkDeltaTrackingModelCompatibility).
+template<typename State>
+void ParticleSimulationManager::simulateParticleTrackDeltaTracking(
+                                              State& particle,
+                                              ParticleBank& bank,
+                                              const double optical_path,
+                                              const bool starting_from_source )
+{
+  // Particle tracking information (op = optical_path)
+  double remaining_track_op = optical_path;
+  double op_to_surface_hit;
+  double distance_to_surface_hit;
+
+  double track_start_point[3] = {particle.getXPosition(),
+                                 particle.getYPosition(),
+                                 particle.getZPosition()};
+
+  // Surface information
+  Geometry::Model::EntityId surface_hit;
+
+  // Cell information
+  double cell_total_macro_cross_section;
+
+  // Majorant information
+  const double majorant_macro_cross_section =
+    d_model->getMacroscopicMajorantCrossSection<State>( particle.getEnergy() );
+
+  const double delta_tracking_cross_section_threshold =
+    d_properties->getDeltaTrackingCrossSectionRatioThreshold()*
+    majorant_macro_cross_section;
+
+  // Records if global subtrack ending event has been dispatched
+  bool global_subtrack_ending_event_dispatched = false;
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+  }
+
+  // Track until a real collision occurs
+  while( true )
+  {
+    // Get the total cross section for the cell
+    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    {
+      cell_total_macro_cross_section =
+        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+    }
+    else
+      cell_total_macro_cross_section = 0.0;
+
+    // Most majorant collisions would be rejected in this cell - surface
+    // track through it
+    if( majorant_macro_cross_section == 0.0 ||
+        cell_total_macro_cross_section <
+        delta_tracking_cross_section_threshold )
+    {
+      // Fire a ray through the cell currently containing the particle
+      try{
+        distance_to_surface_hit =
+          particle.navigator().fireRay( surface_hit ).value();
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+      // Convert the distance to the surface to optical path
+      op_to_surface_hit =
+        distance_to_surface_hit*cell_total_macro_cross_section;
+
+      // The particle passes through this cell to the next
+      if( op_to_surface_hit < remaining_track_op )
+      {
+        try{
+          this->advanceParticleToCellBoundary( particle,
+                                               surface_hit,
+                                               distance_to_surface_hit );
+        }
+        CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+        // The particle has exited the geometry
+        if( d_model->isTerminationCell( particle.getCell() ) )
+        {
+          particle.setAsGone();
+
+          break;
+        }
+
+        // Update the remaining subtrack mfp
+        remaining_track_op -= op_to_surface_hit;
+      }
+
+      // A collision occurs in this cell
+      else
+      {
+        this->advanceParticleToCollisionSite(
+                             particle,
+                             remaining_track_op,
+                             remaining_track_op/cell_total_macro_cross_section,
+                             track_start_point,
+                             global_subtrack_ending_event_dispatched );
+
+        this->collideWithCellMaterial( particle, bank );
+
+        // This track is finished
+        break;
+      }
+    }
+
+    // Delta track to the next majorant collision site
+    else
+    {
+      const double distance_to_collision_site =
+        remaining_track_op/majorant_macro_cross_section;
+
+      const double* position = particle.getPosition();
+      const double* direction = particle.getDirection();
+
+      const double collision_site[3] =
+        {position[0] + distance_to_collision_site*direction[0],
+         position[1] + distance_to_collision_site*direction[1],
+         position[2] + distance_to_collision_site*direction[2]};
+
+      // Locate the cell containing the collision site
+      try{
+        particle.setPosition( collision_site );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+      particle.setTime( particle.getTime() +
+                        distance_to_collision_site/particle.getSpeed() );
+
+      // The particle has exited the geometry
+      if( d_model->isTerminationCell( particle.getCell() ) )
+      {
+        particle.setAsGone();
+
+        break;
+      }
+
+      if( !d_model->isCellVoid<State>( particle.getCell() ) )
+      {
+        cell_total_macro_cross_section =
+          d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+      }
+      else
+        cell_total_macro_cross_section = 0.0;
+
+      // A real collision occurs
+      if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+          majorant_macro_cross_section < cell_total_macro_cross_section )
+      {
+        d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+
+        global_subtrack_ending_event_dispatched = true;
+
+        this->collideWithCellMaterial( particle, bank );
+
+        // This track is finished
+        break;
+      }
+
+      // A virtual collision occurs - continue with a new flight
+      else
+      {
+        remaining_track_op =
+          d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+      }
+    }
+  }
+
+  if( !global_subtrack_ending_event_dispatched )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+  }
+
+  if( !particle )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+}
+
 // Advance a particle to the cell boundary
 template<typename State>
 void ParticleSimulationManager::advanceParticleToCellBoundary(
@@ -655,10 +894,12 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
     d_weight_windows->updateParticleState( particle, bank );
   }
 
+  // Note: the split particle bank is emptied by each splice so it can be
+  //       reused for every progeny particle
+  ParticleBank split_particle_bank;
+
   while( !local_bank.isEmpty() )
   {
-    ParticleBank split_particle_bank;
-
     if( local_bank.top() )
     {
       d_weight_windows->updateParticleState( local_bank.top(),
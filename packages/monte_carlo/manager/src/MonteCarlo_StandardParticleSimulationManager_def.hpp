@@ -120,6 +120,15 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
                        std::placeholders::_2,
                        std::placeholders::_3 );
   }
+  else if( this->template isDeltaTrackingUsed<State>() )
+  {
+    d_simulate_particle_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticleDeltaTracking<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3 );
+  }
   else
   {
     d_simulate_particle_function_map[particle_type] =
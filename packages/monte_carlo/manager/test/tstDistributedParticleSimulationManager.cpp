@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_BatchedDistributedStandardParticleSimulationManager.hpp"
 #include "MonteCarlo_StandardParticleSource.hpp"
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
@@ -34,6 +35,14 @@ using boost::units::si::kelvin;
 using boost::units::cgs::cubic_centimeter;
 using Utility::Units::MeV;
 
+class TestBatchedDistributedStandardParticleSimulationManager : public MonteCarlo::BatchedDistributedStandardParticleSimulationManager<MonteCarlo::NEUTRON_MODE>
+{
+public:
+
+  // Allow public access to the protected member functions
+  using MonteCarlo::BatchedDistributedStandardParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::calculateWorkerBatchSize;
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables
 //---------------------------------------------------------------------------//
@@ -1406,6 +1415,64 @@ FRENSIE_DATA_UNIT_TEST_INST( ParticleSimulationManager, restart_updated_props )
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// Check that the batch size of a worker can be calculated
+FRENSIE_UNIT_TEST( BatchedDistributedStandardParticleSimulationManager,
+                   calculateWorkerBatchSize )
+{
+  // No rates have been measured yet (first batch): the nominal batch size is
+  // used
+  std::vector<double> worker_history_rates( 3, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 100, 10000, 2 ),
+                       100 );
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 2, 100, 10000, 2 ),
+                       100 );
+
+  // A worker with a zero rate gets the nominal batch size
+  worker_history_rates[1] = 50.0;
+
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 2, 100, 10000, 2 ),
+                       100 );
+
+  // A worker that is the only one with a measured rate is average
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 100, 10000, 2 ),
+                       100 );
+
+  // The batch size is scaled by the relative worker rate
+  worker_history_rates[1] = 100.0;
+  worker_history_rates[2] = 300.0;
+
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 100, 10000, 2 ),
+                       50 );
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 2, 100, 10000, 2 ),
+                       150 );
+
+  // The scaling is limited to a factor of 4
+  worker_history_rates.assign( 6, 1.0 );
+  worker_history_rates[0] = 0.0;
+  worker_history_rates[5] = 100.0;
+
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 5, 100, 10000, 5 ),
+                       400 );
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 100, 10000, 5 ),
+                       25 );
+
+  // The batch size is limited to an equal share of the remaining histories
+  worker_history_rates.assign( 3, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 100, 150, 2 ),
+                       75 );
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 100, 3, 1 ),
+                       3 );
+
+  // At least one history is assigned, but never more than remain
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 100, 1, 2 ),
+                       1 );
+  FRENSIE_CHECK_EQUAL( TestBatchedDistributedStandardParticleSimulationManager::calculateWorkerBatchSize( worker_history_rates, 1, 0, 10, 2 ),
+                       1 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
@@ -11,18 +11,23 @@
 #include <memory>
 #include <csignal>
 #include <functional>
+#include <cmath>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_EventBasedParticleSimulationManager.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
 #include "MonteCarlo_StandardParticleSource.hpp"
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardParticleDistribution.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 #include "FRENSIE_config.hpp"
@@ -58,6 +63,160 @@ std::shared_ptr<MonteCarlo::ParticleSimulationManager> global_manager;
 //---------------------------------------------------------------------------//
 // Testing functions
 //---------------------------------------------------------------------------//
+// Run a photon simulation with a cell collision flux estimator
+void runPhotonFluxSimulation( const bool event_based_transport,
+                              const uint64_t histories,
+                              double& flux_mean,
+                              double& flux_relative_error )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( histories );
+
+  // Use small blocks of histories so that every thread runs several blocks
+  if( event_based_transport )
+  {
+    properties->setEventBasedTransportModeOn();
+    properties->setNumberOfEventBasedHistoriesPerThread( 16 );
+  }
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                        0, 1.0, {1}, {1.0} ) );
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler->addEstimator( estimator );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                  source,
+                                                  event_handler,
+                                                  properties,
+                                                  "test_sim",
+                                                  "xml",
+                                                  threads ).getManager();
+
+  manager->runSimulation();
+
+  std::vector<double> mean, relative_error, vov, fom;
+
+  estimator->getTotalProcessedData( mean, relative_error, vov, fom );
+
+  flux_mean = mean.front();
+  flux_relative_error = relative_error.front();
+}
+
+// Create a two material model (a dense sphere inside of a less dense shell)
+std::shared_ptr<const Geometry::Model> createTwoMaterialModel()
+{
+  std::shared_ptr<Geometry::NativeModel>
+    model( new Geometry::NativeModel( "two materials" ) );
+
+  model->addSurface( Geometry::NativeSurface::createSphere( 1, 0.0, 0.0, 0.0, 5.0 ) );
+  model->addSurface( Geometry::NativeSurface::createSphere( 2, 0.0, 0.0, 0.0, 15.0 ) );
+
+  model->addCell( 1, "-1", 1, -3.0*Geometry::Model::DensityUnit() );
+  model->addCell( 2, "1n-2", 2, -1.0*Geometry::Model::DensityUnit() );
+  model->addCell( 3, "2" );
+
+  model->setTerminationCell( 3 );
+
+  return model;
+}
+
+// Run a photon simulation in the two material model with a cell collision
+// flux estimator
+void runTwoMaterialPhotonFluxSimulation(
+                const std::shared_ptr<MonteCarlo::SimulationProperties>& properties,
+                std::vector<double>& cell_flux_means,
+                std::vector<double>& cell_flux_relative_errors )
+{
+  std::shared_ptr<const Geometry::Model> two_material_model =
+    createTwoMaterialModel();
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        two_material_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     two_material_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                     0, 1.0, {1, 2}, *two_material_model ) );
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler->addEstimator( estimator );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                  source,
+                                                  event_handler,
+                                                  properties,
+                                                  "test_sim",
+                                                  "xml",
+                                                  threads ).getManager();
+
+  manager->runSimulation();
+
+  cell_flux_means.resize( 2 );
+  cell_flux_relative_errors.resize( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    std::vector<double> mean, relative_error, vov, fom;
+
+    estimator->getEntityTotalProcessedData( i+1, mean, relative_error, vov, fom );
+
+    cell_flux_means[i] = mean.front();
+    cell_flux_relative_errors[i] = relative_error.front();
+  }
+}
+
 // void (*default_signal_handler)( int );
 
 // extern "C" void custom_signal_handler( int signal )
@@ -982,6 +1141,193 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
   FRENSIE_CHECK( manager->getNumberOfRendezvous() > 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that an event-based simulation can be run
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_event_based )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 5 );
+    properties->setEventBasedTransportModeOn();
+    properties->setNumberOfEventBasedHistoriesPerThread( 2 );
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    manager = factory->getManager();
+  }
+
+  FRENSIE_CHECK( std::dynamic_pointer_cast<MonteCarlo::EventBasedParticleSimulationManager<MonteCarlo::PHOTON_MODE> >( manager ).get() != NULL );
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 5 );
+  FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
+  FRENSIE_CHECK_EQUAL( manager->getEventHandler().getNumberOfCommittedHistories(), 5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that event-based and history-based transport give statistically
+// equivalent results
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_event_based_vs_history_based )
+{
+  double history_based_mean, history_based_relative_error;
+
+  runPhotonFluxSimulation( false,
+                           1000,
+                           history_based_mean,
+                           history_based_relative_error );
+
+  double event_based_mean, event_based_relative_error;
+
+  runPhotonFluxSimulation( true,
+                           1000,
+                           event_based_mean,
+                           event_based_relative_error );
+
+  FRENSIE_REQUIRE( history_based_mean > 0.0 );
+  FRENSIE_REQUIRE( event_based_mean > 0.0 );
+
+  const double history_based_sigma =
+    history_based_mean*history_based_relative_error;
+
+  const double event_based_sigma =
+    event_based_mean*event_based_relative_error;
+
+  FRENSIE_CHECK( std::fabs( history_based_mean - event_based_mean ) <
+                 4*std::sqrt( history_based_sigma*history_based_sigma +
+                              event_based_sigma*event_based_sigma ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that event-based and history-based transport give statistically
+// equivalent results in a bounded model (the surface crossing stage is used)
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_event_based_vs_history_based_bounded )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( 1000 );
+
+  std::vector<double> history_based_means, history_based_relative_errors;
+
+  runTwoMaterialPhotonFluxSimulation( properties,
+                                      history_based_means,
+                                      history_based_relative_errors );
+
+  // Use small blocks of histories so that every thread runs several blocks
+  properties->setEventBasedTransportModeOn();
+  properties->setNumberOfEventBasedHistoriesPerThread( 16 );
+
+  std::vector<double> event_based_means, event_based_relative_errors;
+
+  runTwoMaterialPhotonFluxSimulation( properties,
+                                      event_based_means,
+                                      event_based_relative_errors );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    FRENSIE_REQUIRE( history_based_means[i] > 0.0 );
+    FRENSIE_REQUIRE( event_based_means[i] > 0.0 );
+
+    const double history_based_sigma =
+      history_based_means[i]*history_based_relative_errors[i];
+
+    const double event_based_sigma =
+      event_based_means[i]*event_based_relative_errors[i];
+
+    FRENSIE_CHECK( std::fabs( history_based_means[i] - event_based_means[i] ) <
+                   4*std::sqrt( history_based_sigma*history_based_sigma +
+                                event_based_sigma*event_based_sigma ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that delta tracking and surface tracking give statistically
+// equivalent results in a heterogeneous model
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_delta_tracking_vs_surface_tracking )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( 1000 );
+
+  std::vector<double> surface_tracking_means,
+    surface_tracking_relative_errors;
+
+  runTwoMaterialPhotonFluxSimulation( properties,
+                                      surface_tracking_means,
+                                      surface_tracking_relative_errors );
+
+  // The shell cross section is 1/3 of the majorant, which is above the ratio
+  // threshold - the shell will be delta tracked and 2/3 of the majorant
+  // collisions sampled in it will be virtual
+  properties->setDeltaTrackingModeOn();
+  properties->setDeltaTrackingCrossSectionRatioThreshold( 0.1 );
+
+  std::vector<double> delta_tracking_means, delta_tracking_relative_errors;
+
+  runTwoMaterialPhotonFluxSimulation( properties,
+                                      delta_tracking_means,
+                                      delta_tracking_relative_errors );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    FRENSIE_REQUIRE( surface_tracking_means[i] > 0.0 );
+    FRENSIE_REQUIRE( delta_tracking_means[i] > 0.0 );
+
+    const double surface_tracking_sigma =
+      surface_tracking_means[i]*surface_tracking_relative_errors[i];
+
+    const double delta_tracking_sigma =
+      delta_tracking_means[i]*delta_tracking_relative_errors[i];
+
+    FRENSIE_CHECK( std::fabs( surface_tracking_means[i] - delta_tracking_means[i] ) <
+                   4*std::sqrt( surface_tracking_sigma*surface_tracking_sigma +
+                                delta_tracking_sigma*delta_tracking_sigma ) );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle simulation manager can handle a signal
 #ifdef HAVE_FRENSIE_OPENMP
@@ -1701,6 +2047,9 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
 
     material_definition_database->addDefinition( "H1 @ 293.6K", 1,
                                                  {"H1 @ 293.6K"}, {1.0} );
+
+    material_definition_database->addDefinition( "H1 shell @ 293.6K", 2,
+                                                 {"H1 @ 293.6K"}, {1.0} );
   }
 
   unfilled_model.reset(
@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MemoryBlockPool.cpp
+//! \author Alex Robinson
+//! \brief  The memory block pool class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <new>
+
+// FRENSIE Includes
+#include "Utility_MemoryBlockPool.hpp"
+
+namespace Utility{
+
+// Initialize static member data
+const size_t MemoryBlockPool::s_max_blocks_per_size;
+
+// Constructor
+MemoryBlockPool::MemoryBlockPool()
+  : d_free_blocks()
+{ /* ... */ }
+
+// Destructor
+MemoryBlockPool::~MemoryBlockPool()
+{
+  for( size_t i = 0; i < d_free_blocks.size(); ++i )
+  {
+    for( size_t j = 0; j < d_free_blocks[i].second.size(); ++j )
+      ::operator delete( d_free_blocks[i].second[j] );
+  }
+}
+
+// Allocate a memory block
+void* MemoryBlockPool::allocate( const size_t size )
+{
+  std::vector<void*>& free_blocks = this->getFreeBlocks( size );
+
+  if( free_blocks.empty() )
+    return ::operator new( size );
+  else
+  {
+    void* block = free_blocks.back();
+
+    free_blocks.pop_back();
+
+    return block;
+  }
+}
+
+// Deallocate a memory block
+void MemoryBlockPool::deallocate( void* block, const size_t size )
+{
+  std::vector<void*>& free_blocks = this->getFreeBlocks( size );
+
+  if( free_blocks.size() < s_max_blocks_per_size )
+    free_blocks.push_back( block );
+  else
+    ::operator delete( block );
+}
+
+// Return the number of free memory blocks
+size_t MemoryBlockPool::getNumberOfFreeBlocks() const
+{
+  size_t number_of_free_blocks = 0;
+
+  for( size_t i = 0; i < d_free_blocks.size(); ++i )
+    number_of_free_blocks += d_free_blocks[i].second.size();
+
+  return number_of_free_blocks;
+}
+
+// Get the free memory blocks of the requested size
+std::vector<void*>& MemoryBlockPool::getFreeBlocks( const size_t size )
+{
+  // Note: there are only a handful of block sizes so a linear search is
+  //       faster than a hash lookup
+  for( size_t i = 0; i < d_free_blocks.size(); ++i )
+  {
+    if( d_free_blocks[i].first == size )
+      return d_free_blocks[i].second;
+  }
+
+  d_free_blocks.emplace_back( size, std::vector<void*>() );
+  d_free_blocks.back().second.reserve( s_max_blocks_per_size );
+
+  return d_free_blocks.back().second;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_MemoryBlockPool.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MemoryBlockPool.hpp
+//! \author Alex Robinson
+//! \brief  The memory block pool class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_MEMORY_BLOCK_POOL_HPP
+#define UTILITY_MEMORY_BLOCK_POOL_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <utility>
+
+namespace Utility{
+
+/*! The memory block pool
+ * \details The pool keeps the memory blocks that are returned to it so that
+ * they can be reused by the next allocation of the same size. Every
+ * concrete type has its own size so each type effectively has its own free
+ * list (types with the same size will share a free list). The number of
+ * blocks kept for each size is bounded so that a burst of allocations cannot
+ * pin an unbounded amount of memory. A pool is not thread safe - each
+ * thread should use its own pool (see
+ * Utility::MemoryBlockPool::getThreadPool).
+ */
+class MemoryBlockPool
+{
+
+public:
+
+  //! Constructor
+  MemoryBlockPool();
+
+  //! Destructor
+  ~MemoryBlockPool();
+
+  //! Allocate a memory block
+  void* allocate( const size_t size );
+
+  //! Deallocate a memory block
+  void deallocate( void* block, const size_t size );
+
+  //! Return the number of free memory blocks
+  size_t getNumberOfFreeBlocks() const;
+
+  //! Get the calling thread's pool for the owner type
+  template<typename Owner>
+  static MemoryBlockPool* getThreadPool();
+
+  //! The max number of free memory blocks of each size
+  static const size_t s_max_blocks_per_size = 1024;
+
+private:
+
+  // Copy constructor
+  MemoryBlockPool( const MemoryBlockPool& other );
+
+  // Assignment operator
+  MemoryBlockPool& operator=( const MemoryBlockPool& other );
+
+  // Get the free memory blocks of the requested size
+  std::vector<void*>& getFreeBlocks( const size_t size );
+
+  // The free memory blocks of each size
+  std::vector<std::pair<size_t,std::vector<void*> > > d_free_blocks;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_MemoryBlockPool_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_MEMORY_BLOCK_POOL_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_MemoryBlockPool.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,48 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MemoryBlockPool_def.hpp
+//! \author Alex Robinson
+//! \brief  The memory block pool class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_MEMORY_BLOCK_POOL_DEF_HPP
+#define UTILITY_MEMORY_BLOCK_POOL_DEF_HPP
+
+namespace Utility{
+
+// Get the calling thread's pool for the owner type
+/*! \details Each owner type has its own pool on each thread. A null pointer
+ * will be returned once the thread's pool has been destroyed - memory that
+ * is returned after that point (e.g. by objects with static storage
+ * duration) must bypass the pool. The destroyed flag is trivially
+ * destructible so it can still be checked at that point.
+ */
+template<typename Owner>
+MemoryBlockPool* MemoryBlockPool::getThreadPool()
+{
+  static thread_local bool pool_destroyed = false;
+
+  struct PoolHolder
+  {
+    ~PoolHolder()
+    { pool_destroyed = true; }
+
+    MemoryBlockPool pool;
+  };
+
+  if( pool_destroyed )
+    return NULL;
+
+  static thread_local PoolHolder pool_holder;
+
+  return &pool_holder.pool;
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_MEMORY_BLOCK_POOL_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_MemoryBlockPool_def.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,181 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MemoryMappedFile.cpp
+//! \author Alex Robinson
+//! \brief  The read-only memory mapped file class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+#include <cerrno>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define UTILITY_MEMORY_MAPPED_FILE_USE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_MemoryMappedFile.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+MemoryMappedFile::MemoryMappedFile(
+                         const boost::filesystem::path& file_name_with_path )
+  : d_file_name( file_name_with_path ),
+    d_size( 0 ),
+    d_data( NULL ),
+    d_buffer()
+{
+  d_file_name.make_preferred();
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( d_file_name ),
+                      std::runtime_error,
+                      "File " << d_file_name.string() << " does not exist!" );
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::is_regular_file( d_file_name ),
+                      std::runtime_error,
+                      "File " << d_file_name.string() << " is not a regular "
+                      "file!" );
+
+  this->mapFile();
+}
+
+// Destructor
+MemoryMappedFile::~MemoryMappedFile()
+{
+  this->unmapFile();
+}
+
+// Map the file
+/*! \details Empty files are never mapped (mmap does not allow zero length
+ * mappings).
+ */
+void MemoryMappedFile::mapFile()
+{
+#ifdef UTILITY_MEMORY_MAPPED_FILE_USE_MMAP
+  int file_descriptor = ::open( d_file_name.c_str(), O_RDONLY );
+
+  TEST_FOR_EXCEPTION( file_descriptor == -1,
+                      std::runtime_error,
+                      "File " << d_file_name.string() << " could not be "
+                      "opened (" << std::strerror( errno ) << ")!" );
+
+  struct stat file_stats;
+
+  if( ::fstat( file_descriptor, &file_stats ) == -1 )
+  {
+    ::close( file_descriptor );
+
+    THROW_EXCEPTION( std::runtime_error,
+                     "The size of file " << d_file_name.string() <<
+                     " could not be determined!" );
+  }
+
+  d_size = file_stats.st_size;
+
+  if( d_size > 0 )
+  {
+    void* mapping = ::mmap( NULL, d_size, PROT_READ, MAP_SHARED, file_descriptor, 0 );
+
+    if( mapping == MAP_FAILED )
+    {
+      ::close( file_descriptor );
+
+      THROW_EXCEPTION( std::runtime_error,
+                       "File " << d_file_name.string() << " could not be "
+                       "mapped (" << std::strerror( errno ) << ")!" );
+    }
+
+    d_data = static_cast<const char*>( mapping );
+  }
+
+  // The mapping remains valid after the file has been closed
+  ::close( file_descriptor );
+#else
+  std::ifstream file( d_file_name.string(), std::ios::in | std::ios::binary );
+
+  TEST_FOR_EXCEPTION( !file.good(),
+                      std::runtime_error,
+                      "File " << d_file_name.string() << " could not be "
+                      "opened!" );
+
+  d_size = boost::filesystem::file_size( d_file_name );
+
+  d_buffer.resize( d_size );
+
+  file.read( d_buffer.data(), d_size );
+
+  TEST_FOR_EXCEPTION( (size_t)file.gcount() != d_size,
+                      std::runtime_error,
+                      "File " << d_file_name.string() << " could not be "
+                      "read!" );
+
+  d_data = d_buffer.data();
+#endif
+}
+
+// Unmap the file
+void MemoryMappedFile::unmapFile()
+{
+#ifdef UTILITY_MEMORY_MAPPED_FILE_USE_MMAP
+  if( d_data != NULL )
+    ::munmap( const_cast<char*>( d_data ), d_size );
+#endif
+
+  d_data = NULL;
+  d_size = 0;
+}
+
+// Get the file name
+const boost::filesystem::path& MemoryMappedFile::getFilename() const
+{
+  return d_file_name;
+}
+
+// Get the file size (bytes)
+size_t MemoryMappedFile::size() const
+{
+  return d_size;
+}
+
+// Check if the file is empty
+bool MemoryMappedFile::empty() const
+{
+  return d_size == 0;
+}
+
+// Get the file contents
+const char* MemoryMappedFile::data() const
+{
+  return d_data;
+}
+
+// Get the iterator to the first byte of the file
+const char* MemoryMappedFile::begin() const
+{
+  return d_data;
+}
+
+// Get the iterator to one past the last byte of the file
+const char* MemoryMappedFile::end() const
+{
+  return d_data + d_size;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_MemoryMappedFile.cpp
+//---------------------------------------------------------------------------//
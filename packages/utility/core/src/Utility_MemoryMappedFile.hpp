@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MemoryMappedFile.hpp
+//! \author Alex Robinson
+//! \brief  The read-only memory mapped file class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_MEMORY_MAPPED_FILE_HPP
+#define UTILITY_MEMORY_MAPPED_FILE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <vector>
+
+// Boost Includes
+#include <boost/noncopyable.hpp>
+#include <boost/filesystem/path.hpp>
+
+namespace Utility{
+
+/*! The read-only memory mapped file class
+ *
+ * The entire file is mapped into the address space of the process when the
+ * object is constructed and unmapped when it is destroyed. Pages are only
+ * read from disk when they are accessed and they are shared with every
+ * other process (and object) that maps the same file. The file contents
+ * cannot be modified, which makes it safe to access them from multiple
+ * threads. On platforms without POSIX memory mapping support the file
+ * contents will be read into memory instead. Objects of this class cannot be
+ * copied - use smart pointers instead.
+ */
+class MemoryMappedFile : private boost::noncopyable
+{
+
+public:
+
+  //! Constructor
+  MemoryMappedFile( const boost::filesystem::path& file_name_with_path );
+
+  //! Destructor
+  ~MemoryMappedFile();
+
+  //! Get the file name
+  const boost::filesystem::path& getFilename() const;
+
+  //! Get the file size (bytes)
+  size_t size() const;
+
+  //! Check if the file is empty
+  bool empty() const;
+
+  //! Get the file contents
+  const char* data() const;
+
+  //! Get the iterator to the first byte of the file
+  const char* begin() const;
+
+  //! Get the iterator to one past the last byte of the file
+  const char* end() const;
+
+private:
+
+  // Map the file
+  void mapFile();
+
+  // Unmap the file
+  void unmapFile();
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The file size
+  size_t d_size;
+
+  // The mapped file contents
+  const char* d_data;
+
+  // The file contents (only used when memory mapping is not supported)
+  std::vector<char> d_buffer;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_MEMORY_MAPPED_FILE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_MemoryMappedFile.hpp
+//---------------------------------------------------------------------------//
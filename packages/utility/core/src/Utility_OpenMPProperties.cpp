@@ -8,10 +8,12 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <limits>
 
 // FRENSIE Includes
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_DesignByContract.hpp"
 #include "FRENSIE_config.hpp"
 
 namespace Utility{
@@ -105,6 +107,8 @@ private:
 
 // Initialize static member data
 unsigned OpenMPProperties::threads = 1u;
+thread_local unsigned OpenMPProperties::virtual_thread_id =
+  std::numeric_limits<unsigned>::max();
 
 // Set the number of threads to use in parallel blocks
 /*! \details This function will set the number of threads that will usually
@@ -150,9 +154,15 @@ unsigned OpenMPProperties::getNumberOfThreads()
 // Get the thread id within the current parallel scope
 /*! \details If OpenMP is not used or if the program execution state is not
  *  within an omp parallel block the master thread id (0) will be returned.
+ *  If a virtual thread id has been set for the calling thread it will be
+ *  returned instead.
  */
 unsigned OpenMPProperties::getThreadId()
 {
+  if( OpenMPProperties::virtual_thread_id !=
+      std::numeric_limits<unsigned>::max() )
+    return OpenMPProperties::virtual_thread_id;
+  
 #ifdef HAVE_FRENSIE_OPENMP
   return omp_get_thread_num();
 #else
@@ -160,6 +170,27 @@ unsigned OpenMPProperties::getThreadId()
 #endif
 }
 
+// Set the virtual thread id of the calling thread
+/*! \details A virtual thread id allows a single thread to interleave the
+ * work of several independent tasks that each own a set of per-thread
+ * data (e.g. a random number stream). The caller is responsible for
+ * assigning virtual thread ids that are unique across all of the threads
+ * in the parallel block and for sizing the per-thread data accordingly.
+ */
+void OpenMPProperties::setVirtualThreadId( const unsigned thread_id )
+{
+  // Make sure that the thread id is valid
+  testPrecondition( thread_id != std::numeric_limits<unsigned>::max() );
+  
+  OpenMPProperties::virtual_thread_id = thread_id;
+}
+
+// Unset the virtual thread id of the calling thread
+void OpenMPProperties::unsetVirtualThreadId()
+{
+  OpenMPProperties::virtual_thread_id = std::numeric_limits<unsigned>::max();
+}
+
 // Return if OpenMP has been configured for use
 bool OpenMPProperties::isOpenMPUsed()
 {
@@ -34,6 +34,12 @@ public:
   //! Get the thread id within the current scope
   static unsigned getThreadId();
 
+  //! Set the virtual thread id of the calling thread
+  static void setVirtualThreadId( const unsigned thread_id );
+
+  //! Unset the virtual thread id of the calling thread
+  static void unsetVirtualThreadId();
+
   //! Create a timer using the OpenMP interface
   static std::shared_ptr<Timer> createTimer();
 
@@ -44,6 +50,9 @@ private:
 
   // The number of threads to use in parallel blocks
   static unsigned threads;
+
+  // The virtual thread id of the calling thread
+  static thread_local unsigned virtual_thread_id;
 };
 
 } // end Utility namespace
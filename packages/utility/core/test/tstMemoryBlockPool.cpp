@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstMemoryBlockPool.cpp
+//! \author Alex Robinson
+//! \brief  Memory block pool class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_MemoryBlockPool.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+struct FirstOwner{};
+struct SecondOwner{};
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a deallocated block is reused by the next allocation of the
+// same size
+FRENSIE_UNIT_TEST( MemoryBlockPool, allocate_deallocate )
+{
+  Utility::MemoryBlockPool pool;
+
+  FRENSIE_CHECK_EQUAL( pool.getNumberOfFreeBlocks(), 0 );
+
+  void* block = pool.allocate( 64 );
+
+  FRENSIE_CHECK( block != NULL );
+  FRENSIE_CHECK_EQUAL( pool.getNumberOfFreeBlocks(), 0 );
+
+  pool.deallocate( block, 64 );
+
+  FRENSIE_CHECK_EQUAL( pool.getNumberOfFreeBlocks(), 1 );
+
+  // A block of a different size must not be reused
+  void* other_block = pool.allocate( 128 );
+
+  FRENSIE_CHECK( other_block != block );
+  FRENSIE_CHECK_EQUAL( pool.getNumberOfFreeBlocks(), 1 );
+
+  FRENSIE_CHECK( pool.allocate( 64 ) == block );
+  FRENSIE_CHECK_EQUAL( pool.getNumberOfFreeBlocks(), 0 );
+
+  pool.deallocate( block, 64 );
+  pool.deallocate( other_block, 128 );
+
+  FRENSIE_CHECK_EQUAL( pool.getNumberOfFreeBlocks(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of free blocks of each size is bounded
+FRENSIE_UNIT_TEST( MemoryBlockPool, deallocate_bounded )
+{
+  Utility::MemoryBlockPool pool;
+
+  std::vector<void*> blocks( Utility::MemoryBlockPool::s_max_blocks_per_size + 10 );
+
+  for( size_t i = 0; i < blocks.size(); ++i )
+    blocks[i] = pool.allocate( 32 );
+
+  for( size_t i = 0; i < blocks.size(); ++i )
+    pool.deallocate( blocks[i], 32 );
+
+  FRENSIE_CHECK_EQUAL( pool.getNumberOfFreeBlocks(),
+                       Utility::MemoryBlockPool::s_max_blocks_per_size );
+}
+
+//---------------------------------------------------------------------------//
+// Check that each owner type has its own thread pool
+FRENSIE_UNIT_TEST( MemoryBlockPool, getThreadPool )
+{
+  Utility::MemoryBlockPool* first_pool =
+    Utility::MemoryBlockPool::getThreadPool<FirstOwner>();
+
+  Utility::MemoryBlockPool* second_pool =
+    Utility::MemoryBlockPool::getThreadPool<SecondOwner>();
+
+  FRENSIE_REQUIRE( first_pool != NULL );
+  FRENSIE_REQUIRE( second_pool != NULL );
+  FRENSIE_CHECK( first_pool != second_pool );
+  FRENSIE_CHECK_EQUAL( Utility::MemoryBlockPool::getThreadPool<FirstOwner>(),
+                       first_pool );
+
+  first_pool->deallocate( first_pool->allocate( 16 ), 16 );
+
+  FRENSIE_CHECK_EQUAL( first_pool->getNumberOfFreeBlocks(), 1 );
+  FRENSIE_CHECK_EQUAL( second_pool->getNumberOfFreeBlocks(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstMemoryBlockPool.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstMemoryMappedFile.cpp
+//! \author Alex Robinson
+//! \brief  Memory mapped file class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_MemoryMappedFile.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::string test_file_name;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a file can be mapped
+FRENSIE_UNIT_TEST( MemoryMappedFile, constructor )
+{
+  std::unique_ptr<Utility::MemoryMappedFile> file;
+
+  FRENSIE_CHECK_NO_THROW( file.reset( new Utility::MemoryMappedFile( test_file_name ) ) );
+
+  FRENSIE_CHECK_EQUAL( file->getFilename().string(),
+                       boost::filesystem::path( test_file_name ).make_preferred().string() );
+  FRENSIE_CHECK_EQUAL( file->size(),
+                       boost::filesystem::file_size( test_file_name ) );
+  FRENSIE_CHECK( !file->empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a file that does not exist cannot be mapped
+FRENSIE_UNIT_TEST( MemoryMappedFile, constructor_missing_file )
+{
+  FRENSIE_CHECK_THROW( Utility::MemoryMappedFile( "dummy_file.txt" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the file contents can be accessed
+FRENSIE_UNIT_TEST( MemoryMappedFile, data )
+{
+  Utility::MemoryMappedFile file( test_file_name );
+
+  std::string first_line( file.begin(),
+                          std::find( file.begin(), file.end(), '\n' ) );
+
+  FRENSIE_CHECK_EQUAL( first_line, "This is a test file. Line 1" );
+
+  FRENSIE_CHECK_EQUAL( std::count( file.begin(), file.end(), '\n' ), 5 );
+  FRENSIE_CHECK_EQUAL( file.end() - file.data(), file.size() );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_file",
+                                        test_file_name, "",
+                                        "Test file name" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstMemoryMappedFile.cpp
+//---------------------------------------------------------------------------//
@@ -67,6 +67,33 @@ BOOST_AUTO_TEST_CASE( getNumberOfThreads )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a virtual thread id can be set
+BOOST_AUTO_TEST_CASE( setVirtualThreadId )
+{
+  BOOST_CHECK_EQUAL( Utility::OpenMPProperties::getThreadId(), 0 );
+
+  Utility::OpenMPProperties::setVirtualThreadId( 5 );
+
+  BOOST_CHECK_EQUAL( Utility::OpenMPProperties::getThreadId(), 5 );
+
+  // The virtual thread id is only used by the thread that set it
+  #pragma omp parallel num_threads( 4 )
+  {
+    #pragma omp master
+    {
+      BOOST_CHECK_EQUAL( Utility::OpenMPProperties::getThreadId(), 5 );
+    }
+
+    BOOST_CHECK( Utility::OpenMPProperties::getThreadId() < 4 ||
+                 Utility::OpenMPProperties::getThreadId() == 5 );
+  }
+
+  Utility::OpenMPProperties::unsetVirtualThreadId();
+
+  BOOST_CHECK_EQUAL( Utility::OpenMPProperties::getThreadId(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a timer can be created that is safe for use with OpenMP
 BOOST_AUTO_TEST_CASE( createTimer )
@@ -21,6 +21,15 @@
 
 namespace Utility{
 
+// Enable support for multiple threads
+/*! \details Meshes that cache data for each thread (e.g. the last element
+ * visited) must override this method. It must only be called by the root
+ * thread before a parallel region is entered. The default implementation
+ * does nothing.
+ */
+void Mesh::enableThreadSupport( const unsigned ) const
+{ /* ... */ }
+
 // Export the mesh to a file
 void Mesh::exportData( const std::string& output_file_name ) const
 {
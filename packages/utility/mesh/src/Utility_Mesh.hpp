@@ -88,6 +88,9 @@ public:
               const double end_point[3],
               ElementHandleTrackLengthArray& element_track_lengths ) const = 0;
 
+  //! Enable support for multiple threads
+  virtual void enableThreadSupport( const unsigned num_threads ) const;
+
   //! Export the mesh to a file (type determined by suffix - e.g. mesh.vtk)
   virtual void exportData( const std::string& output_file_name,
                            const TagNameSet& tag_root_names,
@@ -8,6 +8,8 @@
 
 //std includes
 #include <math.h>
+#include <cmath>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // This must be included first
@@ -70,6 +72,8 @@ StructuredHexMesh::StructuredHexMesh( const std::vector<double>& x_planes,
     }
   }
 
+  this->initializeUniformPlaneSpacing();
+
 #ifndef HAVE_FRENSIE_MOAB
   FRENSIE_LOG_TAGGED_WARNING( "StructuredHexMesh",
                               "Cannot export mesh data to vtk because moab "
@@ -134,38 +138,24 @@ auto StructuredHexMesh::whichElementIsPointIn( const double point[3] ) const ->
   // Make sure that the point is in the mesh
   testPrecondition( this->isPointInMesh(point) );
 
-  size_t x_index = Search::binaryLowerBoundIndex( d_x_planes.begin(),
-                                                  d_x_planes.end(),
-                                                  point[X_DIMENSION] );
-
-  // Take care of when the point is exactly on the last x plane. The search
-  // will return the last x plane if this is true which does not correspond to
-  // any of the hex elements. Instead, move it back one
-  if( x_index == d_x_planes.size() - 1)
-  {
-    x_index = d_x_planes.size() - 2;
-  }
+  size_t x_index =
+    this->setHexPlaneIndex( point[X_DIMENSION], d_x_planes, X_DIMENSION );
 
-  size_t y_index = Search::binaryLowerBoundIndex( d_y_planes.begin(),
-                                                  d_y_planes.end(),
-                                                  point[Y_DIMENSION] );
-  if( y_index == d_y_planes.size() - 1)
-  {
-    y_index = d_y_planes.size() - 2;
-  }
+  size_t y_index =
+    this->setHexPlaneIndex( point[Y_DIMENSION], d_y_planes, Y_DIMENSION );
 
-  size_t z_index = Search::binaryLowerBoundIndex( d_z_planes.begin(),
-                                                  d_z_planes.end(),
-                                                  point[Z_DIMENSION] );
-  if( z_index == d_z_planes.size() - 1)
-  {
-    z_index = d_z_planes.size() - 2;
-  }
+  size_t z_index =
+    this->setHexPlaneIndex( point[Z_DIMENSION], d_z_planes, Z_DIMENSION );
 
   return this->findIndex( x_index, y_index, z_index );
 }
 
 // Returns an array of pairs of hex IDs and partial track lengths along a given line segment
+/*! \details The track length array will be cleared before the track lengths
+ * are added. Its capacity is retained so callers that reuse the same array
+ * for every segment will not trigger heap allocations once it has grown to
+ * the largest number of elements crossed by a segment.
+ */
 void StructuredHexMesh::computeTrackLengths(
                const double start_point[3],
                const double end_point[3],
@@ -343,16 +333,18 @@ StructuredHexMesh::doesRayIntersectMesh(
   Utility::get<1>( intersection_data ) = X_DIMENSION;
   Utility::get<2>( intersection_data ) = 0.0;
 
-  std::vector<std::pair<Dimension,double> > bounding_plane_distance_set;
+  std::pair<Dimension,double> bounding_plane_distance_set[3];
+  size_t number_of_bounding_planes;
 
   this->findBoundingInteractionPlaneDistances( point,
                                                direction,
-                                               bounding_plane_distance_set );
+                                               bounding_plane_distance_set,
+                                               number_of_bounding_planes );
 
   // Check whether there are any possible bounding planes to intersect with
-  if( bounding_plane_distance_set.size() > 0 )
+  if( number_of_bounding_planes > 0 )
   {
-    for( size_t i = 0; i < bounding_plane_distance_set.size(); ++i )
+    for( size_t i = 0; i < number_of_bounding_planes; ++i )
     {
       // If the distance is greater than the track length, skip it
       if( bounding_plane_distance_set[i].second >= track_length )
@@ -385,194 +377,174 @@ StructuredHexMesh::doesRayIntersectMesh(
 }
 
 // Trace particle path through mesh until it dies or leaves mesh
+/*! \details The mesh is traversed incrementally using a 3D digital
+ * differential analyzer (Amanatides-Woo). The distance along the ray to the
+ * next plane crossing is tracked for each dimension and the dimension with
+ * the nearest crossing is stepped at every iteration, which only requires
+ * updating a single plane index and the hex index. All distances are
+ * measured from the initial point so that round-off does not accumulate
+ * along the ray. When the planes of a dimension are uniformly spaced the
+ * distance between consecutive crossings (tDelta) is constant and the next
+ * crossing distance is calculated from it without accessing the plane set.
+ * No heap memory is allocated apart from the growth of the track length
+ * array, whose capacity is retained between calls by the caller.
+ */
 void StructuredHexMesh::traceThroughMesh(
-               double point[3],
+               const double point[3],
                const double direction[3],
                const double track_length,
-               PlaneIndex hex_plane_indices[3],
+               const PlaneIndex hex_plane_indices[3],
                ElementHandleTrackLengthArray& hex_element_track_lengths ) const
 {
-  std::vector<std::pair<Dimension,PlaneIndex> > interaction_planes;
-  this->findInteractionPlanes( point,
-                               direction,
-                               hex_plane_indices,
-                               interaction_planes );
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( direction ) );
 
-  double iteration_distance = 0;
+  const std::vector<double>* plane_sets[3] =
+    {&d_x_planes, &d_y_planes, &d_z_planes};
 
-  size_t incrementer[3];
-  this->setIncrementer( incrementer, direction );
+  // The hex index stride of each dimension
+  const ElementHandle hex_index_strides[3] =
+    {1,
+     d_x_planes.size()-1,
+     (d_x_planes.size()-1)*(d_y_planes.size()-1)};
 
-  bool continue_tracing = true;
+  // The next plane crossed in each dimension
+  PlaneIndex next_plane_indices[3];
 
-  while(continue_tracing)
-  {
-    std::pair<Dimension, double> intersection_distance;
-    this->findIntersectionDistance( point,
-                                    direction,
-                                    interaction_planes,
-                                    intersection_distance );
-    double partial_track_length;
+  // The last plane that can be crossed in each dimension (mesh boundary)
+  PlaneIndex boundary_plane_indices[3];
 
-    // Check if track length is exhausted
-    if( track_length <= iteration_distance + intersection_distance.second )
-    {
-      partial_track_length = track_length - iteration_distance;
-      continue_tracing = false;
-    }
-    else
-    {
-      partial_track_length = intersection_distance.second;
-    }
+  // The hex index increment when crossing a plane (modular arithmetic is
+  // used for negative increments)
+  ElementHandle hex_index_increments[3];
 
-    // Push back a new pair for the indices
-    hex_element_track_lengths.push_back(
-       std::make_tuple( this->findIndex( hex_plane_indices ),
-                        std::array<double,3>( {point[0], point[1], point[2]} ),
-                        partial_track_length ) );
+  // The distance along the ray to the next plane crossing
+  double next_crossing_distances[3];
+
+  // The distance along the ray to the first plane crossing
+  double first_crossing_distances[3];
+
+  // The distance along the ray between plane crossings (uniform planes only)
+  double crossing_distance_deltas[3];
+
+  // The number of planes crossed in each dimension
+  size_t number_of_crossings[3] = {0, 0, 0};
 
-    // Check if the particle left the mesh
-    if( this->didParticleLeaveMesh( intersection_distance.first,
-                                    interaction_planes ) )
+  double inverse_direction[3];
+
+  for( size_t d = X_DIMENSION; d <= Z_DIMENSION; ++d )
+  {
+    const std::vector<double>& plane_set = *plane_sets[d];
+
+    if( direction[d] == 0.0 )
     {
-      continue_tracing = false;
+      next_crossing_distances[d] = std::numeric_limits<double>::infinity();
+
+      // These will never be used
+      next_plane_indices[d] = 0;
+      boundary_plane_indices[d] = 0;
+      hex_index_increments[d] = 0;
+      inverse_direction[d] = 0.0;
+      crossing_distance_deltas[d] = 0.0;
     }
-
-    // If the track length was exhausted or the particle left the mesh, leave
-    // loop and return array.
-    if( continue_tracing )
+    else
     {
-      // Otherwise, push point up to new location
-      this->pushPoint(point, direction, partial_track_length);
+      if( direction[d] > 0.0 )
+      {
+        next_plane_indices[d] = hex_plane_indices[d] + 1;
+        boundary_plane_indices[d] = plane_set.size() - 1;
+        hex_index_increments[d] = hex_index_strides[d];
+      }
+      else
+      {
+        next_plane_indices[d] = hex_plane_indices[d];
+        boundary_plane_indices[d] = 0;
+        hex_index_increments[d] = -hex_index_strides[d];
+      }
 
-      // Increase iteration_distance to new value
-      iteration_distance += partial_track_length;
+      inverse_direction[d] = 1.0/direction[d];
 
-      // Increment indices and perform calculation again.
-      hex_plane_indices[intersection_distance.first] +=
-        incrementer[intersection_distance.first];
+      next_crossing_distances[d] =
+        (plane_set[next_plane_indices[d]] - point[d])*inverse_direction[d];
 
-      for( size_t i = 0; i < interaction_planes.size() ; ++i )
+      if( d_inverse_plane_spacing[d] > 0.0 )
       {
-        if(interaction_planes[i].first == intersection_distance.first)
-        {
-          interaction_planes[i].second +=
-            incrementer[interaction_planes[i].first];
-
-          break;
-        }
+        crossing_distance_deltas[d] =
+          std::fabs( inverse_direction[d] )/d_inverse_plane_spacing[d];
       }
+      else
+        crossing_distance_deltas[d] = 0.0;
     }
+
+    first_crossing_distances[d] = next_crossing_distances[d];
   }
-}
 
-// Find the interaction planes that a particle will interact with
-void StructuredHexMesh::findInteractionPlanes(
-      const double point[3],
-      const double direction[3],
-      const PlaneIndex hex_plane_indices[3],
-      std::vector<std::pair<Dimension,PlaneIndex> >& interaction_planes ) const
-{
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh( point ) );
+  ElementHandle hex_index = this->findIndex( hex_plane_indices );
+
+  double current_distance = 0.0;
 
-  for( size_t i = X_DIMENSION; i <= Z_DIMENSION; ++i)
+  while( true )
   {
-    if( direction[i] < 0 )
-    {
-      interaction_planes.push_back( std::make_pair( static_cast<Dimension>(i), hex_plane_indices[i] ) );
-    }
-    else if( direction[i] > 0)
-    {
-      interaction_planes.push_back( std::make_pair( static_cast<Dimension>(i), hex_plane_indices[i] + 1) );
-    }
-  }
-}
+    // Find the dimension with the nearest plane crossing (ties go to the
+    // lowest dimension)
+    size_t crossing_dimension = X_DIMENSION;
 
-// Find the intersection distance along the path of the particle with the next hex
-void StructuredHexMesh::findIntersectionDistance(
-                           const double point[3],
-                           const double direction[3],
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes,
-                           std::pair<Dimension,double>&
-                           intersection_distance ) const
-{
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh(point) );
-  // Make sure that the direction is valid
-  testPrecondition( Utility::isUnitVector( direction ) );
+    if( next_crossing_distances[Y_DIMENSION] <
+        next_crossing_distances[crossing_dimension] )
+      crossing_dimension = Y_DIMENSION;
 
-  intersection_distance.second = std::numeric_limits<double>::infinity();
+    if( next_crossing_distances[Z_DIMENSION] <
+        next_crossing_distances[crossing_dimension] )
+      crossing_dimension = Z_DIMENSION;
 
-  double possible_distance;
+    const double crossing_distance =
+      next_crossing_distances[crossing_dimension];
 
-  for( size_t i = 0; i < interaction_planes.size(); ++i )
-  {
-    if(interaction_planes[i].first == X_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_x_planes[ interaction_planes[i].second ],
-                                    point[X_DIMENSION],
-                                    direction[X_DIMENSION] );
+    // Check if track length is exhausted
+    const bool track_length_exhausted = track_length <= crossing_distance;
 
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = X_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
-    }
-    else if(interaction_planes[i].first == Y_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_y_planes[ interaction_planes[i].second ],
-                                    point[Y_DIMENSION],
-                                    direction[Y_DIMENSION] );
+    const double partial_track_length = track_length_exhausted ?
+      track_length - current_distance : crossing_distance - current_distance;
 
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = Y_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
-    }
-    else if(interaction_planes[i].first == Z_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_z_planes[ interaction_planes[i].second ],
-                                    point[Z_DIMENSION],
-                                    direction[Z_DIMENSION] );
+    hex_element_track_lengths.push_back(
+       std::make_tuple( hex_index,
+                        std::array<double,3>( {point[0] + direction[0]*current_distance,
+                                               point[1] + direction[1]*current_distance,
+                                               point[2] + direction[2]*current_distance} ),
+                        partial_track_length ) );
 
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = Z_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
+    // Check if the particle has left the mesh
+    if( track_length_exhausted ||
+        next_plane_indices[crossing_dimension] ==
+        boundary_plane_indices[crossing_dimension] )
+    {
+      break;
     }
-  }
-}
 
-// Calculate distance to a plane from a ray along its direction
-double StructuredHexMesh::findDistanceToInteractionPlane(
-                                       const double interaction_plane_location,
-                                       const double position_component,
-                                       const double direction_component ) const
-{
-  return (interaction_plane_location - position_component)/direction_component;
-}
+    // Step into the next hex
+    current_distance = crossing_distance;
 
-// Form the incrementer so that the particle increments over the planes in the correct direction
-void StructuredHexMesh::setIncrementer( size_t incrementer[3],
-                                        const double direction[3] ) const
-{
-  for(size_t i = 0; i < 3; ++i)
-  {
-    if(direction[i] >= 0)
+    hex_index += hex_index_increments[crossing_dimension];
+
+    if( direction[crossing_dimension] > 0.0 )
+      ++next_plane_indices[crossing_dimension];
+    else
+      --next_plane_indices[crossing_dimension];
+
+    ++number_of_crossings[crossing_dimension];
+
+    if( crossing_distance_deltas[crossing_dimension] > 0.0 )
     {
-      incrementer[i] = 1;
+      next_crossing_distances[crossing_dimension] =
+        first_crossing_distances[crossing_dimension] +
+        number_of_crossings[crossing_dimension]*
+        crossing_distance_deltas[crossing_dimension];
     }
     else
     {
-      incrementer[i] = -1;
+      next_crossing_distances[crossing_dimension] =
+        ((*plane_sets[crossing_dimension])[next_plane_indices[crossing_dimension]] -
+         point[crossing_dimension])*inverse_direction[crossing_dimension];
     }
   }
 }
@@ -664,7 +636,43 @@ void StructuredHexMesh::setHexPlaneIndices(
   testPostcondition( hex_plane_indices[Z_DIMENSION] >= 0 && hex_plane_indices[Z_DIMENSION] <= d_z_planes.size()-2);
 }
 
+// Cache the inverse plane spacing of each dimension with uniform planes
+/*! \details When the planes of a dimension are uniformly spaced the plane
+ * index of a point can be calculated directly instead of searching the
+ * plane set.
+ */
+void StructuredHexMesh::initializeUniformPlaneSpacing()
+{
+  const std::vector<double>* plane_sets[3] =
+    {&d_x_planes, &d_y_planes, &d_z_planes};
+
+  for( size_t d = 0; d < 3; ++d )
+  {
+    const std::vector<double>& plane_set = *plane_sets[d];
+
+    const double width = plane_set.back() - plane_set.front();
+    const double spacing = width/(plane_set.size() - 1);
+
+    d_inverse_plane_spacing[d] = 1.0/spacing;
+
+    for( size_t i = 1; i < plane_set.size() - 1; ++i )
+    {
+      if( std::fabs( plane_set[i] - (plane_set.front() + i*spacing) ) >
+          s_tol*width )
+      {
+        d_inverse_plane_spacing[d] = 0.0;
+
+        break;
+      }
+    }
+  }
+}
+
 // Set individual hex plane indices for particle.
+/*! \details The plane index is calculated directly (O(1)) if the planes are
+ * uniformly spaced. Round-off is corrected so that the result is always
+ * identical to the binary search result.
+ */
 auto StructuredHexMesh::setHexPlaneIndex(
                          const double position_component,
                          const std::vector<double>& plane_set,
@@ -676,6 +684,29 @@ auto StructuredHexMesh::setHexPlaneIndex(
   {
     hex_plane_index = plane_set.size() - 2;
   }
+  else if( d_inverse_plane_spacing[plane_dimension] > 0.0 )
+  {
+    const double offset = (position_component - plane_set.front())*
+      d_inverse_plane_spacing[plane_dimension];
+
+    if( offset <= 0.0 )
+      hex_plane_index = 0;
+    else
+    {
+      hex_plane_index = std::min( (PlaneIndex)offset, plane_set.size() - 2 );
+    }
+
+    if( hex_plane_index > 0 &&
+        position_component < plane_set[hex_plane_index] )
+    {
+      --hex_plane_index;
+    }
+    else if( hex_plane_index < plane_set.size() - 2 &&
+             position_component >= plane_set[hex_plane_index+1] )
+    {
+      ++hex_plane_index;
+    }
+  }
   else
   {
     hex_plane_index = Search::binaryLowerBoundIndex( plane_set.begin(),
@@ -688,26 +719,32 @@ auto StructuredHexMesh::setHexPlaneIndex(
 
 // Returns a set of distances to up to 3 planes that bound the mesh which the particle may interact with
 void StructuredHexMesh::findBoundingInteractionPlaneDistances(
-  const double point[3],
-  const double direction[3],
-  std::vector<std::pair<Dimension,double> >& bounding_intersection_data ) const
+              const double point[3],
+              const double direction[3],
+              std::pair<Dimension,double> bounding_intersection_data[3],
+              size_t& number_of_bounding_planes ) const
 {
+  number_of_bounding_planes = 0;
+
   this->checkPlaneSet( d_x_planes,
                        point[X_DIMENSION],
                        direction[X_DIMENSION],
                        bounding_intersection_data,
+                       number_of_bounding_planes,
                        X_DIMENSION );
 
   this->checkPlaneSet( d_y_planes,
                        point[Y_DIMENSION],
                        direction[Y_DIMENSION],
                        bounding_intersection_data,
+                       number_of_bounding_planes,
                        Y_DIMENSION );
 
   this->checkPlaneSet( d_z_planes,
                        point[Z_DIMENSION],
                        direction[Z_DIMENSION],
                        bounding_intersection_data,
+                       number_of_bounding_planes,
                        Z_DIMENSION );
 }
 
@@ -716,18 +753,21 @@ void StructuredHexMesh::checkPlaneSet(
                    const std::vector<double>& plane_set,
                    const double position_component,
                    const double direction_component,
-                   std::vector<std::pair<Dimension, double> >& boundary_planes,
+                   std::pair<Dimension,double> boundary_planes[3],
+                   size_t& number_of_boundary_planes,
                    const Dimension plane_dimension ) const
 {
   if( position_component < plane_set.front() && direction_component > 0 )
   {
-    boundary_planes.push_back( std::make_pair(plane_dimension,
-                                              (plane_set.front() - position_component)/direction_component) );
+    boundary_planes[number_of_boundary_planes++] =
+      std::make_pair( plane_dimension,
+                      (plane_set.front() - position_component)/direction_component );
   }
   else if( position_component > plane_set.back() && direction_component < 0 )
   {
-    boundary_planes.push_back( std::make_pair( plane_dimension,
-                                               (plane_set.back() - position_component)/direction_component ) );
+    boundary_planes[number_of_boundary_planes++] =
+      std::make_pair( plane_dimension,
+                      (plane_set.back() - position_component)/direction_component );
   }
 }
 
@@ -797,48 +837,6 @@ void StructuredHexMesh::pushPoint( double point[3],
   point[Z_DIMENSION] += direction[Z_DIMENSION]*push_distance;
 }
 
-// Return whether or not a particle has exited the mesh
-bool StructuredHexMesh::didParticleLeaveMesh(
-                           Dimension intersection_dimension,
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes ) const
-{
-  bool exit_mesh = false;
-
-  for( size_t i = 0; i < interaction_planes.size(); ++i )
-  {
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == X_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_x_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
-    }
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == Y_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_y_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
-    }
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == Z_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_z_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
-    }
-  }
-
-  return exit_mesh;
-}
-
 // Calculate hex index from respective plane indices
 size_t StructuredHexMesh::findIndex( const size_t i,
                                      const size_t j,
@@ -142,37 +142,12 @@ private:
 
   // Trace particle path through mesh until it dies or leaves mesh
   void traceThroughMesh(
-              double point[3],
+              const double point[3],
               const double direction[3],
               const double track_length,
-              PlaneIndex hex_plane_indices[3],
+              const PlaneIndex hex_plane_indices[3],
               ElementHandleTrackLengthArray& hex_element_track_lengths ) const;
 
-  // Find the interaction planes that a particle will interact with
-  void findInteractionPlanes( const double point[3],
-                              const double direction[3],
-                              const PlaneIndex hex_plane_indices[3],
-                              std::vector<std::pair<Dimension,PlaneIndex> >&
-                              interaction_planes ) const;
-
-  // Find the intersection distance along the path of the particle with the next hex
-  void findIntersectionDistance(
-                    const double point[3],
-                    const double direction[3],
-                    const std::vector<std::pair<Dimension,PlaneIndex> >&
-                    interaction_planes,
-                    std::pair<Dimension,double>& intersection_distance ) const;
-
-  // Calculate distance to a plane from a ray along its direction
-  double findDistanceToInteractionPlane(
-                                      const double interaction_plane_location,
-                                      const double position_component,
-                                      const double direction_component ) const;
-
-  // Form the incrementer so that the particle increments over the planes in the correct direction
-  void setIncrementer( size_t incrementer[3],
-                       const double direction[3] ) const;
-
   // set the plane indices that make up the hex element index
   void setHexPlaneIndices( const double current_point[3],
                            PlaneIndex hex_plane_indices[3] )const;
@@ -182,6 +157,9 @@ private:
                            const double current_point[3],
                            PlaneIndex hex_plane_indices[3] )const;
 
+  // Cache the inverse plane spacing of each dimension with uniform planes
+  void initializeUniformPlaneSpacing();
+
   // Set individual hex plane indicies for particle.
   PlaneIndex setHexPlaneIndex( const double position_component,
                                const std::vector<double>& plane_set,
@@ -189,16 +167,17 @@ private:
 
   // Returns a set of distances to up to 3 planes that bound the mesh which the particle may interact with
   void findBoundingInteractionPlaneDistances(
-                                    const double point[3],
-                                    const double direction[3],
-                                    std::vector<std::pair<Dimension, double> >&
-                                    bounding_intersection_data  ) const;
+                        const double point[3],
+                        const double direction[3],
+                        std::pair<Dimension,double> bounding_intersection_data[3],
+                        size_t& number_of_bounding_planes ) const;
 
   // Checks an individual set of planes for interaction plane in that dimension
   void checkPlaneSet( const std::vector<double>& plane_set,
                       const double position_component,
                       const double direction_component,
-                      std::vector<std::pair<Dimension, double> >& boundary_planes,
+                      std::pair<Dimension,double> boundary_planes[3],
+                      size_t& number_of_boundary_planes,
                       const Dimension plane_dimension ) const;
 
   // Returns whether or not a particle actually hit the mesh surface
@@ -209,16 +188,6 @@ private:
   bool checkWithinBoundingPlane( const double position_component,
                                  const std::vector<double>& plane_set )const;
 
-  // determines if the particle has exited the mesh
-  bool didParticleLeaveMesh(
-                           const Dimension intersection_dimension,
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes ) const;
-
-  // sets the incrementer for mesh iteration
-  void setIncrementer( const double direction[3],
-                       int incrementer[3] ) const;
-
   // pushes point along direction to new intersection point
   void pushPoint( double point[3],
                   const double direction[3],
@@ -253,6 +222,9 @@ private:
 
   // The hex elements (ids)
   std::vector<ElementHandle> d_hex_elements;
+
+  // The inverse plane spacing of each dimension (0.0 if not uniform)
+  std::array<double,3> d_inverse_plane_spacing;
 };
 
 // Save the data to an archive
@@ -281,6 +253,8 @@ void StructuredHexMesh::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_y_planes );
   ar & BOOST_SERIALIZATION_NVP( d_z_planes );
   ar & BOOST_SERIALIZATION_NVP( d_hex_elements );
+
+  this->initializeUniformPlaneSpacing();
 }
 
 } // end Utility namespace
@@ -6,8 +6,13 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
 // Boost Includes
 #include <boost/serialization/array_wrapper.hpp>
+#include <boost/align/aligned_allocator.hpp>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // This must be included first
@@ -15,6 +20,7 @@
 #include "Utility_TetrahedronHelpers.hpp"
 #include "Utility_3DCartesianVectorHelpers.hpp"
 #include "Utility_MOABException.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "FRENSIE_config.hpp"
@@ -102,6 +108,9 @@ public:
                             ElementHandleTrackLengthArray&
                             tet_element_track_lengths ) const;
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) const;
+
 private:
 
 #ifdef HAVE_FRENSIE_MOAB
@@ -113,6 +122,26 @@ private:
   void createKDTree( moab::Range& all_tet_elements,
                      const bool verbose );
 
+  // Create the tet traversal data
+  void createTetTraversalData();
+
+  // Find the index of the tet that contains a point
+  size_t findTetContainingPoint( const double point[3] ) const;
+
+  // Calculate the distance along a ray to the exit face of a tet
+  double calculateTetExitDistance( const size_t tet_index,
+                                   const double ray_base_point[3],
+                                   const double ray_direction[3],
+                                   size_t& exit_face ) const;
+
+  // Find the next tet along a ray that is outside of the mesh
+  size_t findNextTetAlongRay( const double ray_base_point[3],
+                              const double ray_direction[3],
+                              const double track_length,
+                              std::vector<double>& ray_tet_intersections,
+                              bool& ray_tet_intersections_calculated,
+                              double& current_distance ) const;
+
 #endif // end HAVE_FRENSIE_MOAB
 
   // Save the data to an archive
@@ -131,6 +160,18 @@ private:
   // The tolerance used for geometric tests
   static const double s_tol;
 
+  // The relative tolerance used for distances along a track
+  static const double s_relative_distance_tol;
+
+  // The invalid tet index
+  static const size_t s_invalid_tet_index;
+
+  // The max number of consecutive zero length steps before a walk restarts
+  static const size_t s_max_zero_length_steps;
+
+  // The cache line size (bytes) assumed for the per-thread data
+  static const size_t s_cache_line_size = 64;
+
 #ifdef HAVE_FRENSIE_MOAB
 
   // The input file that stores the mesh
@@ -157,11 +198,45 @@ private:
 
   // The tet element handles
   std::vector<ElementHandle> d_tets;
+
+  // The tet traversal data
+  struct TetTraversalData
+  {
+    // The barycentric coordinate transform matrix
+    std::array<double,9> barycentric_matrix;
+
+    // The reference vertex (fourth vertex)
+    std::array<double,3> reference_vertex;
+
+    // The indices of the tets across the faces opposite of each vertex
+    std::array<size_t,4> neighbor_indices;
+  };
+
+  // The tet traversal data (indexed like d_tets)
+  std::vector<TetTraversalData> d_tet_traversal_data;
+
+  // The map of tet ids and tet indices
+  std::unordered_map<ElementHandle,size_t> d_tet_indices;
+
+  // The index of the last tet visited by a thread (each index has its own
+  // cache line so that the threads never write to a shared line)
+  struct alignas(s_cache_line_size) LastTetIndex
+  {
+    size_t value;
+  };
+
+  // The index of the last tet visited by each thread
+  mutable std::vector<LastTetIndex,boost::alignment::aligned_allocator<LastTetIndex,s_cache_line_size> >
+  d_last_tet_indices;
 #endif // end HAVE_FRENSIE_MOAB
 };
 
 // Initialize the static member data
 const double TetMeshImpl::s_tol = 1e-6;
+const double TetMeshImpl::s_relative_distance_tol = 1e-12;
+const size_t TetMeshImpl::s_invalid_tet_index =
+  std::numeric_limits<size_t>::max();
+const size_t TetMeshImpl::s_max_zero_length_steps = 20;
 
 } // end Utility namespace
 
@@ -213,7 +288,10 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
     d_kd_tree_root(),
     d_kd_tree( new moab::AdaptiveKDTree( d_moab_interface.get() ) ),
     d_tet_barycentric_data(),
-    d_tets()
+    d_tets(),
+    d_tet_traversal_data(),
+    d_tet_indices(),
+    d_last_tet_indices()
 #endif // end HAVE_FRENSIE_MOAB
 {
 #ifdef HAVE_FRENSIE_MOAB
@@ -276,6 +354,9 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
 
   // Create the kd-tree
   this->createKDTree( all_tet_elements, verbose_construction );
+
+  // Create the tet traversal data
+  this->createTetTraversalData();
 #endif // end HAVE_FRENSIE_MOAB
 }
 
@@ -397,6 +478,291 @@ void TetMeshImpl::createKDTree( moab::Range& all_tet_elements,
     FRENSIE_LOG_NOTIFICATION( "done." );
   }
 }
+
+// Create the tet traversal data
+/*! \details The barycentric data of each tet is copied into an array that is
+ * indexed like the tet handle list. The tet faces are matched by their
+ * (sorted) vertex handles to find the tet across each face. The face
+ * opposite of vertex i is associated with barycentric coordinate i.
+ */
+void TetMeshImpl::createTetTraversalData()
+{
+  d_tet_traversal_data.resize( d_tets.size() );
+  d_tet_indices.clear();
+
+  // The face vertex handles and the face code (tet index*4 + face)
+  std::vector<std::pair<std::array<moab::EntityHandle,3>,size_t> >
+    tet_faces( 4*d_tets.size() );
+
+  std::vector<moab::EntityHandle> vertex_handles;
+
+  for( size_t i = 0; i < d_tets.size(); ++i )
+  {
+    moab::EntityHandle tet_handle = d_tets[i];
+
+    d_tet_indices[d_tets[i]] = i;
+
+    const std::pair<std::array<double,9>,std::array<double,3> >&
+      tet_barycentric_data = d_tet_barycentric_data.find( d_tets[i] )->second;
+
+    TetTraversalData& tet_traversal_data = d_tet_traversal_data[i];
+
+    tet_traversal_data.barycentric_matrix = tet_barycentric_data.first;
+    tet_traversal_data.reference_vertex = tet_barycentric_data.second;
+    tet_traversal_data.neighbor_indices.fill( s_invalid_tet_index );
+
+    vertex_handles.clear();
+
+    moab::ErrorCode return_value =
+      d_moab_interface->get_connectivity( &tet_handle, 1, vertex_handles );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        Utility::MOABException,
+                        moab::ErrorCodeStr[return_value] );
+
+    TEST_FOR_EXCEPTION( vertex_handles.size() != 4,
+                        Utility::MOABException,
+                        "A tet was found with an invalid number of vertices "
+                        "(" << vertex_handles.size() << " != 4)" );
+
+    for( size_t j = 0; j < 4; ++j )
+    {
+      std::array<moab::EntityHandle,3>& face_vertex_handles =
+        tet_faces[4*i+j].first;
+
+      for( size_t k = 0, l = 0; k < 4; ++k )
+      {
+        if( k != j )
+          face_vertex_handles[l++] = vertex_handles[k];
+      }
+
+      std::sort( face_vertex_handles.begin(), face_vertex_handles.end() );
+
+      tet_faces[4*i+j].second = 4*i+j;
+    }
+  }
+
+  // Interior faces are shared by exactly two tets
+  std::sort( tet_faces.begin(), tet_faces.end() );
+
+  for( size_t i = 1; i < tet_faces.size(); ++i )
+  {
+    if( tet_faces[i].first == tet_faces[i-1].first )
+    {
+      const size_t face_code = tet_faces[i].second;
+      const size_t other_face_code = tet_faces[i-1].second;
+
+      d_tet_traversal_data[face_code/4].neighbor_indices[face_code%4] =
+        other_face_code/4;
+
+      d_tet_traversal_data[other_face_code/4].neighbor_indices[other_face_code%4] =
+        face_code/4;
+    }
+  }
+
+  // Initialize the last visited tet cache of the root thread (see
+  // enableThreadSupport)
+  d_last_tet_indices.assign( 1, LastTetIndex{s_invalid_tet_index} );
+}
+
+// Find the index of the tet that contains a point
+/*! \details If the point is not in the mesh the invalid tet index will be
+ * returned.
+ */
+size_t TetMeshImpl::findTetContainingPoint( const double point[3] ) const
+{
+  // Find the kd-tree leaf that contains the point
+  moab::AdaptiveKDTreeIter kd_tree_iterator;
+
+  moab::ErrorCode return_value = d_kd_tree->point_search( point,
+                                                          kd_tree_iterator );
+
+  if( return_value != moab::MB_SUCCESS || kd_tree_iterator.handle() == 0 )
+    return s_invalid_tet_index;
+
+  moab::EntityHandle leaf = kd_tree_iterator.handle();
+  moab::Range tets_in_leaf;
+
+  return_value = d_moab_interface->get_entities_by_dimension( leaf,
+                                                              3,
+                                                              tets_in_leaf,
+                                                              false );
+
+  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                      Utility::MOABException,
+                      moab::ErrorCodeStr[return_value] );
+
+  for( moab::Range::const_iterator tet_handle_it = tets_in_leaf.begin();
+       tet_handle_it != tets_in_leaf.end();
+       ++tet_handle_it )
+  {
+    const size_t tet_index = d_tet_indices.find( *tet_handle_it )->second;
+
+    const TetTraversalData& tet_traversal_data =
+      d_tet_traversal_data[tet_index];
+
+    if( Utility::isPointInTet( point,
+                               tet_traversal_data.reference_vertex.data(),
+                               tet_traversal_data.barycentric_matrix.data(),
+                               s_tol ) )
+    {
+      return tet_index;
+    }
+  }
+
+  return s_invalid_tet_index;
+}
+
+// Calculate the distance along a ray to the exit face of a tet
+/*! \details The barycentric coordinates of a point on the ray are linear in
+ * the distance along the ray. The ray exits the tet through the face whose
+ * barycentric coordinate reaches zero first while decreasing. Only the
+ * decreasing coordinates are checked so the face that the ray entered
+ * through is never returned. The distance is measured from the ray base
+ * point (not from the point where the ray entered the tet).
+ */
+double TetMeshImpl::calculateTetExitDistance( const size_t tet_index,
+                                              const double ray_base_point[3],
+                                              const double ray_direction[3],
+                                              size_t& exit_face ) const
+{
+  const TetTraversalData& tet_traversal_data =
+    d_tet_traversal_data[tet_index];
+
+  const double* matrix = tet_traversal_data.barycentric_matrix.data();
+
+  const double relative_point[3] =
+    {ray_base_point[0] - tet_traversal_data.reference_vertex[0],
+     ray_base_point[1] - tet_traversal_data.reference_vertex[1],
+     ray_base_point[2] - tet_traversal_data.reference_vertex[2]};
+
+  // The barycentric coordinates at the ray base point and their rates of
+  // change along the ray
+  double coordinates[4], coordinate_rates[4];
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    coordinates[i] = matrix[3*i]*relative_point[0] +
+      matrix[3*i+1]*relative_point[1] +
+      matrix[3*i+2]*relative_point[2];
+
+    coordinate_rates[i] = matrix[3*i]*ray_direction[0] +
+      matrix[3*i+1]*ray_direction[1] +
+      matrix[3*i+2]*ray_direction[2];
+  }
+
+  coordinates[3] = 1.0 - coordinates[0] - coordinates[1] - coordinates[2];
+  coordinate_rates[3] =
+    -coordinate_rates[0] - coordinate_rates[1] - coordinate_rates[2];
+
+  double exit_distance = std::numeric_limits<double>::infinity();
+  exit_face = 0;
+
+  for( size_t i = 0; i < 4; ++i )
+  {
+    if( coordinate_rates[i] < 0.0 )
+    {
+      const double face_distance = -coordinates[i]/coordinate_rates[i];
+
+      if( face_distance < exit_distance )
+      {
+        exit_distance = face_distance;
+        exit_face = i;
+      }
+    }
+  }
+
+  return exit_distance;
+}
+
+// Find the next tet along a ray that is outside of the mesh
+/*! \details The intersections of the ray with the tet faces are only
+ * calculated the first time that this method is called for a ray (they are
+ * needed when the ray starts outside of the mesh or leaves a concave mesh).
+ * The tet that contains the midpoint of the first intersection interval
+ * beyond the current distance that is in the mesh is returned and the
+ * current distance is moved to the start of that interval. If the ray does
+ * not enter the mesh again the invalid tet index is returned.
+ */
+size_t TetMeshImpl::findNextTetAlongRay(
+                                  const double ray_base_point[3],
+                                  const double ray_direction[3],
+                                  const double track_length,
+                                  std::vector<double>& ray_tet_intersections,
+                                  bool& ray_tet_intersections_calculated,
+                                  double& current_distance ) const
+{
+  if( !ray_tet_intersections_calculated )
+  {
+    std::vector<moab::EntityHandle> tet_surface_triangles;
+
+    moab::ErrorCode return_value =
+      d_kd_tree->ray_intersect_triangles( d_kd_tree_root,
+                                          s_tol,
+                                          ray_direction,
+                                          ray_base_point,
+                                          tet_surface_triangles,
+                                          ray_tet_intersections,
+                                          0,
+                                          track_length );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        Utility::MOABException,
+                        moab::ErrorCodeStr[return_value] );
+
+    // Sort all intersections of the ray with the tets
+    std::sort( ray_tet_intersections.begin(), ray_tet_intersections.end() );
+
+    ray_tet_intersections_calculated = true;
+  }
+
+  const double distance_tol = s_relative_distance_tol*track_length;
+
+  double interval_start = current_distance;
+
+  std::vector<double>::const_iterator intersection_it =
+    std::upper_bound( ray_tet_intersections.begin(),
+                      ray_tet_intersections.end(),
+                      current_distance + distance_tol );
+
+  while( true )
+  {
+    const double interval_end =
+      (intersection_it != ray_tet_intersections.end() ?
+       std::min( *intersection_it, track_length ) : track_length );
+
+    if( interval_end - interval_start > distance_tol )
+    {
+      const double interval_mid_distance = (interval_start + interval_end)/2;
+
+      const double interval_mid_point[3] =
+        {ray_direction[0]*interval_mid_distance + ray_base_point[0],
+         ray_direction[1]*interval_mid_distance + ray_base_point[1],
+         ray_direction[2]*interval_mid_distance + ray_base_point[2]};
+
+      const size_t tet_index =
+        this->findTetContainingPoint( interval_mid_point );
+
+      if( tet_index != s_invalid_tet_index )
+      {
+        current_distance = interval_start;
+
+        return tet_index;
+      }
+    }
+
+    if( intersection_it == ray_tet_intersections.end() ||
+        interval_end >= track_length )
+      break;
+
+    interval_start = interval_end;
+    ++intersection_it;
+  }
+
+  current_distance = track_length;
+
+  return s_invalid_tet_index;
+}
 #endif // end HAVE_FRENSIE_MOAB
 
 // Get the mesh type name
@@ -669,153 +1035,187 @@ void TetMesh::computeTrackLengths( const double start_point[3],
 }
 
 // Determine the mesh elements that a line segment intersects
+/*! \details The tet that contains the start point is located once (the last
+ * tet visited by the calling thread is checked before the kd-tree is
+ * searched since successive subtracks of a particle usually start where the
+ * previous one ended). The segment is then traced by walking from tet to
+ * tet through the exit faces, which are found using the tet barycentric
+ * data. The kd-tree ray-triangle intersections are only used when the
+ * segment starts outside of the mesh or leaves a concave mesh before it
+ * ends.
+ */
 void TetMeshImpl::computeTrackLengths( const double start_point[3],
                                        const double end_point[3],
                                        ElementHandleTrackLengthArray&
                                        tet_element_track_lengths ) const
 {
 #ifdef HAVE_FRENSIE_MOAB
+  // Reset the tet element track lengths
+  tet_element_track_lengths.clear();
+
   // Calculate the direction and determine the track length
   double direction[3] = {end_point[0]-start_point[0],
                          end_point[1]-start_point[1],
                          end_point[2]-start_point[2]};
 
+  if( direction[0] == 0.0 && direction[1] == 0.0 && direction[2] == 0.0 )
+    return;
+
   double track_length =
     Utility::normalizeVectorAndReturnMagnitude( direction );
 
-  // Determine the distances to intersections with mesh elements
-  std::vector<double> ray_tet_intersections;
-  std::vector<moab::EntityHandle> tet_surface_triangles;
+  const double distance_tol = s_relative_distance_tol*track_length;
 
-  moab::ErrorCode return_value =
-    d_kd_tree->ray_intersect_triangles( d_kd_tree_root,
-                                        s_tol,
-                                        direction,
-                                        start_point,
-                                        tet_surface_triangles,
-                                        ray_tet_intersections,
-                                        0,
-                                        track_length );
+  // Check the last tet visited by this thread before searching the kd-tree
+  const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
-                      Utility::MOABException,
-                      moab::ErrorCodeStr[return_value] );
+  size_t* last_tet_index = (thread_id < d_last_tet_indices.size() ?
+                            &d_last_tet_indices[thread_id].value : nullptr);
 
-  // Clear the tet surface triangles - not used
-  tet_surface_triangles.clear();
+  size_t tet_index = s_invalid_tet_index;
 
-  // Reset the tet element track lengths
-  tet_element_track_lengths.clear();
-
-  if( ray_tet_intersections.size() > 0 )
+  if( last_tet_index && *last_tet_index != s_invalid_tet_index )
   {
-    // Sort all intersections of the ray with the tets
-    std::sort( ray_tet_intersections.begin(),
-               ray_tet_intersections.end() );
+    const TetTraversalData& tet_traversal_data =
+      d_tet_traversal_data[*last_tet_index];
 
-    // Remove the first intersection if it is zero (start point on surface)
-    if( ray_tet_intersections.front() == 0.0 )
-      ray_tet_intersections.erase( ray_tet_intersections.begin() );
+    if( Utility::isPointInTet( start_point,
+                               tet_traversal_data.reference_vertex.data(),
+                               tet_traversal_data.barycentric_matrix.data(),
+                               s_tol ) )
+    {
+      tet_index = *last_tet_index;
+    }
+  }
 
-    // Calculate the tet intersection points and partial track lengths
-    std::vector<moab::CartVect> array_of_hit_points;
+  if( tet_index == s_invalid_tet_index )
+    tet_index = this->findTetContainingPoint( start_point );
 
-    // Add the origin point
-    {
-      moab::CartVect start_point_cv( start_point[0],
-                                     start_point[1],
-                                     start_point[2] );
+  // The ray-triangle intersections (only calculated if needed)
+  std::vector<double> ray_tet_intersections;
+  bool ray_tet_intersections_calculated = false;
 
-      array_of_hit_points.push_back( start_point_cv );
-    }
+  double current_distance = 0.0;
 
-    // Add all intermediate points
-    for( size_t i = 0; i < ray_tet_intersections.size(); ++i )
+  size_t number_of_zero_length_steps = 0;
+
+  double last_restart_distance = -1.0;
+
+  while( true )
+  {
+    // Find the tet where the ray (re)enters the mesh
+    if( tet_index == s_invalid_tet_index )
     {
-      moab::CartVect hit_point;
+      // A restart must always move the walk forward
+      if( current_distance <= last_restart_distance )
+      {
+        if( d_display_warnings )
+        {
+          FRENSIE_LOG_TAGGED_WARNING( "TetMesh",
+                                      "The tet walk could not move past "
+                                      "point {"
+                                      << direction[0]*current_distance + start_point[0] << ","
+                                      << direction[1]*current_distance + start_point[1] << ","
+                                      << direction[2]*current_distance + start_point[2]
+                                      << "} - the rest of the track will be "
+                                      "ignored!" );
+        }
 
-      hit_point[0] = direction[0]*ray_tet_intersections[i]
-        + start_point[0];
-      hit_point[1] = direction[1]*ray_tet_intersections[i]
-        + start_point[1];
-      hit_point[2] = direction[2]*ray_tet_intersections[i]
-        + start_point[2];
+        break;
+      }
 
-      array_of_hit_points.push_back( hit_point );
-    }
+      tet_index = this->findNextTetAlongRay( start_point,
+                                             direction,
+                                             track_length,
+                                             ray_tet_intersections,
+                                             ray_tet_intersections_calculated,
+                                             current_distance );
 
-    // Add the end point (don't add if the end point lies on the surface)
-    if( ray_tet_intersections.back() < track_length )
-    {
-      moab::CartVect end_point_cv(end_point[0], end_point[1], end_point[2]);
+      if( tet_index == s_invalid_tet_index )
+        break;
 
-      array_of_hit_points.push_back( end_point_cv );
+      last_restart_distance = current_distance;
 
-      ray_tet_intersections.push_back( track_length );
+      number_of_zero_length_steps = 0;
     }
 
-    // Determine the tet that each line segment passes through
-    for( size_t i = 0; i < ray_tet_intersections.size(); ++i )
-    {
-      moab::CartVect tet_centroid =
-        (array_of_hit_points[i+1] + array_of_hit_points[i])/2.0;
+    size_t exit_face;
 
-      // Check that the centroid falls in the mesh - if the mesh is concave
-      // it is possible that it falls outside
-      if( this->isPointInMesh( tet_centroid.array() ) )
-      {
-        ElementHandle element_handle =
-          this->whichElementIsPointIn( tet_centroid.array() );
+    double exit_distance = this->calculateTetExitDistance( tet_index,
+                                                           start_point,
+                                                           direction,
+                                                           exit_face );
 
-        // Make sure that a tet was found (tolerance issue may prevent this)
-        if( element_handle == 0 )
-          continue;
+    const bool track_length_exhausted =
+      exit_distance >= track_length - distance_tol;
 
-        double tet_track_length;
+    if( track_length_exhausted )
+      exit_distance = track_length;
 
-        if( i != 0 )
-        {
-          tet_track_length = ray_tet_intersections[i] -
-            ray_tet_intersections[i-1];
-        }
-        else
-          tet_track_length = ray_tet_intersections[i];
-
-        tet_element_track_lengths.push_back( std::make_tuple(
-                           element_handle,
-                           std::array<double,3>( {array_of_hit_points[i][0],
-                                                  array_of_hit_points[i][1],
-                                                  array_of_hit_points[i][2]} ),
-                           tet_track_length ) );
-      }
-    }
-  }
+    const double tet_track_length = exit_distance - current_distance;
 
-  // Handle the cases where there are no intersections
-  else
-  {
-    double mid_point[3] = {(end_point[0]+start_point[0])/2,
-                           (end_point[1]+start_point[1])/2,
-                           (end_point[2]+start_point[2])/2};
+    if( tet_track_length > distance_tol )
+    {
+      tet_element_track_lengths.push_back( std::make_tuple(
+           d_tets[tet_index],
+           std::array<double,3>( {direction[0]*current_distance + start_point[0],
+                                  direction[1]*current_distance + start_point[1],
+                                  direction[2]*current_distance + start_point[2]} ),
+           tet_track_length ) );
+
+      current_distance = exit_distance;
 
-    // case 1: line segment is entirely in one tet
-    if( this->isPointInMesh( mid_point ) )
+      number_of_zero_length_steps = 0;
+    }
+    else
+      ++number_of_zero_length_steps;
+
+    if( track_length_exhausted )
     {
-      ElementHandle element_handle = this->whichElementIsPointIn( mid_point );
+      // Cache the tet that contains the end point
+      if( last_tet_index )
+        *last_tet_index = tet_index;
 
-      if( element_handle != 0 )
-      {
-        tet_element_track_lengths.push_back( std::make_tuple(
-                                      element_handle,
-                                      std::array<double,3>( {start_point[0],
-                                                             start_point[1],
-                                                             start_point[2]} ),
-                                      track_length ) );
-      }
+      return;
     }
 
-    // case 2: track entirely misses mesh - do nothing
+    // Step into the tet across the exit face - if the walk gets stuck
+    // (e.g. the ray runs along an edge), restart it with the ray-triangle
+    // intersections
+    if( number_of_zero_length_steps < s_max_zero_length_steps )
+    {
+      tet_index =
+        d_tet_traversal_data[tet_index].neighbor_indices[exit_face];
+    }
+    else
+      tet_index = s_invalid_tet_index;
   }
+
+  // The end point is outside of the mesh
+  if( last_tet_index )
+    *last_tet_index = s_invalid_tet_index;
+#endif // end HAVE_FRENSIE_MOAB
+}
+
+// Enable support for multiple threads
+void TetMesh::enableThreadSupport( const unsigned num_threads ) const
+{
+  d_impl->enableThreadSupport( num_threads );
+}
+
+// Enable support for multiple threads
+/*! \details Every thread id less than the number of threads gets its own
+ * last visited tet cache. Threads with a larger id will always search the
+ * kd-tree for the start tet.
+ */
+void TetMeshImpl::enableThreadSupport( const unsigned num_threads ) const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+#ifdef HAVE_FRENSIE_MOAB
+  d_last_tet_indices.assign( std::max( num_threads, 1u ),
+                             LastTetIndex{s_invalid_tet_index} );
 #endif // end HAVE_FRENSIE_MOAB
 }
 
@@ -901,6 +1301,9 @@ void TetMeshImpl::load( Archive& ar, const unsigned version )
                         "The tet mesh cannot be loaded from the archive "
                         "because the moab::EntityHandles have changed!" );
   }
+
+  // Reconstruct the tet traversal data
+  this->createTetTraversalData();
 #endif // end HAVE_FRENSIE_MOAB
 }
 
@@ -90,6 +90,9 @@ public:
                             ElementHandleTrackLengthArray&
                             tet_element_track_lengths ) const final override;
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) const final override;
+
   //! Export the mesh to a vtk file (type determined by suffix - e.g. mesh.vtk)
   virtual void exportData( const std::string& output_file_name,
                            const TagNameSet& tag_root_names,
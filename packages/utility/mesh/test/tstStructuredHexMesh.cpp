@@ -11,6 +11,7 @@
 #include <iomanip>
 #include <memory>
 #include <utility>
+#include <random>
 
 // FRENSIE Includes
 #include "Utility_StructuredHexMesh.hpp"
@@ -227,6 +228,43 @@ FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIsPointIn )
   FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn(point11), 7);
 }
 
+//---------------------------------------------------------------------------//
+// test that the whichElementIsPointIn method works with uniform and
+// non-uniform planes
+FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIsPointIn_plane_spacing )
+{
+  // Uniform planes with spacings that can't be represented exactly
+  std::vector<double> x_planes( 11 ), y_planes( {-1.0, -0.3, 0.2, 1.0} ),
+    z_planes( {0.0, 1.0} );
+
+  for( size_t i = 0; i < x_planes.size(); ++i )
+    x_planes[i] = -0.1 + i*0.1;
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  // Points on the planes are in the element above the plane
+  for( size_t i = 0; i < x_planes.size()-1; ++i )
+  {
+    double point[3] {x_planes[i], -0.3, 0.5};
+
+    FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn(point), i + 10 );
+
+    point[0] = 0.5*(x_planes[i] + x_planes[i+1]);
+    point[1] = -0.31;
+
+    FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn(point), i );
+
+    point[1] = 0.2;
+
+    FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn(point), i + 20 );
+  }
+
+  double point[3] {x_planes.back(), y_planes.back(), z_planes.back()};
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn(point), 29 );
+}
+
 //---------------------------------------------------------------------------//
 // test simple cases of rays not interacting with mesh and computeTrackLengths
 // returning empty arrays
@@ -1089,6 +1127,105 @@ FRENSIE_UNIT_TEST( StructuredHexMesh,
                                    1e-10);
 }
 
+//---------------------------------------------------------------------------//
+// Check that the track lengths of random segments are consistent with the
+// mesh for uniform and non-uniform plane spacing
+FRENSIE_UNIT_TEST( StructuredHexMesh, computeTrackLengths_random_segments )
+{
+  std::vector<double> uniform_planes( 11 );
+
+  for( size_t i = 0; i < uniform_planes.size(); ++i )
+    uniform_planes[i] = i*0.1;
+
+  std::vector<double> nonuniform_planes( {0.0, 0.05, 0.2, 0.25, 0.5, 0.55,
+                                          0.7, 0.9, 0.95, 1.0} );
+
+  std::vector<std::shared_ptr<Utility::StructuredHexMesh> > hex_meshes;
+
+  hex_meshes.emplace_back( new Utility::StructuredHexMesh( uniform_planes,
+                                                           uniform_planes,
+                                                           uniform_planes ) );
+  hex_meshes.emplace_back( new Utility::StructuredHexMesh( nonuniform_planes,
+                                                           nonuniform_planes,
+                                                           nonuniform_planes ) );
+  hex_meshes.emplace_back( new Utility::StructuredHexMesh( uniform_planes,
+                                                           nonuniform_planes,
+                                                           uniform_planes ) );
+
+  Utility::StructuredHexMesh::ElementHandleTrackLengthArray contribution;
+
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution<double> coordinate_distribution( -0.5, 1.5 );
+
+  for( size_t m = 0; m < hex_meshes.size(); ++m )
+  {
+    for( size_t n = 0; n < 1000; ++n )
+    {
+      double start_point[3], end_point[3], direction[3];
+
+      for( size_t d = 0; d < 3; ++d )
+      {
+        start_point[d] = coordinate_distribution( generator );
+        end_point[d] = coordinate_distribution( generator );
+
+        direction[d] = end_point[d] - start_point[d];
+      }
+
+      const double ray_length =
+        Utility::normalizeVectorAndReturnMagnitude( direction );
+
+      // Clip the segment with the mesh bounding box
+      double min_distance = 0.0, max_distance = ray_length;
+
+      for( size_t d = 0; d < 3; ++d )
+      {
+        const double lower_distance = (0.0 - start_point[d])/direction[d];
+        const double upper_distance = (1.0 - start_point[d])/direction[d];
+
+        min_distance = std::max( min_distance,
+                                 std::min( lower_distance, upper_distance ) );
+        max_distance = std::min( max_distance,
+                                 std::max( lower_distance, upper_distance ) );
+      }
+
+      const double clipped_length = std::max( max_distance - min_distance, 0.0 );
+
+      hex_meshes[m]->computeTrackLengths( start_point, end_point, contribution );
+
+      double sum_of_segments = 0.0;
+
+      for( size_t i = 0; i < contribution.size(); ++i )
+      {
+        sum_of_segments += Utility::get<2>( contribution[i] );
+
+        // Check that the midpoint of the segment is in the element
+        if( Utility::get<2>( contribution[i] ) > 1e-9 )
+        {
+          double midpoint[3];
+
+          for( size_t d = 0; d < 3; ++d )
+          {
+            midpoint[d] = Utility::get<1>( contribution[i] )[d] +
+              0.5*Utility::get<2>( contribution[i] )*direction[d];
+          }
+
+          FRENSIE_CHECK_EQUAL( hex_meshes[m]->whichElementIsPointIn( midpoint ),
+                               Utility::get<0>( contribution[i] ) );
+        }
+      }
+
+      if( clipped_length > 1e-9 )
+      {
+        FRENSIE_CHECK_FLOATING_EQUALITY( sum_of_segments, clipped_length, 1e-9 );
+      }
+      else
+      {
+        FRENSIE_CHECK_SMALL( sum_of_segments, 1e-9 );
+      }
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the mesh data can be exported
 FRENSIE_UNIT_TEST( StructuredHexMesh, exportData )
@@ -9,9 +9,11 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <cmath>
 
 // FRENSIE Includes
 #include "Utility_TetMesh.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "FRENSIE_config.hpp"
 #include "ArchiveTestHelpers.hpp"
@@ -449,6 +451,155 @@ FRENSIE_UNIT_TEST( TetMesh, computeTrackLengths )
                                    1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the tracks through multiple tets can be calculated
+FRENSIE_UNIT_TEST( TetMesh, computeTrackLengths_multiple_tets )
+{
+  std::unique_ptr<Utility::Mesh> mesh( new Utility::TetMesh( tet_mesh_file_name ) );
+
+  // Start and end point outside of mesh
+  // start intersection { 0.0, 0.375, 0.375 }
+  // end intersection { 1.0, 0.525, 0.725 }
+  double start_point[3] = {-0.5, 0.3, 0.2};
+  double end_point[3] = {1.5, 0.6, 0.9};
+
+  Utility::TetMesh::ElementHandleTrackLengthArray contribution;
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE( contribution.size() > 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution.front()),
+                                   (std::array<double,3>( {0.0, 0.375, 0.375} )),
+                                   1e-12 );
+
+  const double direction[3] = {2.0/std::sqrt(4.58),
+                               0.3/std::sqrt(4.58),
+                               0.7/std::sqrt(4.58)};
+
+  double total_track_length = 0.0;
+
+  for( size_t i = 0; i < contribution.size(); ++i )
+  {
+    total_track_length += Utility::get<2>(contribution[i]);
+
+    // Check that the tet track segments are contiguous
+    if( i > 0 )
+    {
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+           Utility::get<1>(contribution[i]),
+           (std::array<double,3>( {Utility::get<1>(contribution[i-1])[0] +
+                                   direction[0]*Utility::get<2>(contribution[i-1]),
+                                   Utility::get<1>(contribution[i-1])[1] +
+                                   direction[1]*Utility::get<2>(contribution[i-1]),
+                                   Utility::get<1>(contribution[i-1])[2] +
+                                   direction[2]*Utility::get<2>(contribution[i-1])} )),
+           1e-12 );
+    }
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( total_track_length,
+                                   0.5*std::sqrt(4.58),
+                                   1e-12 );
+
+  // Split the track at a point inside of the mesh - the tets visited by the
+  // two subtracks must be the tets visited by the whole track
+  double mid_point[3] = {0.5, 0.45, 0.55};
+
+  Utility::TetMesh::ElementHandleTrackLengthArray first_contribution,
+    second_contribution;
+
+  mesh->computeTrackLengths( start_point, mid_point, first_contribution );
+  mesh->computeTrackLengths( mid_point, end_point, second_contribution );
+
+  FRENSIE_REQUIRE( first_contribution.size() > 0 );
+  FRENSIE_REQUIRE( second_contribution.size() > 0 );
+
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(first_contribution.front()),
+                       Utility::get<0>(contribution.front()) );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(second_contribution.back()),
+                       Utility::get<0>(contribution.back()) );
+
+  double split_track_length = 0.0;
+
+  for( size_t i = 0; i < first_contribution.size(); ++i )
+    split_track_length += Utility::get<2>(first_contribution[i]);
+
+  for( size_t i = 0; i < second_contribution.size(); ++i )
+    split_track_length += Utility::get<2>(second_contribution[i]);
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( split_track_length,
+                                   total_track_length,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths are the same on every thread once thread
+// support has been enabled
+FRENSIE_UNIT_TEST( TetMesh, computeTrackLengths_thread_support )
+{
+  std::unique_ptr<Utility::Mesh> mesh( new Utility::TetMesh( tet_mesh_file_name ) );
+
+  const unsigned num_threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  mesh->enableThreadSupport( num_threads );
+
+  double start_point[3] = {-0.5, 0.3, 0.2};
+  double mid_point[3] = {0.5, 0.45, 0.55};
+  double end_point[3] = {1.5, 0.6, 0.9};
+
+  Utility::TetMesh::ElementHandleTrackLengthArray expected_first_contribution,
+    expected_second_contribution;
+
+  mesh->computeTrackLengths( start_point, mid_point, expected_first_contribution );
+  mesh->computeTrackLengths( mid_point, end_point, expected_second_contribution );
+
+  std::vector<Utility::TetMesh::ElementHandleTrackLengthArray>
+    first_contributions( num_threads ), second_contributions( num_threads );
+
+  // The second subtrack of each thread starts in the last tet visited by the
+  // thread
+  #pragma omp parallel num_threads( num_threads )
+  {
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+    mesh->computeTrackLengths( start_point,
+                               mid_point,
+                               first_contributions[thread_id] );
+    mesh->computeTrackLengths( mid_point,
+                               end_point,
+                               second_contributions[thread_id] );
+  }
+
+  for( unsigned i = 0; i < num_threads; ++i )
+  {
+    FRENSIE_REQUIRE_EQUAL( first_contributions[i].size(),
+                           expected_first_contribution.size() );
+    FRENSIE_REQUIRE_EQUAL( second_contributions[i].size(),
+                           expected_second_contribution.size() );
+
+    for( size_t j = 0; j < expected_first_contribution.size(); ++j )
+    {
+      FRENSIE_CHECK_EQUAL( Utility::get<0>(first_contributions[i][j]),
+                           Utility::get<0>(expected_first_contribution[j]) );
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+                               Utility::get<2>(first_contributions[i][j]),
+                               Utility::get<2>(expected_first_contribution[j]),
+                               1e-12 );
+    }
+
+    for( size_t j = 0; j < expected_second_contribution.size(); ++j )
+    {
+      FRENSIE_CHECK_EQUAL( Utility::get<0>(second_contributions[i][j]),
+                           Utility::get<0>(expected_second_contribution[j]) );
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+                              Utility::get<2>(second_contributions[i][j]),
+                              Utility::get<2>(expected_second_contribution[j]),
+                              1e-12 );
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the tet mesh data can be exported
 FRENSIE_UNIT_TEST( TetMesh, exportData )
@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_CounterBasedGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Definition of a counter-based (stateless) pseudo-random number
+//!         generator that can be used to create reproducible parallel random
+//!         number streams.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_CounterBasedGenerator.hpp"
+
+namespace Utility{
+
+// Constructor
+CounterBasedGenerator::CounterBasedGenerator()
+  : d_history( 0ULL ),
+    d_secondary_index( 0ULL ),
+    d_block_counter( 0ULL ),
+    d_block(),
+    d_block_word( 2u ),
+    d_state( 0ULL )
+{ /* ... */ }
+
+// Return a random number for the current history
+double CounterBasedGenerator::getRandomNumber()
+{
+  // Each block holds two 64-bit random numbers
+  if( d_block_word == 2u )
+    this->generateNextBlock();
+
+  d_state = (static_cast<unsigned long long>( d_block[2*d_block_word+1] ) << 32) |
+    d_block[2*d_block_word];
+
+  ++d_block_word;
+
+  // Return the uniform random number using the upper 53 bits of the state
+  // ((state >> 11)*2^-53)
+  return (d_state >> 11)*1.1102230246251565e-16;
+}
+
+// Return the state of the random number
+unsigned long long CounterBasedGenerator::getGeneratorState() const
+{
+  return d_state;
+}
+
+// Initialize the generator for the desired history
+void CounterBasedGenerator::changeHistory(
+                                      const unsigned long long history_number )
+{
+  this->changeHistory( history_number, 0ULL );
+}
+
+// Initialize the generator for the desired history and secondary stream
+void CounterBasedGenerator::changeHistory(
+                                     const unsigned long long history_number,
+                                     const unsigned long long secondary_index )
+{
+  d_history = history_number;
+  d_secondary_index = secondary_index;
+  d_block_counter = 0ULL;
+  d_block_word = 2u;
+}
+
+// Initialize the generator for the next history
+void CounterBasedGenerator::nextHistory()
+{
+  this->changeHistory( d_history+1ULL, 0ULL );
+}
+
+// Return the current history number
+unsigned long long CounterBasedGenerator::getHistory() const
+{
+  return d_history;
+}
+
+// Return the current secondary stream index
+unsigned long long CounterBasedGenerator::getSecondaryIndex() const
+{
+  return d_secondary_index;
+}
+
+// Generate the next block of the current stream
+void CounterBasedGenerator::generateNextBlock()
+{
+  const uint32_t counter[4] =
+    {static_cast<uint32_t>( d_block_counter ),
+     static_cast<uint32_t>( d_block_counter >> 32 ),
+     static_cast<uint32_t>( d_secondary_index ),
+     static_cast<uint32_t>( d_secondary_index >> 32 )};
+
+  const uint32_t key[2] = {static_cast<uint32_t>( d_history ),
+                           static_cast<uint32_t>( d_history >> 32 )};
+
+  CounterBasedGenerator::generateBlock( counter, key, d_block );
+
+  ++d_block_counter;
+  d_block_word = 0u;
+}
+
+// Generate a Philox-4x32-10 block
+void CounterBasedGenerator::generateBlock( const uint32_t counter[4],
+                                           const uint32_t key[2],
+                                           uint32_t block[4] )
+{
+  uint32_t x[4] = {counter[0], counter[1], counter[2], counter[3]};
+  uint32_t k[2] = {key[0], key[1]};
+
+  for( unsigned round = 0u; round < 10u; ++round )
+  {
+    // Bump the key (Weyl sequence) between rounds
+    if( round > 0u )
+    {
+      k[0] += 0x9E3779B9u;
+      k[1] += 0xBB67AE85u;
+    }
+
+    const uint64_t product_0 = static_cast<uint64_t>( 0xD2511F53u )*x[0];
+    const uint64_t product_1 = static_cast<uint64_t>( 0xCD9E8D57u )*x[2];
+
+    const uint32_t x_0 =
+      static_cast<uint32_t>( product_1 >> 32 ) ^ x[1] ^ k[0];
+    const uint32_t x_2 =
+      static_cast<uint32_t>( product_0 >> 32 ) ^ x[3] ^ k[1];
+
+    x[0] = x_0;
+    x[1] = static_cast<uint32_t>( product_1 );
+    x[2] = x_2;
+    x[3] = static_cast<uint32_t>( product_0 );
+  }
+
+  block[0] = x[0];
+  block[1] = x[1];
+  block[2] = x[2];
+  block[3] = x[3];
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_CounterBasedGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_CounterBasedGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Declaration of a counter-based (stateless) pseudo-random number
+//!         generator that can be used to create reproducible parallel random
+//!         number streams.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_COUNTER_BASED_GENERATOR_HPP
+#define UTILITY_COUNTER_BASED_GENERATOR_HPP
+
+// Std Lib Includes
+#include <cstdint>
+
+// FRENSIE Includes
+#include "Utility_ParallelRandomNumberGenerator.hpp"
+
+namespace Utility{
+
+//! A counter-based pseudo-random number generator (Philox-4x32-10)
+/*! \details Each random number is a pure function of the history number
+ * (the key), a secondary stream index and the draw counter. Changing
+ * histories is therefore O(1) regardless of the distance between the
+ * current and the new history. Each Philox block provides two 64-bit
+ * random numbers. See Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3", SC11 (2011).
+ */
+class CounterBasedGenerator : public ParallelRandomNumberGenerator
+{
+
+public:
+
+  //! Constructor
+  CounterBasedGenerator();
+
+  //! Destructor
+  ~CounterBasedGenerator()
+  { /* ... */ }
+
+  //! Return a random number for the current history
+  double getRandomNumber() override;
+
+  //! Return the state of the random number
+  unsigned long long getGeneratorState() const override;
+
+  //! Initialize the generator for the desired history
+  void changeHistory( const unsigned long long history_number ) override;
+
+  //! Initialize the generator for the desired history and secondary stream
+  void changeHistory( const unsigned long long history_number,
+                      const unsigned long long secondary_index );
+
+  //! Initialize the generator for the next history
+  void nextHistory() override;
+
+  //! Return the current history number
+  unsigned long long getHistory() const;
+
+  //! Return the current secondary stream index
+  unsigned long long getSecondaryIndex() const;
+
+  //! Generate a Philox-4x32-10 block
+  static void generateBlock( const uint32_t counter[4],
+                             const uint32_t key[2],
+                             uint32_t block[4] );
+
+private:
+
+  // Generate the next block of the current stream
+  void generateNextBlock();
+
+  // The history number (key)
+  unsigned long long d_history;
+
+  // The secondary stream index (upper half of the counter)
+  unsigned long long d_secondary_index;
+
+  // The block counter (lower half of the counter)
+  unsigned long long d_block_counter;
+
+  // The current block
+  uint32_t d_block[4];
+
+  // The next 64-bit word of the current block that will be used
+  unsigned d_block_word;
+
+  // The last 64-bit random number generated
+  unsigned long long d_state;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_COUNTER_BASED_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_CounterBasedGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -48,11 +48,8 @@ void LinearCongruentialGenerator::changeHistory(
     // Calculate the new history seed from the current history seed
     else if( history_diff > 1LL )
     {
-      d_initial_history_seed =
-	d_initial_history_seed*
-	Exponentiation::recursive(
-			    LinearCongruentialGenerator::multiplier,
-		            history_diff*LinearCongruentialGenerator::stride );
+      d_initial_history_seed *=
+        LinearCongruentialGenerator::getHistoryJumpMultiplier( history_diff );
 
       d_state = d_initial_history_seed;
 
@@ -63,9 +60,7 @@ void LinearCongruentialGenerator::changeHistory(
     {
       d_initial_history_seed =
 	LinearCongruentialGenerator::initial_seed*
-	Exponentiation::recursive(
-			  LinearCongruentialGenerator::multiplier,
-			  history_number*LinearCongruentialGenerator::stride );
+        LinearCongruentialGenerator::getHistoryJumpMultiplier( history_number );
 
       d_state = d_initial_history_seed;
 
@@ -81,16 +76,61 @@ void LinearCongruentialGenerator::changeHistory(
 // Initialize the generator for the next history
 void LinearCongruentialGenerator::nextHistory()
 {
-  d_initial_history_seed =
-    d_initial_history_seed*
-    Exponentiation::recursive( LinearCongruentialGenerator::multiplier,
-			       LinearCongruentialGenerator::stride );
+  d_initial_history_seed *=
+    LinearCongruentialGenerator::getHistoryJumpMultiplierTable()[0];
 
   d_state = d_initial_history_seed;
 
   ++d_history;
 }
 
+// Return the multiplier that jumps a history seed ahead n histories
+/*! \details The multiplier is g^(L*n) mod 2^64, which is assembled from the
+ * binary representation of n using the history jump multiplier table.
+ */
+unsigned long long LinearCongruentialGenerator::getHistoryJumpMultiplier(
+                                                  const unsigned long long n )
+{
+  const HistoryJumpMultiplierTable& table =
+    LinearCongruentialGenerator::getHistoryJumpMultiplierTable();
+
+  unsigned long long jump_multiplier = 1ULL;
+  unsigned long long remaining_histories = n;
+
+  for( size_t k = 0; remaining_histories > 0ULL; ++k )
+  {
+    if( remaining_histories & 1ULL )
+      jump_multiplier *= table[k];
+
+    remaining_histories >>= 1;
+  }
+
+  return jump_multiplier;
+}
+
+// Create the history jump multiplier table
+auto LinearCongruentialGenerator::createHistoryJumpMultiplierTable() -> HistoryJumpMultiplierTable
+{
+  HistoryJumpMultiplierTable table;
+
+  table[0] = Exponentiation::recursive( LinearCongruentialGenerator::multiplier,
+                                        LinearCongruentialGenerator::stride );
+
+  for( size_t k = 1; k < table.size(); ++k )
+    table[k] = table[k-1]*table[k-1];
+
+  return table;
+}
+
+// Get the history jump multiplier table
+auto LinearCongruentialGenerator::getHistoryJumpMultiplierTable() -> const HistoryJumpMultiplierTable&
+{
+  static const HistoryJumpMultiplierTable table =
+    LinearCongruentialGenerator::createHistoryJumpMultiplierTable();
+
+  return table;
+}
+
 // Return a random number for the current history
 double LinearCongruentialGenerator::getRandomNumber()
 {
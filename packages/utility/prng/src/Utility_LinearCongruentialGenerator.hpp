@@ -10,13 +10,22 @@
 #ifndef UTILITY_LINEAR_CONGRUENTIAL_GENERATOR_HPP
 #define UTILITY_LINEAR_CONGRUENTIAL_GENERATOR_HPP
 
+// Std Lib Includes
+#include <array>
+
+// FRENSIE Includes
+#include "Utility_ParallelRandomNumberGenerator.hpp"
+
 namespace Utility{
 
 //! A linear congruential pseudo-random number generator (LCG)
 /*! \details A modulus of 2^64 is used so that modular arithmetic is done
- * implicitly (using integer overflow).
+ * implicitly (using integer overflow). The initial seed of a history is
+ * found from a precomputed table of history jump multipliers
+ * (g^(L*2^k) mod 2^64) so that any history can be reached with at most 64
+ * multiplications.
  */
-class LinearCongruentialGenerator
+class LinearCongruentialGenerator : public ParallelRandomNumberGenerator
 {
 
 public:
@@ -29,16 +38,20 @@ public:
   { /* ... */}
 
   //! Return a random number for the current history
-  virtual double getRandomNumber();
+  double getRandomNumber() override;
 
   //! Return the state of the random number
-  virtual unsigned long long getGeneratorState() const;
+  unsigned long long getGeneratorState() const override;
 
   //! Initialize the generator for the desired history
-  void changeHistory( const unsigned long long history_number );
+  void changeHistory( const unsigned long long history_number ) override;
 
   //! Initialize the generator for the next history
-  void nextHistory();
+  void nextHistory() override;
+
+  //! Return the multiplier that jumps a history seed ahead n histories
+  static unsigned long long getHistoryJumpMultiplier(
+                                                const unsigned long long n );
 
 protected:
 
@@ -47,6 +60,15 @@ protected:
 
 private:
 
+  // The history jump multiplier table (g^(L*2^k) mod 2^64, k = 0,...,63)
+  typedef std::array<unsigned long long,64> HistoryJumpMultiplierTable;
+
+  // Create the history jump multiplier table
+  static HistoryJumpMultiplierTable createHistoryJumpMultiplierTable();
+
+  // Get the history jump multiplier table
+  static const HistoryJumpMultiplierTable& getHistoryJumpMultiplierTable();
+
   // Initial seed of generator
   static const unsigned long long initial_seed = 19073486328125ULL;
 
@@ -0,0 +1,46 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ParallelRandomNumberGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Definition of the parallel (history stream) pseudo-random number
+//!         generator interface.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <new>
+
+// Boost Includes
+#include <boost/align/aligned_alloc.hpp>
+
+// FRENSIE Includes
+#include "Utility_ParallelRandomNumberGenerator.hpp"
+
+namespace Utility{
+
+// Allocate a generator on a cache line boundary
+/*! \details C++14 operator new does not respect over-aligned types so the
+ * cache line alignment of the generators must be enforced here.
+ */
+void* ParallelRandomNumberGenerator::operator new( std::size_t size )
+{
+  void* generator =
+    boost::alignment::aligned_alloc( UTILITY_PRNG_CACHE_LINE_SIZE, size );
+
+  if( !generator )
+    throw std::bad_alloc();
+
+  return generator;
+}
+
+// Deallocate a generator
+void ParallelRandomNumberGenerator::operator delete( void* generator )
+{
+  boost::alignment::aligned_free( generator );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_ParallelRandomNumberGenerator.cpp
+//---------------------------------------------------------------------------//
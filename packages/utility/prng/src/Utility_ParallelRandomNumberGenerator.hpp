@@ -0,0 +1,66 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ParallelRandomNumberGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Declaration of the parallel (history stream) pseudo-random number
+//!         generator interface.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PARALLEL_RANDOM_NUMBER_GENERATOR_HPP
+#define UTILITY_PARALLEL_RANDOM_NUMBER_GENERATOR_HPP
+
+// Std Lib Includes
+#include <cstddef>
+
+//! The cache line size (bytes) assumed for per-thread generator state
+#define UTILITY_PRNG_CACHE_LINE_SIZE 64
+
+namespace Utility{
+
+//! The parallel pseudo-random number generator interface
+/*! \details Each history has its own reproducible random number stream,
+ * which is independent of the thread that simulates the history. The
+ * generators are over-aligned (and allocated) on cache line boundaries so
+ * that the state of the generator owned by one thread never shares a cache
+ * line with the state owned by another thread.
+ */
+class alignas(UTILITY_PRNG_CACHE_LINE_SIZE) ParallelRandomNumberGenerator
+{
+
+public:
+
+  //! Constructor
+  ParallelRandomNumberGenerator()
+  { /* ... */ }
+
+  //! Destructor
+  virtual ~ParallelRandomNumberGenerator()
+  { /* ... */ }
+
+  //! Return a random number for the current history
+  virtual double getRandomNumber() = 0;
+
+  //! Return the state of the random number
+  virtual unsigned long long getGeneratorState() const = 0;
+
+  //! Initialize the generator for the desired history
+  virtual void changeHistory( const unsigned long long history_number ) = 0;
+
+  //! Initialize the generator for the next history
+  virtual void nextHistory() = 0;
+
+  //! Allocate a generator on a cache line boundary
+  static void* operator new( std::size_t size );
+
+  //! Deallocate a generator
+  static void operator delete( void* generator );
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_PARALLEL_RANDOM_NUMBER_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_ParallelRandomNumberGenerator.hpp
+//---------------------------------------------------------------------------//
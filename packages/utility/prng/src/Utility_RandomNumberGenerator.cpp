@@ -9,18 +9,52 @@
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_FakeGenerator.hpp"
+#include "Utility_CounterBasedGenerator.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Utility{
 
+// Initialize the generator type
+RandomNumberGeneratorType RandomNumberGenerator::generator_type =
+  LINEAR_CONGRUENTIAL_GENERATOR;
+
 // Initialize the stored generator pointer
-boost::ptr_vector<LinearCongruentialGenerator>
+std::vector<std::unique_ptr<ParallelRandomNumberGenerator> >
 RandomNumberGenerator::generator( 1 );
 
 // Constructor
 RandomNumberGenerator::RandomNumberGenerator()
 { /* ... */ }
 
+// Set the generator type used by the streams (LCG by default)
+/*! \details The type will only be used by streams that are created after
+ * this call (see createStreams).
+ */
+void RandomNumberGenerator::setGeneratorType(
+                                        const RandomNumberGeneratorType type )
+{
+  generator_type = type;
+}
+
+// Get the generator type used by the streams
+RandomNumberGeneratorType RandomNumberGenerator::getGeneratorType()
+{
+  return generator_type;
+}
+
+// Create a generator of the requested type
+ParallelRandomNumberGenerator* RandomNumberGenerator::createGenerator()
+{
+  switch( generator_type )
+  {
+    case COUNTER_BASED_GENERATOR:
+      return new CounterBasedGenerator;
+    case LINEAR_CONGRUENTIAL_GENERATOR:
+    default:
+      return new LinearCongruentialGenerator;
+  }
+}
+
 //! Check if the streams have been created
 bool RandomNumberGenerator::hasStreams()
 {
@@ -31,7 +65,7 @@ bool RandomNumberGenerator::hasStreams()
   // Check that each stream has been initialized
   for( unsigned i = 0u; i < generator.size(); ++i )
   {
-    if( generator.is_null(i) )
+    if( !generator[i] )
       return false;
   }
 
@@ -44,21 +78,37 @@ bool RandomNumberGenerator::hasStreams()
  */
 void RandomNumberGenerator::createStreams()
 {
+  RandomNumberGenerator::createStreams(
+                         OpenMPProperties::getRequestedNumberOfThreads() );
+}
+
+// Create the requested number of random number streams
+/*! \details One stream is required for every thread id that will request
+ * random numbers (see OpenMPProperties::setVirtualThreadId). The number of
+ * streams must be at least the number of threads requested at run time.
+ */
+void RandomNumberGenerator::createStreams( const unsigned number_of_streams )
+{
+  // Make sure that there is a stream for every thread
+  testPrecondition( number_of_streams >=
+                    OpenMPProperties::getRequestedNumberOfThreads() );
+
+  generator.resize( number_of_streams );
+
 #pragma omp parallel num_threads(OpenMPProperties::getRequestedNumberOfThreads())
   {
-    #pragma omp master
+    // Each thread creates the streams with ids equal to its thread id
+    // modulo the number of threads
+    for( unsigned i = OpenMPProperties::getThreadId();
+         i < number_of_streams;
+         i += OpenMPProperties::getNumberOfThreads() )
     {
-      generator.resize( OpenMPProperties::getRequestedNumberOfThreads() );
+      generator[i].reset( RandomNumberGenerator::createGenerator() );
     }
-
-    #pragma omp barrier
-
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
   }
 
   // Make sure the streams have been created
-  testPostcondition( !generator.is_null( OpenMPProperties::getThreadId() ));
+  testPostcondition( generator[OpenMPProperties::getThreadId()]);
 }
 
 // Initialize the generator for the desired history
@@ -68,9 +118,9 @@ void RandomNumberGenerator::initialize(
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
   // Make sure the streams have been created
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  testPrecondition( generator[OpenMPProperties::getThreadId()] );
 
-  generator[OpenMPProperties::getThreadId()].changeHistory(history_number);
+  generator[OpenMPProperties::getThreadId()]->changeHistory(history_number);
 }
 
 // Initialize the generator for the next history
@@ -79,9 +129,9 @@ void RandomNumberGenerator::initializeNextHistory()
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
   // Make sure the streams have been created
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  testPrecondition( generator[OpenMPProperties::getThreadId()] );
 
-  generator[OpenMPProperties::getThreadId()].nextHistory();
+  generator[OpenMPProperties::getThreadId()]->nextHistory();
 }
 
 // Set a fake stream for the generator
@@ -96,12 +146,12 @@ void RandomNumberGenerator::setFakeStream(
 
   if( thread_id == OpenMPProperties::getThreadId() )
   {
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new FakeGenerator( fake_stream ) );
+    generator[OpenMPProperties::getThreadId()].reset(
+                                             new FakeGenerator( fake_stream ) );
   }
 
   // Make sure the generator has been created
-  testPostcondition( !generator.is_null( OpenMPProperties::getThreadId() ));
+  testPostcondition( generator[OpenMPProperties::getThreadId()]);
 }
 
 // Unset the fake stream
@@ -114,12 +164,12 @@ void RandomNumberGenerator::unsetFakeStream( const unsigned thread_id )
 
   if( thread_id == OpenMPProperties::getThreadId() )
   {
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
+    generator[OpenMPProperties::getThreadId()].reset(
+                                   RandomNumberGenerator::createGenerator() );
   }
 
   // Make sure that the generator has been created
-  testPostcondition(!generator.is_null( OpenMPProperties::getThreadId() ) );
+  testPostcondition(generator[OpenMPProperties::getThreadId()] );
 }
 
 } // end Utility namespace
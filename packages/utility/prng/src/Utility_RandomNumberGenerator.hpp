@@ -11,30 +11,44 @@
 
 // Std Lib Includes
 #include <vector>
-
-// Boost Includes
-#include <boost/ptr_container/ptr_vector.hpp>
-#include <boost/scoped_ptr.hpp>
+#include <memory>
 
 // FRENSIE includes
+#include "Utility_ParallelRandomNumberGenerator.hpp"
 #include "Utility_LinearCongruentialGenerator.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Utility{
 
+//! The random number generator types
+enum RandomNumberGeneratorType
+{
+  LINEAR_CONGRUENTIAL_GENERATOR = 0,
+  COUNTER_BASED_GENERATOR
+};
+
 //! Struct that is used to obtain random numbers
 class RandomNumberGenerator
 {
 
 public:
 
+  //! Set the generator type used by the streams (LCG by default)
+  static void setGeneratorType( const RandomNumberGeneratorType type );
+
+  //! Get the generator type used by the streams
+  static RandomNumberGeneratorType getGeneratorType();
+
   //! Check if the streams have been created
   static bool hasStreams();
 
   //! Create the number of random number streams required
   static void createStreams();
 
+  //! Create the requested number of random number streams
+  static void createStreams( const unsigned number_of_streams );
+
   //! Initialize the generator for the desired history
   static void initialize( const unsigned long long history_number = 0ULL );
 
@@ -61,8 +75,14 @@ private:
   // Constructor
   RandomNumberGenerator();
 
-  // Pointer to generator
-  static boost::ptr_vector<LinearCongruentialGenerator> generator;
+  // Create a generator of the requested type
+  static ParallelRandomNumberGenerator* createGenerator();
+
+  // The generator type
+  static RandomNumberGeneratorType generator_type;
+
+  // Pointer to generator (one per thread - each is cache line aligned)
+  static std::vector<std::unique_ptr<ParallelRandomNumberGenerator> > generator;
 };
 
 // Return a random number in interval [0,1)
@@ -72,10 +92,10 @@ inline ScalarType RandomNumberGenerator::getRandomNumber()
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
   // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  testPrecondition( generator[OpenMPProperties::getThreadId()] );
 
   return static_cast<ScalarType>(
-	     generator[OpenMPProperties::getThreadId()].getRandomNumber() );
+	     generator[OpenMPProperties::getThreadId()]->getRandomNumber() );
 }
 
 // Return a random double in interval [0,1)
@@ -85,9 +105,9 @@ inline double RandomNumberGenerator::getRandomNumber<double>()
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
   // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  testPrecondition( generator[OpenMPProperties::getThreadId()] );
 
-  return generator[OpenMPProperties::getThreadId()].getRandomNumber();
+  return generator[OpenMPProperties::getThreadId()]->getRandomNumber();
 }
 
 // Return a random long long unsigned integer in [0,2^64)
@@ -98,11 +118,11 @@ RandomNumberGenerator::getRandomNumber<unsigned long long>()
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
   // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  testPrecondition( generator[OpenMPProperties::getThreadId()] );
 
-  generator[OpenMPProperties::getThreadId()].getRandomNumber();
+  generator[OpenMPProperties::getThreadId()]->getRandomNumber();
 
-  return generator[OpenMPProperties::getThreadId()].getGeneratorState();
+  return generator[OpenMPProperties::getThreadId()]->getGeneratorState();
 }
 
 } // end Utility namespace
@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCounterBasedGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Counter-based generator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+#include <set>
+#include <memory>
+#include <cstdint>
+
+// FRENSIE Includes
+#include "Utility_CounterBasedGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the Philox-4x32-10 known answer tests pass
+FRENSIE_UNIT_TEST( CounterBasedGenerator, generateBlock )
+{
+  uint32_t block[4];
+
+  {
+    const uint32_t counter[4] = {0u, 0u, 0u, 0u};
+    const uint32_t key[2] = {0u, 0u};
+
+    Utility::CounterBasedGenerator::generateBlock( counter, key, block );
+
+    FRENSIE_CHECK_EQUAL( block[0], 0x6627e8d5u );
+    FRENSIE_CHECK_EQUAL( block[1], 0xe169c58du );
+    FRENSIE_CHECK_EQUAL( block[2], 0xbc57ac4cu );
+    FRENSIE_CHECK_EQUAL( block[3], 0x9b00dbd8u );
+  }
+
+  {
+    const uint32_t counter[4] =
+      {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu};
+    const uint32_t key[2] = {0xffffffffu, 0xffffffffu};
+
+    Utility::CounterBasedGenerator::generateBlock( counter, key, block );
+
+    FRENSIE_CHECK_EQUAL( block[0], 0x408f276du );
+    FRENSIE_CHECK_EQUAL( block[1], 0x41c83b0eu );
+    FRENSIE_CHECK_EQUAL( block[2], 0xa20bc7c6u );
+    FRENSIE_CHECK_EQUAL( block[3], 0x6d5451fdu );
+  }
+
+  {
+    const uint32_t counter[4] =
+      {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u};
+    const uint32_t key[2] = {0xa4093822u, 0x299f31d0u};
+
+    Utility::CounterBasedGenerator::generateBlock( counter, key, block );
+
+    FRENSIE_CHECK_EQUAL( block[0], 0xd16cfe09u );
+    FRENSIE_CHECK_EQUAL( block[1], 0x94fdccebu );
+    FRENSIE_CHECK_EQUAL( block[2], 0x5001e420u );
+    FRENSIE_CHECK_EQUAL( block[3], 0x24126ea1u );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a random number in the interval [0,1) can be obtained
+FRENSIE_UNIT_TEST( CounterBasedGenerator, getRandomNumber )
+{
+  Utility::CounterBasedGenerator generator;
+
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    double random_number = generator.getRandomNumber();
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( random_number, 0.0 );
+    FRENSIE_CHECK_LESS( random_number, 1.0 );
+  }
+
+  // The first two states come from the first block of history 0
+  generator.changeHistory( 0ULL );
+
+  generator.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( generator.getGeneratorState(), 0xe169c58d6627e8d5ULL );
+
+  generator.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( generator.getGeneratorState(), 0x9b00dbd8bc57ac4cULL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can jump to any history
+FRENSIE_UNIT_TEST( CounterBasedGenerator, changeHistory )
+{
+  Utility::CounterBasedGenerator generator;
+
+  generator.changeHistory( 1000000000000ULL );
+
+  FRENSIE_CHECK_EQUAL( generator.getHistory(), 1000000000000ULL );
+  FRENSIE_CHECK_EQUAL( generator.getSecondaryIndex(), 0ULL );
+
+  std::vector<double> history_stream( 5 );
+
+  for( size_t i = 0; i < history_stream.size(); ++i )
+    history_stream[i] = generator.getRandomNumber();
+
+  generator.changeHistory( 3ULL );
+  generator.getRandomNumber();
+
+  generator.changeHistory( 1000000000000ULL );
+
+  for( size_t i = 0; i < history_stream.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), history_stream[i] );
+  }
+
+  // The secondary streams of a history are independent
+  generator.changeHistory( 1000000000000ULL, 1ULL );
+
+  FRENSIE_CHECK_EQUAL( generator.getSecondaryIndex(), 1ULL );
+  FRENSIE_CHECK( generator.getRandomNumber() != history_stream[0] );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be initialized for the next history
+FRENSIE_UNIT_TEST( CounterBasedGenerator, nextHistory )
+{
+  Utility::CounterBasedGenerator generator, jump_generator;
+
+  std::set<unsigned long long> first_states;
+
+  for( unsigned long long history = 0ULL; history < 100ULL; ++history )
+  {
+    if( history > 0ULL )
+      generator.nextHistory();
+
+    jump_generator.changeHistory( history );
+
+    generator.getRandomNumber();
+    jump_generator.getRandomNumber();
+
+    FRENSIE_CHECK_EQUAL( generator.getGeneratorState(),
+                         jump_generator.getGeneratorState() );
+
+    first_states.insert( generator.getGeneratorState() );
+  }
+
+  FRENSIE_CHECK_EQUAL( first_states.size(), 100 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generators are allocated on cache line boundaries
+FRENSIE_UNIT_TEST( CounterBasedGenerator, cache_line_alignment )
+{
+  std::vector<std::unique_ptr<Utility::ParallelRandomNumberGenerator> >
+    generators;
+
+  for( size_t i = 0; i < 8; ++i )
+  {
+    generators.emplace_back( new Utility::CounterBasedGenerator );
+
+    FRENSIE_CHECK_EQUAL( reinterpret_cast<uintptr_t>( generators.back().get() ) % UTILITY_PRNG_CACHE_LINE_SIZE, 0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( sizeof(Utility::CounterBasedGenerator) % UTILITY_PRNG_CACHE_LINE_SIZE, 0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstCounterBasedGenerator.cpp
+//---------------------------------------------------------------------------//
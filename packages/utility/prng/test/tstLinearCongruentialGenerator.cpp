@@ -8,9 +8,11 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <vector>
 
 // FRENSIE Includes
 #include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_ExponentiationAlgorithms.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -27,6 +29,76 @@ FRENSIE_UNIT_TEST( LinearCongruentialGenerator, getRandomNumber )
   FRENSIE_CHECK_LESS( random_number, 1.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the history jump multiplier can be returned
+FRENSIE_UNIT_TEST( LinearCongruentialGenerator, getHistoryJumpMultiplier )
+{
+  FRENSIE_CHECK_EQUAL( Utility::LinearCongruentialGenerator::getHistoryJumpMultiplier( 0ULL ), 1ULL );
+
+  // g^(L*n) mod 2^64
+  FRENSIE_CHECK_EQUAL( Utility::LinearCongruentialGenerator::getHistoryJumpMultiplier( 1ULL ),
+                       Utility::Exponentiation::recursive( 19073486328125ULL, 152917ULL ) );
+  FRENSIE_CHECK_EQUAL( Utility::LinearCongruentialGenerator::getHistoryJumpMultiplier( 1000ULL ),
+                       Utility::Exponentiation::recursive( 19073486328125ULL, 1000ULL*152917ULL ) );
+  FRENSIE_CHECK_EQUAL( Utility::LinearCongruentialGenerator::getHistoryJumpMultiplier( 123456789ULL ),
+                       Utility::Exponentiation::recursive( 19073486328125ULL, 123456789ULL*152917ULL ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can jump to any history
+FRENSIE_UNIT_TEST( LinearCongruentialGenerator, changeHistory )
+{
+  Utility::LinearCongruentialGenerator sequential_lcg;
+
+  std::vector<unsigned long long> sequential_states( 100 );
+
+  for( size_t i = 0; i < sequential_states.size(); ++i )
+  {
+    if( i > 0 )
+      sequential_lcg.nextHistory();
+
+    sequential_lcg.getRandomNumber();
+
+    sequential_states[i] = sequential_lcg.getGeneratorState();
+  }
+
+  Utility::LinearCongruentialGenerator lcg;
+
+  // Jump forward
+  lcg.changeHistory( 7ULL );
+  lcg.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( lcg.getGeneratorState(), sequential_states[7] );
+
+  lcg.changeHistory( 8ULL );
+  lcg.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( lcg.getGeneratorState(), sequential_states[8] );
+
+  lcg.changeHistory( 99ULL );
+  lcg.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( lcg.getGeneratorState(), sequential_states[99] );
+
+  // Jump backward
+  lcg.changeHistory( 42ULL );
+  lcg.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( lcg.getGeneratorState(), sequential_states[42] );
+
+  // Restart the current history
+  lcg.getRandomNumber();
+  lcg.changeHistory( 42ULL );
+  lcg.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( lcg.getGeneratorState(), sequential_states[42] );
+
+  lcg.changeHistory( 0ULL );
+  lcg.getRandomNumber();
+
+  FRENSIE_CHECK_EQUAL( lcg.getGeneratorState(), sequential_states[0] );
+}
+
 //---------------------------------------------------------------------------//
 // end tstLinearCongruentialGenerator.cpp
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_CounterBasedGenerator.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_Vector.hpp"
@@ -133,6 +134,101 @@ FRENSIE_UNIT_TEST( RandomNumberGenerator, initialize_history )
   FRENSIE_CHECK_EQUAL( all_random_numbers.size(), random_set.size() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the counter-based generator streams can be used
+FRENSIE_UNIT_TEST( RandomNumberGenerator, setGeneratorType )
+{
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  Utility::RandomNumberGenerator::setGeneratorType(
+                                             Utility::COUNTER_BASED_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::COUNTER_BASED_GENERATOR );
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  FRENSIE_REQUIRE( Utility::RandomNumberGenerator::hasStreams() );
+
+  // The stream of a history must not depend on the thread that uses it
+  std::vector<unsigned long long> local_random_numbers(
+                    Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+#pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  {
+    Utility::RandomNumberGenerator::initialize( 1000ULL );
+
+    local_random_numbers[Utility::OpenMPProperties::getThreadId()] =
+      Utility::RandomNumberGenerator::getRandomNumber<unsigned long long>();
+  }
+
+  Utility::CounterBasedGenerator generator;
+  generator.changeHistory( 1000ULL );
+  generator.getRandomNumber();
+
+  for( size_t i = 0; i < local_random_numbers.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( local_random_numbers[i],
+                         generator.getGeneratorState() );
+  }
+
+  // Restore the default generator type
+  Utility::RandomNumberGenerator::setGeneratorType(
+                                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a stream can be created for every virtual thread id
+FRENSIE_UNIT_TEST( RandomNumberGenerator, createStreams_virtual_threads )
+{
+  const unsigned number_of_streams =
+    4*Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  Utility::RandomNumberGenerator::createStreams( number_of_streams );
+
+  FRENSIE_REQUIRE( Utility::RandomNumberGenerator::hasStreams() );
+
+  // Each virtual thread id must own an independent stream
+  std::vector<double> first_random_numbers( number_of_streams );
+  std::vector<double> second_random_numbers( number_of_streams );
+
+  for( unsigned i = 0; i < number_of_streams; ++i )
+  {
+    Utility::OpenMPProperties::setVirtualThreadId( i );
+
+    Utility::RandomNumberGenerator::initialize( i );
+
+    first_random_numbers[i] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  for( unsigned i = 0; i < number_of_streams; ++i )
+  {
+    Utility::OpenMPProperties::setVirtualThreadId( i );
+
+    second_random_numbers[i] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  Utility::OpenMPProperties::unsetVirtualThreadId();
+
+  // Interleaving the streams must not change the numbers of each history
+  for( unsigned i = 0; i < number_of_streams; ++i )
+  {
+    Utility::RandomNumberGenerator::initialize( i );
+
+    FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                         first_random_numbers[i] );
+    FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                         second_random_numbers[i] );
+  }
+
+  Utility::RandomNumberGenerator::createStreams();
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
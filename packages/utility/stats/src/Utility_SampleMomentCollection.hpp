@@ -107,6 +107,9 @@ public:
   //! Add a raw score to all moments in the collection
   void addRawScore( const T& raw_score );
 
+  //! Add a raw score (thread safe)
+  void addRawScoreAtomic( const size_t i, const T& raw_score );
+
 private:
 
   // Make the data extractor class a friend
@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "Utility_SampleMomentCollection.hpp"
+#include "Utility_SampleMomentSnapshotFileWriter.hpp"
 #include "Utility_List.hpp"
 #include "Utility_SerializationHelpers.hpp"
 
@@ -100,6 +101,18 @@ public:
                      const double sampling_time_from_last_snapshot,
                      const SampleMomentCollection<T,N,Ns...>& collection );
 
+  //! Take a snapshot of a sample moment collection and write it to a file
+  void takeSnapshot( const uint64_t number_of_additional_samples,
+                     const double sampling_time_from_last_snapshot,
+                     const SampleMomentCollection<T,N,Ns...>& collection,
+                     SampleMomentSnapshotFileWriter& snapshot_file,
+                     const uint64_t collection_id );
+
+  //! Write the snapshots to a file
+  void writeSnapshots( const size_t first_snapshot,
+                       SampleMomentSnapshotFileWriter& snapshot_file,
+                       const uint64_t collection_id );
+
   //! Merge the snapshots
   void mergeSnapshots( const SampleMomentCollectionSnapshots& collection );
 
@@ -228,17 +228,50 @@ public:
     d_snapshot_sampling_times.push_back( sampling_time );
   }
 
+  //! Take a snapshot of a sample moment collection and write it to a file
+  void takeSnapshot( const uint64_t number_of_additional_samples,
+                     const double sampling_time_from_last_snapshot,
+                     const SampleMomentCollection<T,Ns...>& collection,
+                     SampleMomentSnapshotFileWriter&,
+                     const uint64_t )
+  {
+    this->takeSnapshot( number_of_additional_samples,
+                        sampling_time_from_last_snapshot,
+                        collection );
+
+    // Only the last snapshot is kept in memory
+    d_snapshot_indices.erase( d_snapshot_indices.begin(),
+                              std::prev( d_snapshot_indices.end() ) );
+    d_snapshot_sampling_times.erase( d_snapshot_sampling_times.begin(),
+                                     std::prev( d_snapshot_sampling_times.end() ) );
+  }
+
+  //! Write the snapshots to a file
+  void writeSnapshots( const size_t,
+                       SampleMomentSnapshotFileWriter&,
+                       const uint64_t )
+  {
+    // Only the last snapshot is kept in memory
+    if( !d_snapshot_indices.empty() )
+    {
+      d_snapshot_indices.erase( d_snapshot_indices.begin(),
+                                std::prev( d_snapshot_indices.end() ) );
+      d_snapshot_sampling_times.erase( d_snapshot_sampling_times.begin(),
+                                       std::prev( d_snapshot_sampling_times.end() ) );
+    }
+  }
+
   //! Merge the snapshots
   void mergeSnapshots( const SampleMomentCollectionSnapshots& collection )
   {
-    const typename SummationIndexContainerType::value_type& max_summation_index =
-      d_snapshot_indices.back();
+    const typename SummationIndexContainerType::value_type max_summation_index =
+      d_snapshot_indices.empty() ? 0 : d_snapshot_indices.back();
     
     for( auto&& other_summation_index : collection.d_snapshot_indices )
       d_snapshot_indices.push_back( max_summation_index + other_summation_index );
 
-    const typename SamplingTimeContainerType::value_type& max_sampling_time =
-      d_snapshot_sampling_times.back();
+    const typename SamplingTimeContainerType::value_type max_sampling_time =
+      d_snapshot_sampling_times.empty() ? 0.0 : d_snapshot_sampling_times.back();
 
     for( auto&& other_sampling_times : collection.d_snapshot_sampling_times )
       d_snapshot_sampling_times.push_back( max_sampling_time + other_sampling_times );
@@ -381,6 +414,167 @@ void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::takeSnapshot(
   }
 }
 
+// Take a snapshot of a sample moment collection and write it to a file
+/*! \details Only the bins that changed since the previous snapshot are
+ * written to the file and only the last snapshot is kept in memory (the
+ * snapshot history must be loaded with the
+ * Utility::SampleMomentSnapshotFileReader). The collection snapshots must
+ * either be empty or only contain snapshots that were also written to the
+ * file with this method since the scores are compared to the last snapshot
+ * in memory.
+ */
+template<typename T, template<typename,typename...> class SnapshotContainer, size_t N, size_t... Ns>
+void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::takeSnapshot(
+                          const uint64_t number_of_additional_samples,
+                          const double sampling_time_from_last_snapshot,
+                          const SampleMomentCollection<T,N,Ns...>& collection,
+                          SampleMomentSnapshotFileWriter& snapshot_file,
+                          const uint64_t collection_id )
+{
+  // Make sure that the snapshot collection and the collection have the same
+  // size
+  testPrecondition( this->size() == collection.size() );
+
+  BaseType::takeSnapshot( number_of_additional_samples,
+                          sampling_time_from_last_snapshot,
+                          collection,
+                          snapshot_file,
+                          collection_id );
+
+  typedef Utility::QuantityTraits<MomentValueType> MVT;
+
+  std::vector<uint64_t> changed_bin_indices;
+  std::vector<double> changed_bin_scores;
+
+  bool first_snapshot = true;
+
+  for( size_t i = 0; i < collection.size(); ++i )
+  {
+    MomentSnapshotContainerType& bin_score_snapshots = d_score_snapshots[i];
+
+    const MomentValueType& score = Utility::getCurrentScore<N>(collection, i);
+
+    // The scores of the first snapshot are relative to zero
+    if( bin_score_snapshots.empty() )
+    {
+      if( score != MVT::zero() )
+      {
+        changed_bin_indices.push_back( i );
+        changed_bin_scores.push_back( MVT::getRawQuantity( score ) );
+      }
+
+      bin_score_snapshots.push_back( score );
+    }
+    else
+    {
+      first_snapshot = false;
+
+      // Only the last snapshot is kept in memory
+      bin_score_snapshots.erase( bin_score_snapshots.begin(),
+                                 std::prev( bin_score_snapshots.end() ) );
+
+      if( score != bin_score_snapshots.back() )
+      {
+        changed_bin_indices.push_back( i );
+        changed_bin_scores.push_back( MVT::getRawQuantity( score ) );
+
+        bin_score_snapshots.back() = score;
+      }
+    }
+  }
+
+  snapshot_file.writeSnapshot( collection_id,
+                               N,
+                               first_snapshot,
+                               this->getSnapshotIndices().back(),
+                               this->getSnapshotSamplingTimes().back(),
+                               changed_bin_indices,
+                               changed_bin_scores );
+}
+
+// Write the snapshots to a file
+/*! \details The snapshots starting at the first snapshot index are written
+ * to the file (only the bins that changed since the previous snapshot are
+ * written). The snapshots before the first snapshot index must have already
+ * been written to the file (e.g. with the streaming takeSnapshot method).
+ * Only the last snapshot is kept in memory afterwards.
+ */
+template<typename T, template<typename,typename...> class SnapshotContainer, size_t N, size_t... Ns>
+void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::writeSnapshots(
+                                   const size_t first_snapshot,
+                                   SampleMomentSnapshotFileWriter& snapshot_file,
+                                   const uint64_t collection_id )
+{
+  // Make sure that the first snapshot is valid
+  testPrecondition( first_snapshot <= this->getNumberOfSnapshots() );
+
+  typedef Utility::QuantityTraits<MomentValueType> MVT;
+
+  std::vector<typename MomentSnapshotContainerType::const_iterator>
+    score_snapshot_its( d_score_snapshots.size() );
+
+  for( size_t i = 0; i < d_score_snapshots.size(); ++i )
+  {
+    score_snapshot_its[i] = d_score_snapshots[i].begin();
+    std::advance( score_snapshot_its[i], first_snapshot );
+  }
+
+  auto summation_index_it = this->getSnapshotIndices().begin();
+  std::advance( summation_index_it, first_snapshot );
+
+  auto sampling_time_it = this->getSnapshotSamplingTimes().begin();
+  std::advance( sampling_time_it, first_snapshot );
+
+  std::vector<uint64_t> changed_bin_indices;
+  std::vector<double> changed_bin_scores;
+
+  for( size_t j = first_snapshot; j < this->getNumberOfSnapshots(); ++j )
+  {
+    changed_bin_indices.clear();
+    changed_bin_scores.clear();
+
+    for( size_t i = 0; i < d_score_snapshots.size(); ++i )
+    {
+      const MomentValueType& score = *score_snapshot_its[i];
+
+      // The scores of the first snapshot are relative to zero
+      const MomentValueType previous_score = j == 0 ? MVT::zero() :
+        *std::prev( score_snapshot_its[i] );
+
+      if( score != previous_score )
+      {
+        changed_bin_indices.push_back( i );
+        changed_bin_scores.push_back( MVT::getRawQuantity( score ) );
+      }
+
+      ++score_snapshot_its[i];
+    }
+
+    snapshot_file.writeSnapshot( collection_id,
+                                 N,
+                                 j == 0,
+                                 *summation_index_it,
+                                 *sampling_time_it,
+                                 changed_bin_indices,
+                                 changed_bin_scores );
+
+    ++summation_index_it;
+    ++sampling_time_it;
+  }
+
+  // Only the last snapshot is kept in memory
+  for( auto&& bin_score_snapshots : d_score_snapshots )
+  {
+    if( !bin_score_snapshots.empty() )
+    {
+      bin_score_snapshots.erase( bin_score_snapshots.begin(),
+                                 std::prev( bin_score_snapshots.end() ) );
+    }
+  }
+
+  BaseType::writeSnapshots( first_snapshot, snapshot_file, collection_id );
+}
+
 // Merge the snapshots
 template<typename T, template<typename,typename...> class SnapshotContainer, size_t N, size_t... Ns>
 void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::mergeSnapshots( const SampleMomentCollectionSnapshots& collection )
@@ -390,9 +584,12 @@ void SampleMomentCollectionSnapshots<T,SnapshotContainer,N,Ns...>::mergeSnapshot
 
   BaseType::mergeSnapshots( collection );
 
+  typedef Utility::QuantityTraits<MomentValueType> MVT;
+
   for( size_t i = 0; i < d_score_snapshots.size(); ++i )
   {
-    const MomentValueType& last_score = d_score_snapshots[i].back();
+    const MomentValueType last_score = d_score_snapshots[i].empty() ?
+      MVT::zero() : d_score_snapshots[i].back();
 
     for( auto&& other_score : collection.d_score_snapshots[i] )
       d_score_snapshots[i].push_back( last_score + other_score );
@@ -187,6 +187,10 @@ protected:
   void addRawScore( const T& raw_score )
   { /* ... */ }
 
+  //! Add a raw score (thread safe)
+  void addRawScoreAtomic( const size_t i, const T& raw_score )
+  { /* ... */ }
+
 private:
 
   // Make all moment collections friend
@@ -328,6 +332,33 @@ void SampleMomentCollection<T,N,Ns...>::addRawScore( const T& raw_score )
     d_current_scores[i] += processed_score;
 }
 
+// Add a raw score (thread safe)
+/*! \details The current score of each moment is updated with an atomic
+ * operation. Multiple threads can therefore add scores to the collection
+ * concurrently without having to acquire a lock. This method can only be
+ * used with arithmetic value types.
+ */
+template<typename T, size_t N, size_t... Ns>
+void SampleMomentCollection<T,N,Ns...>::addRawScoreAtomic( const size_t i,
+                                                           const T& raw_score )
+{
+  static_assert( std::is_arithmetic<ValueType>::value,
+                 "Atomic updates require an arithmetic value type!" );
+
+  // Make sure the the index is valid
+  testPrecondition( i < this->size() );
+
+  SampleMomentCollection<T,Ns...>::addRawScoreAtomic( i, raw_score );
+
+  const ValueType processed_score =
+    SampleMoment<N,T>::processRawScore( raw_score );
+
+  ValueType& current_score = d_current_scores[i];
+
+  #pragma omp atomic
+  current_score += processed_score;
+}
+
 // Save the collection data to an archive
 template<typename T, size_t N, size_t... Ns>
 template<class Archive>
@@ -76,9 +76,17 @@ public:
   //! Add a raw score
   void addRawScore( const T& raw_score );
 
+  //! Add a raw score (thread safe)
+  void addRawScoreAtomic( const T& raw_score );
+
   //! Merge histograms
   void mergeHistograms( const SampleMomentHistogram& histogram );
 
+  //! Merge histogram values (e.g. values that were reduced over processes)
+  void mergeHistogramValues(
+               const Utility::ArrayView<const HistogramValueType>& histogram_values,
+               const uint64_t number_of_scores );
+
   //! Get the number of scores
   uint64_t getNumberOfScores() const;
 
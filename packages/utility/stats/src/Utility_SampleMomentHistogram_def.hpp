@@ -158,6 +158,38 @@ void SampleMomentHistogram<T>::addRawScore( const T& raw_score )
   }
 }
 
+// Add a raw score (thread safe)
+/*! \details The histogram value and the number of scores are updated with
+ * atomic operations so multiple threads can add scores to the histogram
+ * concurrently. The bin boundaries must not be changed while scores are
+ * being added.
+ */
+template<typename T>
+void SampleMomentHistogram<T>::addRawScoreAtomic( const T& raw_score )
+{
+  size_t bin_index;
+
+  if( raw_score >= d_bin_boundaries->front() &&
+      raw_score < d_bin_boundaries->back() )
+  {
+    bin_index = Search::binaryLowerBoundIndex( d_bin_boundaries->begin(),
+                                               d_bin_boundaries->end(),
+                                               raw_score );
+  }
+  else if( raw_score == d_bin_boundaries->back() )
+    bin_index = d_histogram_values.size() - 1;
+  else
+    return;
+
+  HistogramValueType& histogram_value = d_histogram_values[bin_index];
+
+  #pragma omp atomic
+  histogram_value += 1.0;
+
+  #pragma omp atomic
+  ++d_number_of_scores;
+}
+
 // Merge histograms
 /*! \details The histograms must have the same bin boundaries. If 
  * Design by Contract is not enabled this method will not check if this
@@ -176,6 +208,24 @@ void SampleMomentHistogram<T>::mergeHistograms( const SampleMomentHistogram<T>&
   d_number_of_scores += histogram.d_number_of_scores;
 }
 
+// Merge histogram values
+/*! \details The histogram values must be ordered by bin and there must be a
+ * value for every bin.
+ */
+template<typename T>
+void SampleMomentHistogram<T>::mergeHistogramValues(
+          const Utility::ArrayView<const HistogramValueType>& histogram_values,
+          const uint64_t number_of_scores )
+{
+  // Make sure that the histogram values are valid
+  testPrecondition( histogram_values.size() == d_histogram_values.size() );
+
+  for( size_t i = 0; i < d_histogram_values.size(); ++i )
+    d_histogram_values[i] += histogram_values[i];
+
+  d_number_of_scores += number_of_scores;
+}
+
 // Get the number of scores
 template<typename T>
 uint64_t SampleMomentHistogram<T>::getNumberOfScores() const
@@ -0,0 +1,318 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_SampleMomentSnapshotFileReader.cpp
+//! \author Alex Robinson
+//! \brief  The sample moment snapshot file reader definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/array.hpp>
+
+// FRENSIE Includes
+#include "Utility_SampleMomentSnapshotFileReader.hpp"
+#include "Utility_SampleMomentSnapshotFileWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+/*! \details Only the records that end before the max file size will be
+ * indexed (e.g. the records that were written before an estimator was
+ * archived).
+ */
+SampleMomentSnapshotFileReader::SampleMomentSnapshotFileReader(
+                                     const boost::filesystem::path& file_name,
+                                     const uint64_t max_file_size )
+  : d_file_name( file_name ),
+    d_file( file_name.string(), std::ios::binary ),
+    d_collection_records()
+{
+  TEST_FOR_EXCEPTION( !d_file.is_open(),
+                      std::runtime_error,
+                      "Could not open sample moment snapshot file "
+                      << file_name.string() << "!" );
+
+  // Verify the file header
+  {
+    char file_format_id[8];
+    uint32_t file_format_version;
+
+    d_file.read( file_format_id, sizeof(file_format_id) );
+    d_file.read( (char*)&file_format_version, sizeof(file_format_version) );
+
+    TEST_FOR_EXCEPTION( !d_file ||
+                        std::memcmp( file_format_id,
+                                     SampleMomentSnapshotFileWriter::s_file_format_id,
+                                     sizeof(file_format_id) ) != 0,
+                        std::runtime_error,
+                        "File " << file_name.string() << " is not a sample "
+                        "moment snapshot file!" );
+
+    TEST_FOR_EXCEPTION( file_format_version !=
+                        SampleMomentSnapshotFileWriter::s_file_format_version,
+                        std::runtime_error,
+                        "Sample moment snapshot file " << file_name.string()
+                        << " has an unsupported format version ("
+                        << file_format_version << ")!" );
+  }
+
+  // Index the records - a record that was only partially written (e.g. the
+  // simulation was killed) or that ends after the max file size will be
+  // ignored
+  d_file.seekg( 0, std::ios::end );
+
+  const uint64_t file_size =
+    std::min( (uint64_t)d_file.tellg(), max_file_size );
+
+  d_file.seekg( sizeof(SampleMomentSnapshotFileWriter::s_file_format_id) +
+                sizeof(SampleMomentSnapshotFileWriter::s_file_format_version) );
+
+  while( true )
+  {
+    uint64_t collection_id;
+    uint32_t moment_order;
+    uint8_t first_snapshot;
+    Record record;
+
+    d_file.read( (char*)&collection_id, sizeof(collection_id) );
+    d_file.read( (char*)&moment_order, sizeof(moment_order) );
+    d_file.read( (char*)&first_snapshot, sizeof(first_snapshot) );
+    d_file.read( (char*)&record.summation_index,
+                 sizeof(record.summation_index) );
+    d_file.read( (char*)&record.sampling_time,
+                 sizeof(record.sampling_time) );
+    d_file.read( (char*)&record.number_of_changed_bins,
+                 sizeof(record.number_of_changed_bins) );
+    d_file.read( (char*)&record.compressed_data_size,
+                 sizeof(record.compressed_data_size) );
+
+    if( !d_file )
+      break;
+
+    record.compressed_data_offset = d_file.tellg();
+
+    if( record.compressed_data_offset + record.compressed_data_size >
+        file_size )
+      break;
+
+    std::vector<Record>& collection_moment_records =
+      d_collection_records[collection_id][moment_order];
+
+    // The scores of the first snapshot are relative to zero - any previous
+    // snapshots were reset
+    if( first_snapshot )
+      collection_moment_records.clear();
+
+    collection_moment_records.push_back( record );
+
+    d_file.seekg( record.compressed_data_offset +
+                  record.compressed_data_size );
+  }
+
+  d_file.clear();
+}
+
+// Return the file name
+const boost::filesystem::path&
+SampleMomentSnapshotFileReader::getFileName() const
+{
+  return d_file_name;
+}
+
+// Check if the file has snapshots of a collection
+bool SampleMomentSnapshotFileReader::hasSnapshots(
+                                          const uint64_t collection_id ) const
+{
+  return this->getRecords( collection_id ) != NULL;
+}
+
+// Return the number of snapshots of a collection
+size_t SampleMomentSnapshotFileReader::getNumberOfSnapshots(
+                                          const uint64_t collection_id ) const
+{
+  const std::vector<Record>* records = this->getRecords( collection_id );
+
+  if( records )
+    return records->size();
+  else
+    return 0;
+}
+
+// Get the snapshot indices (summation indices) of a collection
+/*! \details If the file has no snapshots of the collection the snapshot
+ * indices will be empty.
+ */
+void SampleMomentSnapshotFileReader::getSnapshotIndices(
+                               const uint64_t collection_id,
+                               std::vector<uint64_t>& snapshot_indices ) const
+{
+  snapshot_indices.clear();
+
+  const std::vector<Record>* records = this->getRecords( collection_id );
+
+  if( records )
+  {
+    snapshot_indices.resize( records->size() );
+
+    for( size_t i = 0; i < records->size(); ++i )
+      snapshot_indices[i] = (*records)[i].summation_index;
+  }
+}
+
+// Get the snapshot sampling times of a collection
+/*! \details If the file has no snapshots of the collection the sampling
+ * times will be empty.
+ */
+void SampleMomentSnapshotFileReader::getSnapshotSamplingTimes(
+                                   const uint64_t collection_id,
+                                   std::vector<double>& sampling_times ) const
+{
+  sampling_times.clear();
+
+  const std::vector<Record>* records = this->getRecords( collection_id );
+
+  if( records )
+  {
+    sampling_times.resize( records->size() );
+
+    for( size_t i = 0; i < records->size(); ++i )
+      sampling_times[i] = (*records)[i].sampling_time;
+  }
+}
+
+// Get the score snapshots of a collection moment bin
+/*! \details If the file has no snapshots of the collection moment the score
+ * snapshots will be empty.
+ */
+void SampleMomentSnapshotFileReader::getScoreSnapshots(
+                                   const uint64_t collection_id,
+                                   const unsigned moment_order,
+                                   const size_t bin_index,
+                                   std::vector<double>& score_snapshots ) const
+{
+  score_snapshots.clear();
+
+  const std::vector<Record>* records =
+    this->getRecords( collection_id, moment_order );
+
+  if( records )
+  {
+    score_snapshots.resize( records->size() );
+
+    std::vector<uint64_t> changed_bin_indices;
+    std::vector<double> changed_bin_scores;
+
+    double score = 0.0;
+
+    for( size_t i = 0; i < records->size(); ++i )
+    {
+      const Record& record = (*records)[i];
+
+      if( record.number_of_changed_bins > 0 )
+      {
+        this->readRecord( record, changed_bin_indices, changed_bin_scores );
+
+        std::vector<uint64_t>::const_iterator changed_bin_index_it =
+          std::lower_bound( changed_bin_indices.begin(),
+                            changed_bin_indices.end(),
+                            (uint64_t)bin_index );
+
+        if( changed_bin_index_it != changed_bin_indices.end() &&
+            *changed_bin_index_it == bin_index )
+        {
+          score = changed_bin_scores[changed_bin_index_it -
+                                     changed_bin_indices.begin()];
+        }
+      }
+
+      score_snapshots[i] = score;
+    }
+  }
+}
+
+// Return the records of a collection moment (NULL if there are none)
+auto SampleMomentSnapshotFileReader::getRecords(
+                                   const uint64_t collection_id,
+                                   const unsigned moment_order ) const
+  -> const std::vector<Record>*
+{
+  std::unordered_map<uint64_t,CollectionMomentRecords>::const_iterator
+    collection_records_it = d_collection_records.find( collection_id );
+
+  if( collection_records_it != d_collection_records.end() )
+  {
+    CollectionMomentRecords::const_iterator moment_records_it =
+      collection_records_it->second.find( moment_order );
+
+    if( moment_records_it != collection_records_it->second.end() )
+      return &moment_records_it->second;
+  }
+
+  return NULL;
+}
+
+// Return the records of the lowest moment of a collection
+auto SampleMomentSnapshotFileReader::getRecords(
+                                   const uint64_t collection_id ) const
+  -> const std::vector<Record>*
+{
+  std::unordered_map<uint64_t,CollectionMomentRecords>::const_iterator
+    collection_records_it = d_collection_records.find( collection_id );
+
+  if( collection_records_it != d_collection_records.end() &&
+      !collection_records_it->second.empty() )
+    return &collection_records_it->second.begin()->second;
+  else
+    return NULL;
+}
+
+// Read the changed bin indices and scores of a record
+void SampleMomentSnapshotFileReader::readRecord(
+                              const Record& record,
+                              std::vector<uint64_t>& changed_bin_indices,
+                              std::vector<double>& changed_bin_scores ) const
+{
+  std::vector<char> compressed_data( record.compressed_data_size );
+
+  d_file.seekg( record.compressed_data_offset );
+  d_file.read( compressed_data.data(), compressed_data.size() );
+
+  TEST_FOR_EXCEPTION( !d_file,
+                      std::runtime_error,
+                      "Could not read snapshot from sample moment snapshot "
+                      "file " << d_file_name.string() << "!" );
+
+  changed_bin_indices.resize( record.number_of_changed_bins );
+  changed_bin_scores.resize( record.number_of_changed_bins );
+
+  boost::iostreams::filtering_istream compressed_data_stream;
+
+  compressed_data_stream.push( boost::iostreams::zlib_decompressor() );
+  compressed_data_stream.push(
+                      boost::iostreams::array_source( compressed_data.data(),
+                                                      compressed_data.size() ) );
+
+  compressed_data_stream.read( (char*)changed_bin_indices.data(),
+                               changed_bin_indices.size()*sizeof(uint64_t) );
+  compressed_data_stream.read( (char*)changed_bin_scores.data(),
+                               changed_bin_scores.size()*sizeof(double) );
+
+  TEST_FOR_EXCEPTION( !compressed_data_stream,
+                      std::runtime_error,
+                      "Could not decompress snapshot from sample moment "
+                      "snapshot file " << d_file_name.string() << "!" );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_SampleMomentSnapshotFileReader.cpp
+//---------------------------------------------------------------------------//
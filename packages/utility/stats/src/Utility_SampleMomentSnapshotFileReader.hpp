@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_SampleMomentSnapshotFileReader.hpp
+//! \author Alex Robinson
+//! \brief  The sample moment snapshot file reader declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_SAMPLE_MOMENT_SNAPSHOT_FILE_READER_HPP
+#define UTILITY_SAMPLE_MOMENT_SNAPSHOT_FILE_READER_HPP
+
+// Std Lib Includes
+#include <fstream>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <limits>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+namespace Utility{
+
+/*! The sample moment snapshot file reader
+ *
+ * \details The file is indexed when the reader is constructed (only the
+ * record headers are read). The snapshots of a collection moment bin are
+ * reconstructed on request by applying the changed bin scores stored in each
+ * record of the collection moment in order, so only the records of the
+ * requested collection moment are read and decompressed.
+ */
+class SampleMomentSnapshotFileReader
+{
+
+public:
+
+  //! Constructor
+  SampleMomentSnapshotFileReader(
+                  const boost::filesystem::path& file_name,
+                  const uint64_t max_file_size =
+                  std::numeric_limits<uint64_t>::max() );
+
+  //! Destructor
+  ~SampleMomentSnapshotFileReader()
+  { /* ... */ }
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Check if the file has snapshots of a collection
+  bool hasSnapshots( const uint64_t collection_id ) const;
+
+  //! Return the number of snapshots of a collection
+  size_t getNumberOfSnapshots( const uint64_t collection_id ) const;
+
+  //! Get the snapshot indices (summation indices) of a collection
+  void getSnapshotIndices( const uint64_t collection_id,
+                           std::vector<uint64_t>& snapshot_indices ) const;
+
+  //! Get the snapshot sampling times of a collection
+  void getSnapshotSamplingTimes( const uint64_t collection_id,
+                                 std::vector<double>& sampling_times ) const;
+
+  //! Get the score snapshots of a collection moment bin
+  void getScoreSnapshots( const uint64_t collection_id,
+                          const unsigned moment_order,
+                          const size_t bin_index,
+                          std::vector<double>& score_snapshots ) const;
+
+private:
+
+  // The snapshot record data
+  struct Record
+  {
+    // The summation index
+    uint64_t summation_index;
+
+    // The sampling time
+    double sampling_time;
+
+    // The number of changed bins
+    uint64_t number_of_changed_bins;
+
+    // The offset of the compressed data in the file
+    uint64_t compressed_data_offset;
+
+    // The compressed data size
+    uint64_t compressed_data_size;
+  };
+
+  // The collection moment records
+  typedef std::map<unsigned,std::vector<Record> > CollectionMomentRecords;
+
+  // Return the records of a collection moment (NULL if there are none)
+  const std::vector<Record>* getRecords( const uint64_t collection_id,
+                                         const unsigned moment_order ) const;
+
+  // Return the records of the lowest moment of a collection
+  const std::vector<Record>* getRecords( const uint64_t collection_id ) const;
+
+  // Read the changed bin indices and scores of a record
+  void readRecord( const Record& record,
+                   std::vector<uint64_t>& changed_bin_indices,
+                   std::vector<double>& changed_bin_scores ) const;
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The file stream
+  mutable std::ifstream d_file;
+
+  // The records of each collection
+  std::unordered_map<uint64_t,CollectionMomentRecords> d_collection_records;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_SAMPLE_MOMENT_SNAPSHOT_FILE_READER_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_SampleMomentSnapshotFileReader.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,204 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_SampleMomentSnapshotFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  The sample moment snapshot file writer definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+
+// Boost Includes
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/filesystem/operations.hpp>
+
+// FRENSIE Includes
+#include "Utility_SampleMomentSnapshotFileWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Initialize static member data
+const char SampleMomentSnapshotFileWriter::s_file_format_id[8] =
+  {'F','R','N','S','S','N','A','P'};
+
+const uint32_t SampleMomentSnapshotFileWriter::s_file_format_version = 1;
+
+// Constructor
+/*! \details If the resume file size is not zero the existing file will be
+ * truncated to the resume file size and new snapshots will be added to the
+ * end of it (e.g. when a simulation is restarted from a rendezvous, the
+ * snapshots written after the rendezvous are discarded). Otherwise the file
+ * will be overwritten.
+ */
+SampleMomentSnapshotFileWriter::SampleMomentSnapshotFileWriter(
+                                     const boost::filesystem::path& file_name,
+                                     const uint64_t resume_file_size )
+  : d_file_name( file_name ),
+    d_file(),
+    d_file_size( 0 )
+{
+  const uint64_t header_size =
+    sizeof(s_file_format_id) + sizeof(s_file_format_version);
+
+  if( resume_file_size > 0 )
+  {
+    TEST_FOR_EXCEPTION( resume_file_size < header_size ||
+                        !boost::filesystem::exists( file_name ) ||
+                        boost::filesystem::file_size( file_name ) <
+                        resume_file_size,
+                        std::runtime_error,
+                        "Cannot resume sample moment snapshot file "
+                        << file_name.string() << " at byte "
+                        << resume_file_size << " because the file is "
+                        "missing or too small!" );
+
+    // Verify the file header before adding data to the file
+    {
+      std::ifstream existing_file( file_name.string(), std::ios::binary );
+
+      char file_format_id[8];
+      uint32_t file_format_version;
+
+      existing_file.read( file_format_id, sizeof(file_format_id) );
+      existing_file.read( (char*)&file_format_version,
+                          sizeof(file_format_version) );
+
+      TEST_FOR_EXCEPTION( !existing_file ||
+                          std::memcmp( file_format_id,
+                                       s_file_format_id,
+                                       sizeof(file_format_id) ) != 0 ||
+                          file_format_version != s_file_format_version,
+                          std::runtime_error,
+                          "Cannot append to sample moment snapshot file "
+                          << file_name.string() << " because it is not a "
+                          "valid sample moment snapshot file!" );
+    }
+
+    // Discard the data written after the resume point
+    boost::filesystem::resize_file( file_name, resume_file_size );
+
+    d_file.open( file_name.string(), std::ios::binary | std::ios::app );
+
+    d_file_size = resume_file_size;
+  }
+  else
+    d_file.open( file_name.string(), std::ios::binary | std::ios::trunc );
+
+  TEST_FOR_EXCEPTION( !d_file.is_open(),
+                      std::runtime_error,
+                      "Could not open sample moment snapshot file "
+                      << file_name.string() << "!" );
+
+  if( resume_file_size == 0 )
+  {
+    d_file.write( s_file_format_id, sizeof(s_file_format_id) );
+    d_file.write( (const char*)&s_file_format_version,
+                  sizeof(s_file_format_version) );
+    d_file.flush();
+
+    d_file_size = header_size;
+  }
+}
+
+// Return the file name
+const boost::filesystem::path&
+SampleMomentSnapshotFileWriter::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the size of the file (bytes)
+/*! \details This includes the data that has not been flushed yet.
+ */
+uint64_t SampleMomentSnapshotFileWriter::getFileSize() const
+{
+  return d_file_size;
+}
+
+// Write the snapshot of a collection moment
+/*! \details The changed bin indices must be sorted. The first snapshot flag
+ * indicates that the snapshot scores are relative to zero (any previous
+ * snapshots of the collection moment in the file will be discarded by the
+ * reader, which is consistent with resetting the collection snapshots).
+ */
+void SampleMomentSnapshotFileWriter::writeSnapshot(
+                             const uint64_t collection_id,
+                             const unsigned moment_order,
+                             const bool first_snapshot,
+                             const uint64_t summation_index,
+                             const double sampling_time,
+                             const std::vector<uint64_t>& changed_bin_indices,
+                             const std::vector<double>& changed_bin_scores )
+{
+  // Make sure that there is a score for every changed bin
+  testPrecondition( changed_bin_indices.size() == changed_bin_scores.size() );
+
+  std::string compressed_data;
+
+  if( !changed_bin_indices.empty() )
+  {
+    boost::iostreams::filtering_ostream compressed_data_stream;
+
+    compressed_data_stream.push( boost::iostreams::zlib_compressor() );
+    compressed_data_stream.push(
+                      boost::iostreams::back_inserter( compressed_data ) );
+
+    compressed_data_stream.write(
+                       (const char*)changed_bin_indices.data(),
+                       changed_bin_indices.size()*sizeof(uint64_t) );
+    compressed_data_stream.write(
+                       (const char*)changed_bin_scores.data(),
+                       changed_bin_scores.size()*sizeof(double) );
+
+    boost::iostreams::close( compressed_data_stream );
+  }
+
+  const uint32_t raw_moment_order = moment_order;
+  const uint8_t raw_first_snapshot = (first_snapshot ? 1 : 0);
+  const uint64_t number_of_changed_bins = changed_bin_indices.size();
+  const uint64_t compressed_data_size = compressed_data.size();
+
+  d_file.write( (const char*)&collection_id, sizeof(collection_id) );
+  d_file.write( (const char*)&raw_moment_order, sizeof(raw_moment_order) );
+  d_file.write( (const char*)&raw_first_snapshot,
+                sizeof(raw_first_snapshot) );
+  d_file.write( (const char*)&summation_index, sizeof(summation_index) );
+  d_file.write( (const char*)&sampling_time, sizeof(sampling_time) );
+  d_file.write( (const char*)&number_of_changed_bins,
+                sizeof(number_of_changed_bins) );
+  d_file.write( (const char*)&compressed_data_size,
+                sizeof(compressed_data_size) );
+  d_file.write( compressed_data.data(), compressed_data.size() );
+
+  TEST_FOR_EXCEPTION( !d_file,
+                      std::runtime_error,
+                      "Could not write snapshot to sample moment snapshot "
+                      "file " << d_file_name.string() << "!" );
+
+  d_file_size += sizeof(collection_id) + sizeof(raw_moment_order) +
+    sizeof(raw_first_snapshot) + sizeof(summation_index) +
+    sizeof(sampling_time) + sizeof(number_of_changed_bins) +
+    sizeof(compressed_data_size) + compressed_data_size;
+}
+
+// Flush the file
+void SampleMomentSnapshotFileWriter::flush()
+{
+  d_file.flush();
+
+  TEST_FOR_EXCEPTION( !d_file,
+                      std::runtime_error,
+                      "Could not flush sample moment snapshot file "
+                      << d_file_name.string() << "!" );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_SampleMomentSnapshotFileWriter.cpp
+//---------------------------------------------------------------------------//
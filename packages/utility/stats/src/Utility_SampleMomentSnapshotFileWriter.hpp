@@ -0,0 +1,87 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_SampleMomentSnapshotFileWriter.hpp
+//! \author Alex Robinson
+//! \brief  The sample moment snapshot file writer declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_SAMPLE_MOMENT_SNAPSHOT_FILE_WRITER_HPP
+#define UTILITY_SAMPLE_MOMENT_SNAPSHOT_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <fstream>
+#include <vector>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+namespace Utility{
+
+/*! The sample moment snapshot file writer
+ *
+ * \details Sample moment snapshots are appended to the file as records. A
+ * record stores the snapshot of a single moment of a collection (identified
+ * by a collection id and the moment order). Only the bins that changed since
+ * the previous snapshot of the collection moment are stored (the scores of
+ * the first snapshot are relative to zero). The record header is not
+ * compressed, which allows the Utility::SampleMomentSnapshotFileReader to
+ * index the file without decompressing it. The changed bin indices and scores
+ * are zlib compressed.
+ */
+class SampleMomentSnapshotFileWriter
+{
+
+public:
+
+  //! Constructor
+  SampleMomentSnapshotFileWriter( const boost::filesystem::path& file_name,
+                                  const uint64_t resume_file_size = 0 );
+
+  //! Destructor
+  ~SampleMomentSnapshotFileWriter()
+  { /* ... */ }
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the size of the file (bytes)
+  uint64_t getFileSize() const;
+
+  //! Write the snapshot of a collection moment
+  void writeSnapshot( const uint64_t collection_id,
+                      const unsigned moment_order,
+                      const bool first_snapshot,
+                      const uint64_t summation_index,
+                      const double sampling_time,
+                      const std::vector<uint64_t>& changed_bin_indices,
+                      const std::vector<double>& changed_bin_scores );
+
+  //! Flush the file
+  void flush();
+
+  //! The file format identifier
+  static const char s_file_format_id[8];
+
+  //! The file format version
+  static const uint32_t s_file_format_version;
+
+private:
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The file stream
+  std::ofstream d_file;
+
+  // The size of the file
+  uint64_t d_file_size;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_SAMPLE_MOMENT_SNAPSHOT_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_SampleMomentSnapshotFileWriter.hpp
+//---------------------------------------------------------------------------//
@@ -585,6 +585,36 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollection, addRawScore, TestingTypes )
                        Utility::QuantityTraits<ValueType4>::one()*10000. );
 }
 
+//---------------------------------------------------------------------------//
+// Check that raw scores can be added to the collection by multiple threads
+FRENSIE_UNIT_TEST( SampleMomentCollection, addRawScoreAtomic )
+{
+  Utility::SampleMomentCollection<double,1,2,3,4> moment_collection( 3 );
+
+  #pragma omp parallel for num_threads( 4 )
+  for( int i = 0; i < 1000; ++i )
+    moment_collection.addRawScoreAtomic( i % 3 == 0 ? 0 : 1, 2.0 );
+
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 0 ),
+                       334*2.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 1 ),
+                       666*2.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 2 ),
+                       0.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, 0 ),
+                       334*4.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, 1 ),
+                       666*4.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, 0 ),
+                       334*8.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, 1 ),
+                       666*8.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 0 ),
+                       334*16.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 1 ),
+                       666*16.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the current score can be returned using the standalone helper
 // function
@@ -15,9 +15,11 @@
 #include <boost/units/systems/si/length.hpp>
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
+#include <boost/filesystem/operations.hpp>
 
 // FRENSIE Includes
 #include "Utility_SampleMomentCollectionSnapshots.hpp"
+#include "Utility_SampleMomentSnapshotFileReader.hpp"
 #include "Utility_ArrayView.hpp"
 #include "Utility_QuantityTraits.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -174,6 +176,286 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollectionSnapshots, takeSnapshot, Testi
                        (Utility::getCurrentScore<1>(moment_collection, 1)) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that snapshots can be written to a file
+FRENSIE_UNIT_TEST( SampleMomentCollectionSnapshots, takeSnapshot_file )
+{
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> in_memory_snapshots( 3 );
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> streamed_snapshots( 3 );
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> other_streamed_snapshots( 2 );
+
+  Utility::SampleMomentCollection<double,1,2> moment_collection( 3 );
+  Utility::SampleMomentCollection<double,1,2> other_moment_collection( 2 );
+
+  {
+    Utility::SampleMomentSnapshotFileWriter
+      snapshot_file( "test_sample_moment_snapshots.snap" );
+
+    moment_collection.addRawScore( 0, 1.0 );
+    other_moment_collection.addRawScore( 1, 3.0 );
+
+    in_memory_snapshots.takeSnapshot( 1, 1.0, moment_collection );
+    streamed_snapshots.takeSnapshot( 1, 1.0, moment_collection, snapshot_file, 0 );
+    other_streamed_snapshots.takeSnapshot( 1, 1.0, other_moment_collection, snapshot_file, 1 );
+
+    // Only the last snapshot is kept in memory
+    FRENSIE_CHECK_EQUAL( streamed_snapshots.getNumberOfSnapshots(), 1 );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(streamed_snapshots, 0).size(), 1 );
+
+    moment_collection.addRawScore( 2, 2.0 );
+
+    in_memory_snapshots.takeSnapshot( 2, 1.5, moment_collection );
+    streamed_snapshots.takeSnapshot( 2, 1.5, moment_collection, snapshot_file, 0 );
+    other_streamed_snapshots.takeSnapshot( 2, 1.5, other_moment_collection, snapshot_file, 1 );
+
+    moment_collection.addRawScore( 0, 4.0 );
+    moment_collection.addRawScore( 2, 1.0 );
+
+    in_memory_snapshots.takeSnapshot( 3, 2.0, moment_collection );
+    streamed_snapshots.takeSnapshot( 3, 2.0, moment_collection, snapshot_file, 0 );
+
+    FRENSIE_CHECK_EQUAL( streamed_snapshots.getNumberOfSnapshots(), 1 );
+    FRENSIE_CHECK_EQUAL( streamed_snapshots.getSnapshotIndices().back(), 6 );
+    FRENSIE_CHECK_EQUAL( streamed_snapshots.getSnapshotSamplingTimes().back(), 4.5 );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(streamed_snapshots, 0).size(), 1 );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(streamed_snapshots, 0).back(), 5.0 );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<2>(streamed_snapshots, 2).back(), 5.0 );
+
+    snapshot_file.flush();
+  }
+
+  Utility::SampleMomentSnapshotFileReader
+    snapshot_file( "test_sample_moment_snapshots.snap" );
+
+  FRENSIE_CHECK( snapshot_file.hasSnapshots( 0 ) );
+  FRENSIE_CHECK( snapshot_file.hasSnapshots( 1 ) );
+  FRENSIE_CHECK( !snapshot_file.hasSnapshots( 2 ) );
+  FRENSIE_CHECK_EQUAL( snapshot_file.getNumberOfSnapshots( 0 ), 3 );
+  FRENSIE_CHECK_EQUAL( snapshot_file.getNumberOfSnapshots( 1 ), 2 );
+
+  std::vector<uint64_t> snapshot_indices;
+
+  snapshot_file.getSnapshotIndices( 0, snapshot_indices );
+
+  FRENSIE_CHECK_EQUAL( snapshot_indices,
+                       std::vector<uint64_t>( in_memory_snapshots.getSnapshotIndices().begin(),
+                                              in_memory_snapshots.getSnapshotIndices().end() ) );
+
+  std::vector<double> sampling_times;
+
+  snapshot_file.getSnapshotSamplingTimes( 0, sampling_times );
+
+  FRENSIE_CHECK_EQUAL( sampling_times,
+                       std::vector<double>( in_memory_snapshots.getSnapshotSamplingTimes().begin(),
+                                            in_memory_snapshots.getSnapshotSamplingTimes().end() ) );
+
+  std::vector<double> score_snapshots;
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    snapshot_file.getScoreSnapshots( 0, 1, i, score_snapshots );
+
+    FRENSIE_CHECK_EQUAL( score_snapshots,
+                         std::vector<double>( Utility::getScoreSnapshots<1>(in_memory_snapshots, i).begin(),
+                                              Utility::getScoreSnapshots<1>(in_memory_snapshots, i).end() ) );
+
+    snapshot_file.getScoreSnapshots( 0, 2, i, score_snapshots );
+
+    FRENSIE_CHECK_EQUAL( score_snapshots,
+                         std::vector<double>( Utility::getScoreSnapshots<2>(in_memory_snapshots, i).begin(),
+                                              Utility::getScoreSnapshots<2>(in_memory_snapshots, i).end() ) );
+  }
+
+  snapshot_file.getScoreSnapshots( 1, 1, 1, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {3.0, 3.0} ) );
+
+  snapshot_file.getScoreSnapshots( 1, 2, 0, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {0.0, 0.0} ) );
+
+  snapshot_file.getScoreSnapshots( 2, 1, 0, score_snapshots );
+
+  FRENSIE_CHECK( score_snapshots.empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that reset snapshots and snapshots written after the resume point
+// are discarded when they are loaded from a file
+FRENSIE_UNIT_TEST( SampleMomentCollectionSnapshots, takeSnapshot_file_reset )
+{
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> streamed_snapshots( 2 );
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> lost_streamed_snapshots( 2 );
+
+  Utility::SampleMomentCollection<double,1,2> moment_collection( 2 );
+
+  uint64_t resume_file_size;
+
+  {
+    Utility::SampleMomentSnapshotFileWriter
+      snapshot_file( "test_sample_moment_snapshots_reset.snap" );
+
+    moment_collection.addRawScore( 0, 1.0 );
+
+    streamed_snapshots.takeSnapshot( 1, 1.0, moment_collection, snapshot_file, 0 );
+    streamed_snapshots.takeSnapshot( 1, 1.0, moment_collection, snapshot_file, 0 );
+
+    streamed_snapshots.reset();
+    moment_collection.reset();
+
+    moment_collection.addRawScore( 1, 2.0 );
+
+    streamed_snapshots.takeSnapshot( 1, 1.0, moment_collection, snapshot_file, 0 );
+
+    snapshot_file.flush();
+
+    resume_file_size = snapshot_file.getFileSize();
+
+    FRENSIE_CHECK_EQUAL( resume_file_size,
+                         boost::filesystem::file_size( "test_sample_moment_snapshots_reset.snap" ) );
+  }
+
+  // Snapshots written after the resume point are discarded on restart
+  {
+    Utility::SampleMomentSnapshotFileWriter
+      snapshot_file( "test_sample_moment_snapshots_reset.snap",
+                     resume_file_size );
+
+    lost_streamed_snapshots.takeSnapshot( 1, 1.0, moment_collection, snapshot_file, 1 );
+
+    FRENSIE_CHECK( snapshot_file.getFileSize() > resume_file_size );
+  }
+
+  // A reader can ignore the records written after the resume point
+  {
+    Utility::SampleMomentSnapshotFileReader
+      snapshot_file( "test_sample_moment_snapshots_reset.snap",
+                     resume_file_size );
+
+    FRENSIE_CHECK( !snapshot_file.hasSnapshots( 1 ) );
+    FRENSIE_CHECK_EQUAL( snapshot_file.getNumberOfSnapshots( 0 ), 1 );
+  }
+
+  // Snapshots can be appended to an existing file
+  {
+    Utility::SampleMomentSnapshotFileWriter
+      snapshot_file( "test_sample_moment_snapshots_reset.snap",
+                     resume_file_size );
+
+    FRENSIE_CHECK_EQUAL( snapshot_file.getFileSize(), resume_file_size );
+
+    moment_collection.addRawScore( 0, 3.0 );
+
+    streamed_snapshots.takeSnapshot( 1, 1.0, moment_collection, snapshot_file, 0 );
+  }
+
+  Utility::SampleMomentSnapshotFileReader
+    snapshot_file( "test_sample_moment_snapshots_reset.snap" );
+
+  FRENSIE_CHECK( !snapshot_file.hasSnapshots( 1 ) );
+  FRENSIE_CHECK_EQUAL( snapshot_file.getNumberOfSnapshots( 0 ), 2 );
+
+  std::vector<uint64_t> snapshot_indices;
+
+  snapshot_file.getSnapshotIndices( 0, snapshot_indices );
+
+  FRENSIE_CHECK_EQUAL( snapshot_indices, std::vector<uint64_t>( {1, 2} ) );
+
+  std::vector<double> score_snapshots;
+
+  snapshot_file.getScoreSnapshots( 0, 1, 0, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {0.0, 3.0} ) );
+
+  snapshot_file.getScoreSnapshots( 0, 1, 1, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {2.0, 2.0} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that merged snapshots can be written to a file
+FRENSIE_UNIT_TEST( SampleMomentCollectionSnapshots, writeSnapshots )
+{
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> streamed_snapshots( 2 );
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> other_snapshots( 2 );
+  Utility::SampleMomentCollectionSnapshots<double,std::list,1,2> empty_snapshots( 2 );
+
+  Utility::SampleMomentCollection<double,1,2> moment_collection( 2 );
+  Utility::SampleMomentCollection<double,1,2> other_moment_collection( 2 );
+
+  {
+    Utility::SampleMomentSnapshotFileWriter
+      snapshot_file( "test_sample_moment_snapshots_merged.snap" );
+
+    moment_collection.addRawScore( 0, 1.0 );
+
+    streamed_snapshots.takeSnapshot( 1, 1.0, moment_collection, snapshot_file, 0 );
+
+    other_moment_collection.addRawScore( 1, 2.0 );
+    other_snapshots.takeSnapshot( 2, 1.0, other_moment_collection );
+
+    other_moment_collection.addRawScore( 1, 3.0 );
+    other_snapshots.takeSnapshot( 2, 1.0, other_moment_collection );
+
+    // Only the merged snapshots must be written
+    size_t first_snapshot = streamed_snapshots.getNumberOfSnapshots();
+
+    streamed_snapshots.mergeSnapshots( other_snapshots );
+    streamed_snapshots.writeSnapshots( first_snapshot, snapshot_file, 0 );
+
+    FRENSIE_CHECK_EQUAL( streamed_snapshots.getNumberOfSnapshots(), 1 );
+    FRENSIE_CHECK_EQUAL( streamed_snapshots.getSnapshotIndices().back(), 5 );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(streamed_snapshots, 0).size(), 1 );
+    FRENSIE_CHECK_EQUAL( Utility::getScoreSnapshots<1>(streamed_snapshots, 1).back(), 5.0 );
+
+    // Snapshots that are merged into empty snapshots are relative to zero
+    first_snapshot = empty_snapshots.getNumberOfSnapshots();
+
+    empty_snapshots.mergeSnapshots( other_snapshots );
+    empty_snapshots.writeSnapshots( first_snapshot, snapshot_file, 1 );
+
+    FRENSIE_CHECK_EQUAL( empty_snapshots.getNumberOfSnapshots(), 1 );
+    FRENSIE_CHECK_EQUAL( empty_snapshots.getSnapshotIndices().back(), 4 );
+  }
+
+  Utility::SampleMomentSnapshotFileReader
+    snapshot_file( "test_sample_moment_snapshots_merged.snap" );
+
+  std::vector<uint64_t> snapshot_indices;
+
+  snapshot_file.getSnapshotIndices( 0, snapshot_indices );
+
+  FRENSIE_CHECK_EQUAL( snapshot_indices, std::vector<uint64_t>( {1, 3, 5} ) );
+
+  std::vector<double> sampling_times;
+
+  snapshot_file.getSnapshotSamplingTimes( 0, sampling_times );
+
+  FRENSIE_CHECK_EQUAL( sampling_times, std::vector<double>( {1.0, 2.0, 3.0} ) );
+
+  std::vector<double> score_snapshots;
+
+  snapshot_file.getScoreSnapshots( 0, 1, 0, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {1.0, 1.0, 1.0} ) );
+
+  snapshot_file.getScoreSnapshots( 0, 1, 1, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {0.0, 2.0, 5.0} ) );
+
+  snapshot_file.getScoreSnapshots( 0, 2, 1, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {0.0, 4.0, 13.0} ) );
+
+  snapshot_file.getSnapshotIndices( 1, snapshot_indices );
+
+  FRENSIE_CHECK_EQUAL( snapshot_indices, std::vector<uint64_t>( {2, 4} ) );
+
+  snapshot_file.getScoreSnapshots( 1, 1, 1, score_snapshots );
+
+  FRENSIE_CHECK_EQUAL( score_snapshots, std::vector<double>( {2.0, 5.0} ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that two collection snapshots can be merged
 FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollectionSnapshots, mergeSnapshots, TestingTypes )
@@ -139,6 +139,29 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram, addRawScore, TestingTypes )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that raw scores can be added to the histogram by multiple threads
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram, addRawScoreAtomic, TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  typedef typename Utility::QuantityTraits<T>::RawType RawType;
+
+  Utility::SampleMomentHistogram<T> histogram( std::make_shared<std::vector<T> >( std::vector<T>({Utility::QuantityTraits<T>::zero(), Utility::QuantityTraits<T>::one(), Utility::QuantityTraits<T>::one()*2.0}) ) );
+
+  #pragma omp parallel for num_threads( 4 )
+  for( int i = 0; i < 1000; ++i )
+    histogram.addRawScoreAtomic( Utility::QuantityTraits<T>::one()*((i % 4)*0.75) );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), 750 );
+
+  const std::vector<RawType>& histogram_values =
+    histogram.getHistogramValues();
+
+  FRENSIE_REQUIRE_EQUAL( histogram_values.size(), 2 );
+  FRENSIE_CHECK_EQUAL( histogram_values[0], 500.0 );
+  FRENSIE_CHECK_EQUAL( histogram_values[1], 250.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a histogram can be cleared
 FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram, clear, TestingTypes )
@@ -462,6 +485,52 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram,
                        2.0*Utility::QuantityTraits<HistogramValueType>::one() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that histogram values can be merged
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram,
+                            mergeHistogramValues,
+                            TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  typedef typename Utility::SampleMomentHistogram<T>::HistogramValueType HistogramValueType;
+
+  Utility::SampleMomentHistogram<T> histogram( std::make_shared<std::vector<T> >( std::vector<T>({Utility::QuantityTraits<T>::lowest(), Utility::QuantityTraits<T>::zero(), Utility::QuantityTraits<T>::one()*0.5, Utility::QuantityTraits<T>::one(), Utility::QuantityTraits<T>::one()*1.5, Utility::QuantityTraits<T>::one()*2.0, Utility::QuantityTraits<T>::max()}) ) );
+
+  histogram.addRawScore( -Utility::QuantityTraits<T>::one() );
+  histogram.addRawScore( Utility::QuantityTraits<T>::one()*0.2 );
+  histogram.addRawScore( Utility::QuantityTraits<T>::one()*1.2 );
+
+  std::vector<HistogramValueType> other_histogram_values( 6 );
+
+  for( size_t i = 0; i < other_histogram_values.size(); ++i )
+  {
+    other_histogram_values[i] =
+      (i + 1.0)*Utility::QuantityTraits<HistogramValueType>::one();
+  }
+
+  histogram.mergeHistogramValues( Utility::arrayViewOfConst( other_histogram_values ),
+                                  21 );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), 24 );
+
+  const std::vector<HistogramValueType>& histogram_values =
+    histogram.getHistogramValues();
+
+  FRENSIE_REQUIRE_EQUAL( histogram_values.size(), 6 );
+  FRENSIE_CHECK_EQUAL( histogram_values[0],
+                       2.0*Utility::QuantityTraits<HistogramValueType>::one() );
+  FRENSIE_CHECK_EQUAL( histogram_values[1],
+                       3.0*Utility::QuantityTraits<HistogramValueType>::one() );
+  FRENSIE_CHECK_EQUAL( histogram_values[2],
+                       3.0*Utility::QuantityTraits<HistogramValueType>::one() );
+  FRENSIE_CHECK_EQUAL( histogram_values[3],
+                       5.0*Utility::QuantityTraits<HistogramValueType>::one() );
+  FRENSIE_CHECK_EQUAL( histogram_values[4],
+                       5.0*Utility::QuantityTraits<HistogramValueType>::one() );
+  FRENSIE_CHECK_EQUAL( histogram_values[5],
+                       6.0*Utility::QuantityTraits<HistogramValueType>::one() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a histogram can be archived
 FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram, archive, TestingTypes )
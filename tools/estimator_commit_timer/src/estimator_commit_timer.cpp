@@ -0,0 +1,153 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   estimator_commit_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing concurrent estimator commits
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// The number of cells assigned to the estimator
+const unsigned number_of_cells = 100;
+
+// The number of subtracks in each history
+const unsigned subtracks_per_history = 10;
+
+// The number of energy bins
+const unsigned number_of_energy_bins = 10;
+
+// Create the estimator
+std::shared_ptr<MonteCarlo::Estimator> createEstimator(
+                                                   const unsigned threads )
+{
+  std::vector<MonteCarlo::StandardCellEstimator::CellIdType>
+    cell_ids( number_of_cells );
+  std::vector<double> cell_volumes( number_of_cells, 1.0 );
+
+  for( unsigned i = 0; i < number_of_cells; ++i )
+    cell_ids[i] = i;
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+      new MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                                                0u,
+                                                                1.0,
+                                                                cell_ids,
+                                                                cell_volumes ) );
+
+  estimator->setParticleTypes(
+                     std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  std::vector<double> energy_bin_boundaries( number_of_energy_bins+1 );
+
+  for( unsigned i = 0; i <= number_of_energy_bins; ++i )
+    energy_bin_boundaries[i] = i*1.0/number_of_energy_bins;
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                       energy_bin_boundaries );
+
+  estimator->enableThreadSupport( threads );
+
+  return estimator;
+}
+
+// Time the history contribution commits
+/*! \details Each history adds a fixed number of subtracks (with
+ * deterministic cells and energies) to the estimator and then commits its
+ * contribution. The wall time is used.
+ */
+void timeCommits( const int histories, const unsigned max_threads )
+{
+  std::cout << "  Threads\tTime (s)\tHistories/s" << std::endl;
+
+  for( unsigned threads = 1; threads <= max_threads; threads *= 2 )
+  {
+    std::shared_ptr<MonteCarlo::Estimator> estimator =
+      createEstimator( threads );
+
+    MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>&
+      cell_estimator = dynamic_cast<MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>&>( *estimator );
+
+    std::shared_ptr<Utility::Timer> timer =
+      Utility::OpenMPProperties::createTimer();
+
+    timer->start();
+
+    #pragma omp parallel for num_threads( threads )
+    for( int history = 0; history < histories; ++history )
+    {
+      MonteCarlo::PhotonState particle( history );
+      particle.setWeight( 1.0 );
+
+      for( unsigned i = 0; i < subtracks_per_history; ++i )
+      {
+        particle.setEnergy( ((history + i)%number_of_energy_bins + 0.5)/
+                            number_of_energy_bins );
+
+        cell_estimator.updateFromParticleSubtrackEndingInCellEvent(
+                                      particle,
+                                      (history*7 + i*13)%number_of_cells,
+                                      1.0 );
+      }
+
+      cell_estimator.commitHistoryContribution();
+    }
+
+    timer->stop();
+
+    const double time = timer->elapsed().count();
+
+    if( time < 1.0e-15 )
+    {
+      std::cerr << "Timing information not accurate enough for "
+                << threads << " threads." << std::endl;
+    }
+    else
+    {
+      std::cout << "  " << threads << "\t\t" << time << "\t\t"
+                << histories/time << std::endl;
+    }
+  }
+
+  std::cout << std::endl;
+}
+
+// Main timing function
+/*! \details The maximum number of threads to time can be passed as the
+ * first argument (default: 1) and the number of histories can be passed as
+ * the second argument (default: 200000). The thread counts 1, 2, 4, ... up to
+ * the maximum number of threads will be timed.
+ */
+int main( int argc, char** argv )
+{
+  unsigned max_threads = 1;
+  int histories = 200000;
+
+  if( argc > 1 )
+    max_threads = std::max( std::atoi( argv[1] ), 1 );
+
+  if( argc > 2 )
+    histories = std::max( std::atoi( argv[2] ), 1 );
+
+  std::cout << "Timing estimator commits (" << number_of_cells << " cells, "
+            << subtracks_per_history << " subtracks/history, "
+            << histories << " histories)" << std::endl;
+
+  timeCommits( histories, max_threads );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end estimator_commit_timer.cpp
+//---------------------------------------------------------------------------//
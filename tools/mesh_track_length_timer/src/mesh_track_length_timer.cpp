@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   mesh_track_length_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing structured hex mesh track lengths
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <string>
+#include <random>
+
+// FRENSIE Includes
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Create the planes of a dimension on [0,1]
+std::vector<double> createPlanes( const unsigned planes_per_dimension,
+                                  const bool uniform )
+{
+  std::vector<double> planes( planes_per_dimension );
+
+  const double spacing = 1.0/(planes_per_dimension - 1);
+
+  for( size_t i = 0; i < planes.size(); ++i )
+    planes[i] = i*spacing;
+
+  // Perturb the interior planes so that the spacing is not uniform
+  if( !uniform )
+  {
+    for( size_t i = 1; i < planes.size() - 1; ++i )
+      planes[i] += (i % 2 == 0 ? 0.25 : -0.25)*spacing;
+  }
+
+  return planes;
+}
+
+// Time the track length calculation for random segments through the mesh
+/*! \details The segments can start and end outside of the mesh. The same
+ * segments are used for every mesh. The wall time is used.
+ */
+void timeTrackLengthCalculation( const Utility::StructuredHexMesh& hex_mesh,
+                                 const std::string& mesh_description,
+                                 const unsigned long long number_of_segments )
+{
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution<double> coordinate_distribution( -0.1, 1.1 );
+
+  std::vector<double> segment_points( 6*number_of_segments );
+
+  for( size_t i = 0; i < segment_points.size(); ++i )
+    segment_points[i] = coordinate_distribution( generator );
+
+  Utility::StructuredHexMesh::ElementHandleTrackLengthArray
+    element_track_lengths;
+
+  unsigned long long number_of_crossed_elements = 0ull;
+
+  double total_track_length = 0.0;
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  for( size_t i = 0; i < number_of_segments; ++i )
+  {
+    hex_mesh.computeTrackLengths( &segment_points[6*i],
+                                  &segment_points[6*i+3],
+                                  element_track_lengths );
+
+    number_of_crossed_elements += element_track_lengths.size();
+
+    for( size_t j = 0; j < element_track_lengths.size(); ++j )
+      total_track_length += Utility::get<2>( element_track_lengths[j] );
+  }
+
+  timer->stop();
+
+  const double time = timer->elapsed().count();
+
+  if( time < 1.0e-15 )
+  {
+    std::cerr << "Timing information not accurate enough for the "
+              << mesh_description << "." << std::endl;
+  }
+  else
+  {
+    std::cout << "  " << mesh_description << " ("
+              << hex_mesh.getNumberOfElements() << " elements):\tTime = "
+              << time << " seconds\tSegments/s = "
+              << number_of_segments/time << "\tCrossings/s = "
+              << number_of_crossed_elements/time
+              << "\tTotal track length = " << total_track_length
+              << std::endl;
+  }
+}
+
+// Main timing function
+/*! \details The number of random segments can be passed as the first
+ * argument (default: 1000000) and the number of planes in each mesh
+ * dimension can be passed as the second argument (default: 101, which gives
+ * 10^6 elements - 216 gives 10^7 elements).
+ */
+int main( int argc, char** argv )
+{
+  unsigned long long number_of_segments = 1000000ull;
+  unsigned planes_per_dimension = 101u;
+
+  if( argc > 1 )
+    number_of_segments = std::max( std::atoll( argv[1] ), 1ll );
+
+  if( argc > 2 )
+    planes_per_dimension = std::max( std::atoi( argv[2] ), 2 );
+
+  std::cout << "Timing structured hex mesh track lengths ("
+            << number_of_segments << " segments)" << std::endl;
+
+  {
+    std::vector<double> planes = createPlanes( planes_per_dimension, true );
+
+    Utility::StructuredHexMesh hex_mesh( planes, planes, planes );
+
+    timeTrackLengthCalculation( hex_mesh, "Uniform mesh", number_of_segments );
+  }
+
+  {
+    std::vector<double> planes = createPlanes( planes_per_dimension, false );
+
+    Utility::StructuredHexMesh hex_mesh( planes, planes, planes );
+
+    timeTrackLengthCalculation( hex_mesh,
+                                "Non-uniform mesh",
+                                number_of_segments );
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end mesh_track_length_timer.cpp
+//---------------------------------------------------------------------------//
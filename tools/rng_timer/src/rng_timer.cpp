@@ -8,26 +8,28 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <string>
 #include <time.h>
 
-// Boost Scoped Pointer
-#include <boost/scoped_ptr.hpp>
-#include <boost/shared_ptr.hpp>
-
-// Trilinos Includes
-#include <Teuchos_RCP.hpp>
-
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_CounterBasedGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
 
 // Time macro
 #define TIME() (clock()/((double)CLOCKS_PER_SEC))
 
 // Generator timing function
+template<typename RawGenerator>
 void timeGenerator( const int trial_size, const int histories = 1 )
 {
   // Raw generator
-  Utility::LinearCongruentialGenerator generator;
+  RawGenerator generator;
 
   double time1 = TIME();
 
@@ -84,27 +86,128 @@ void timeGenerator( const int trial_size, const int histories = 1 )
   }
 }
 
+// Threaded generator timing function
+/*! \details Each thread simulates interleaved histories (like an OpenMP
+ * for loop with a static schedule), which forces the generators to jump
+ * between histories. The wall time is used.
+ */
+void timeGeneratorThreads( const int trial_size_per_thread,
+                           const int histories_per_thread,
+                           const unsigned max_threads )
+{
+  std::cout << "  Threads\tTime (s)\tMRS/thread\tMRS total" << std::endl;
 
-// Main itming function
-int main()
+  for( unsigned threads = 1; threads <= max_threads; ++threads )
+  {
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+    Utility::RandomNumberGenerator::createStreams();
+
+    // Store the sums so that the draws cannot be optimized away
+    std::vector<double> thread_sums( threads, 0.0 );
+
+    std::shared_ptr<Utility::Timer> timer =
+      Utility::OpenMPProperties::createTimer();
+
+    timer->start();
+
+    #pragma omp parallel num_threads( threads )
+    {
+      const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+      double sum = 0.0;
+
+      for( int i = 0; i < histories_per_thread; ++i )
+      {
+        Utility::RandomNumberGenerator::initialize( i*threads + thread_id );
+
+        for( int j = 0; j < trial_size_per_thread/histories_per_thread; ++j )
+          sum += Utility::RandomNumberGenerator::getRandomNumber<double>();
+      }
+
+      thread_sums[thread_id] = sum;
+    }
+
+    timer->stop();
+
+    double time = timer->elapsed().count();
+
+    if( time < 1.0e-15 )
+    {
+      std::cerr << "Timing information not accurate enough for this generator."
+                << std::endl;
+    }
+    else
+    {
+      double mdbls_per_sec_per_thread = trial_size_per_thread/time/1e6;
+
+      std::cout << "  " << threads << "\t\t" << time << "\t\t"
+                << mdbls_per_sec_per_thread << "\t\t"
+                << mdbls_per_sec_per_thread*threads << std::endl;
+    }
+  }
+
+  std::cout << std::endl;
+}
+
+// Time a generator type
+template<typename RawGenerator>
+void timeGeneratorType( const Utility::RandomNumberGeneratorType type,
+                        const std::string& type_name,
+                        const unsigned max_threads )
 {
+  Utility::RandomNumberGenerator::setGeneratorType( type );
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1 );
+
   Utility::RandomNumberGenerator::createStreams();
 
   Utility::RandomNumberGenerator::initialize();
 
   int trial_size = 10000000;
 
+  std::cout << "==== " << type_name << " ====" << std::endl;
+
   std::cout << "Timing generator for single history" << std::endl;
-  timeGenerator( trial_size );
+  timeGenerator<RawGenerator>( trial_size );
 
   std::cout << "Timing generator for 10 histories" << std::endl;
-  timeGenerator( trial_size, 10 );
+  timeGenerator<RawGenerator>( trial_size, 10 );
 
   std::cout << "Timing generator for 100 histories" << std::endl;
-  timeGenerator( trial_size, 100 );
+  timeGenerator<RawGenerator>( trial_size, 100 );
 
   std::cout << "Timing generator for 1000 histories" << std::endl;
-  timeGenerator( trial_size, 1000 );
+  timeGenerator<RawGenerator>( trial_size, 1000 );
+
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+  {
+    std::cout << "Timing generator for 1 to " << max_threads
+              << " threads (10000 histories/thread, wall time)" << std::endl;
+    timeGeneratorThreads( trial_size, 10000, max_threads );
+  }
+}
+
+// Main itming function
+/*! \details The maximum number of threads to time can be passed as the
+ * first argument (default: 1).
+ */
+int main( int argc, char** argv )
+{
+  unsigned max_threads = 1;
+
+  if( argc > 1 )
+    max_threads = std::max( std::atoi( argv[1] ), 1 );
+
+  timeGeneratorType<Utility::LinearCongruentialGenerator>(
+                                        Utility::LINEAR_CONGRUENTIAL_GENERATOR,
+                                        "Linear congruential generator",
+                                        max_threads );
+
+  timeGeneratorType<Utility::CounterBasedGenerator>(
+                                              Utility::COUNTER_BASED_GENERATOR,
+                                              "Counter-based generator",
+                                              max_threads );
 
   return 0;
 }
@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   root_navigator_clone_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing root navigator clones
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
+#include <string>
+
+// Root Includes
+#include <TGeoManager.h>
+#include <TGeoNavigator.h>
+
+// FRENSIE Includes
+#include "Geometry_RootModel.hpp"
+#include "Geometry_RootModelProperties.hpp"
+#include "Geometry_RootNavigator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_QuantityTraits.hpp"
+
+namespace cgs = boost::units::cgs;
+
+// Report the clone time
+void reportCloneTime( const std::string& clone_description,
+                      const double time,
+                      const unsigned long long number_of_clones )
+{
+  if( time < 1.0e-15 )
+  {
+    std::cerr << "Timing information not accurate enough for the "
+              << clone_description << "." << std::endl;
+  }
+  else
+  {
+    std::cout << "  " << clone_description << ":\tTime = " << time
+              << " seconds\tClones/s = " << number_of_clones/time
+              << "\tTime/clone = " << time/number_of_clones << " seconds"
+              << std::endl;
+  }
+}
+
+// Time the navigator clones that use the navigator pool of the model
+void timePooledClones( const Geometry::Navigator& navigator,
+                       const unsigned long long number_of_clones )
+{
+  // Warm up the navigator pool
+  delete navigator.clone();
+
+  unsigned long long number_of_mismatched_cells = 0ull;
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  for( unsigned long long i = 0; i < number_of_clones; ++i )
+  {
+    std::unique_ptr<Geometry::Navigator> navigator_clone( navigator.clone() );
+
+    if( navigator_clone->getCurrentCell() != navigator.getCurrentCell() )
+      ++number_of_mismatched_cells;
+  }
+
+  timer->stop();
+
+  reportCloneTime( "Pooled navigator clones",
+                   timer->elapsed().count(),
+                   number_of_clones );
+
+  if( number_of_mismatched_cells > 0ull )
+  {
+    std::cerr << "  " << number_of_mismatched_cells
+              << " clones were not in the cell of the source navigator!"
+              << std::endl;
+  }
+}
+
+// Time the navigator clones that register a new root navigator
+/*! \details This is the cost of a clone before the navigator pool was
+ * added: a root navigator is added to the manager, its track is initialized
+ * at the state of the source navigator (which requires a point search) and
+ * it is removed from the manager when the clone is destroyed.
+ */
+void timeUnpooledClones( const Geometry::Navigator& navigator,
+                         const unsigned long long number_of_clones )
+{
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  for( unsigned long long i = 0; i < number_of_clones; ++i )
+  {
+    TGeoNavigator* root_navigator = gGeoManager->AddNavigator();
+
+    root_navigator->InitTrack(
+                       Utility::reinterpretAsRaw( navigator.getPosition() ),
+                       navigator.getDirection() );
+
+    gGeoManager->RemoveNavigator( root_navigator );
+  }
+
+  timer->stop();
+
+  reportCloneTime( "Unpooled navigator clones",
+                   timer->elapsed().count(),
+                   number_of_clones );
+}
+
+// Main timing function
+/*! \details The root geometry file must be passed as the first argument. The
+ * number of clones can be passed as the second argument (default: 100000).
+ * The navigator that gets cloned is located at the origin.
+ */
+int main( int argc, char** argv )
+{
+  if( argc < 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " root_geom_file [number of clones]"
+              << std::endl;
+
+    return 1;
+  }
+
+  unsigned long long number_of_clones = 100000ull;
+
+  if( argc > 2 )
+    number_of_clones = std::max( std::atoll( argv[2] ), 1ll );
+
+  Geometry::RootModelProperties model_properties( argv[1] );
+
+  std::shared_ptr<Geometry::RootModel> model =
+    Geometry::RootModel::getInstance();
+
+  model->initialize( model_properties );
+
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  std::cout << "Timing root navigator clones (" << number_of_clones
+            << " clones)" << std::endl;
+
+  timePooledClones( *navigator, number_of_clones );
+
+  timeUnpooledClones( *navigator, number_of_clones );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end root_navigator_clone_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,270 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   transport_mode_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing event-based and history-based transport
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <string>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// The scattering center database name
+std::string scattering_center_database_name;
+
+// The scattering center definitions
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+// The material definitions
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+// Create the material definitions (hydrogen photoatomic data)
+void createMaterialDefinitions()
+{
+  const Data::ScatteringCenterPropertiesDatabase
+    database( scattering_center_database_name );
+
+  const Data::AtomProperties& h_properties =
+    database.getAtomProperties( 1001 );
+
+  scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  MonteCarlo::ScatteringCenterDefinition& h_definition =
+    scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 );
+
+  h_definition.setPhotoatomicDataProperties(
+          h_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+  material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+  material_definition_database->addDefinition( "H1 @ 293.6K", 1,
+                                               {"H1 @ 293.6K"}, {1.0} );
+
+  material_definition_database->addDefinition( "H1 shell @ 293.6K", 2,
+                                               {"H1 @ 293.6K"}, {1.0} );
+}
+
+// Create the infinite medium model
+std::shared_ptr<const Geometry::Model> createInfiniteMediumModel()
+{
+  return std::shared_ptr<const Geometry::Model>(
+                    new Geometry::InfiniteMediumModel(
+                          1, 1, -1.0*Geometry::Model::DensityUnit() ) );
+}
+
+// Create the two material model (a dense sphere inside of a less dense shell)
+std::shared_ptr<const Geometry::Model> createTwoMaterialModel()
+{
+  std::shared_ptr<Geometry::NativeModel>
+    model( new Geometry::NativeModel( "two materials" ) );
+
+  model->addSurface( Geometry::NativeSurface::createSphere( 1, 0.0, 0.0, 0.0, 5.0 ) );
+  model->addSurface( Geometry::NativeSurface::createSphere( 2, 0.0, 0.0, 0.0, 15.0 ) );
+
+  model->addCell( 1, "-1", 1, -3.0*Geometry::Model::DensityUnit() );
+  model->addCell( 2, "1n-2", 2, -1.0*Geometry::Model::DensityUnit() );
+  model->addCell( 3, "2" );
+
+  model->setTerminationCell( 3 );
+
+  return model;
+}
+
+// Run a photon simulation and return the wall time
+/*! \details The mean and relative error of the collision flux in cell 1 are
+ * also returned so that the two transport modes can be compared.
+ */
+double runPhotonSimulation(
+                  const std::shared_ptr<const Geometry::Model>& unfilled_model,
+                  const bool event_based_transport,
+                  const uint64_t histories,
+                  const unsigned threads,
+                  double& flux_mean,
+                  double& flux_relative_error )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( histories );
+
+  if( event_based_transport )
+    properties->setEventBasedTransportModeOn();
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<const MonteCarlo::ParticleDistribution>
+      particle_distribution( new MonteCarlo::StandardParticleDistribution( "default" ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                        0, 1.0, {1}, *unfilled_model ) );
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler->addEstimator( estimator );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                  source,
+                                                  event_handler,
+                                                  properties,
+                                                  "transport_mode_timer",
+                                                  "xml",
+                                                  threads ).getManager();
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  manager->runSimulation();
+
+  timer->stop();
+
+  std::vector<double> mean, relative_error, vov, fom;
+
+  estimator->getTotalProcessedData( mean, relative_error, vov, fom );
+
+  flux_mean = mean.front();
+  flux_relative_error = relative_error.front();
+
+  return timer->elapsed().count();
+}
+
+// Time the transport modes in a model
+void timeTransportModes(
+                  const std::string& model_name,
+                  const std::shared_ptr<const Geometry::Model>& unfilled_model,
+                  const uint64_t histories,
+                  const unsigned max_threads )
+{
+  std::cout << model_name << std::endl;
+  std::cout << "  Threads\tMode\t\tTime (s)\tHistories/s\tFlux (RE)"
+            << std::endl;
+
+  for( unsigned threads = 1; threads <= max_threads; threads *= 2 )
+  {
+    for( bool event_based_transport : {false, true} )
+    {
+      double flux_mean, flux_relative_error;
+
+      const double time = runPhotonSimulation( unfilled_model,
+                                               event_based_transport,
+                                               histories,
+                                               threads,
+                                               flux_mean,
+                                               flux_relative_error );
+
+      std::cout << "  " << threads << "\t\t"
+                << (event_based_transport ? "event  " : "history") << "\t\t"
+                << time << "\t\t";
+
+      if( time < 1.0e-15 )
+        std::cout << "-";
+      else
+        std::cout << histories/time;
+
+      std::cout << "\t\t" << flux_mean << " (" << flux_relative_error << ")"
+                << std::endl;
+    }
+  }
+
+  std::cout << std::endl;
+}
+
+// Main timing function
+/*! \details The scattering center database (e.g. the test database.xml)
+ * must be passed as the first argument. The maximum number of threads to time
+ * can be passed as the second argument (default: 1) and the number of
+ * histories can be passed as the third argument (default: 10000). The thread
+ * counts 1, 2, 4, ... up to the maximum number of threads will be timed in an
+ * infinite medium model and in a bounded two material model.
+ */
+int main( int argc, char** argv )
+{
+  if( argc < 2 )
+  {
+    std::cerr << "Usage: transport_mode_timer database.xml [max threads] "
+              << "[histories]" << std::endl;
+
+    return 1;
+  }
+
+  scattering_center_database_name = argv[1];
+
+  unsigned max_threads = 1;
+  uint64_t histories = 10000;
+
+  if( argc > 2 )
+    max_threads = std::max( std::atoi( argv[2] ), 1 );
+
+  if( argc > 3 )
+    histories = std::max( std::atoll( argv[3] ), 1ll );
+
+  createMaterialDefinitions();
+
+  std::cout << "Timing photon transport modes (" << histories
+            << " histories)" << std::endl;
+
+  timeTransportModes( "Infinite medium",
+                      createInfiniteMediumModel(),
+                      histories,
+                      max_threads );
+
+  timeTransportModes( "Two material spheres",
+                      createTwoMaterialModel(),
+                      histories,
+                      max_threads );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end transport_mode_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,271 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   weight_window_fom.cpp
+//! \author Alex Robinson
+//! \brief  Main function for the weight window figure of merit benchmark
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <string>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_PhysicalConstants.hpp"
+
+// The slab thickness (cm)
+const double slab_thickness = 10.0;
+
+// The slab total macroscopic cross section (1/cm)
+const double slab_total_cross_section = 1.0;
+
+// The slab scattering probability
+const double slab_scattering_probability = 0.5;
+
+// The asymptotic attenuation coefficient of the importance in the slab (1/cm)
+const double importance_attenuation_coefficient = 0.95;
+
+// The number of weight window mesh cells through the slab
+const unsigned number_of_slab_cells = 20;
+
+// The benchmark results
+struct BenchmarkResults
+{
+  double mean;
+  double relative_error;
+  double time;
+  double figure_of_merit;
+};
+
+// Create the slab weight windows
+/*! \details The lower bound of each cell is proportional to the inverse of
+ * the asymptotic importance at the center of the cell. The upper bounds are
+ * five times the lower bounds.
+ */
+std::shared_ptr<const MonteCarlo::WeightWindowMesh> createSlabWeightWindows()
+{
+  std::vector<double> x_planes( {-1e3, 1e3} ), y_planes( {-1e3, 1e3} );
+  std::vector<double> z_planes( number_of_slab_cells+1 );
+
+  for( unsigned i = 0; i <= number_of_slab_cells; ++i )
+    z_planes[i] = i*slab_thickness/number_of_slab_cells;
+
+  std::shared_ptr<const Utility::Mesh> mesh(
+                new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  std::vector<double> lower_bounds( number_of_slab_cells );
+  std::vector<double> upper_bounds( number_of_slab_cells );
+
+  for( unsigned i = 0; i < number_of_slab_cells; ++i )
+  {
+    const double cell_center = 0.5*(z_planes[i] + z_planes[i+1]);
+
+    lower_bounds[i] =
+      0.5*std::exp( -importance_attenuation_coefficient*cell_center );
+    upper_bounds[i] = 5.0*lower_bounds[i];
+  }
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    weight_windows( new MonteCarlo::WeightWindowMesh );
+
+  weight_windows->setWeightWindows( MonteCarlo::NEUTRON,
+                                    mesh,
+                                    std::vector<double>( {0.0, 20.0} ),
+                                    lower_bounds,
+                                    upper_bounds );
+
+  return weight_windows;
+}
+
+// Simulate the slab transmission problem
+/*! \details Neutrons are born on the left face of the slab travelling in the
+ * direction of the slab normal. Scattering is isotropic and does not change
+ * the energy. When no weight windows are used the simulation is analog.
+ * Otherwise absorption is treated implicitly and the weight windows are
+ * applied after every collision. The transmitted weight is tallied.
+ */
+BenchmarkResults simulateSlabTransmission(
+           const unsigned long long histories,
+           const std::shared_ptr<const MonteCarlo::WeightWindowMesh>& weight_windows )
+{
+  double first_moment = 0.0, second_moment = 0.0;
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  MonteCarlo::ParticleBank bank;
+
+  for( unsigned long long i = 0; i < histories; ++i )
+  {
+    Utility::RandomNumberGenerator::initialize( i );
+
+    {
+      MonteCarlo::NeutronState source_neutron( i );
+      source_neutron.setPosition( 0.0, 0.0, 0.0 );
+      source_neutron.setDirection( 0.0, 0.0, 1.0 );
+      source_neutron.setEnergy( 1.0 );
+      source_neutron.setWeight( 1.0 );
+
+      bank.push( source_neutron );
+    }
+
+    double history_score = 0.0;
+
+    while( !bank.isEmpty() )
+    {
+      std::shared_ptr<MonteCarlo::ParticleState> neutron;
+
+      bank.pop( neutron );
+
+      while( !neutron->isGone() )
+      {
+        const double distance = -std::log(
+                Utility::RandomNumberGenerator::getRandomNumber<double>() )/
+          slab_total_cross_section;
+
+        neutron->advance( distance );
+
+        // Leakage
+        if( neutron->getZPosition() < 0.0 )
+        {
+          neutron->setAsGone();
+        }
+        // Transmission
+        else if( neutron->getZPosition() > slab_thickness )
+        {
+          history_score += neutron->getWeight();
+
+          neutron->setAsGone();
+        }
+        // Collision
+        else
+        {
+          if( weight_windows )
+          {
+            neutron->multiplyWeight( slab_scattering_probability );
+          }
+          else if( Utility::RandomNumberGenerator::getRandomNumber<double>() >
+                   slab_scattering_probability )
+          {
+            neutron->setAsGone();
+
+            continue;
+          }
+
+          const double mu = 2.0*
+            Utility::RandomNumberGenerator::getRandomNumber<double>() - 1.0;
+          const double phi = 2.0*Utility::PhysicalConstants::pi*
+            Utility::RandomNumberGenerator::getRandomNumber<double>();
+          const double sin_theta = std::sqrt( std::max( 0.0, 1.0 - mu*mu ) );
+
+          neutron->setDirection( sin_theta*std::cos( phi ),
+                                 sin_theta*std::sin( phi ),
+                                 mu );
+
+          if( weight_windows )
+            weight_windows->updateParticleState( *neutron, bank );
+        }
+      }
+    }
+
+    first_moment += history_score;
+    second_moment += history_score*history_score;
+  }
+
+  timer->stop();
+
+  BenchmarkResults results;
+
+  results.mean = first_moment/histories;
+  results.time = timer->elapsed().count();
+
+  if( first_moment > 0.0 )
+  {
+    results.relative_error =
+      std::sqrt( std::max( 0.0, second_moment/(first_moment*first_moment) -
+                           1.0/histories ) );
+  }
+  else
+    results.relative_error = 0.0;
+
+  if( results.relative_error > 0.0 && results.time > 0.0 )
+  {
+    results.figure_of_merit = 1.0/(results.relative_error*
+                                   results.relative_error*results.time);
+  }
+  else
+    results.figure_of_merit = 0.0;
+
+  return results;
+}
+
+// Print the benchmark results
+void printResults( const std::string& name, const BenchmarkResults& results )
+{
+  std::cout << "  " << name << ":\tMean = " << results.mean
+            << "\tRE = " << results.relative_error
+            << "\tTime = " << results.time << " seconds"
+            << "\tFOM = " << results.figure_of_merit << std::endl;
+}
+
+// Main benchmark function
+/*! \details The number of histories can be passed as the first argument
+ * (default: 1000000). The figure of merit (1/(RE^2*T)) of the transmission
+ * through a deep penetration slab is reported with and without weight
+ * windows.
+ */
+int main( int argc, char** argv )
+{
+  unsigned long long histories = 1000000ull;
+
+  if( argc > 1 )
+    histories = std::max( std::atoll( argv[1] ), 1ll );
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::cout << "Slab transmission (" << slab_thickness*slab_total_cross_section
+            << " mfp, scattering probability = "
+            << slab_scattering_probability << ", " << histories
+            << " histories)" << std::endl;
+
+  BenchmarkResults analog_results =
+    simulateSlabTransmission( histories,
+                              std::shared_ptr<const MonteCarlo::WeightWindowMesh>() );
+
+  printResults( "Analog", analog_results );
+
+  BenchmarkResults weight_window_results =
+    simulateSlabTransmission( histories, createSlabWeightWindows() );
+
+  printResults( "Weight windows", weight_window_results );
+
+  if( analog_results.figure_of_merit > 0.0 )
+  {
+    std::cout << "  FOM improvement: "
+              << weight_window_results.figure_of_merit/
+      analog_results.figure_of_merit << std::endl;
+  }
+  else
+  {
+    std::cout << "  FOM improvement: no analog histories were transmitted"
+              << std::endl;
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end weight_window_fom.cpp
+//---------------------------------------------------------------------------//